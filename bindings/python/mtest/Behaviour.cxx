@@ -18,6 +18,12 @@
 #include "MTest/Behaviour.hxx"
 #include "MTest/LogarithmicStrain1DBehaviourWrapper.hxx"
 #include "MTest/SmallStrainTridimensionalBehaviourWrapper.hxx"
+#ifdef TFEL_NUMPY_SUPPORT
+#include <boost/python/numpy.hpp>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Numpy/ndarray.hxx"
+#include "MTest/BehaviourBatchIntegration.hxx"
+#endif /* TFEL_NUMPY_SUPPORT */
 
 static std::shared_ptr<mtest::Behaviour> getBehaviour1(
     const std::string& i,
@@ -138,6 +144,115 @@ static int Behaviour_getBehaviourKinematic(const mtest::Behaviour& b) {
   return 4;
 }  // end of Behaviour_getBehaviourKinematic
 
+#ifdef TFEL_NUMPY_SUPPORT
+
+/*!
+ * \return a pointer to the values of an array associated with a set of
+ * integration points, or a null pointer if the array is not given.
+ * \param[in] o: array
+ * \param[in] n: number of integration points
+ * \param[in] m: number of values per integration point
+ * \param[in] v: name of the array, used in error messages
+ */
+static const double* Behaviour_getIntegrationPointsValues(
+    const boost::python::object& o,
+    const std::size_t n,
+    const std::size_t m,
+    const std::string& v) {
+  namespace np = boost::python::numpy;
+  if (o.is_none()) {
+    return nullptr;
+  }
+  const auto a = boost::python::extract<np::ndarray>(o)();
+  tfel::raise_if(!(a.get_flags() & np::ndarray::C_CONTIGUOUS),
+                 "Behaviour::integrate: array '" + v + "' is not contiguous");
+  const auto nd = a.get_nd();
+  const auto valid_shape = [&a, nd, n, m] {
+    if (nd == 1) {
+      return (m == 1) && (static_cast<std::size_t>(a.shape(0)) == n);
+    }
+    return (nd == 2) && (static_cast<std::size_t>(a.shape(0)) == n) &&
+           (static_cast<std::size_t>(a.shape(1)) == m);
+  }();
+  tfel::raise_if(!valid_shape, "Behaviour::integrate: array '" + v +
+                                   "' has an invalid shape (expected (" +
+                                   std::to_string(n) + ", " +
+                                   std::to_string(m) + "))");
+  return tfel::numpy::get_data(a);
+}  // end of Behaviour_getIntegrationPointsValues
+
+/*!
+ * \brief integrate the behaviour on a set of independent integration
+ * points described by numpy arrays.
+ * \return a dictionary containing the results of the integration
+ */
+static boost::python::dict Behaviour_integrate(
+    const mtest::Behaviour& b,
+    const double dt,
+    const boost::python::numpy::ndarray& e0,
+    const boost::python::numpy::ndarray& e1,
+    const boost::python::object& s0,
+    const boost::python::object& mps,
+    const boost::python::object& isvs0,
+    const boost::python::object& esvs0,
+    const boost::python::object& desvs,
+    const mtest::StiffnessMatrixType ktype,
+    const std::size_t nthreads) {
+  namespace np = boost::python::numpy;
+  tfel::raise_if(e0.get_nd() == 0,
+                 "Behaviour::integrate: invalid array 'gradients0'");
+  const auto n = static_cast<std::size_t>(e0.shape(0));
+  const auto ng = b.getGradientsSize();
+  const auto nth = b.getThermodynamicForcesSize();
+  const auto nmps = b.getMaterialPropertiesNames().size();
+  const auto nisvs = b.getInternalStateVariablesSize();
+  const auto nesvs = b.expandExternalStateVariablesNames().size();
+  const auto [nr, nc] = mtest::getTangentOperatorSizes(b);
+  auto i = mtest::BehaviourBatchIntegrationInputs{};
+  i.n = n;
+  const auto ao0 = boost::python::object(e0);
+  const auto ao1 = boost::python::object(e1);
+  i.gradients0 = Behaviour_getIntegrationPointsValues(ao0, n, ng, "gradients0");
+  i.gradients1 = Behaviour_getIntegrationPointsValues(ao1, n, ng, "gradients1");
+  i.thermodynamic_forces0 = Behaviour_getIntegrationPointsValues(
+      s0, n, nth, "thermodynamic_forces0");
+  i.material_properties = Behaviour_getIntegrationPointsValues(
+      mps, n, nmps, "material_properties");
+  i.internal_state_variables0 = Behaviour_getIntegrationPointsValues(
+      isvs0, n, nisvs, "internal_state_variables0");
+  i.external_state_variables0 = Behaviour_getIntegrationPointsValues(
+      esvs0, n, nesvs, "external_state_variables0");
+  i.external_state_variables_increments = Behaviour_getIntegrationPointsValues(
+      desvs, n, nesvs, "external_state_variables_increments");
+  tfel::raise_if((nmps != 0) && (i.material_properties == nullptr),
+                 "Behaviour::integrate: no material properties given");
+  const auto dtype = np::dtype::get_builtin<double>();
+  auto s1 = np::zeros(boost::python::make_tuple(n, nth), dtype);
+  auto isvs1 = np::zeros(boost::python::make_tuple(n, nisvs), dtype);
+  auto K = np::zeros(boost::python::make_tuple(n, nr, nc), dtype);
+  auto status =
+      np::zeros(boost::python::make_tuple(n), np::dtype::get_builtin<int>());
+  auto o = mtest::BehaviourBatchIntegrationOutputs{};
+  o.thermodynamic_forces1 = tfel::numpy::get_data(s1);
+  o.internal_state_variables1 = tfel::numpy::get_data(isvs1);
+  if (ktype != mtest::StiffnessMatrixType::NOSTIFFNESS) {
+    o.tangent_operators = tfel::numpy::get_data(K);
+  }
+  o.status = reinterpret_cast<int*>(status.get_data());
+  const auto success = mtest::integrate(o, b, i, dt, ktype, nthreads);
+  auto r = boost::python::dict{};
+  r["success"] = success;
+  r["status"] = status;
+  r["thermodynamic_forces"] = s1;
+  r["internal_state_variables"] = isvs1;
+  if (ktype != mtest::StiffnessMatrixType::NOSTIFFNESS) {
+    r["tangent_operators"] = K;
+  }
+  return r;
+}  // end of Behaviour_integrate
+
+#endif /* TFEL_NUMPY_SUPPORT */
+
 void declareBehaviour() {
   namespace bp = boost::python;
   using mtest::Behaviour;
@@ -325,6 +440,32 @@ void declareBehaviour() {
       .def("getLowerPhysicalBound", &Behaviour::getLowerPhysicalBound,
            "return the lower bound of the given variable")
       .def("getUpperPhysicalBound", &Behaviour::getUpperPhysicalBound,
-           "return the upper bound of the given variable");
+           "return the upper bound of the given variable")
+#ifdef TFEL_NUMPY_SUPPORT
+      .def("integrate", &Behaviour_integrate,
+           (bp::arg("dt"), bp::arg("gradients0"), bp::arg("gradients1"),
+            bp::arg("thermodynamic_forces0") = bp::object(),
+            bp::arg("material_properties") = bp::object(),
+            bp::arg("internal_state_variables0") = bp::object(),
+            bp::arg("external_state_variables0") = bp::object(),
+            bp::arg("external_state_variables_increments") = bp::object(),
+            bp::arg("stiffness_matrix_type") =
+                mtest::StiffnessMatrixType::CONSISTENTTANGENTOPERATOR,
+            bp::arg("number_of_threads") = 1),
+           "Integrate the behaviour over a time step on a set of `n` "
+           "independent integration points.\n"
+           "The values associated with the integration points are given "
+           "by contiguous numpy arrays of shape (n, m), where m is the "
+           "number of values per integration point. Optional arrays which "
+           "are not given are assumed to be null.\n"
+           "The result is a dictionary containing:\n"
+           "- success: true if the integration succeeded on all points\n"
+           "- status: array of integers (1 on success, 0 on failure)\n"
+           "- thermodynamic_forces: array of shape (n, nth)\n"
+           "- internal_state_variables: array of shape (n, nisvs)\n"
+           "- tangent_operators: array of shape (n, nth, ng), if a "
+           "stiffness matrix is requested\n")
+#endif /* TFEL_NUMPY_SUPPORT */
+      ;
 
 }  // end of declareBehaviour()
@@ -177,6 +177,7 @@ void declarePipeTest() {
       .def("setInnerRadius", &PipeTest::setInnerRadius)
       .def("setOuterRadius", &PipeTest::setOuterRadius)
       .def("setNumberOfElements", &PipeTest::setNumberOfElements)
+      .def("setNumberOfThreads", &PipeTest::setNumberOfThreads)
       .def("getNumberOfUnknowns", &PipeTest::getNumberOfUnknowns)
       .def("completeInitialisation", &PipeTest::completeInitialisation)
       .def("execute", pm)
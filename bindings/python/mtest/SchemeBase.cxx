@@ -88,6 +88,19 @@ static void setOutputFrequency(mtest::SchemeBase& s, const std::string& v) {
   }
 }
 
+static void setOutputFileFormat(mtest::SchemeBase& s, const std::string& f) {
+  if (f == "text") {
+    s.setOutputFileFormat(mtest::SchemeBase::TEXTOUTPUTFILEFORMAT);
+  } else if (f == "binary") {
+    s.setOutputFileFormat(mtest::SchemeBase::BINARYOUTPUTFILEFORMAT);
+  } else {
+    tfel::raise(
+        "SchemeBase::setOutputFileFormat: "
+        "invalid format '" +
+        f + "'");
+  }
+}
+
 static void SchemeBase_printOutput(mtest::SchemeBase& s,
                                    const mtest::real t,
                                    const mtest::StudyCurrentState& scs) {
@@ -248,6 +261,31 @@ void declareSchemeBase() {
            "This method specify the number of digits used to print "
            "the results in the output file.\n"
            "* The parameter (uint) is the number of digits wanted.")
+      .def("setOutputFileFormat", setOutputFileFormat,
+           "This method specify the format of the output file.\n"
+           "* The parameter (string) specify the choosen format. "
+           "The two allowed formats are:\n"
+           "- 'text': the results are written as text (default).\n"
+           "- 'binary': the results are written using a columnar "
+           "binary format which can be read by the 'TextData' and "
+           "'ColumnarBinaryData' classes.")
+      .def("setAsynchronousOutput", &SchemeBase::setAsynchronousOutput,
+           "This method specify if the results are written by a "
+           "background thread.\n"
+           "* If the parameter (bool) is 'true', the computation "
+           "thread only copies the results, which are formatted and "
+           "written in the output file, the residual file and the "
+           "files of the user defined post-processings by a "
+           "background thread.\n"
+           "Note : the 'flushOutputFile' method must be called before "
+           "reading the output files during the computation.")
+      .def("setOutputFlushFrequency", &SchemeBase::setOutputFlushFrequency,
+           "This method specify the number of records after which "
+           "the output files are flushed when the results are written "
+           "asynchronously (see the 'setAsynchronousOutput' method).\n"
+           "* The parameter (uint) is the number of records. If null "
+           "(default), the files are only flushed at the end of the "
+           "computation.")
       .def("printOutput", &SchemeBase::printOutput)
       .def("printOutput", &SchemeBase_printOutput)
       .def("setResidualFileName", &SchemeBase::setResidualFileName,
@@ -297,5 +335,9 @@ void declareSchemeBase() {
            "successful iteration.\n"
            "Note : These options only differs in case of substepping.")
       .def("resetOutputFile", &SchemeBase::resetOutputFile,
-           "close and reopen the output files");
+           "close and reopen the output files")
+      .def("flushOutputFile", &SchemeBase::flushOutputFile,
+           "write the results stored in memory in the output file. "
+           "If the results are written asynchronously, this method "
+           "waits until all the pending results have been written");
 }
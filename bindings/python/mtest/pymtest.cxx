@@ -12,6 +12,9 @@
  */
 
 #include <boost/python.hpp>
+#ifdef TFEL_NUMPY_SUPPORT
+#include "TFEL/Numpy/InitNumpy.hxx"
+#endif /* TFEL_NUMPY_SUPPORT */
 #include "MTest/RoundingMode.hxx"
 #include "MTest/SolverOptions.hxx"
 
@@ -32,6 +35,9 @@ void declareMFrontLogStream();
 void declareMTestFileExport();
 
 BOOST_PYTHON_MODULE(_mtest) {
+#ifdef TFEL_NUMPY_SUPPORT
+  tfel::numpy::initializeNumPy();
+#endif /* TFEL_NUMPY_SUPPORT */
   boost::python::enum_<mtest::StiffnessUpdatingPolicy>(
       "StiffnessUpdatingPolicy")
       .value("CONSTANTSTIFFNESS",
@@ -0,0 +1,54 @@
+import os
+try:
+    import unittest2 as unittest
+except ImportError:
+    import unittest
+import numpy
+import mtest
+
+
+class BatchIntegration(unittest.TestCase):
+    def test(self):
+        l = os.environ['MTEST_BEHAVIOUR_LIBRARY']
+        b = mtest.Behaviour('generic', l, 'ImplicitNorton', 'Tridimensional')
+        n = 100
+        E = 150e9
+        nu = 0.3
+        lbda = E * nu / ((1 + nu) * (1 - 2 * nu))
+        mu = E / (2 * (1 + nu))
+        e0 = numpy.zeros((n, 6))
+        e1 = numpy.zeros((n, 6))
+        e1[:, 0] = numpy.linspace(0, 1e-4, n)
+        mps = numpy.empty((n, 2))
+        mps[:, 0] = E
+        mps[:, 1] = nu
+        T = numpy.full((n, 1), 293.15)
+        for nthreads in [1, 4]:
+            r = b.integrate(dt=1e-3,
+                            gradients0=e0,
+                            gradients1=e1,
+                            material_properties=mps,
+                            external_state_variables0=T,
+                            number_of_threads=nthreads)
+            self.assertTrue(r['success'])
+            self.assertTrue(numpy.all(r['status'] == 1))
+            s1 = r['thermodynamic_forces']
+            isvs1 = r['internal_state_variables']
+            K = r['tangent_operators']
+            self.assertTrue(s1.shape == (n, 6))
+            self.assertTrue(isvs1.shape == (n, 7))
+            self.assertTrue(K.shape == (n, 6, 6))
+            seps = 1e-8 * E
+            self.assertTrue(
+                numpy.allclose(s1[:, 0], (lbda + 2 * mu) * e1[:, 0],
+                               rtol=0, atol=seps))
+            self.assertTrue(
+                numpy.allclose(s1[:, 1], lbda * e1[:, 0], rtol=0, atol=seps))
+            self.assertTrue(
+                numpy.allclose(isvs1[:, 0], e1[:, 0], rtol=0, atol=1e-8))
+            self.assertTrue(
+                numpy.allclose(K[:, 0, 0], lbda + 2 * mu, rtol=1e-6))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,44 @@
+/*!
+ * \file   bindings/python/tfel/ColumnarBinaryData.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <boost/python.hpp>
+#include "TFEL/Utilities/ColumnarBinaryData.hxx"
+
+static std::vector<std::string> ColumnarBinaryData_getLegends(
+    const tfel::utilities::ColumnarBinaryData& d) {
+  return d.getLegends();
+}
+
+void declareColumnarBinaryData();
+
+void declareColumnarBinaryData() {
+  using namespace boost::python;
+  using namespace tfel::utilities;
+  using size_type = ColumnarBinaryData::size_type;
+
+  std::vector<double> (ColumnarBinaryData::*getColumn)(const size_type) const =
+      &ColumnarBinaryData::getColumn;
+
+  class_<ColumnarBinaryData, boost::noncopyable>("ColumnarBinaryData",
+                                                 no_init)
+      .def(init<std::string>())
+      .def("isColumnarBinaryFile", &ColumnarBinaryData::isColumnarBinaryFile)
+      .staticmethod("isColumnarBinaryFile")
+      .def("getNumberOfColumns", &ColumnarBinaryData::getNumberOfColumns)
+      .def("getNumberOfRows", &ColumnarBinaryData::getNumberOfRows)
+      .def("getColumn", getColumn)
+      .def("findColumn", &ColumnarBinaryData::findColumn)
+      .def("getLegend", &ColumnarBinaryData::getLegend)
+      .def("getLegends", ColumnarBinaryData_getLegends);
+
+}  // end of declareColumnarBinaryData
@@ -11,9 +11,53 @@
  * project under specific licensing conditions.
  */
 
+#include <map>
+#include <string>
 #include <boost/python.hpp>
+#ifdef TFEL_NUMPY_SUPPORT
+#include <boost/python/numpy.hpp>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Numpy/ndarray.hxx"
+#endif /* TFEL_NUMPY_SUPPORT */
 #include "TFEL/Math/Evaluator.hxx"
 
+#ifdef TFEL_NUMPY_SUPPORT
+
+/*!
+ * \brief evaluate the formula for all the values given by a set of arrays
+ * \param[in] e: evaluator
+ * \param[in] d: dictionary associating arrays to the variables
+ */
+static boost::python::numpy::ndarray Evaluator_getValues(
+    tfel::math::Evaluator& e, const boost::python::dict& d) {
+  namespace np = boost::python::numpy;
+  auto args = std::map<std::string, const double*>{};
+  auto n = std::size_t{};
+  const auto keys = d.keys();
+  for (boost::python::ssize_t i = 0; i != boost::python::len(keys); ++i) {
+    const auto k = boost::python::extract<std::string>(keys[i])();
+    const auto a = boost::python::extract<np::ndarray>(d[keys[i]])();
+    tfel::raise_if(!(a.get_flags() & np::ndarray::C_CONTIGUOUS),
+                   "Evaluator::getValues: "
+                   "array associated with variable '" +
+                       k + "' is not contiguous");
+    const auto s = tfel::numpy::get_size(a);
+    tfel::raise_if((i != 0) && (s != n),
+                   "Evaluator::getValues: "
+                   "unmatched size of the array associated with "
+                   "variable '" +
+                       k + "'");
+    n = s;
+    args.insert({k, tfel::numpy::get_data(a)});
+  }
+  auto r = np::empty(boost::python::make_tuple(n),
+                     np::dtype::get_builtin<double>());
+  e.getValues(tfel::numpy::get_data(r), args, n);
+  return r;
+}  // end of Evaluator_getValues
+
+#endif /* TFEL_NUMPY_SUPPORT */
+
 void declareEvaluator();
 
 void declareEvaluator() {
@@ -36,5 +80,13 @@ void declareEvaluator() {
       .def("getVariablesNames", &Evaluator::getVariablesNames,
            "return the variable names")
       .def("removeDependencies", &Evaluator::removeDependencies,
-           "resolves dependencies and removes them");
+           "resolves dependencies and removes them")
+#ifdef TFEL_NUMPY_SUPPORT
+      .def("getValues", Evaluator_getValues,
+           "evaluates the formula for all the values of the arrays given "
+           "in a dictionary associating the name of a variable to a "
+           "contiguous numpy array. The current values of the variables "
+           "not given in the dictionary are used.")
+#endif /* TFEL_NUMPY_SUPPORT */
+      ;
 }
@@ -15,8 +15,10 @@
 
 void declareData();
 void declareTextData();
+void declareColumnarBinaryData();
 
 BOOST_PYTHON_MODULE(utilities) {
   declareData();
   declareTextData();
+  declareColumnarBinaryData();
 }
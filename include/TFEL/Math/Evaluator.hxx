@@ -23,6 +23,7 @@
 
 #include "TFEL/Config/TFELConfig.hxx"
 #include "TFEL/Math/Parser/Expr.hxx"
+#include "TFEL/Math/Parser/ByteCode.hxx"
 #include "TFEL/Math/Parser/EvaluatorBase.hxx"
 #include "TFEL/Math/Parser/ExternalFunction.hxx"
 #include "TFEL/Math/Parser/ExternalFunctionManager.hxx"
@@ -175,8 +176,24 @@ namespace tfel::math {
      * \return the result of the evaluation
      * \note variables values shall have been set with the
      * `setVariableValue` method.
+     * \note by default, the formula is evaluated using a bytecode
+     * compiled once for all when the formula is analysed. The
+     * intermediate results are stored in a storage local to the call, or
+     * to the calling thread for large formulae, so this method can be
+     * called concurrently on the same object as long as the values of the
+     * variables are not modified meanwhile.
      */
     double getValue() const override;
+    /*!
+     * \brief select how the formula is evaluated.
+     * \param[in] b: if true, the formula is evaluated using the bytecode
+     * resulting from the compilation of the formula. Otherwise, the tree of
+     * expressions resulting from the analysis of the formula is directly
+     * evaluated.
+     * \note the bytecode evaluation is used by default. Disabling it is
+     * mostly meant for testing and benchmarking purposes.
+     */
+    void setByteCodeEvaluation(const bool);
     /*!
      * \brief evaluate the formula
      * \param[in] vs: a map giving the values of some of the
@@ -186,6 +203,32 @@ namespace tfel::math {
      * have been set with the `setVariableValue` method.
      */
     double getValue(const std::map<std::string, double>&);
+    /*!
+     * \brief evaluate the formula for `n` sets of values of the variables
+     * \param[out] r: results of the evaluations
+     * \param[in] args: pointers to the values of the variables. The i-th
+     * pointer is associated with the variable at position `i`. If this
+     * pointer is null, the current value of the variable is used.
+     * \param[in] n: number of evaluations
+     * \note if possible, the formula is evaluated on blocks of values,
+     * which allows the compiler to vectorize most operations. Otherwise,
+     * the formula is evaluated for each set of values.
+     * \note the values of the variables after this call are unspecified.
+     */
+    void getValues(double* const,
+                   const std::vector<const double*>&,
+                   const std::vector<double>::size_type);
+    /*!
+     * \brief evaluate the formula for `n` sets of values of the variables
+     * \param[out] r: results of the evaluations
+     * \param[in] args: pointers to the values of some of the variables.
+     * The current values of the other variables are used.
+     * \param[in] n: number of evaluations
+     * \note the values of the variables after this call are unspecified.
+     */
+    void getValues(double* const,
+                   const std::map<std::string, const double*>&,
+                   const std::vector<double>::size_type);
     /*!
      * \brief evaluate the formula
      * \return the result of the evaluation
@@ -210,6 +253,14 @@ namespace tfel::math {
     virtual std::string getCxxFormula(
         const std::map<std::string, std::string>& = {}) const;
     virtual std::vector<std::string> getVariablesNames() const;
+    /*!
+     * \return the position of the given variable
+     * \param[in] n: name of the variable
+     * \note the position can be used to set the value of the variable
+     * without any lookup by name.
+     */
+    std::vector<double>::size_type getVariablePosition(
+        const std::string&) const;
     std::vector<double>::size_type getNumberOfVariables() const override;
     virtual void checkCyclicDependency() const;
     void checkCyclicDependency(const std::string&) const override;
@@ -244,6 +295,8 @@ namespace tfel::math {
     static bool TFEL_VISIBILITY_LOCAL isNumber(const std::string&);
     //! \brief clear the object
     TFEL_VISIBILITY_LOCAL void clear();
+    //! \brief compile the expression in the bytecode, if any
+    TFEL_VISIBILITY_LOCAL void compileByteCode();
     void TFEL_VISIBILITY_LOCAL
     treatDiff(std::vector<std::string>::const_iterator&,
               const std::vector<std::string>::const_iterator,
@@ -253,8 +306,6 @@ namespace tfel::math {
     registerVariable(const std::string&);
     std::shared_ptr<tfel::math::parser::ExternalFunctionManager>
         TFEL_VISIBILITY_LOCAL getExternalFunctionManager();
-    std::vector<double>::size_type TFEL_VISIBILITY_LOCAL
-    getVariablePosition(const std::string&) const;
     std::vector<std::string> TFEL_VISIBILITY_LOCAL
     analyseParameters(std::vector<std::string>::const_iterator&,
                       const std::vector<std::string>::const_iterator);
@@ -350,6 +401,10 @@ namespace tfel::math {
      * formula to be evaluated
      */
     ExprPtr expr;
+    //! \brief bytecode resulting from the compilation of the expression
+    tfel::math::parser::ByteCode bytecode;
+    //! \brief if true, the bytecode is used to evaluate the formula
+    bool use_bytecode = true;
     //! \brief a pointer to externally defined functions
     std::shared_ptr<tfel::math::parser::ExternalFunctionManager> manager;
   };  // end of struct Evaluator
@@ -19,6 +19,7 @@
 
 #include "TFEL/Math/Kriging/KrigingVariable.hxx"
 #include "TFEL/Math/Kriging/KrigingDefaultModels.hxx"
+#include "TFEL/Math/Kriging/KrigingSymmetricFactorization.hxx"
 
 namespace tfel::math {
 
@@ -31,8 +32,51 @@ namespace tfel::math {
     void addValue(const typename KrigingVariable<N, T>::type&, const T&);
 
     void buildInterpolation();
+    /*!
+     * \brief select the factorization used to solve the kriging system.
+     *
+     * By default, the kriging system is solved by a LU decomposition. If
+     * the symmetric factorization is used, the factorization is kept
+     * and new values can be added by the `addValueAndUpdateInterpolation`
+     * method without factorizing the system again.
+     *
+     * \param[in] b: use the symmetric factorization
+     * \note this choice is taken into account by the next call to the
+     * `buildInterpolation` method.
+     */
+    void useSymmetricFactorization(const bool = true);
+    /*!
+     * \brief add a new value and update the interpolation.
+     *
+     * If the interpolation has been built using the symmetric
+     * factorization, the factorization is extended by one row and one
+     * column, which scales as the square of the number of values.
+     * Otherwise, or if the extension of the factorization is not
+     * numerically stable, the interpolation is built from scratch. The
+     * interpolation is not built as long as the number of values is not
+     * greater than the number of drifts.
+     *
+     * \param[in] xv: location
+     * \param[in] fv: value
+     */
+    void addValueAndUpdateInterpolation(
+        const typename KrigingVariable<N, T>::type&, const T&);
 
     T operator()(const typename KrigingVariable<N, T>::type&) const;
+    /*!
+     * \brief evaluate the interpolation on many locations.
+     *
+     * The locations are treated by blocks and the contribution of each
+     * value to all the locations of a block is computed at once, which
+     * allows the compiler to vectorize the evaluation of the covariance.
+     *
+     * \param[out] r: results
+     * \param[in] xv: locations
+     * \param[in] n: number of locations
+     */
+    void getValues(T* const,
+                   const typename KrigingVariable<N, T>::type* const,
+                   const typename tfel::math::vector<T>::size_type) const;
 
     ~Kriging() noexcept;
 
@@ -40,9 +84,26 @@ namespace tfel::math {
     Kriging(const Kriging&) = delete;
     Kriging& operator=(const Kriging&) = delete;
 
+    /*!
+     * \brief compute the unknowns of the kriging system using its
+     * symmetric factorization
+     */
+    void solveFactorizedSystem();
+
     tfel::math::vector<typename KrigingVariable<N, T>::type> x;
     tfel::math::vector<T> f;
     tfel::math::vector<T> a;
+    //! \brief factorization of the kriging system, if kept
+    KrigingSymmetricFactorization<T> ldlt;
+    /*!
+     * \brief position of the drifts in the rows of the factorized
+     * system. The values added before the last factorization come first,
+     * followed by the drifts and then by the values appended to the
+     * factorization.
+     */
+    typename tfel::math::vector<T>::size_type drifts_offset = 0;
+    //! \brief use the symmetric factorization
+    bool symmetric_factorization = false;
 
   };  // end of struct Kriging
 
@@ -14,6 +14,7 @@
 #ifndef LIB_TFEL_MATH_KRIGINGIXX
 #define LIB_TFEL_MATH_KRIGINGIXX
 
+#include <vector>
 #include <algorithm>
 
 #include "TFEL/Math/matrix.hxx"
@@ -84,6 +85,35 @@ namespace tfel::math {
     return r;
   }  // end of Kriging<N,T,Model>::operator()
 
+  template <unsigned short N, typename T, typename Model>
+  void Kriging<N, T, Model>::getValues(
+      T* const r,
+      const typename KrigingVariable<N, T>::type* const xv,
+      const typename tfel::math::vector<T>::size_type n) const {
+    using namespace tfel::math::internals;
+    using size_type = typename tfel::math::vector<T>::size_type;
+    using diff = typename tfel::math::vector<T>::difference_type;
+    // number of locations treated at once
+    constexpr size_type bsize = 64;
+    const auto ns = this->x.size();
+    for (size_type b = 0; b < n; b += bsize) {
+      const auto e = std::min(n, b + bsize);
+      std::fill(r + b, r + e, T(0));
+      for (size_type i = 0; i != ns; ++i) {
+        const auto ai = this->a[i];
+        const auto& xi = this->x[i];
+        for (auto k = b; k != e; ++k) {
+          r[k] += ai * Model::covariance(xv[k] - xi);
+        }
+      }
+      for (auto k = b; k != e; ++k) {
+        auto p = this->a.begin() + static_cast<diff>(ns);
+        ApplySpecificationDrifts<0, Model::nb, N, T, Model>::apply(r[k], p,
+                                                                  xv[k]);
+      }
+    }
+  }  // end of Kriging<N,T,Model>::getValues
+
   template <unsigned short N, typename T, typename Model>
   void Kriging<N, T, Model>::addValue(
       const typename KrigingVariable<N, T>::type& xv, const T& fv) {
@@ -125,6 +155,12 @@ namespace tfel::math {
     }
     ApplySpecificationDrifts<0, Model::nb, N, T, Model>::apply(
         m, this->x.size(), this->x);
+    if (this->symmetric_factorization) {
+      this->ldlt.factorize(m);
+      this->drifts_offset = this->x.size();
+      this->solveFactorizedSystem();
+      return;
+    }
     // computing unknown values
 #ifdef HAVE_ATLAS
     gesv(m, this->a);
@@ -133,6 +169,73 @@ namespace tfel::math {
 #endif /* LIB_TFEL_MATH_KRIGINGIXX */
   }
 
+  template <unsigned short N, typename T, typename Model>
+  void Kriging<N, T, Model>::useSymmetricFactorization(const bool b) {
+    this->symmetric_factorization = b;
+  }  // end of Kriging<N,T,Model>::useSymmetricFactorization
+
+  template <unsigned short N, typename T, typename Model>
+  void Kriging<N, T, Model>::solveFactorizedSystem() {
+    using size_type = typename tfel::math::vector<T>::size_type;
+    const auto ns = this->x.size();
+    const auto nr = ns + Model::nb;
+    const auto o = this->drifts_offset;
+    // right hand side, using the ordering of the factorized system
+    tfel::math::vector<T> u(nr, T(0));
+    for (size_type i = 0; i != nr; ++i) {
+      if (i < o) {
+        u[i] = this->f[i];
+      } else if (i >= o + Model::nb) {
+        u[i] = this->f[i - Model::nb];
+      }
+    }
+    this->ldlt.solve(u);
+    this->a.resize(nr);
+    for (size_type i = 0; i != nr; ++i) {
+      if (i < o) {
+        this->a[i] = u[i];
+      } else if (i < o + Model::nb) {
+        this->a[ns + i - o] = u[i];
+      } else {
+        this->a[i - Model::nb] = u[i];
+      }
+    }
+  }  // end of Kriging<N,T,Model>::solveFactorizedSystem
+
+  template <unsigned short N, typename T, typename Model>
+  void Kriging<N, T, Model>::addValueAndUpdateInterpolation(
+      const typename KrigingVariable<N, T>::type& xv, const T& fv) {
+    using size_type = typename tfel::math::vector<T>::size_type;
+    const auto ns = this->x.size();
+    const auto nr = ns + Model::nb;
+    if ((!this->symmetric_factorization) || (this->ldlt.size() != nr)) {
+      this->addValue(xv, fv);
+      if (this->x.size() > Model::nb) {
+        this->buildInterpolation();
+      }
+      return;
+    }
+    // new column of the kriging system
+    const auto o = this->drifts_offset;
+    std::vector<T> b(nr);
+    for (size_type i = 0; i != nr; ++i) {
+      if (i < o) {
+        b[i] = Model::covariance(xv - this->x[i]);
+      } else if (i < o + Model::nb) {
+        b[i] = (Model::drifts[i - o])(xv);
+      } else {
+        b[i] = Model::covariance(xv - this->x[i - Model::nb]);
+      }
+    }
+    const auto c = Model::nuggetEffect(ns, xv);
+    this->addValue(xv, fv);
+    if (!this->ldlt.append(b, c)) {
+      this->buildInterpolation();
+      return;
+    }
+    this->solveFactorizedSystem();
+  }  // end of Kriging<N,T,Model>::addValueAndUpdateInterpolation
+
   template <unsigned short N, typename T, typename Model>
   Kriging<N, T, Model>::~Kriging() noexcept = default;
 
@@ -41,6 +41,13 @@ namespace tfel::math {
     ~KrigingErrorInsufficientData() noexcept override;
   };  // end of struct KrigingErrorInsufficientData
 
+  struct TFELMATHKRIGING_VISIBILITY_EXPORT KrigingErrorSingularSystem
+      : public std::runtime_error {
+    KrigingErrorSingularSystem();
+    KrigingErrorSingularSystem(const KrigingErrorSingularSystem&) = default;
+    ~KrigingErrorSingularSystem() noexcept override;
+  };  // end of struct KrigingErrorSingularSystem
+
 }  // end of namespace tfel::math
 
 #endif /* LIB_TFEL_MATH_KRINGINGERRORS_HXX */
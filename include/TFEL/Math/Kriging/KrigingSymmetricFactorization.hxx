@@ -0,0 +1,114 @@
+/*!
+ * \file   include/TFEL/Math/Kriging/KrigingSymmetricFactorization.hxx
+ * \brief  This file declares the `KrigingSymmetricFactorization` class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_KRIGINGSYMMETRICFACTORIZATION_HXX
+#define LIB_TFEL_MATH_KRIGINGSYMMETRICFACTORIZATION_HXX
+
+#include <vector>
+#include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/matrix.hxx"
+
+namespace tfel::math {
+
+  /*!
+   * \brief factorization of a symmetric matrix `A` in the form
+   * \f[
+   * P\,A\,P^{T} = L\,D\,L^{T}
+   * \f]
+   * where \f$P\f$ is a permutation matrix, \f$L\f$ is a unit lower
+   * triangular matrix and \f$D\f$ is a block diagonal matrix made of
+   * \f$1\times 1\f$ and \f$2\times 2\f$ blocks.
+   *
+   * The pivots are selected using the partial pivoting strategy of
+   * Bunch and Kaufman. This factorization is suitable for the
+   * indefinite systems arising in kriging, which contain a null block
+   * associated with the drifts and for which a Cholesky factorization
+   * can't be used.
+   *
+   * The factorization can be extended by one row and one column without
+   * being computed again (see the `append` method).
+   *
+   * \tparam T: numeric type
+   */
+  template <typename T>
+  struct KrigingSymmetricFactorization {
+    //! \brief a simple alias
+    using size_type = typename tfel::math::vector<T>::size_type;
+    /*!
+     * \brief factorize the given matrix
+     * \param[in] m: matrix. Only the lower part of this matrix is used.
+     * This matrix is modified by this method.
+     * \throw KrigingErrorSingularSystem if the matrix is singular
+     */
+    void factorize(matrix<T>&);
+    /*!
+     * \brief extend the factorized matrix by one row and one column.
+     *
+     * The pivot associated with the new row is not allowed to be
+     * selected among the previous ones. If this pivot is too small, the
+     * factorization is left unchanged and this method returns false. In
+     * this case, the extended matrix must be factorized from scratch.
+     *
+     * \return true on success
+     * \param[in] b: values of the new column (excluding the diagonal
+     * term) in the original ordering
+     * \param[in] c: new diagonal term
+     */
+    bool append(const std::vector<T>&, const T);
+    /*!
+     * \brief solve the linear system \f$A\,x=b\f$
+     * \param[in,out] b: right hand side on input, solution on output
+     */
+    void solve(tfel::math::vector<T>&) const;
+    //! \return the size of the factorized matrix
+    size_type size() const;
+
+   private:
+    /*!
+     * \brief solve \f$L\,z=u\f$ where `u` is given in the permuted
+     * ordering
+     * \param[in,out] u: right hand side on input, solution on output
+     */
+    void solveLower(std::vector<T>&) const;
+    /*!
+     * \brief solve \f$D\,z=u\f$
+     * \param[in,out] u: right hand side on input, solution on output
+     */
+    void solveDiagonal(std::vector<T>&) const;
+    /*!
+     * \brief rows of the unit lower triangular matrix \f$L\f$, stored
+     * contiguously without the unit diagonal: the row `i` begins at
+     * the offset \f$i\,(i-1)/2\f$ and has `i` elements.
+     */
+    std::vector<T> l;
+    //! \brief diagonal terms of \f$D\f$
+    std::vector<T> d;
+    /*!
+     * \brief sub-diagonal terms of \f$D\f$. The term `e[i]` is only
+     * meaningful if the rows `i` and `i+1` define a \f$2\times 2\f$ block.
+     */
+    std::vector<T> e;
+    /*!
+     * \brief `blocks[i]` is true if the rows `i` and `i+1` define a
+     * \f$2\times 2\f$ block of \f$D\f$.
+     */
+    std::vector<bool> blocks;
+    //! \brief `perm[i]` is the original index of the `i`-th permuted row
+    std::vector<size_type> perm;
+  };  // end of struct KrigingSymmetricFactorization
+
+}  // end of namespace tfel::math
+
+#include "TFEL/Math/Kriging/KrigingSymmetricFactorization.ixx"
+
+#endif /* LIB_TFEL_MATH_KRIGINGSYMMETRICFACTORIZATION_HXX */
@@ -0,0 +1,259 @@
+/*!
+ * \file   include/TFEL/Math/Kriging/KrigingSymmetricFactorization.ixx
+ * \brief  This file implements the `KrigingSymmetricFactorization` class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_KRIGINGSYMMETRICFACTORIZATION_IXX
+#define LIB_TFEL_MATH_KRIGINGSYMMETRICFACTORIZATION_IXX
+
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <algorithm>
+#include "TFEL/Math/General/IEEE754.hxx"
+#include "TFEL/Math/Kriging/KrigingErrors.hxx"
+
+namespace tfel::math {
+
+  template <typename T>
+  void KrigingSymmetricFactorization<T>::factorize(matrix<T>& m) {
+    using std::abs;
+    using std::swap;
+    const auto n = static_cast<size_type>(m.getNbRows());
+    if ((n == 0) || (m.getNbCols() != n)) {
+      throw(KrigingErrorInvalidLength());
+    }
+    // Bunch-Kaufman parameter
+    const auto alpha = (1 + std::sqrt(T(17))) / 8;
+    // access to the lower part of the matrix
+    auto lower = [&m](const size_type i, const size_type j) -> T& {
+      return (i >= j) ? m(i, j) : m(j, i);
+    };
+    // symmetric permutation of the rows and columns p and q, p < q
+    auto permute = [&m, &lower, n, this](const size_type p,
+                                         const size_type q) {
+      for (size_type j = 0; j != p; ++j) {
+        swap(m(p, j), m(q, j));
+      }
+      swap(m(p, p), m(q, q));
+      for (size_type j = p + 1; j != q; ++j) {
+        swap(lower(j, p), m(q, j));
+      }
+      for (size_type i = q + 1; i != n; ++i) {
+        swap(m(i, p), m(i, q));
+      }
+      swap(this->perm[p], this->perm[q]);
+    };
+    this->perm.resize(n);
+    std::iota(this->perm.begin(), this->perm.end(), size_type(0));
+    this->d.assign(n, T(0));
+    this->e.assign(n, T(0));
+    this->blocks.assign(n, false);
+    auto w0 = std::vector<T>(n);
+    auto w1 = std::vector<T>(n);
+    size_type k = 0;
+    while (k != n) {
+      // pivot selection
+      const auto absakk = abs(m(k, k));
+      auto imax = k;
+      auto colmax = T(0);
+      for (auto i = k + 1; i != n; ++i) {
+        if (abs(m(i, k)) > colmax) {
+          colmax = abs(m(i, k));
+          imax = i;
+        }
+      }
+      if (ieee754::fpclassify(std::max(absakk, colmax)) == FP_ZERO) {
+        throw(KrigingErrorSingularSystem());
+      }
+      auto kp = k;
+      auto kstep = size_type(1);
+      if (absakk < alpha * colmax) {
+        auto rowmax = T(0);
+        for (auto j = k; j != n; ++j) {
+          if (j != imax) {
+            rowmax = std::max(rowmax, abs(lower(imax, j)));
+          }
+        }
+        if (absakk * rowmax < alpha * colmax * colmax) {
+          kp = imax;
+          if (abs(m(imax, imax)) < alpha * rowmax) {
+            kstep = 2;
+          }
+        }
+      }
+      const auto kk = k + kstep - 1;
+      if (kp != kk) {
+        permute(kk, kp);
+      }
+      // elimination
+      if (kstep == 1) {
+        const auto dk = m(k, k);
+        this->d[k] = dk;
+        for (auto i = k + 1; i != n; ++i) {
+          w0[i] = m(i, k);
+          m(i, k) /= dk;
+        }
+        for (auto i = k + 1; i != n; ++i) {
+          const auto li = m(i, k);
+          for (auto j = k + 1; j != i + 1; ++j) {
+            m(i, j) -= li * w0[j];
+          }
+        }
+      } else {
+        const auto a = m(k, k);
+        const auto b = m(k + 1, k);
+        const auto c = m(k + 1, k + 1);
+        const auto det = a * c - b * b;
+        this->d[k] = a;
+        this->d[k + 1] = c;
+        this->e[k] = b;
+        this->blocks[k] = true;
+        for (auto i = k + 2; i != n; ++i) {
+          w0[i] = m(i, k);
+          w1[i] = m(i, k + 1);
+          m(i, k) = (c * w0[i] - b * w1[i]) / det;
+          m(i, k + 1) = (a * w1[i] - b * w0[i]) / det;
+        }
+        for (auto i = k + 2; i != n; ++i) {
+          const auto l0 = m(i, k);
+          const auto l1 = m(i, k + 1);
+          for (auto j = k + 2; j != i + 1; ++j) {
+            m(i, j) -= l0 * w0[j] + l1 * w1[j];
+          }
+        }
+      }
+      k += kstep;
+    }
+    // storing the rows of L
+    this->l.resize((n * (n - 1)) / 2);
+    for (size_type i = 1; i != n; ++i) {
+      auto* const li = this->l.data() + (i * (i - 1)) / 2;
+      for (size_type j = 0; j != i; ++j) {
+        li[j] = m(i, j);
+      }
+      if (this->blocks[i - 1]) {
+        // (i-1, i) is a 2x2 block of D
+        li[i - 1] = T(0);
+      }
+    }
+  }  // end of factorize
+
+  template <typename T>
+  void KrigingSymmetricFactorization<T>::solveLower(std::vector<T>& u) const {
+    const auto n = this->size();
+    for (size_type i = 1; i != n; ++i) {
+      const auto* const li = this->l.data() + (i * (i - 1)) / 2;
+      auto s = T(0);
+      for (size_type j = 0; j != i; ++j) {
+        s += li[j] * u[j];
+      }
+      u[i] -= s;
+    }
+  }  // end of solveLower
+
+  template <typename T>
+  void KrigingSymmetricFactorization<T>::solveDiagonal(
+      std::vector<T>& u) const {
+    const auto n = this->size();
+    size_type i = 0;
+    while (i != n) {
+      if (this->blocks[i]) {
+        const auto a = this->d[i];
+        const auto b = this->e[i];
+        const auto c = this->d[i + 1];
+        const auto det = a * c - b * b;
+        const auto u0 = u[i];
+        const auto u1 = u[i + 1];
+        u[i] = (c * u0 - b * u1) / det;
+        u[i + 1] = (a * u1 - b * u0) / det;
+        i += 2;
+      } else {
+        u[i] /= this->d[i];
+        ++i;
+      }
+    }
+  }  // end of solveDiagonal
+
+  template <typename T>
+  void KrigingSymmetricFactorization<T>::solve(
+      tfel::math::vector<T>& b) const {
+    const auto n = this->size();
+    if (b.size() != n) {
+      throw(KrigingErrorInvalidLength());
+    }
+    auto u = std::vector<T>(n);
+    for (size_type i = 0; i != n; ++i) {
+      u[i] = b[this->perm[i]];
+    }
+    this->solveLower(u);
+    this->solveDiagonal(u);
+    // backward substitution, L^T being accessed by rows of L
+    for (auto i = n - 1; i != 0; --i) {
+      const auto* const li = this->l.data() + (i * (i - 1)) / 2;
+      const auto ui = u[i];
+      for (size_type j = 0; j != i; ++j) {
+        u[j] -= li[j] * ui;
+      }
+    }
+    for (size_type i = 0; i != n; ++i) {
+      b[this->perm[i]] = u[i];
+    }
+  }  // end of solve
+
+  template <typename T>
+  bool KrigingSymmetricFactorization<T>::append(const std::vector<T>& b,
+                                                const T c) {
+    using std::abs;
+    const auto n = this->size();
+    if (b.size() != n) {
+      throw(KrigingErrorInvalidLength());
+    }
+    auto z = std::vector<T>(n);
+    for (size_type i = 0; i != n; ++i) {
+      z[i] = b[this->perm[i]];
+    }
+    this->solveLower(z);
+    auto ln = z;
+    this->solveDiagonal(ln);
+    auto s = T(0);
+    auto as = T(0);
+    for (size_type i = 0; i != n; ++i) {
+      if (!std::isfinite(ln[i])) {
+        return false;
+      }
+      s += ln[i] * z[i];
+      as += abs(ln[i] * z[i]);
+    }
+    const auto dn = c - s;
+    // reject the new pivot if it is dominated by rounding errors
+    const auto eps = 128 * std::numeric_limits<T>::epsilon();
+    if ((!std::isfinite(dn)) || (!(abs(dn) > eps * (abs(c) + as)))) {
+      return false;
+    }
+    this->l.insert(this->l.end(), ln.begin(), ln.end());
+    this->d.push_back(dn);
+    this->e.push_back(T(0));
+    this->blocks.push_back(false);
+    this->perm.push_back(n);
+    return true;
+  }  // end of append
+
+  template <typename T>
+  typename KrigingSymmetricFactorization<T>::size_type
+  KrigingSymmetricFactorization<T>::size() const {
+    return this->perm.size();
+  }  // end of size
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_KRIGINGSYMMETRICFACTORIZATION_IXX */
@@ -20,6 +20,9 @@
 #ifndef LIB_TFEL_MATH_LEVENBERGMARQUARDT_HXX
 #define LIB_TFEL_MATH_LEVENBERGMARQUARDT_HXX
 
+#include <vector>
+#include <utility>
+#include <functional>
 #include "TFEL/Config/TFELConfig.hxx"
 #include "TFEL/Math/vector.hxx"
 #include "TFEL/Math/matrix.hxx"
@@ -52,6 +55,42 @@ namespace tfel::math {
     void setMultiplicationFactor(const T);
 
     void setMaximumIteration(const T);
+    /*!
+     * \brief a function executing `n` tasks, possibly concurrently. The
+     * tasks are described by a function taking the index of the task, in
+     * the range `[0, n)`. This function shall return once all the tasks
+     * are done and rethrow the exception thrown by a task, if any.
+     *
+     * For example, the `parallel_for` method of a
+     * `tfel::system::ThreadPool` can be used as follows:
+     *
+     * \code{.cxx}
+     * [&pool](const size_type n,
+     *         const std::function<void(const size_type)>& t) {
+     *   pool.parallel_for(size_type{0}, n, size_type{1}, t);
+     * }
+     * \endcode
+     */
+    using Executor = std::function<void(
+        const size_type, const std::function<void(const size_type)>&)>;
+    /*!
+     * \brief set the function used to evaluate the function and its
+     * derivatives concurrently on the data points.
+     *
+     * The data points are split in contiguous ranges, which are treated
+     * as tasks by the executor. Each range is treated by a copy of the
+     * function object, so the copy constructor of the function object
+     * must produce an object which can be used concurrently with the
+     * original one. The partial contributions of each range are summed
+     * in the order of the ranges, so that the results do not depend on
+     * the scheduling of the tasks.
+     *
+     * \param[in] n: number of ranges. If `n` is equal to one, the
+     * data points are treated sequentially by the calling thread and the
+     * executor is not used.
+     * \param[in] e: executor
+     */
+    void setExecutor(const size_type, Executor);
 
     unsigned short getNumberOfIterations() const;
 
@@ -60,6 +99,21 @@ namespace tfel::math {
     ~LevenbergMarquardt();
 
    private:
+    /*!
+     * \brief compute the gradient of the objective function, the
+     * approximation of its hessian and the sum of the squared residuals
+     * \param[out] g: gradient
+     * \param[out] J: approximation of the hessian
+     * \param[out] s: sum of the squared residuals
+     * \param[in] fcts: copies of the function used by the ranges
+     * \param[in] p_: parameters
+     */
+    void computeResidualsAndGradient(Gradient&,
+                                     matrix<T>&,
+                                     T&,
+                                     std::vector<F>&,
+                                     const Parameter&);
+
     F f;
     std::vector<std::pair<Variable, double>> data;
     Parameter p;
@@ -69,6 +123,10 @@ namespace tfel::math {
     T eps2 = T(1.e-10);
     unsigned short iter = 0;
     unsigned short iterMax = 100;
+    //! \brief number of ranges of data points
+    size_type nranges = 1;
+    //! \brief function executing the treatment of the ranges
+    Executor executor;
   };  // end of struct LevenbergMarquardt
 
 }  // end of namespace tfel::math
@@ -15,7 +15,9 @@
 #ifndef LIB_TFEL_MATH_LEVENBERGMARQUARDTIXX
 #define LIB_TFEL_MATH_LEVENBERGMARQUARDTIXX
 
+#include <utility>
 #include <algorithm>
+#include "TFEL/Raise.hxx"
 #include "TFEL/Math/power.hxx"
 #include "TFEL/Math/MathException.hxx"
 
@@ -65,11 +67,74 @@ namespace tfel::math {
     this->iterMax = nb;
   }  // end of LevenbergMarquardt::setMaximumIteration
 
+  template <typename F>
+  void LevenbergMarquardt<F>::setExecutor(const size_type n, Executor e) {
+    raise_if(n == 0,
+             "LevenbergMarquardt<F>::setExecutor: "
+             "invalid number of ranges");
+    raise_if((n != 1) && (!e),
+             "LevenbergMarquardt<F>::setExecutor: "
+             "invalid executor");
+    this->nranges = n;
+    this->executor = std::move(e);
+  }  // end of LevenbergMarquardt::setExecutor
+
   template <typename F>
   unsigned short LevenbergMarquardt<F>::getNumberOfIterations() const {
     return this->iter;
   }  // end of LevenbergMarquardt::getNumberOfIterations
 
+  template <typename F>
+  void LevenbergMarquardt<F>::computeResidualsAndGradient(
+      Gradient& g,
+      matrix<T>& J,
+      T& s,
+      std::vector<F>& fcts,
+      const Parameter& p_) {
+    using tfel::math::stdfunctions::power;
+    const auto m = this->f.getNumberOfParameters();
+    auto evaluate = [this, &p_, m](F& fct, Gradient& gr, matrix<T>& Jr,
+                                   T& sr, const size_type b,
+                                   const size_type e) {
+      Gradient gradient(m, T(0));
+      T v(0);
+      for (auto i = b; i != e; ++i) {
+        const auto& d = this->data[i];
+        fct(v, gradient, d.first, p_);
+        gr += (v - d.second) * gradient;
+        Jr += gradient ^ gradient;
+        sr += power<2>(v - d.second);
+      }
+    };
+    std::fill(g.begin(), g.end(), T(0));
+    std::fill(J.begin(), J.end(), T(0));
+    s = T(0);
+    const auto n = this->data.size();
+    if (fcts.empty()) {
+      evaluate(this->f, g, J, s, 0, n);
+      return;
+    }
+    // the first range is treated by the original function object and
+    // its contributions are directly stored in the outputs
+    const auto nt = fcts.size() + 1;
+    auto gs = std::vector<Gradient>(fcts.size(), Gradient(m, T(0)));
+    auto Js = std::vector<matrix<T>>(fcts.size(), matrix<T>(m, m, T(0)));
+    auto ss = std::vector<T>(fcts.size(), T(0));
+    this->executor(nt, [&](const size_type t) {
+      if (t == 0) {
+        evaluate(this->f, g, J, s, 0, n / nt);
+      } else {
+        evaluate(fcts[t - 1], gs[t - 1], Js[t - 1], ss[t - 1], (t * n) / nt,
+                 ((t + 1) * n) / nt);
+      }
+    });
+    for (size_type t = 1; t != nt; ++t) {
+      g += gs[t - 1];
+      J += Js[t - 1];
+      s += ss[t - 1];
+    }
+  }  // end of LevenbergMarquardt::computeResidualsAndGradient
+
   template <typename F>
   const typename LevenbergMarquardt<F>::Parameter&
   LevenbergMarquardt<F>::execute() {
@@ -81,22 +146,23 @@ namespace tfel::math {
     matrix<T> Jn(m, m, T(0));
     Parameter g(m, T(0));
     Parameter gn(m, T(0));
-    Parameter gradient(m, T(0));
     Parameter h(m);
     Parameter p_(m);
     T s(T(0));
-    T v(0);
     T lambda = this->lambda0;
     unsigned short i;
     bool success;
-    s = T(0);
-    for (auto it = this->data.begin(); it != this->data.end(); ++it) {
-      p_ = this->p + h;
-      (this->f)(v, gradient, it->first, p_);
-      g += (v - it->second) * gradient;
-      J += gradient ^ gradient;
-      s += power<2>(v - it->second);
+    // copies of the function used by the additional ranges
+    auto fcts = std::vector<F>{};
+    const auto nt =
+        std::min(this->nranges, static_cast<size_type>(this->data.size()));
+    if (nt > 1) {
+      fcts.reserve(nt - 1);
+      for (size_type t = 1; t != nt; ++t) {
+        fcts.push_back(this->f);
+      }
     }
+    this->computeResidualsAndGradient(g, J, s, fcts, this->p);
     lambda *= *(max_element(J.begin(), J.end()));
     for (i = 0; i != m; ++i) {
       J(i, i) += lambda;
@@ -106,18 +172,11 @@ namespace tfel::math {
     for (this->iter = 0; (this->iter != this->iterMax) && (!success);
          ++(this->iter)) {
       Jn = J;
-      fill(gn.begin(), gn.end(), T(0));
       h = -g;
       T sn(T(0));
       LUSolve::exe(Jn, h);
-      fill(Jn.begin(), Jn.end(), T(0));
-      for (auto it = this->data.begin(); it != this->data.end(); ++it) {
-        p_ = this->p + h;
-        (this->f)(v, gradient, it->first, p_);
-        gn += (v - it->second) * gradient;
-        Jn += gradient ^ gradient;
-        sn += power<2>(v - it->second);
-      }
+      p_ = this->p + h;
+      this->computeResidualsAndGradient(gn, Jn, sn, fcts, p_);
       T rho = (s - sn) / (0.5 * (h | (lambda * h - g)));
       if (rho > 0) {
         lambda *= max(T(0.3333), T(1) - power<3>(2 * rho - 1));
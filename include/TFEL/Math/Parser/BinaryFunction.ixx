@@ -18,6 +18,7 @@
 #include <string>
 #include <cstring>
 #include <cerrno>
+#include "TFEL/Math/Parser/ByteCode.hxx"
 
 namespace tfel::math::parser {
 
@@ -65,6 +66,14 @@ namespace tfel::math::parser {
     return res;
   }  // end of StandardBinaryFunction::StandardBinaryFunction
 
+  template <double (*f)(const double, const double)>
+  std::vector<double>::size_type StandardBinaryFunction<f>::compile(
+      ByteCode& c) const {
+    const auto ra = this->expr1->compile(c);
+    const auto rb = this->expr2->compile(c);
+    return c.addBinaryFunction(f, ra, rb);
+  }  // end of compile
+
   template <double (*f)(const double, const double)>
   void StandardBinaryFunction<f>::checkCyclicDependency(
       std::vector<std::string>& names) const {
@@ -18,10 +18,13 @@
 #include "TFEL/Config/TFELConfig.hxx"
 #include <memory>
 #include "TFEL/Math/Parser/Expr.hxx"
+#include "TFEL/Math/Parser/ByteCode.hxx"
 
 namespace tfel::math::parser {
 
   struct OpPlus {
+    //! \brief operation code used by the bytecode
+    static constexpr ByteCode::OpCode opcode = ByteCode::ADDITION;
     /*!
      * \param[in] a: lhs
      * \param[in] b: rhs
@@ -36,6 +39,8 @@ namespace tfel::math::parser {
   };  // end of struct OpPlus
 
   struct OpMinus {
+    //! \brief operation code used by the bytecode
+    static constexpr ByteCode::OpCode opcode = ByteCode::SUBSTRACTION;
     /*!
      * \param[in] a: lhs
      * \param[in] b: rhs
@@ -50,6 +55,8 @@ namespace tfel::math::parser {
   };  // end of struct OpMinus
 
   struct OpMult {
+    //! \brief operation code used by the bytecode
+    static constexpr ByteCode::OpCode opcode = ByteCode::MULTIPLICATION;
     /*!
      * \param[in] a: lhs
      * \param[in] b: rhs
@@ -64,6 +71,8 @@ namespace tfel::math::parser {
   };  // end of struct OpMult
 
   struct OpDiv {
+    //! \brief operation code used by the bytecode
+    static constexpr ByteCode::OpCode opcode = ByteCode::DIVISION;
     /*!
      * \param[in] a: lhs
      * \param[in] b: rhs
@@ -78,6 +87,8 @@ namespace tfel::math::parser {
   };  // end of struct OpDiv
 
   struct OpPower {
+    //! \brief operation code used by the bytecode
+    static constexpr ByteCode::OpCode opcode = ByteCode::POWER;
     /*!
      * \param[in] a: lhs
      * \param[in] b: rhs
@@ -104,6 +115,7 @@ namespace tfel::math::parser {
     //
     bool isConstant() const override;
     double getValue() const override final;
+    std::vector<double>::size_type compile(ByteCode&) const override final;
     bool dependsOnVariable(const std::vector<double>::size_type) const override;
     std::string getCxxFormula(
         const std::vector<std::string>&) const override final;
@@ -0,0 +1,339 @@
+/*!
+ * \file   include/TFEL/Math/Parser/ByteCode.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_PARSER_BYTECODE_HXX
+#define LIB_TFEL_MATH_PARSER_BYTECODE_HXX
+
+#include <map>
+#include <tuple>
+#include <vector>
+#include <cstdint>
+#include "TFEL/Config/TFELConfig.hxx"
+
+namespace tfel::math::parser {
+
+  // forward declaration
+  struct Expr;
+  // forward declaration
+  struct LogicalExpr;
+
+  /*!
+   * \brief a compact register-based representation of an expression.
+   *
+   * The tree of expressions resulting from the analysis of a formula is
+   * flattened in a sequence of instructions. Each instruction stores its
+   * result in a dedicated register. The evaluation of the sequence of
+   * instructions does not allocate memory, except the first time a thread
+   * evaluates a byte code with many registers, and does not rely on
+   * virtual calls, except for expressions which can't be represented by an
+   * instruction (external functions for instance). Those expressions are
+   * evaluated by calling their `getValue` method.
+   *
+   * During the compilation:
+   *
+   * - instructions whose arguments are all constants are evaluated once
+   *   for all (constant folding).
+   * - an instruction identical to a previous one is not added (common
+   *   subexpression elimination), unless the previous one belongs to
+   *   a branch of a conditional expression.
+   *
+   * The result of the evaluation is the same as the one given by the
+   * `getValue` method of the compiled expression, including the
+   * exceptions thrown on invalid operations.
+   *
+   * \note the registers are copied in a storage local to each evaluation,
+   * or to each thread and level of nested evaluations for large byte codes,
+   * so the `getValue` and `getValues` methods can be called concurrently
+   * on the same object.
+   */
+  struct TFELMATHPARSER_VISIBILITY_EXPORT ByteCode {
+    //! \brief a simple alias
+    using size_type = std::vector<double>::size_type;
+    //! \brief a simple alias
+    using FunctionPtr = double (*)(double);
+    //! \brief a simple alias
+    using BinaryFunctionPtr = double (*)(const double, const double);
+    //! \brief list of supported operations
+    enum OpCode : std::uint8_t {
+      VARIABLE,
+      NEGATION,
+      ADDITION,
+      SUBSTRACTION,
+      MULTIPLICATION,
+      DIVISION,
+      POWER,
+      INTEGER_POWER,
+      FUNCTION,
+      UNCHECKED_FUNCTION,
+      BINARY_FUNCTION,
+      EQUAL,
+      GREATER,
+      GREATER_OR_EQUAL,
+      LESSER,
+      LESSER_OR_EQUAL,
+      AND,
+      OR,
+      NOT,
+      MOVE,
+      JUMP,
+      JUMP_IF_FALSE,
+      EXPRESSION,
+      LOGICAL_EXPRESSION
+    };  // end of enum OpCode
+    //! \brief default constructor
+    ByteCode();
+    //! \brief move constructor
+    ByteCode(ByteCode&&);
+    //! \brief copy constructor
+    ByteCode(const ByteCode&);
+    //! \brief move assignement
+    ByteCode& operator=(ByteCode&&);
+    //! \brief standard assignement
+    ByteCode& operator=(const ByteCode&);
+    /*!
+     * \brief compile the given expression.
+     * \param[in] e: expression
+     * \note the previous instructions are discarded.
+     * \note the expression must outlive this object, as well as the
+     * vectors of variables referenced by the expression.
+     */
+    void compile(const Expr&);
+    //! \brief remove all the instructions
+    void clear();
+    //! \return if an expression has been compiled
+    bool empty() const;
+    //! \return the number of instructions
+    size_type getNumberOfInstructions() const;
+    //! \return the number of registers
+    size_type getNumberOfRegisters() const;
+    //! \return the result of the evaluation of the compiled expression
+    double getValue() const;
+    /*!
+     * \return if the compiled expression can be evaluated by the
+     * `getValues` method, i.e. if:
+     *
+     * - it does not contain any expression evaluated by its `getValue`
+     *   method.
+     * - the branches of the conditional expressions only contain
+     *   operations that can't fail.
+     */
+    bool isVectorizable() const;
+    /*!
+     * \brief evaluate the compiled expression for `n` sets of values of
+     * the variables.
+     *
+     * The instructions are evaluated on blocks of values, which allows
+     * the compiler to vectorize most operations. Both branches of the
+     * conditional expressions are evaluated and the results are selected
+     * according to the value of the condition.
+     *
+     * \param[out] v: results of the evaluations
+     * \param[in] args: pointers to the values of the variables. The i-th
+     * pointer is associated with the i-th variable. If this pointer is
+     * null, the value of the variable is taken from the vector of values
+     * given at compile time.
+     * \param[in] n: number of evaluations
+     * \note the compiled expression must be vectorizable.
+     */
+    void getValues(double* const,
+                   const std::vector<const double*>&,
+                   const size_type) const;
+    /*!
+     * \brief add a constant
+     * \return the register holding the value
+     * \param[in] v: value
+     */
+    size_type addConstant(const double);
+    /*!
+     * \brief add an instruction loading the value of a variable
+     * \return the register holding the value
+     * \param[in] v: values of the variables
+     * \param[in] p: position of the variable
+     */
+    size_type addVariable(const std::vector<double>&, const size_type);
+    /*!
+     * \brief add an unary operation (`NEGATION` or `NOT`)
+     * \return the register holding the result
+     * \param[in] op: operation
+     * \param[in] a: register holding the argument
+     */
+    size_type addUnaryOperation(const OpCode, const size_type);
+    /*!
+     * \brief add a binary operation (arithmetic, comparison or logical
+     * operation)
+     * \return the register holding the result
+     * \param[in] op: operation
+     * \param[in] a: register holding the first argument
+     * \param[in] b: register holding the second argument
+     */
+    size_type addBinaryOperation(const OpCode,
+                                 const size_type,
+                                 const size_type);
+    /*!
+     * \brief add the call to a standard function. An exception is thrown
+     * at runtime if `errno` is set by the function.
+     * \return the register holding the result
+     * \param[in] f: function
+     * \param[in] a: register holding the argument
+     */
+    size_type addFunction(const FunctionPtr, const size_type);
+    /*!
+     * \brief add the call to a function which does not report errors
+     * through `errno`.
+     * \return the register holding the result
+     * \param[in] f: function
+     * \param[in] a: register holding the argument
+     */
+    size_type addUncheckedFunction(const FunctionPtr, const size_type);
+    /*!
+     * \brief add the call to a standard binary function. An exception is
+     * thrown at runtime if `errno` is set by the function.
+     * \return the register holding the result
+     * \param[in] f: function
+     * \param[in] a: register holding the first argument
+     * \param[in] b: register holding the second argument
+     */
+    size_type addBinaryFunction(const BinaryFunctionPtr,
+                                const size_type,
+                                const size_type);
+    /*!
+     * \brief add the computation of an integer power of a value.
+     * \return the register holding the result
+     * \param[in] a: register holding the argument
+     * \param[in] n: exponent
+     */
+    size_type addIntegerPower(const size_type, const int);
+    /*!
+     * \brief add a conditional expression. Only the selected branch is
+     * evaluated at runtime.
+     * \return the register holding the result
+     * \param[in] c: condition
+     * \param[in] a: expression evaluated if the condition is true
+     * \param[in] b: expression evaluated if the condition is false
+     */
+    size_type addConditionalExpression(const LogicalExpr&,
+                                       const Expr&,
+                                       const Expr&);
+    /*!
+     * \brief add an expression which is evaluated by calling its
+     * `getValue` method.
+     * \return the register holding the result
+     * \param[in] e: expression
+     */
+    size_type addExpression(const Expr&);
+    /*!
+     * \brief add a logical expression which is evaluated by calling its
+     * `getValue` method.
+     * \return the register holding the result
+     * \param[in] e: logical expression
+     */
+    size_type addLogicalExpression(const LogicalExpr&);
+    //! \brief destructor
+    ~ByteCode();
+
+   private:
+    //! \brief description of an instruction
+    struct Instruction {
+      //! \brief operation
+      OpCode op;
+      //! \brief register holding the result
+      size_type r;
+      //! \brief first argument (register or position of a variable)
+      size_type a;
+      //! \brief second argument (register or target of a jump)
+      size_type b;
+      //! \brief additional data
+      union {
+        FunctionPtr f;
+        BinaryFunctionPtr f2;
+        const std::vector<double>* v;
+        const Expr* e;
+        const LogicalExpr* l;
+        int n;
+      };
+    };  // end of struct Instruction
+    //! \brief key used to detect common subexpressions
+    using InstructionKey =
+        std::tuple<OpCode, size_type, size_type, std::uintptr_t, int>;
+    /*!
+     * \brief evaluate an instruction which is neither a jump nor a move
+     * \param[in] i: instruction
+     * \param[in,out] r: registers
+     */
+    static void evaluate(const Instruction&, double* const);
+    /*!
+     * \brief execute the instructions
+     * \return the value of the expression
+     * \param[in,out] r: registers
+     */
+    double execute(double* const) const;
+    /*!
+     * \brief evaluate an instruction on a block of values
+     * \param[in] i: instruction
+     * \param[in,out] r: registers, each register holding `block_size`
+     * values
+     * \param[in] args: pointers to the values of the variables
+     * \param[in] o: offset of the first value of the block
+     * \param[in] n: number of values in the block
+     */
+    static void evaluateBlock(const Instruction&,
+                              double* const,
+                              const std::vector<const double*>&,
+                              const size_type,
+                              const size_type);
+    /*!
+     * \brief add an instruction, performing constant folding and common
+     * subexpression elimination when possible.
+     * \return the register holding the result
+     * \param[in] i: instruction
+     * \param[in] k: key identifying the instruction
+     * \param[in] ca: if true, the first argument is a register
+     * \param[in] cb: if true, the second argument is a register
+     */
+    size_type addInstruction(Instruction,
+                             const InstructionKey&,
+                             const bool,
+                             const bool);
+    //! \return a new register
+    size_type addRegister();
+    //! \brief list of instructions
+    std::vector<Instruction> instructions;
+    /*!
+     * \brief maximal number of registers for which the `getValue` method
+     * uses an uninitialized storage allocated on the stack. Larger byte
+     * codes use a storage preallocated for the calling thread.
+     */
+    static constexpr size_type small_size = 64;
+    //! \brief number of values treated at once by the `getValues` method
+    static constexpr size_type block_size = 64;
+    /*!
+     * \brief initial values of the registers.
+     *
+     * Only the registers associated with constants have meaningful
+     * values. Those values are copied in a storage local to each call of
+     * the `getValue` and `getValues` methods, which are thus reentrant.
+     */
+    std::vector<double> registers;
+    //! \brief flags stating if a register holds a constant
+    std::vector<bool> constants;
+    //! \brief registers associated with constant values
+    std::map<std::uint64_t, size_type> constants_registers;
+    //! \brief registers associated with previous instructions
+    std::map<InstructionKey, size_type> cse;
+    //! \brief register holding the result
+    size_type result = 0;
+  };  // end of struct ByteCode
+
+}  // end of namespace tfel::math::parser
+
+#endif /* LIB_TFEL_MATH_PARSER_BYTECODE_HXX */
@@ -30,6 +30,7 @@ namespace tfel::math::parser {
     bool isConstant() const override;
     bool dependsOnVariable(const std::vector<double>::size_type) const override;
     double getValue() const override;
+    std::vector<double>::size_type compile(ByteCode&) const override;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
 
     void checkCyclicDependency(std::vector<std::string>&) const override;
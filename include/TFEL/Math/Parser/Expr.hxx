@@ -23,6 +23,9 @@
 
 namespace tfel::math::parser {
 
+  // forward declaration
+  struct ByteCode;
+
   /*!
    * \brief base class resulting from the analysis of a formula.
    */
@@ -38,6 +41,15 @@ namespace tfel::math::parser {
     virtual bool isConstant() const = 0;
     //! \return the result of the evaluation of the expression
     virtual double getValue() const = 0;
+    /*!
+     * \brief add the instructions evaluating this expression to the given
+     * bytecode.
+     * \return the register holding the result of the evaluation
+     * \param[in,out] c: bytecode
+     * \note the default implementation adds an instruction calling the
+     * `getValue` method.
+     */
+    virtual std::vector<double>::size_type compile(ByteCode&) const;
     //! \brief check if the expression does not lead to a cyclic dependency
     virtual void checkCyclicDependency(std::vector<std::string>&) const = 0;
     virtual std::shared_ptr<Expr> resolveDependencies(
@@ -29,6 +29,17 @@ namespace tfel::math::parser {
     LevenbergMarquardtEvaluatorWrapper(std::shared_ptr<tfel::math::Evaluator>,
                                        const size_type,
                                        const size_type);
+    /*!
+     * \brief copy constructor
+     *
+     * The evaluator and its derivatives are duplicated, so that the copy
+     * can be used concurrently with the source, for example by the
+     * threads of the `LevenbergMarquardt` algorithm.
+     *
+     * \param[in] src: source
+     */
+    LevenbergMarquardtEvaluatorWrapper(
+        const LevenbergMarquardtEvaluatorWrapper&);
 
     size_type getNumberOfVariables() const;
 
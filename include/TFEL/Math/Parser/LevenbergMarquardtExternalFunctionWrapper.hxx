@@ -31,6 +31,17 @@ namespace tfel::math::parser {
         std::shared_ptr<tfel::math::parser::ExternalFunction>,
         const size_type,
         const size_type);
+    /*!
+     * \brief copy constructor
+     *
+     * The external function and its derivatives are duplicated, so that
+     * the copy can be used concurrently with the source, for example by
+     * the threads of the `LevenbergMarquardt` algorithm.
+     *
+     * \param[in] src: source
+     */
+    LevenbergMarquardtExternalFunctionWrapper(
+        const LevenbergMarquardtExternalFunctionWrapper&);
 
     size_type getNumberOfVariables() const;
 
@@ -22,10 +22,13 @@
 
 #include "TFEL/Config/TFELConfig.hxx"
 #include "TFEL/Math/Parser/Expr.hxx"
+#include "TFEL/Math/Parser/ByteCode.hxx"
 
 namespace tfel::math::parser {
 
   struct OpEqual {
+    //! \brief operation code used by the bytecode
+    static constexpr ByteCode::OpCode opcode = ByteCode::EQUAL;
     static bool apply(const double, const double);
     /*!
      * \brief return a string suitable for integration in a C++
@@ -37,6 +40,8 @@ namespace tfel::math::parser {
   };  // end of struct OpEqual
 
   struct OpGreater {
+    //! \brief operation code used by the bytecode
+    static constexpr ByteCode::OpCode opcode = ByteCode::GREATER;
     static bool apply(const double, const double);
     /*!
      * \brief return a string suitable for integration in a C++
@@ -48,6 +53,8 @@ namespace tfel::math::parser {
   };  // end of struct OpGreater
 
   struct OpGreaterOrEqual {
+    //! \brief operation code used by the bytecode
+    static constexpr ByteCode::OpCode opcode = ByteCode::GREATER_OR_EQUAL;
     static bool apply(const double, const double);
     /*!
      * \brief return a string suitable for integration in a C++
@@ -59,6 +66,8 @@ namespace tfel::math::parser {
   };  // end of struct OpGreaterOrEqual
 
   struct OpLesser {
+    //! \brief operation code used by the bytecode
+    static constexpr ByteCode::OpCode opcode = ByteCode::LESSER;
     static bool apply(const double, const double);
     /*!
      * \brief return a string suitable for integration in a C++
@@ -70,6 +79,8 @@ namespace tfel::math::parser {
   };  // end of struct OpLess
 
   struct OpLesserOrEqual {
+    //! \brief operation code used by the bytecode
+    static constexpr ByteCode::OpCode opcode = ByteCode::LESSER_OR_EQUAL;
     static bool apply(const double, const double);
     /*!
      * \brief return a string suitable for integration in a C++
@@ -81,6 +92,8 @@ namespace tfel::math::parser {
   };  // end of struct OpLessOrEqual
 
   struct OpAnd {
+    //! \brief operation code used by the bytecode
+    static constexpr ByteCode::OpCode opcode = ByteCode::AND;
     static bool apply(const bool, const bool);
     /*!
      * \brief return a string suitable for integration in a C++
@@ -92,6 +105,8 @@ namespace tfel::math::parser {
   };  // end of struct OpAnd
 
   struct OpOr {
+    //! \brief operation code used by the bytecode
+    static constexpr ByteCode::OpCode opcode = ByteCode::OR;
     static bool apply(const bool, const bool);
     /*!
      * \brief return a string suitable for integration in a C++
@@ -108,6 +123,16 @@ namespace tfel::math::parser {
   struct LogicalExpr {
     //! \return the result of the evaluation of the logical expression
     virtual bool getValue() const = 0;
+    /*!
+     * \brief add the instructions evaluating this logical expression to the
+     * given bytecode.
+     * \return the register holding the result of the evaluation (1 if the
+     * expression is true, 0 otherwise)
+     * \param[in,out] c: bytecode
+     * \note the default implementation adds an instruction calling the
+     * `getValue` method.
+     */
+    virtual std::vector<double>::size_type compile(ByteCode&) const;
     //! \brief return if the expression is constant
     virtual bool isConstant() const = 0;
     /*!
@@ -148,6 +173,7 @@ namespace tfel::math::parser {
     bool isConstant() const override;
     bool dependsOnVariable(const std::vector<double>::size_type) const override;
     bool getValue() const override;
+    std::vector<double>::size_type compile(ByteCode&) const override;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     void checkCyclicDependency(std::vector<std::string>&) const override;
     LogicalExprPtr resolveDependencies(
@@ -176,6 +202,7 @@ namespace tfel::math::parser {
     bool isConstant() const override;
     bool dependsOnVariable(const std::vector<double>::size_type) const override;
     bool getValue() const override;
+    std::vector<double>::size_type compile(ByteCode&) const override;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     void checkCyclicDependency(std::vector<std::string>&) const override;
     LogicalExprPtr resolveDependencies(
@@ -202,6 +229,7 @@ namespace tfel::math::parser {
     bool isConstant() const override;
     bool dependsOnVariable(const std::vector<double>::size_type) const override;
     bool getValue() const override;
+    std::vector<double>::size_type compile(ByteCode&) const override;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     void checkCyclicDependency(std::vector<std::string>&) const override;
     LogicalExprPtr resolveDependencies(
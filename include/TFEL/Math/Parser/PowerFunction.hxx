@@ -34,6 +34,7 @@ namespace tfel::math::parser {
      */
     PowerFunction(const std::shared_ptr<Expr>) noexcept;
     double getValue() const override;
+    std::vector<double>::size_type compile(ByteCode&) const override;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     std::shared_ptr<Expr> resolveDependencies(
         const std::vector<double>&) const override;
@@ -50,6 +51,11 @@ namespace tfel::math::parser {
     ~PowerFunction() override;
 
    private:
+    /*!
+     * \return the `N`-th power of the given value
+     * \param[in] arg: value
+     */
+    static double apply(const double);
     PowerFunction& operator=(const PowerFunction&) = delete;
     PowerFunction& operator=(PowerFunction&&) = delete;
   };  // end of struct PowerFunction
@@ -66,6 +72,7 @@ namespace tfel::math::parser {
      */
     GeneralPowerFunction(const std::shared_ptr<Expr>, const int) noexcept;
     double getValue() const override;
+    std::vector<double>::size_type compile(ByteCode&) const override;
     std::string getCxxFormula(const std::vector<std::string>&) const override;
     std::shared_ptr<Expr> resolveDependencies(
         const std::vector<double>&) const override;
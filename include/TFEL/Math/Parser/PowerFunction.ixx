@@ -32,19 +32,35 @@ namespace tfel::math::parser {
       : Function(e) {}  // end of PowerFunction
 
   template <int N>
-  double PowerFunction<N>::getValue() const {
-    if constexpr (N == 0) {
-      return 1;
-    }
-    const auto arg = this->expr->getValue();
+  double PowerFunction<N>::apply(const double arg) {
     if constexpr (N < 0) {
       if (tfel::math::ieee754::fpclassify(arg) == FP_ZERO) {
         FunctionBase::throwInvalidCallException(arg, EINVAL);
       }
     }
     return tfel::math::power<N>(arg);
+  }  // end of apply
+
+  template <int N>
+  double PowerFunction<N>::getValue() const {
+    if constexpr (N == 0) {
+      return 1;
+    }
+    return PowerFunction<N>::apply(this->expr->getValue());
   }  // end of getValue
 
+  template <int N>
+  std::vector<double>::size_type PowerFunction<N>::compile(ByteCode& c) const {
+    if constexpr (N == 0) {
+      return c.addConstant(1);
+    } else if constexpr (N == 1) {
+      return this->expr->compile(c);
+    } else {
+      return c.addUncheckedFunction(&PowerFunction<N>::apply,
+                                    this->expr->compile(c));
+    }
+  }  // end of compile
+
   template <int N>
   std::string PowerFunction<N>::getCxxFormula(
       const std::vector<std::string>& m) const {
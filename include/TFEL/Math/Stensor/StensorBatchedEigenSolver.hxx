@@ -0,0 +1,93 @@
+/*!
+ * \file   include/TFEL/Math/Stensor/StensorBatchedEigenSolver.hxx
+ * \brief  This file declares functions computing the eigenvalues and
+ * the eigenvectors of arrays of three-dimensional symmetric tensors.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_STENSOR_STENSORBATCHEDEIGENSOLVER_HXX
+#define LIB_TFEL_MATH_STENSOR_STENSORBATCHEDEIGENSOLVER_HXX
+
+#include <cstddef>
+#include "TFEL/Math/stensor.hxx"
+
+namespace tfel::math {
+
+  /*!
+   * \brief number of symmetric tensors treated simultaneously by the
+   * batched eigen solvers. The values of a pack fill a 64 bytes cache
+   * line, which matches the widest SIMD registers currently available.
+   * \tparam real: numeric type
+   */
+  template <typename real>
+  inline constexpr std::size_t StensorBatchedEigenSolverPackSize =
+      (sizeof(real) >= 16) ? 4 : 64 / sizeof(real);
+
+  /*!
+   * \brief compute the eigenvalues of an array of three-dimensional
+   * symmetric tensors.
+   *
+   * The tensors are treated by packs of
+   * `StensorBatchedEigenSolverPackSize<real>` tensors. The
+   * `FSESANALYTICALEIGENSOLVER` and `FSESJACOBIEIGENSOLVER` solvers are
+   * implemented so that the tensors of a pack are treated in the lanes
+   * of SIMD registers. The other solvers treat the tensors one by one.
+   *
+   * The eigenvalues are given in the same order than the ones returned
+   * by the `computeEigenValues` method of the `stensor` class for the
+   * same eigen solver (they are not sorted).
+   *
+   * \tparam es: eigen solver
+   * \tparam real: numeric type
+   * \param[out] vp: eigenvalues. This array must contain `3 n` values.
+   * \param[in] s: values of the symmetric tensors, using `TFEL`
+   * conventions. This array must contain `6 n` values.
+   * \param[in] n: number of tensors
+   * \param[in] b: refine eigenvalues. This parameter is only used by
+   * the solvers which support it.
+   */
+  template <stensor_common::EigenSolver = stensor_common::TFELEIGENSOLVER,
+            typename real>
+  void computeBatchedEigenValues(real* const,
+                                 const real* const,
+                                 const std::size_t,
+                                 const bool = false);
+  /*!
+   * \brief compute the eigenvalues and the eigenvectors of an array of
+   * three-dimensional symmetric tensors.
+   *
+   * See `computeBatchedEigenValues` for details.
+   *
+   * \tparam es: eigen solver
+   * \tparam real: numeric type
+   * \param[out] vp: eigenvalues. This array must contain `3 n` values.
+   * \param[out] m: eigenvectors. This array must contain `9 n` values.
+   * The eigenvectors of the `i`-th tensor are stored as the columns of a
+   * \f$3\times 3\f$ matrix in row-major order, as in the `tmatrix`
+   * class, starting at the offset `9 i`.
+   * \param[in] s: values of the symmetric tensors, using `TFEL`
+   * conventions. This array must contain `6 n` values.
+   * \param[in] n: number of tensors
+   * \param[in] b: refine eigenvalues. This parameter is only used by
+   * the solvers which support it.
+   */
+  template <stensor_common::EigenSolver = stensor_common::TFELEIGENSOLVER,
+            typename real>
+  void computeBatchedEigenVectors(real* const,
+                                  real* const,
+                                  const real* const,
+                                  const std::size_t,
+                                  const bool = false);
+
+}  // end of namespace tfel::math
+
+#include "TFEL/Math/Stensor/StensorBatchedEigenSolver.ixx"
+
+#endif /* LIB_TFEL_MATH_STENSOR_STENSORBATCHEDEIGENSOLVER_HXX */
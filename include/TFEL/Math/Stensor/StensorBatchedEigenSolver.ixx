@@ -0,0 +1,560 @@
+/*!
+ * \file   include/TFEL/Math/Stensor/StensorBatchedEigenSolver.ixx
+ * \brief  This file implements functions computing the eigenvalues and
+ * the eigenvectors of arrays of three-dimensional symmetric tensors.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_STENSOR_STENSORBATCHEDEIGENSOLVER_IXX
+#define LIB_TFEL_MATH_STENSOR_STENSORBATCHEDEIGENSOLVER_IXX
+
+#include <cmath>
+#include <array>
+#include <limits>
+#include <algorithm>
+#include "FSES/syevv3.hxx"
+#include "TFEL/Math/tvector.hxx"
+#include "TFEL/Math/tmatrix.hxx"
+#include "TFEL/Math/Stensor/Internals/StensorEigenSolver.hxx"
+
+namespace tfel::math::internals {
+
+  /*!
+   * \brief an helper structure used to compute the eigenvalues and the
+   * eigenvectors of arrays of three-dimensional symmetric tensors.
+   *
+   * By default, the tensors are treated one by one by the
+   * `StensorEigenSolver` class.
+   *
+   * \tparam es: eigen solver
+   * \tparam real: numeric type
+   */
+  template <stensor_common::EigenSolver es, typename real>
+  struct StensorBatchedEigenSolver {
+    /*!
+     * \param[out] vp: eigenvalues
+     * \param[in]  s:  values of the symmetric tensors
+     * \param[in]  n:  number of tensors
+     * \param[in]  b:  refine eigenvalues
+     */
+    static void computeEigenValues(real* const vp,
+                                   const real* const s,
+                                   const std::size_t n,
+                                   const bool b) {
+      using Solver = StensorEigenSolver<es, 3u, real>;
+      for (std::size_t i = 0; i != n; ++i) {
+        Solver::computeEigenValues(vp[3 * i], vp[3 * i + 1], vp[3 * i + 2],
+                                   s + 6 * i, b);
+      }
+    }  // end of computeEigenValues
+    /*!
+     * \param[out] vp: eigenvalues
+     * \param[out] m:  eigenvectors
+     * \param[in]  s:  values of the symmetric tensors
+     * \param[in]  n:  number of tensors
+     * \param[in]  b:  refine eigenvalues
+     */
+    static void computeEigenVectors(real* const vp,
+                                    real* const m,
+                                    const real* const s,
+                                    const std::size_t n,
+                                    const bool b) {
+      using Solver = StensorEigenSolver<es, 3u, real>;
+      auto e = tvector<3u, real>{};
+      auto q = tmatrix<3u, 3u, real>{};
+      for (std::size_t i = 0; i != n; ++i) {
+        Solver::computeEigenVectors(e, q, s + 6 * i, b);
+        for (unsigned short r = 0; r != 3; ++r) {
+          vp[3 * i + r] = e(r);
+          for (unsigned short c = 0; c != 3; ++c) {
+            m[9 * i + 3 * r + c] = q(r, c);
+          }
+        }
+      }
+    }  // end of computeEigenVectors
+  };   // end of struct StensorBatchedEigenSolver
+
+  /*!
+   * \brief an helper structure gathering the tensors of a pack, and
+   * their eigenvalues and eigenvectors, in separate arrays for each
+   * component, so that the loops over the tensors of a pack can be
+   * vectorized by the compiler. Gathering all those arrays in the same
+   * object also allows the compiler to prove that they don't overlap.
+   * \tparam real: numeric type
+   * \tparam N: pack size
+   */
+  template <typename real, std::size_t N>
+  struct StensorBatchedEigenSolverPack {
+    /*!
+     * \brief load the tensors of a pack. If the pack is incomplete, the
+     * unused lanes are filled by null tensors.
+     * \param[in] s: values of the symmetric tensors
+     * \param[in] nb: number of tensors in the pack
+     */
+    void load(const real* const s, const std::size_t nb) {
+      constexpr auto icste = Cste<real>::isqrt2;
+      for (std::size_t l = 0; l != N; ++l) {
+        for (unsigned short c = 0; c != 6; ++c) {
+          this->a[c][l] = (l < nb) ? s[6 * l + c] : real(0);
+        }
+      }
+      for (unsigned short c = 3; c != 6; ++c) {
+        for (std::size_t l = 0; l != N; ++l) {
+          this->a[c][l] *= icste;
+        }
+      }
+    }  // end of load
+    /*!
+     * \brief components of the symmetric matrices associated with the
+     * tensors of the pack: the three first rows are the diagonal
+     * components, the next ones are the components \f$(0,1)\f$,
+     * \f$(0,2)\f$ and \f$(1,2)\f$.
+     */
+    real a[6][N];
+    //! \brief eigenvalues
+    real w[3][N];
+    /*!
+     * \brief eigenvectors, the component `(i,j)` being stored in the row
+     * `3 * i + j`
+     */
+    real v[9][N];
+  };  // end of struct StensorBatchedEigenSolverPack
+
+  /*!
+   * \brief compute the eigenvalues of the tensors of a pack using the
+   * analytical algorithm of Joachim Kopp (see `fses::syevc3`).
+   *
+   * The evaluation of the trigonometric functions is isolated in a
+   * separate loop, so that the two other loops are vectorized even if
+   * no vectorized version of those functions is available.
+   *
+   * \param[in,out] p: pack
+   */
+  template <typename real, std::size_t N>
+  void computeBatchedAnalyticalEigenValues(
+      StensorBatchedEigenSolverPack<real, N>& p) {
+    constexpr auto c_sqrt3 = real(1.73205080756887729352744634151);
+    constexpr auto one_third = real(1) / real(3);
+    constexpr auto c1_4 = real(1) / real(4);
+    constexpr auto c3_2 = real(3) / real(2);
+    constexpr auto c27 = real(27);
+    constexpr auto c27_2 = real(27) / real(2);
+    constexpr auto c27_4 = real(27) / real(4);
+    const auto& a = p.a;
+    auto& w = p.w;
+    real m[N], sqrt_p[N], phi[N], q[N];
+    for (std::size_t l = 0; l != N; ++l) {
+      const auto de = a[3][l] * a[5][l];
+      const auto dd = a[3][l] * a[3][l];
+      const auto ee = a[5][l] * a[5][l];
+      const auto ff = a[4][l] * a[4][l];
+      m[l] = a[0][l] + a[1][l] + a[2][l];
+      const auto c1 =
+          (a[0][l] * a[1][l] + a[0][l] * a[2][l] + a[1][l] * a[2][l]) -
+          (dd + ee + ff);
+      const auto c0 = (a[2][l] * dd + a[0][l] * ee + a[1][l] * ff -
+                       a[0][l] * a[1][l] * a[2][l] - 2 * a[4][l] * de);
+      const auto pl = m[l] * m[l] - 3 * c1;
+      q[l] = m[l] * (pl - c3_2 * c1) - c27_2 * c0;
+      sqrt_p[l] = std::sqrt(std::abs(pl));
+      phi[l] = std::sqrt(std::abs(
+          c27 * (c1_4 * c1 * c1 * (pl - c1) + c0 * (q[l] + c27_4 * c0))));
+    }
+    real c[N], s[N];
+    for (std::size_t l = 0; l != N; ++l) {
+      const auto phil = one_third * std::atan2(phi[l], q[l]);
+      c[l] = std::cos(phil);
+      s[l] = std::sin(phil);
+    }
+    for (std::size_t l = 0; l != N; ++l) {
+      const auto cl = sqrt_p[l] * c[l];
+      const auto sl = (1 / c_sqrt3) * sqrt_p[l] * s[l];
+      const auto w1 = one_third * (m[l] - cl);
+      w[0][l] = w1 + cl;
+      w[1][l] = w1 - sl;
+      w[2][l] = w1 + sl;
+    }
+  }  // end of computeBatchedAnalyticalEigenValues
+
+  /*!
+   * \brief compute the eigenvector associated with the `i`-th
+   * eigenvalue of the tensors of a pack as the cross product of the two
+   * first columns of the shifted matrices (see `fses::syevv3`).
+   *
+   * \return values set to one for the lanes for which the cross
+   * product is not accurate, and to zero otherwise. Those flags are
+   * stored as real values so that the loop is vectorized.
+   * \tparam i: index of the eigenvalue
+   * \param[in,out] p: pack
+   */
+  template <unsigned short i, typename real, std::size_t N>
+  std::array<real, N> computeBatchedAnalyticalEigenVector(
+      StensorBatchedEigenSolverPack<real, N>& p) {
+    constexpr auto ulp = std::numeric_limits<real>::epsilon();
+    constexpr auto c8ulp = 8 * ulp;
+    constexpr auto c64ulp2 = (64 * ulp) * (64 * ulp);
+    const auto& a = p.a;
+    const auto& w = p.w;
+    auto& v = p.v;
+    auto special = std::array<real, N>{};
+    for (std::size_t l = 0; l != N; ++l) {
+      const auto wmax = std::max(
+          std::max(std::abs(w[0][l]), std::abs(w[1][l])), std::abs(w[2][l]));
+      const auto thresh = (c8ulp * wmax) * (c8ulp * wmax);
+      const auto b00 = a[0][l] - w[i][l];
+      const auto b11 = a[1][l] - w[i][l];
+      const auto v0 =
+          a[3][l] * a[5][l] - a[4][l] * a[1][l] + a[4][l] * w[i][l];
+      const auto v1 =
+          a[4][l] * a[3][l] - a[5][l] * a[0][l] + a[5][l] * w[i][l];
+      const auto v2 = b00 * b11 - a[3][l] * a[3][l];
+      const auto nv = v0 * v0 + v1 * v1 + v2 * v2;
+      const auto n0 = a[3][l] * a[3][l] + a[4][l] * a[4][l] + b00 * b00;
+      const auto n1 = a[3][l] * a[3][l] + a[5][l] * a[5][l] + b11 * b11;
+      const auto b =
+          (n0 <= thresh) | (n1 <= thresh) | (nv < c64ulp2 * n0 * n1);
+      special[l] = b ? real(1) : real(0);
+      const auto inv = std::sqrt(real(1) / (b ? real(1) : nv));
+      v[i][l] = v0 * inv;
+      v[3 + i][l] = v1 * inv;
+      v[6 + i][l] = v2 * inv;
+    }
+    return special;
+  }  // end of computeBatchedAnalyticalEigenVector
+
+  /*!
+   * \brief compute the eigenvalues and the eigenvectors of the tensors
+   * of a pack using the analytical algorithm of Joachim Kopp (see
+   * `fses::syevv3`).
+   *
+   * The eigenvectors are computed as the cross product of two columns
+   * of the shifted matrices in every lanes. The lanes for which this
+   * formula is not accurate (degenerate eigenvalues, nearly colinear
+   * columns, etc.) are flagged and treated afterwards by the scalar
+   * version of the algorithm.
+   *
+   * \param[in,out] p: pack
+   * \param[in] nb: number of tensors in the pack
+   */
+  template <typename real, std::size_t N>
+  void computeBatchedAnalyticalEigenVectors(
+      StensorBatchedEigenSolverPack<real, N>& p, const std::size_t nb) {
+    constexpr auto c8ulp = 8 * std::numeric_limits<real>::epsilon();
+    const auto& a = p.a;
+    auto& w = p.w;
+    auto& v = p.v;
+    computeBatchedAnalyticalEigenValues(p);
+    // lanes with degenerate eigenvalues are treated by the scalar solver
+    bool fallback[N];
+    for (std::size_t l = 0; l != N; ++l) {
+      const auto wmax = std::max(std::max(std::abs(w[0][l]), std::abs(w[1][l])),
+                                 std::abs(w[2][l]));
+      fallback[l] = !(std::abs(w[0][l] - w[1][l]) > c8ulp * wmax);
+    }
+    const auto special0 = computeBatchedAnalyticalEigenVector<0>(p);
+    const auto special1 = computeBatchedAnalyticalEigenVector<1>(p);
+    for (std::size_t l = 0; l != N; ++l) {
+      fallback[l] = fallback[l] | (special0[l] > 0) | (special1[l] > 0);
+    }
+    // third eigenvector, v[2] = v[0] x v[1]
+    for (std::size_t l = 0; l != N; ++l) {
+      v[2][l] = v[3][l] * v[7][l] - v[6][l] * v[4][l];
+      v[5][l] = v[6][l] * v[1][l] - v[0][l] * v[7][l];
+      v[8][l] = v[0][l] * v[4][l] - v[3][l] * v[1][l];
+    }
+    // treatment of the flagged lanes
+    for (std::size_t l = 0; l != nb; ++l) {
+      if (!fallback[l]) {
+        continue;
+      }
+      auto sm = tmatrix<3u, 3u, real>{a[0][l], a[3][l], a[4][l],  //
+                                      a[3][l], a[1][l], a[5][l],  //
+                                      a[4][l], a[5][l], a[2][l]};
+      auto vp = tvector<3u, real>{};
+      auto q = tmatrix<3u, 3u, real>{};
+      fses::syevv3(q, vp, sm);
+      for (unsigned short r = 0; r != 3; ++r) {
+        w[r][l] = vp(r);
+        for (unsigned short c = 0; c != 3; ++c) {
+          v[3 * r + c][l] = q(r, c);
+        }
+      }
+    }
+  }  // end of computeBatchedAnalyticalEigenVectors
+
+  /*!
+   * \brief apply a Jacobi rotation to the tensors of a pack to cancel
+   * their component \f$(p,q)\f$ (see `fses::syevj3`).
+   *
+   * The Jacobi rotations are computed without branches and reduce to
+   * the identity in the lanes where no rotation is required. The indices
+   * are template parameters so that the compiler only sees accesses to
+   * fixed rows of the pack, which is required to vectorize the loop.
+   *
+   * \tparam computeEigenVectors: update the eigenvectors
+   * \tparam ip: index \f$p\f$
+   * \tparam iq: index \f$q\f$
+   * \tparam ipq: row of the pack storing the component \f$(p,q)\f$
+   * \tparam irp: row of the pack storing the component \f$(r,p)\f$,
+   * \f$r\f$ being the third index
+   * \tparam irq: row of the pack storing the component \f$(r,q)\f$
+   * \param[in,out] p: pack
+   * \param[in] thresh: threshold below which no rotation is made
+   * \param[in] annihilate_small_terms: cancel the component \f$(p,q)\f$
+   * if it is negligible compared to the diagonal components
+   */
+  template <bool computeEigenVectors,
+            unsigned short ip,
+            unsigned short iq,
+            unsigned short ipq,
+            unsigned short irp,
+            unsigned short irq,
+            typename real,
+            std::size_t N>
+  void applyBatchedJacobiRotation(StensorBatchedEigenSolverPack<real, N>& p,
+                                  const std::array<real, N> thresh,
+                                  const bool annihilate_small_terms) {
+    constexpr auto eps = std::numeric_limits<real>::epsilon();
+    constexpr auto zero = real(0);
+    constexpr auto one = real(1);
+    constexpr auto one_half = one / 2;
+    constexpr auto c100 = real(100);
+    auto& a = p.a;
+    auto& w = p.w;
+    auto& v = p.v;
+    for (std::size_t l = 0; l != N; ++l) {
+      const auto apq = a[ipq][l];
+      const auto g = c100 * std::abs(apq);
+      // the conditions are combined with bitwise operators and all the
+      // operations are evaluated in every lanes, so that this loop does
+      // not contain any branch
+      const auto annihilate = annihilate_small_terms &
+                              (g < std::abs(w[ip][l]) * eps) &
+                              (g < std::abs(w[iq][l]) * eps);
+      const auto rotate = (!annihilate) & (std::abs(apq) > thresh[l]);
+      const auto h = w[iq][l] - w[ip][l];
+      const auto small = g < std::abs(h) * eps;
+      // the denominators are replaced by one in the lanes where the
+      // associated quotients are not used
+      const auto use_theta = rotate & (!small);
+      const auto use_t3 = rotate & small;
+      const auto theta0 = one_half * h / (use_theta ? apq : one);
+      const auto theta = use_theta ? theta0 : zero;
+      const auto t1 = one / (std::abs(theta) + std::sqrt(one + theta * theta));
+      const auto t2 = (theta < zero) ? -t1 : t1;
+      const auto t3 = apq / (use_t3 ? h : one);
+      const auto t = rotate ? (small ? t3 : t2) : zero;
+      const auto c = one / std::sqrt(one + t * t);
+      const auto s = t * c;
+      const auto z = t * apq;
+      a[ipq][l] = (rotate | annihilate) ? zero : apq;
+      w[ip][l] -= z;
+      w[iq][l] += z;
+      auto rotate_components = [c, s](real& x, real& y) {
+        const auto x0 = x;
+        x = c * x0 - s * y;
+        y = s * x0 + c * y;
+      };
+      rotate_components(a[irp][l], a[irq][l]);
+      if constexpr (computeEigenVectors) {
+        rotate_components(v[ip][l], v[iq][l]);
+        rotate_components(v[3 + ip][l], v[3 + iq][l]);
+        rotate_components(v[6 + ip][l], v[6 + iq][l]);
+      }
+    }
+  }  // end of applyBatchedJacobiRotation
+
+  /*!
+   * \brief compute the eigenvalues, and optionally the eigenvectors, of
+   * the tensors of a pack using the Jacobi algorithm of Joachim Kopp
+   * (see `fses::syevj3`).
+   *
+   * The tensors of the pack are treated in lockstep and the sweeps are
+   * stopped when all the lanes have converged. The results are the
+   * same as the ones of the scalar version of the algorithm.
+   *
+   * \tparam computeEigenVectors: compute the eigenvectors
+   * \param[in,out] p: pack. The components of the tensors are modified
+   * by this function.
+   */
+  template <bool computeEigenVectors, typename real, std::size_t N>
+  void computeBatchedJacobiEigenVectors(
+      StensorBatchedEigenSolverPack<real, N>& p) {
+    constexpr auto zero = real(0);
+    constexpr auto one = real(1);
+    constexpr auto c1_5 = one / 5;
+    auto& a = p.a;
+    auto& w = p.w;
+    auto& v = p.v;
+    for (unsigned short i = 0; i != 3; ++i) {
+      for (std::size_t l = 0; l != N; ++l) {
+        w[i][l] = a[i][l];
+      }
+    }
+    if constexpr (computeEigenVectors) {
+      for (unsigned short i = 0; i != 9; ++i) {
+        for (std::size_t l = 0; l != N; ++l) {
+          v[i][l] = (i % 4 == 0) ? one : zero;
+        }
+      }
+    }
+    auto thresh = std::array<real, N>{};
+    for (int iter = 0; iter < 50; ++iter) {
+      // test for convergence
+      auto somax = zero;
+      for (std::size_t l = 0; l != N; ++l) {
+        const auto so =
+            std::abs(a[3][l]) + std::abs(a[4][l]) + std::abs(a[5][l]);
+        thresh[l] = (iter < 4) ? c1_5 * so / 9 : zero;
+        somax = std::max(somax, so);
+      }
+      if (std::fpclassify(somax) == FP_ZERO) {
+        return;
+      }
+      // sweep over the pairs (0,1), (0,2) and (1,2)
+      applyBatchedJacobiRotation<computeEigenVectors, 0, 1, 3, 4, 5>(
+          p, thresh, iter > 4);
+      applyBatchedJacobiRotation<computeEigenVectors, 0, 2, 4, 3, 5>(
+          p, thresh, iter > 4);
+      applyBatchedJacobiRotation<computeEigenVectors, 1, 2, 5, 3, 4>(
+          p, thresh, iter > 4);
+    }
+  }  // end of computeBatchedJacobiEigenVectors
+
+  /*!
+   * \brief partial specialisation of the `StensorBatchedEigenSolver`
+   * class for the `FSESANALYTICALEIGENSOLVER` solver
+   * \tparam real: numeric type
+   */
+  template <typename real>
+  struct StensorBatchedEigenSolver<stensor_common::FSESANALYTICALEIGENSOLVER,
+                                   real> {
+    //! \brief pack size
+    static constexpr auto N = StensorBatchedEigenSolverPackSize<real>;
+    //! \copydoc StensorBatchedEigenSolver::computeEigenValues
+    static void computeEigenValues(real* const vp,
+                                   const real* const s,
+                                   const std::size_t n,
+                                   const bool) {
+      auto p = StensorBatchedEigenSolverPack<real, N>{};
+      for (std::size_t i = 0; i < n; i += N) {
+        const auto nb = std::min(N, n - i);
+        p.load(s + 6 * i, nb);
+        computeBatchedAnalyticalEigenValues(p);
+        for (std::size_t l = 0; l != nb; ++l) {
+          for (unsigned short r = 0; r != 3; ++r) {
+            vp[3 * (i + l) + r] = p.w[r][l];
+          }
+        }
+      }
+    }  // end of computeEigenValues
+    //! \copydoc StensorBatchedEigenSolver::computeEigenVectors
+    static void computeEigenVectors(real* const vp,
+                                    real* const m,
+                                    const real* const s,
+                                    const std::size_t n,
+                                    const bool) {
+      auto p = StensorBatchedEigenSolverPack<real, N>{};
+      for (std::size_t i = 0; i < n; i += N) {
+        const auto nb = std::min(N, n - i);
+        p.load(s + 6 * i, nb);
+        computeBatchedAnalyticalEigenVectors(p, nb);
+        for (std::size_t l = 0; l != nb; ++l) {
+          for (unsigned short r = 0; r != 3; ++r) {
+            vp[3 * (i + l) + r] = p.w[r][l];
+          }
+          for (unsigned short c = 0; c != 9; ++c) {
+            m[9 * (i + l) + c] = p.v[c][l];
+          }
+        }
+      }
+    }  // end of computeEigenVectors
+  };   // end of struct StensorBatchedEigenSolver
+
+  /*!
+   * \brief partial specialisation of the `StensorBatchedEigenSolver`
+   * class for the `FSESJACOBIEIGENSOLVER` solver
+   * \tparam real: numeric type
+   */
+  template <typename real>
+  struct StensorBatchedEigenSolver<stensor_common::FSESJACOBIEIGENSOLVER,
+                                   real> {
+    //! \brief pack size
+    static constexpr auto N = StensorBatchedEigenSolverPackSize<real>;
+    //! \copydoc StensorBatchedEigenSolver::computeEigenValues
+    static void computeEigenValues(real* const vp,
+                                   const real* const s,
+                                   const std::size_t n,
+                                   const bool) {
+      auto p = StensorBatchedEigenSolverPack<real, N>{};
+      for (std::size_t i = 0; i < n; i += N) {
+        const auto nb = std::min(N, n - i);
+        p.load(s + 6 * i, nb);
+        computeBatchedJacobiEigenVectors<false>(p);
+        for (std::size_t l = 0; l != nb; ++l) {
+          for (unsigned short r = 0; r != 3; ++r) {
+            vp[3 * (i + l) + r] = p.w[r][l];
+          }
+        }
+      }
+    }  // end of computeEigenValues
+    //! \copydoc StensorBatchedEigenSolver::computeEigenVectors
+    static void computeEigenVectors(real* const vp,
+                                    real* const m,
+                                    const real* const s,
+                                    const std::size_t n,
+                                    const bool) {
+      auto p = StensorBatchedEigenSolverPack<real, N>{};
+      for (std::size_t i = 0; i < n; i += N) {
+        const auto nb = std::min(N, n - i);
+        p.load(s + 6 * i, nb);
+        computeBatchedJacobiEigenVectors<true>(p);
+        for (std::size_t l = 0; l != nb; ++l) {
+          for (unsigned short r = 0; r != 3; ++r) {
+            vp[3 * (i + l) + r] = p.w[r][l];
+          }
+          for (unsigned short c = 0; c != 9; ++c) {
+            m[9 * (i + l) + c] = p.v[c][l];
+          }
+        }
+      }
+    }  // end of computeEigenVectors
+  };   // end of struct StensorBatchedEigenSolver
+
+}  // end of namespace tfel::math::internals
+
+namespace tfel::math {
+
+  template <stensor_common::EigenSolver es, typename real>
+  void computeBatchedEigenValues(real* const vp,
+                                 const real* const s,
+                                 const std::size_t n,
+                                 const bool b) {
+    static_assert(tfel::typetraits::IsReal<real>::cond,
+                  "invalid numeric type");
+    internals::StensorBatchedEigenSolver<es, real>::computeEigenValues(vp, s,
+                                                                       n, b);
+  }  // end of computeBatchedEigenValues
+
+  template <stensor_common::EigenSolver es, typename real>
+  void computeBatchedEigenVectors(real* const vp,
+                                  real* const m,
+                                  const real* const s,
+                                  const std::size_t n,
+                                  const bool b) {
+    static_assert(tfel::typetraits::IsReal<real>::cond,
+                  "invalid numeric type");
+    internals::StensorBatchedEigenSolver<es, real>::computeEigenVectors(
+        vp, m, s, n, b);
+  }  // end of computeBatchedEigenVectors
+
+}  // end of namespace tfel::math
+
+#endif /* LIB_TFEL_MATH_STENSOR_STENSORBATCHEDEIGENSOLVER_IXX */
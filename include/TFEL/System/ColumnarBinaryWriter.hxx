@@ -0,0 +1,81 @@
+/*!
+ * \file   include/TFEL/System/ColumnarBinaryWriter.hxx
+ * \brief  This file declares the ColumnarBinaryWriter class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_SYSTEM_COLUMNARBINARYWRITER_HXX
+#define LIB_TFEL_SYSTEM_COLUMNARBINARYWRITER_HXX
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include "TFEL/Config/TFELConfig.hxx"
+#include "TFEL/System/wfstream.hxx"
+
+namespace tfel::system {
+
+  /*!
+   * \brief a class writing rows of values in a file using the columnar
+   * binary format described in `TFEL/Utilities/ColumnarBinaryFormat.hxx`.
+   *
+   * The rows are stored in a buffer, which is written in the file as a
+   * block when it is full, when the `flush` method is called or when
+   * the writer is destroyed. Those files can be read by the
+   * `ColumnarBinaryData` and `TextData` classes.
+   */
+  struct TFELSYSTEM_VISIBILITY_EXPORT ColumnarBinaryWriter {
+    /*!
+     * \brief constructor
+     * \param[in] f: file name
+     * \param[in] c: names of the columns
+     * \param[in] n: number of rows per block
+     */
+    ColumnarBinaryWriter(const std::string&,
+                         const std::vector<std::string>&,
+                         const std::size_t = 1024);
+    //! \return the number of columns
+    std::size_t getNumberOfColumns() const;
+    /*!
+     * \brief add a row
+     * \param[in] v: values of the row. This array must contain as many
+     * values as columns.
+     */
+    void write(const double* const);
+    /*!
+     * \brief add a row
+     * \param[in] v: values of the row
+     */
+    void write(const std::vector<double>&);
+    //! \brief write the rows stored in the buffer
+    void flush();
+    //! \brief destructor
+    ~ColumnarBinaryWriter();
+
+   private:
+    ColumnarBinaryWriter(ColumnarBinaryWriter&&) = delete;
+    ColumnarBinaryWriter(const ColumnarBinaryWriter&) = delete;
+    ColumnarBinaryWriter& operator=(ColumnarBinaryWriter&&) = delete;
+    ColumnarBinaryWriter& operator=(const ColumnarBinaryWriter&) = delete;
+    //! \brief output file
+    wfstream file;
+    //! \brief values of the current block, stored column after column
+    std::vector<double> buffer;
+    //! \brief number of columns
+    std::size_t ncolumns;
+    //! \brief maximum number of rows per block
+    std::size_t block_size;
+    //! \brief number of rows in the buffer
+    std::size_t nrows = 0;
+  };  // end of struct ColumnarBinaryWriter
+
+}  // end of namespace tfel::system
+
+#endif /* LIB_TFEL_SYSTEM_COLUMNARBINARYWRITER_HXX */
@@ -72,6 +72,7 @@ typedef mfront_gmp_MaterialPropertyPtr GenericMaterialPropertyPtr;
 
 // forward declaration
 typedef struct mfront_gb_BehaviourData mfront_gb_BehaviourData;
+typedef struct mfront_gb_BatchBehaviourData mfront_gb_BatchBehaviourData;
 
 #ifdef __cplusplus
 }
@@ -367,6 +368,9 @@ namespace tfel::system {
   typedef int(TFEL_ADDCALL_PTR GenericBehaviourFctPtr)(
       ::mfront_gb_BehaviourData *const);
   //! \brief a simple alias.
+  typedef int(TFEL_ADDCALL_PTR GenericBehaviourBatchFctPtr)(
+      ::mfront_gb_BatchBehaviourData *const);
+  //! \brief a simple alias.
   typedef int(TFEL_ADDCALL_PTR GenericBehaviourInitializeFunctionPtr)(
       ::mfront_gb_BehaviourData *const, const ::mfront_gb_real *const);
   //! \brief a simple alias.
@@ -15,6 +15,10 @@
 #define LIB_TFEL_SYSTEM_EXTERNALLIBRARYMANAGER_HXX
 
 #include <map>
+#include <tuple>
+#include <functional>
+#include <mutex>
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -31,6 +35,9 @@
 
 namespace tfel::system {
 
+  // forward declaration
+  struct ExternalBehaviourDescription;
+
   /*!
    * \brief Structure in charge of loading external function and
    * retrieving information from shared libraries.
@@ -53,10 +60,52 @@ namespace tfel::system {
 #else
     void* loadLibrary(const std::string&, const bool = false);
 #endif /* LIB_EXTERNALLIBRARYMANAGER_HXX */
-       /*!
-        * \return the path of a library
-        * \param[in] l: library name
-        */
+    /*!
+     * \brief unload a library and load it again.
+     *
+     * The symbols resolved in this library and the descriptions of
+     * the behaviours it contains are removed from the caches of this
+     * class.
+     *
+     * \param[in] name: name of the library
+     * \note the pointers to functions or data previously retrieved from
+     * this library must not be used after this call.
+     */
+    void reloadLibrary(const std::string&);
+    /*!
+     * \return the address of a symbol in a library
+     * \param[in] lib: library
+     * \param[in] s: symbol
+     * \note the results of the resolutions, including the undefined
+     * symbols, are cached until the library is reloaded. A null pointer
+     * is returned if the symbol is not defined. In this case, the error
+     * reported by the system at the first resolution of the symbol is
+     * reported again by the error messages of this class.
+     */
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+    void* getSymbolAddress(HINSTANCE__* const, const char* const);
+#else
+    void* getSymbolAddress(void* const, const char* const);
+#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+    /*!
+     * \return the description of a behaviour for the given modelling
+     * hypothesis
+     *
+     * The description is built at the first call and cached until the
+     * library is reloaded.
+     *
+     * \param[in] l: library
+     * \param[in] f: function
+     * \param[in] h: modelling hypothesis
+     */
+    std::shared_ptr<const ExternalBehaviourDescription>
+    getExternalBehaviourDescription(const std::string&,
+                                    const std::string&,
+                                    const std::string&);
+    /*!
+     * \return the path of a library
+     * \param[in] l: library name
+     */
     std::string getLibraryPath(const std::string&);
     /*!
      * \return the list of all mfront generated entry points
@@ -550,6 +599,22 @@ namespace tfel::system {
      */
     GenericBehaviourFctPtr getGenericBehaviourFunction(const std::string&,
                                                        const std::string&);
+    /*!
+     * \return true if the given library exports a function integrating a
+     * block of integration points for the given behaviour function.
+     * \param[in] l: name of the library
+     * \param[in] f: function name
+     */
+    bool hasGenericBehaviourBatchFunction(const std::string&,
+                                          const std::string&);
+    /*!
+     * \return the function integrating a block of integration points
+     * associated with the given behaviour function.
+     * \param[in] l: name of the library
+     * \param[in] f: function name
+     */
+    GenericBehaviourBatchFctPtr getGenericBehaviourBatchFunction(
+        const std::string&, const std::string&);
     /*!
      * \return the post-processings associated with a behaviour generated
      * through the `generic` interface.
@@ -1440,11 +1505,44 @@ namespace tfel::system {
                                             const std::string&,
                                             const std::string&);
 
+    /*!
+     * \brief mutex protecting the list of loaded libraries and the cache
+     * of resolved symbols
+     */
+    std::mutex librairies_mutex;
+    //! \brief result of the resolution of a symbol
+    struct ResolvedSymbol {
+      //! \brief address of the symbol, null if the symbol is undefined
+      void* address;
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+      //! \brief error code reported by the system if the symbol is
+      //! undefined
+      unsigned long error;
+#else
+      //! \brief error message reported by the system if the symbol is
+      //! undefined
+      std::string error;
+#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+    };
 #if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
     std::map<std::string, HINSTANCE__*> librairies;
+    //! \brief resolved symbols, sorted by library
+    std::map<HINSTANCE__*,
+             std::map<std::string, ResolvedSymbol, std::less<>>>
+        symbols;
 #else
     std::map<std::string, void*> librairies;
+    //! \brief resolved symbols, sorted by library
+    std::map<void*, std::map<std::string, ResolvedSymbol, std::less<>>>
+        symbols;
 #endif /* LIB_EXTERNALLIBRARYMANAGER_HXX */
+    //! \brief mutex protecting the cache of behaviours' descriptions
+    std::mutex descriptions_mutex;
+    //! \brief descriptions of behaviours, sorted by library, function and
+    //! hypothesis
+    std::map<std::tuple<std::string, std::string, std::string>,
+             std::shared_ptr<const ExternalBehaviourDescription>>
+        descriptions;
 
   };  // end of struct LibraryManager
 
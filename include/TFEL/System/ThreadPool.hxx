@@ -7,6 +7,10 @@
  * We added the possibility to handle exceptions through the
  * ThreadedTaskResult class.
  *
+ * Each worker now owns a double-ended queue of tasks: a worker
+ * treats the most recent tasks of its own queue first and steals the
+ * oldest tasks of the other queues when its own queue is empty.
+ *
  * \author Thomas Helfer
  * \date   19 juin 2016
  * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
@@ -20,8 +24,10 @@
 #ifndef TFEL_SYSTEM_THREAD_POOL_HXX
 #define TFEL_SYSTEM_THREAD_POOL_HXX
 
-#include <queue>
+#include <deque>
 #include <mutex>
+#include <atomic>
+#include <memory>
 #include <vector>
 #include <thread>
 #include <future>
@@ -38,11 +44,31 @@ namespace tfel::system {
   struct TFELSYSTEM_VISIBILITY_EXPORT ThreadPool {
     //! a simple alias
     using size_type = std::vector<std::thread>::size_type;
+    //! \brief policy used to bind the threads to the processors
+    enum PinningPolicy {
+      //! \brief the threads are not bound to specific processors
+      NO_PINNING,
+      /*!
+       * \brief the i-th thread is bound to the i-th processor available to
+       * the process (modulo the number of available processors)
+       */
+      PIN_TO_PROCESSORS
+    };  // end of enum PinningPolicy
     /*!
      * \brief constructor
      * \param[in] n: number of thread to be created
+     * \param[in] p: pinning policy
+     */
+    ThreadPool(const size_type, const PinningPolicy = NO_PINNING);
+    /*!
+     * \brief constructor
+     * \param[in] processors: list of processors. One thread is created per
+     * processor and bound to it.
+     *
+     * \note thread pinning is only supported on `Linux`. On other systems,
+     * the threads are not bound.
      */
-    ThreadPool(const size_type);
+    ThreadPool(const std::vector<size_type>&);
     /*!
      * \brief add a new task
      * \param[in] f: task
@@ -51,6 +77,28 @@ namespace tfel::system {
     template <typename F, typename... Args>
     std::future<ThreadedTaskResult<typename std::result_of<F(Args...)>::type>>
     addTask(F&&, Args&&...);
+    /*!
+     * \brief execute the given function on the range `[b, e[`
+     *
+     * The range is divided in blocks of `g` indices. The workers and the
+     * calling thread treat those blocks until the range is exhausted. No
+     * future is created for the blocks.
+     *
+     * If the function is callable with two indices, it is called once per
+     * block with the bounds of the block. Otherwise, it is called for each
+     * index of the range.
+     *
+     * \param[in] b: first index
+     * \param[in] e: index past the last index
+     * \param[in] g: grain size, i.e. number of indices per block
+     * \param[in] f: function
+     *
+     * \note the first exception thrown by the function is rethrown once all
+     * the blocks being treated are finished. The remaining blocks are not
+     * treated.
+     */
+    template <typename Index, typename F>
+    void parallel_for(const Index, const Index, const Index, F&&);
     //! \return the number of threads managed by the ppol
     size_type getNumberOfThreads() const;
     //! \brief wait for all tasks to be finished
@@ -62,17 +110,62 @@ namespace tfel::system {
     //! wrapper around the given task
     template <typename F>
     struct Wrapper;
-    //! enum describing the status of workers
-    enum Status { WORKING, IDLE };  // end of enum Status
-    std::vector<Status> statuses;
+    //! \brief queue of tasks associated with a worker
+    struct WorkQueue;
+    /*!
+     * \brief create the workers
+     * \param[in] processors: processors to which the workers are bound.
+     */
+    void createWorkers(const std::vector<int>&);
+    /*!
+     * \brief add a task in one of the queues
+     * \param[in] t: task
+     */
+    void push(std::function<void()>);
+    /*!
+     * \brief retrieve a task, from the given queue first, then from the
+     * other queues
+     * \param[out] t: task
+     * \param[in] i: index of the queue to be checked first
+     * \return true if a task was found
+     */
+    bool pop(std::function<void()>&, const size_type);
+    /*!
+     * \brief execute a task, if any, and notify the end of the task
+     * \param[in] i: index of the queue to be checked first
+     * \return true if a task was executed
+     */
+    bool runPendingTask(const size_type);
+    //! \brief notify that a task is finished
+    void finishTask();
+    /*!
+     * \brief execute the given number of blocks
+     * \param[in] n: number of blocks
+     * \param[in] f: function treating a block
+     * \param[in] ctx: context passed to `f`
+     */
+    void executeBlocks(const size_type,
+                       void (*)(const void*, const size_type),
+                       const void*);
+    //! \brief queues of tasks, one per worker
+    std::vector<std::unique_ptr<WorkQueue>> queues;
     //! list of available threads
     std::vector<std::thread> workers;
-    // the task queue
-    std::queue<std::function<void()>> tasks;
+    //! \brief number of tasks stored in the queues
+    std::atomic<size_type> queued_tasks{0};
+    //! \brief number of tasks added and not finished
+    std::atomic<size_type> unfinished_tasks{0};
+    //! \brief index of the next queue used to add a task
+    std::atomic<size_type> next_queue{0};
     // synchronization
     std::mutex m;
+    //! \brief condition variable used to wake up the workers
     std::condition_variable c;
-    bool stop = false;
+    //! \brief condition variable used to signal that all tasks are finished
+    std::condition_variable finished;
+    //! \brief number of workers waiting for a task
+    std::atomic<size_type> sleeping_workers{0};
+    std::atomic<bool> stop{false};
   };
 
 }  // end of namespace tfel::system
@@ -15,6 +15,7 @@
 #define TFEL_SYSTEM_THREAD_POOL_IXX
 
 #include <memory>
+#include <algorithm>
 #include <type_traits>
 
 namespace tfel::system {
@@ -68,20 +69,45 @@ namespace tfel::system {
     auto t = std::make_shared<task>(
         std::bind(Wrapper<F>(std::forward<F>(f)), std::forward<Args>(a)...));
     auto res = t->get_future();
-    {
-      std::unique_lock<std::mutex> lock(this->m);
-      // don't allow enqueueing after stopping the pool
-      if (this->stop) {
-        throw std::runtime_error(
-            "ThreadPool::addTask: "
-            "enqueue on stopped ThreadPool");
-      }
-      this->tasks.emplace([t] { (*t)(); });
-    }
-    this->c.notify_one();
+    this->push([t] { (*t)(); });
     return res;
   }
 
+  template <typename Index, typename F>
+  void ThreadPool::parallel_for(const Index b,
+                                const Index e,
+                                const Index g,
+                                F&& f) {
+    static_assert(std::is_integral_v<Index>, "invalid index type");
+    if (e <= b) {
+      return;
+    }
+    const auto n = static_cast<size_type>(e - b);
+    const auto grain = (g > 0) ? static_cast<size_type>(g) : size_type{1};
+    const auto nblocks = (n + grain - 1) / grain;
+    auto block = [&f, b, n, grain](const size_type i) {
+      const auto bb = b + static_cast<Index>(i * grain);
+      const auto be = b + static_cast<Index>(std::min(n, (i + 1) * grain));
+      if constexpr (std::is_invocable_v<F&, const Index, const Index>) {
+        f(bb, be);
+      } else {
+        for (auto idx = bb; idx != be; ++idx) {
+          f(idx);
+        }
+      }
+    };
+    // the block function is passed through a plain function pointer rather
+    // than a std::function: this avoids an indirection and the deduction of
+    // its exception specification
+    using Block = decltype(block);
+    this->executeBlocks(
+        nblocks,
+        [](const void* const ctx, const size_type i) {
+          (*static_cast<const Block*>(ctx))(i);
+        },
+        &block);
+  }  // end of parallel_for
+
 }  // end of namespace tfel::system
 
 #endif /* TFEL_SYSTEM_THREAD_POOL_IXX */
@@ -28,6 +28,16 @@ typedef void* LibraryHandlerPtr;
 extern "C" {
 #endif /* __cplusplus */
 
+/*!
+ * \brief return the address of a symbol. Resolved symbols are cached
+ * by the `ExternalLibraryManager` class.
+ * \param l: link to library opened through dlopen
+ * \param s: name of the symbol
+ * \return the address of the symbol or a null pointer if the symbol is
+ * not defined.
+ */
+void* tfel_getSymbolAddress(LibraryHandlerPtr, const char* const);
+
 /*!
  * \brief this function returns true if the given behaviour requires
  * an offset for the elastic properties.
@@ -110,6 +120,17 @@ double(TFEL_ADDCALL_PTR tfel_getGenericMaterialProperty(
 int(TFEL_ADDCALL_PTR tfel_getGenericBehaviourFunction(LibraryHandlerPtr,
                                                       const char* const))(
     struct mfront_gb_BehaviourData* const);
+/*!
+ * \brief return a function generated by the generic behaviour interface
+ * integrating a block of integration points.
+ * \param l: library handler
+ * \param f: function name
+ * \return the searched function pointer if the call succeed, the NULL pointer
+ * if not.
+ */
+int(TFEL_ADDCALL_PTR tfel_getGenericBehaviourBatchFunction(LibraryHandlerPtr,
+                                                           const char* const))(
+    struct mfront_gb_BatchBehaviourData* const);
 /*!
  * \brief return a function generated by the generic behaviour interface
  * associated with an initialize functions.
@@ -15,12 +15,13 @@
 #define LIB_TFEL_TESTS_TESTOUTPUT_HXX 1
 
 #include <string>
+#include "TFEL/Config/TFELConfig.hxx"
 #include "TFEL/Tests/TestResult.hxx"
 
 namespace tfel::tests {
 
   //! \brief base class for tests' outputs
-  struct TestOutput {
+  struct TFELTESTS_VISIBILITY_EXPORT TestOutput {
     /*!
      * \brief begin a new test suite
      * \param[in] n: name of the test suite
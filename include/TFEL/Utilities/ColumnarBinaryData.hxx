@@ -0,0 +1,158 @@
+/*!
+ * \file   include/TFEL/Utilities/ColumnarBinaryData.hxx
+ * \brief  This file declares the ColumnarBinaryData class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_UTILITIES_COLUMNARBINARYDATA_HXX
+#define LIB_TFEL_UTILITIES_COLUMNARBINARYDATA_HXX
+
+#include <memory>
+#include <vector>
+#include <string>
+#include <cstddef>
+#include "TFEL/Config/TFELConfig.hxx"
+
+namespace tfel::utilities {
+
+  /*!
+   * \brief class in charge of reading data in a file using the columnar
+   * binary format described in `TFEL/Utilities/ColumnarBinaryFormat.hxx`.
+   *
+   * The file is memory-mapped on POSIX systems and the values of the
+   * columns are accessed in place through column views, without any
+   * copy. The values of a block are only copied if they are not
+   * suitably aligned, which only happens for files using the first
+   * version of the format. As in the `TextData` class, columns are
+   * numbered starting from 1.
+   */
+  struct TFELUTILITIES_VISIBILITY_EXPORT ColumnarBinaryData {
+    //! a simple alias
+    using size_type = std::size_t;
+    /*!
+     * \brief a read-only view of the values of a column.
+     *
+     * The values of a column are stored contiguously in each block of
+     * the file, so a view is made of one segment per block. A view is
+     * only valid during the lifetime of the `ColumnarBinaryData` object
+     * which created it.
+     */
+    struct TFELUTILITIES_VISIBILITY_EXPORT ColumnView {
+      //! \brief contiguous values of the column in a block
+      struct Segment {
+        //! \brief index of the first row of the segment
+        size_type first;
+        //! \brief number of values
+        size_type size;
+        //! \brief values
+        const double* values;
+      };
+      //! \return the number of values
+      size_type size() const;
+      /*!
+       * \return the value of the given row
+       * \param[in] i: row index, starting from 0
+       */
+      double operator[](const size_type) const;
+      /*!
+       * \brief copy the values of the column
+       * \param[out] out: output array, which must be able to store
+       * `size()` values
+       */
+      void copy(double* const) const;
+      //! \brief segments of the view
+      std::vector<Segment> segments;
+    };  // end of struct ColumnView
+    /*!
+     * \return if the given file uses the columnar binary format, i.e.
+     * if it starts with the expected magic string.
+     * \param[in] f: file name
+     */
+    static bool isColumnarBinaryFile(const std::string&);
+    /*!
+     * \brief constructor
+     * \param[in] f: file name
+     */
+    ColumnarBinaryData(const std::string&);
+    //! \brief move constructor
+    ColumnarBinaryData(ColumnarBinaryData&&);
+    //! \brief move assignement
+    ColumnarBinaryData& operator=(ColumnarBinaryData&&);
+    //! \return the number of columns
+    size_type getNumberOfColumns() const;
+    //! \return the number of rows
+    size_type getNumberOfRows() const;
+    /*!
+     * \return the specified column
+     * \param[in] i: column number
+     */
+    std::vector<double> getColumn(const size_type) const;
+    /*!
+     * \brief extract the specified column
+     * \param[out] tab: column values
+     * \param[in]  i: column number
+     */
+    void getColumn(std::vector<double>&, const size_type) const;
+    /*!
+     * \return a view of the values of the specified column
+     * \param[in] i: column number
+     */
+    ColumnView getColumnView(const size_type) const;
+    /*!
+     * \return the column having the specified name
+     * \param[in] name: column name
+     */
+    size_type findColumn(const std::string&) const;
+    //! \return the names of the columns
+    const std::vector<std::string>& getLegends() const;
+    /*!
+     * \return the name of the specified column
+     * \param[in] c: column number
+     */
+    std::string getLegend(const size_type) const;
+    //! \brief destructor
+    ~ColumnarBinaryData();
+
+   private:
+    ColumnarBinaryData() = delete;
+    ColumnarBinaryData(const ColumnarBinaryData&) = delete;
+    ColumnarBinaryData& operator=(const ColumnarBinaryData&) = delete;
+    /*!
+     * \brief check that the given column number is valid
+     * \param[in] m: calling method
+     * \param[in] i: column number
+     */
+    void checkColumnNumber(const char* const, const size_type) const;
+    //! \brief description of a block of rows
+    struct Block {
+      //! \brief index of the first row of the block
+      size_type first;
+      //! \brief number of rows
+      size_type nrows;
+      //! \brief values of the block, stored column after column
+      const double* values;
+    };
+    //! \brief content of the file
+    struct File;
+    //! \brief content of the file
+    std::unique_ptr<File> file;
+    //! \brief names of the columns
+    std::vector<std::string> legends;
+    //! \brief blocks of rows
+    std::vector<Block> blocks;
+    //! \brief copies of the blocks which are not suitably aligned
+    std::vector<double> copies;
+    //! \brief number of rows
+    size_type nrows = 0;
+  };  // end of struct ColumnarBinaryData
+
+}  // end of namespace tfel::utilities
+
+#endif /* LIB_TFEL_UTILITIES_COLUMNARBINARYDATA_HXX */
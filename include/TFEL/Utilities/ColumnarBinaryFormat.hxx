@@ -0,0 +1,62 @@
+/*!
+ * \file   include/TFEL/Utilities/ColumnarBinaryFormat.hxx
+ * \brief  This file describes the columnar binary format used to store
+ * the results of `MTest` and `PipeTest`.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_UTILITIES_COLUMNARBINARYFORMAT_HXX
+#define LIB_TFEL_UTILITIES_COLUMNARBINARYFORMAT_HXX
+
+#include <cstdint>
+#include <cstddef>
+
+/*!
+ * \brief description of the columnar binary format.
+ *
+ * A file in this format is made of a header followed by blocks of
+ * rows. All integers are unsigned integers of 64 bits, except the
+ * version and the byte order mark which are unsigned integers of 32
+ * bits. All numbers are stored using the byte order of the writer,
+ * which is checked by the reader using the byte order mark.
+ *
+ * The header contains:
+ *
+ * - the magic string `TFELCBF`, including its final null character.
+ * - the version of the format.
+ * - the byte order mark.
+ * - the number of columns.
+ * - for each column, the size of its name followed by its characters
+ *   (without final null character).
+ * - null bytes, so that the size of the header is a multiple of
+ *   `alignment` (since version 2).
+ *
+ * Each block contains the number of rows of the block followed by the
+ * values of each column for those rows, stored as doubles, column
+ * after column. Since the size of a block is a multiple of `alignment`,
+ * the values of all blocks are suitably aligned to be read in place
+ * from a memory-mapped file.
+ */
+namespace tfel::utilities::columnar_binary_format {
+
+  //! \brief magic string starting a file
+  inline constexpr char magic[8] = "TFELCBF";
+  //! \brief size of the magic string, including its final null character
+  inline constexpr std::size_t magic_size = sizeof(magic);
+  //! \brief version of the format
+  inline constexpr std::uint32_t version = 2;
+  //! \brief alignment of the blocks, in bytes
+  inline constexpr std::size_t alignment = sizeof(double);
+  //! \brief byte order mark
+  inline constexpr std::uint32_t byte_order_mark = 0x01020304;
+
+}  // end of namespace tfel::utilities::columnar_binary_format
+
+#endif /* LIB_TFEL_UTILITIES_COLUMNARBINARYFORMAT_HXX */
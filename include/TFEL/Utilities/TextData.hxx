@@ -14,6 +14,7 @@
 #ifndef LIB_TFEL_UTILITIES_TEXTDATA_HXX
 #define LIB_TFEL_UTILITIES_TEXTDATA_HXX
 
+#include <mutex>
 #include <vector>
 #include <string>
 
@@ -24,6 +25,15 @@ namespace tfel::utilities {
 
   /*!
    * \brief class in charge of reading data in a text file
+   *
+   * If all the data lines contain the same number of numeric values,
+   * those values are parsed directly in a column-major array of
+   * doubles, in parallel for large files. Otherwise, the data lines
+   * are split in tokens by the `CxxTokenizer` class.
+   *
+   * Files using the columnar binary format (see the
+   * `ColumnarBinaryData` class) are also supported. In this case, the
+   * legends are the names of the columns and the preamble is empty.
    */
   struct TFELUTILITIES_VISIBILITY_EXPORT TextData {
     //! a simple alias
@@ -90,6 +100,9 @@ namespace tfel::utilities {
     std::string getLegend(const size_type c) const;
     /*!
      * \return an iterator to the first line
+     *
+     * \note if the file was read through the fast numeric path, the
+     * tokens are built on demand by reading the file again.
      */
     std::vector<Line>::const_iterator begin() const;
     /*!
@@ -112,8 +125,28 @@ namespace tfel::utilities {
     TextData(const TextData&) = delete;
     TextData& operator=(TextData&&) = delete;
     TextData& operator=(const TextData&) = delete;
+    //! \brief build the tokens of each line if required
+    void buildLines() const;
+    //! \brief name of the file
+    std::string file;
+    //! \brief file format
+    std::string format;
+    //! \brief numeric values stored by columns (fast numeric path)
+    std::vector<double> values;
+    //! \brief line numbers associated with the numeric values
+    std::vector<size_type> line_numbers;
+    //! \brief number of columns of the numeric values
+    size_type ncolumns = 0;
+    //! \brief lowest number of the lines kept, see `skipLines`
+    size_type first_line = 0;
+    //! \brief boolean stating if the fast numeric path was used
+    bool numeric = false;
+    //! \brief boolean stating if the file uses the columnar binary format
+    bool binary = false;
+    //! \brief flag used to build the tokens of each line on demand
+    mutable std::once_flag lines_flag;
     //! list of all tokens of the file, sorted by line
-    std::vector<Line> lines;
+    mutable std::vector<Line> lines;
     //! list of column titles
     std::vector<std::string> legends;
     //! first commented lines
@@ -141,8 +141,14 @@ namespace mfront {
     //! if this attribute is true, the implicit algorithm compares the
     //! analytical jacobian to the numeric one
     static const char* const compareToNumericalJacobian;
+    //! \brief finite difference scheme used to compute the numerical
+    //! jacobian (`Centered` or `Forward`)
+    static const char* const numericalJacobianComputationScheme;
     //! list of jacobian blocks that must be computed numerically
     static const char* const numericallyComputedJacobianBlocks;
+    //! \brief list of integration variables eliminated by static
+    //! condensation when solving the linear systems of the implicit scheme
+    static const char* const condensedIntegrationVariables;
     /*!
      * a boolean attribute telling if the additionnal variables can be
      * declared. This attribute is set by DSL's when the first code
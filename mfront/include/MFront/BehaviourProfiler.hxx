@@ -25,18 +25,55 @@
 #include "MFront/MFrontConfig.hxx"
 
 #include <array>
+#include <mutex>
 #include <atomic>
+#include <memory>
 #include <string>
+#include <vector>
+#include <cstdint>
+#include <iosfwd>
 
 namespace mfront {
 
   /*!
    * structure in charge of performance measurements in mechanical
    * behaviour
+   *
+   * The measures are accumulated in per-thread shards, so that timers
+   * running concurrently in different threads do not contend on the
+   * same counters. The shards are merged when the results are
+   * reported.
+   *
+   * For each code block, the total time, the number of calls and an
+   * histogram of the durations of the calls are recorded. The bucket
+   * `i` of the histogram counts the calls whose duration `d`, in
+   * nanoseconds, satisfies \f$2^{i}\leq d<2^{i+1}\f$ (the first bucket
+   * also counts the calls lasting less than one nanosecond and the last
+   * bucket counts all the calls longer than \f$2^{39}\f$ nanoseconds).
+   *
+   * At destruction, the results are printed on the standard output and,
+   * if an output file has been specified, exported in this file. The
+   * output file can be specified by the `MFRONT_PROFILING_OUTPUT_FILE`
+   * environment variable.
    */
   struct MFRONTPROFILING_VISIBILITY_EXPORT BehaviourProfiler {
     //! a simple alias
     using index_type = unsigned short;
+    //! \brief number of code blocks
+    static constexpr std::size_t nbr_of_code_blocks = 23;
+    //! \brief number of buckets of the histograms
+    static constexpr std::size_t nbr_of_buckets = 40;
+    //! \brief per-thread measures (defined in the source file)
+    struct ThreadMeasures;
+    //! \brief merged results for one code block
+    struct CodeBlockResults {
+      //! \brief total time spent in the code block (nanoseconds)
+      std::intmax_t time = 0;
+      //! \brief number of calls
+      std::intmax_t calls = 0;
+      //! \brief histogram of the durations of the calls
+      std::array<std::intmax_t, nbr_of_buckets> histogram = {};
+    };
     /*!
      * a timer for a specicied code block.
      * This descructor will increase the time count for the code block.
@@ -55,8 +92,8 @@ namespace mfront {
       Timer(Timer&&) = default;
       Timer& operator=(const Timer&) = delete;
       Timer& operator=(Timer&&) = delete;
-      //! timer to which the results are reported
-      BehaviourProfiler& gtimer;
+      //! measures of the current thread
+      ThreadMeasures& measures;
       //! code block associated with the timer
       const index_type c;
 #if !(defined _WIN32 || defined _WIN64)
@@ -137,14 +174,70 @@ namespace mfront {
         APOSTERIORITIMESTEPSCALINGFACTOR = 21;
     //! code block index in the measures array
     static MFRONTBEHAVIOURPROFILER_CONST_QUALIFIER index_type TOTALTIME = 22;
+    /*!
+     * \return the name of the given code block
+     * \param[in] c: code block
+     */
+    static std::string getCodeBlockName(const index_type);
+    /*!
+     * \brief set the file in which the results are exported at
+     * destruction.
+     *
+     * The results are exported in the `CSV` format if the file name
+     * ends with `.csv` and in the `JSON` format otherwise. The string
+     * `{behaviour}` is replaced by the name of the behaviour. An empty
+     * string disables the export.
+     *
+     * If several profilers export their results in the same file, the
+     * results of all those profilers are gathered in this file: the `CSV`
+     * file contains the lines of each profiler after a unique header and
+     * the `JSON` file contains an array of objects.
+     *
+     * \param[in] f: file name
+     */
+    void setOutputFile(const std::string&);
+    //! \return the results merged over all threads
+    std::array<CodeBlockResults, nbr_of_code_blocks> getResults() const;
+    //! \return the number of threads which reported measures
+    std::size_t getNumberOfThreads() const;
+    /*!
+     * \brief print a summary of the results
+     * \param[in] os: output stream
+     */
+    void print(std::ostream&) const;
+    /*!
+     * \brief export the results in the `JSON` format
+     * \param[in] os: output stream
+     */
+    void exportToJSON(std::ostream&) const;
+    /*!
+     * \brief export the results in the `CSV` format
+     * \param[in] os: output stream
+     */
+    void exportToCSV(std::ostream&) const;
+    /*!
+     * \brief export the results in the output file, if any.
+     *
+     * This method is called by the destructor. Calling it several times
+     * replaces the results previously exported by this profiler.
+     */
+    void exportResults() const;
     //! destructor
     ~BehaviourProfiler();
 
    protected:
+    //! \return the measures associated with the current thread
+    ThreadMeasures& getThreadMeasures();
     //! name of the behaviour
     const std::string name;
-    //! time spend in each code block (nanoseconds)
-    std::array<std::atomic<intmax_t>, 23> measures;
+    //! \brief unique identifier of the profiler
+    const std::size_t identifier;
+    //! \brief output file
+    std::string output_file;
+    //! \brief mutex protecting the list of shards
+    mutable std::mutex m;
+    //! \brief measures of each thread
+    std::vector<std::unique_ptr<ThreadMeasures>> thread_measures;
   };  // end of BehaviourProfiler
 
 }  // end of namespace mfront
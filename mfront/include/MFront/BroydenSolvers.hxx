@@ -33,6 +33,7 @@ namespace mfront {
     bool allowsJacobianInvertInitialisation() const override;
     bool requiresJacobianToBeReinitialisedToIdentityAtEachIterations()
         const override;
+    bool solvesLinearSystemsWithTheJacobian() const override;
     void writeSpecificInitializeMethodPart(std::ostream&,
                                            const BehaviourDescription&,
                                            const Hypothesis) const override;
@@ -19,6 +19,7 @@
 
 #include "TFEL/Math/vector.hxx"
 #include "TFEL/Math/tvector.hxx"
+#include "MFront/Castem/CastemGenericPlaneStressHandlerStatistics.hxx"
 
 #ifndef LIB_MFRONT_CASTEM_CALL_HXX
 #error "This header shall not be called directly"
@@ -131,23 +132,91 @@ namespace castem {
           (NSTATV_ < 20), tfel::math::tvector<NSTATV_, CastemReal>,
           tfel::math::vector<CastemReal>>::type SVector;
       CastemGenericPlaneStressHandler::checkNSTATV(*NSTATV);
-      unsigned int i;
-      const unsigned int iterMax = 50;
       CastemReal eto[4];
       CastemReal deto[4];
       CastemReal s[4];
       SVector v;
       CastemGenericPlaneStressHandler::resize(v, NSTATV_);
-      CastemReal dez;
+      // elastic prediction of the axial strain increment
+      const CastemReal dez0 = c1 * DSTRAN[0] + c2 * DSTRAN[1];
+      CastemReal dez = dez0;
+      // number of integrations of the behaviour
+      unsigned int n = 0;
+      bool converged = false;
+      bool fallback = false;
+      if constexpr (CastemTraits<BV>::useNewtonGenericPlaneStressAlgorithm &&
+                    Traits::hasConsistentTangentOperator) {
+        converged = CastemGenericPlaneStressHandler::template newton<
+            GeneralisedPlaneStrainBehaviour>(
+            c3, DTIME, DROT, TEMP, DTEMP, PROPS, NPROPS, PREDEF, DPRED, STATEV,
+            STRESS, PNEWDT, STRAN, DSTRAN, dez, n, &v[0], s, eto, deto, op,
+            sfeh);
+        if (!converged) {
+          fallback = true;
+          dez = dez0;
+        }
+      }
+      if (!converged) {
+        converged = CastemGenericPlaneStressHandler::template secant<
+            GeneralisedPlaneStrainBehaviour>(
+            c3, DTIME, DROT, DDSDDE, TEMP, DTEMP, PROPS, NPROPS, PREDEF, DPRED,
+            STATEV, STRESS, PNEWDT, STRAN, DSTRAN, dez, n, &v[0], s, eto, deto,
+            op, sfeh);
+      }
+      CastemGenericPlaneStressHandlerStatistics::getStatistics().registerCall(
+          n, fallback);
+      if (!converged) {
+        throwPlaneStressMaximumNumberOfIterationsReachedException(
+            Traits::getName());
+      }
+      copy<4>::exe(s, STRESS);
+      STRESS[2] = 0;
+      std::copy(v.begin(), v.end(), STATEV);
+      STATEV[*NSTATV - 1] += dez;
+    }  // end of exe
+
+    /*!
+     * \brief solve the plane stress condition using a secant algorithm
+     * \return true on success
+     * \param[in] c3: inverse of the elastic axial stiffness
+     * \param[in,out] dez: axial strain increment
+     * \param[in,out] n: number of integrations of the behaviour
+     */
+    template <typename GeneralisedPlaneStrainBehaviour>
+    TFEL_CASTEM_INLINE2 static bool secant(
+        const CastemReal c3,
+        const CastemReal *const DTIME,
+        const CastemReal *const DROT,
+        CastemReal *const DDSDDE,
+        const CastemReal *const TEMP,
+        const CastemReal *const DTEMP,
+        const CastemReal *const PROPS,
+        const CastemInt *const NPROPS,
+        const CastemReal *const PREDEF,
+        const CastemReal *const DPRED,
+        const CastemReal *const STATEV,
+        const CastemReal *const STRESS,
+        CastemReal *const PNEWDT,
+        const CastemReal *const STRAN,
+        const CastemReal *const DSTRAN,
+        CastemReal &dez,
+        unsigned int &n,
+        CastemReal *const v,
+        CastemReal *const s,
+        CastemReal *const eto,
+        CastemReal *const deto,
+        const tfel::material::OutOfBoundsPolicy op,
+        const StressFreeExpansionHandler &sfeh) {
+      using std::abs;
+      const unsigned int iterMax = 50;
       CastemReal x[2];
       CastemReal f[2];
-
-      dez = c1 * DSTRAN[0] + c2 * DSTRAN[1];
       CastemGenericPlaneStressHandler::template iter<
           GeneralisedPlaneStrainBehaviour>(DTIME, DROT, DDSDDE, TEMP, DTEMP,
                                            PROPS, NPROPS, PREDEF, DPRED, STATEV,
                                            STRESS, PNEWDT, STRAN, DSTRAN, dez,
-                                           &v[0], s, eto, deto, op, sfeh);
+                                           v, s, eto, deto, op, sfeh);
+      ++n;
       x[1] = dez;
       f[1] = s[2];
 
@@ -156,11 +225,12 @@ namespace castem {
         CastemGenericPlaneStressHandler::template iter<
             GeneralisedPlaneStrainBehaviour>(
             DTIME, DROT, DDSDDE, TEMP, DTEMP, PROPS, NPROPS, PREDEF, DPRED,
-            STATEV, STRESS, PNEWDT, STRAN, DSTRAN, dez, &v[0], s, eto, deto, op,
+            STATEV, STRESS, PNEWDT, STRAN, DSTRAN, dez, v, s, eto, deto, op,
             sfeh);
+        ++n;
       }
 
-      i = 2;
+      unsigned int i = 2;
       while ((abs(c3 * s[2]) > 1.e-12) && (i < iterMax)) {
         x[0] = x[1];
         f[0] = f[1];
@@ -170,19 +240,83 @@ namespace castem {
         CastemGenericPlaneStressHandler::template iter<
             GeneralisedPlaneStrainBehaviour>(
             DTIME, DROT, DDSDDE, TEMP, DTEMP, PROPS, NPROPS, PREDEF, DPRED,
-            STATEV, STRESS, PNEWDT, STRAN, DSTRAN, dez, &v[0], s, eto, deto, op,
+            STATEV, STRESS, PNEWDT, STRAN, DSTRAN, dez, v, s, eto, deto, op,
             sfeh);
+        ++n;
         ++i;
       }
-      if (i == iterMax) {
-        throwPlaneStressMaximumNumberOfIterationsReachedException(
-            Traits::getName());
+      return i != iterMax;
+    }  // end of secant
+
+    /*!
+     * \brief solve the plane stress condition using a Newton algorithm
+     * based on the consistent tangent operator of the behaviour.
+     *
+     * The algorithm is stopped, and `false` is returned, if the axial
+     * stiffness is not strictly positive or if the residual does not
+     * decrease. The caller is then expected to use the secant algorithm.
+     *
+     * \return true on success
+     * \param[in] c3: inverse of the elastic axial stiffness
+     * \param[in,out] dez: axial strain increment
+     * \param[in,out] n: number of integrations of the behaviour
+     */
+    template <typename GeneralisedPlaneStrainBehaviour>
+    TFEL_CASTEM_INLINE2 static bool newton(
+        const CastemReal c3,
+        const CastemReal *const DTIME,
+        const CastemReal *const DROT,
+        const CastemReal *const TEMP,
+        const CastemReal *const DTEMP,
+        const CastemReal *const PROPS,
+        const CastemInt *const NPROPS,
+        const CastemReal *const PREDEF,
+        const CastemReal *const DPRED,
+        const CastemReal *const STATEV,
+        const CastemReal *const STRESS,
+        CastemReal *const PNEWDT,
+        const CastemReal *const STRAN,
+        const CastemReal *const DSTRAN,
+        CastemReal &dez,
+        unsigned int &n,
+        CastemReal *const v,
+        CastemReal *const s,
+        CastemReal *const eto,
+        CastemReal *const deto,
+        const tfel::material::OutOfBoundsPolicy op,
+        const StressFreeExpansionHandler &sfeh) {
+      using std::abs;
+      const unsigned int iterMax = 10;
+      // consistent tangent operator of the generalised plane strain
+      // behaviour, stored using the Cast3M conventions
+      CastemReal K[16];
+      CastemReal r0 = 0;
+      for (unsigned int i = 0; i != iterMax; ++i) {
+        // request the consistent tangent operator
+        K[0] = 4;
+        CastemGenericPlaneStressHandler::template iter<
+            GeneralisedPlaneStrainBehaviour>(DTIME, DROT, K, TEMP, DTEMP, PROPS,
+                                             NPROPS, PREDEF, DPRED, STATEV,
+                                             STRESS, PNEWDT, STRAN, DSTRAN, dez,
+                                             v, s, eto, deto, op, sfeh);
+        ++n;
+        const auto r = s[2];
+        if (abs(c3 * r) <= 1.e-12) {
+          return true;
+        }
+        if ((i != 0) && (!(abs(r) < abs(r0)))) {
+          return false;
+        }
+        // derivative of the axial stress with respect to the axial strain
+        const auto Kzz = K[10];
+        if ((!std::isfinite(Kzz)) || (!(Kzz > 0))) {
+          return false;
+        }
+        dez -= r / Kzz;
+        r0 = r;
       }
-      copy<4>::exe(s, STRESS);
-      STRESS[2] = 0;
-      std::copy(v.begin(), v.end(), STATEV);
-      STATEV[*NSTATV - 1] += dez;
-    }  // end of exe
+      return false;
+    }  // end of newton
 
     template <unsigned short N, typename T>
     static void resize(tfel::math::tvector<N, T> &, const unsigned short) {}
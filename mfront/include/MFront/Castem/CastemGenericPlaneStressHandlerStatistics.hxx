@@ -0,0 +1,102 @@
+/*!
+ * \file  mfront/include/MFront/Castem/CastemGenericPlaneStressHandlerStatistics.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_CASTEM_CASTEMGENERICPLANESTRESSHANDLERSTATISTICS_HXX
+#define LIB_MFRONT_CASTEM_CASTEMGENERICPLANESTRESSHANDLERSTATISTICS_HXX
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <iosfwd>
+#include "MFront/Castem/CastemConfig.hxx"
+
+namespace castem {
+
+  /*!
+   * \brief statistics about the number of integrations of the behaviour
+   * performed by the generic plane stress handler to satisfy the plane
+   * stress condition.
+   *
+   * Those statistics are shared by all the behaviours and are updated
+   * by many threads. If the `CASTEM_GENERIC_PLANE_STRESS_STATISTICS`
+   * environment variable is defined, the statistics are printed on the
+   * standard error output when the program exits.
+   */
+  struct MFRONT_CASTEM_VISIBILITY_EXPORT
+      CastemGenericPlaneStressHandlerStatistics {
+    //! \brief size of the histogram of the number of integrations
+    static constexpr std::size_t histogramSize = 51;
+    //! \return the unique instance of this class
+    static CastemGenericPlaneStressHandlerStatistics& getStatistics();
+    /*!
+     * \brief register a call to the generic plane stress handler
+     * \param[in] n: number of integrations of the behaviour
+     * \param[in] b: boolean stating if the `Newton` algorithm failed and
+     * if the secant algorithm was used as a fallback
+     */
+    void registerCall(const unsigned int, const bool);
+    //! \return the number of calls to the generic plane stress handler
+    std::size_t getNumberOfCalls() const;
+    /*!
+     * \return the number of calls which required the given number of
+     * integrations of the behaviour
+     * \param[in] n: number of integrations. The last bin of the
+     * histogram gathers all the calls which required at least
+     * `histogramSize - 1` integrations.
+     */
+    std::size_t getNumberOfCalls(const unsigned int) const;
+    //! \return the total number of integrations of the behaviour
+    std::size_t getNumberOfIntegrations() const;
+    /*!
+     * \return the number of calls for which the secant algorithm was
+     * used after a failure of the `Newton` algorithm
+     */
+    std::size_t getNumberOfFallbacks() const;
+    //! \return the maximum number of integrations for a single call
+    unsigned int getMaximumNumberOfIntegrations() const;
+    //! \brief reset the statistics
+    void reset();
+    /*!
+     * \brief print the statistics
+     * \param[in] os: output stream
+     */
+    void print(std::ostream&) const;
+
+   private:
+    //! \brief default constructor
+    CastemGenericPlaneStressHandlerStatistics();
+    //! \brief destructor
+    ~CastemGenericPlaneStressHandlerStatistics();
+    CastemGenericPlaneStressHandlerStatistics(
+        CastemGenericPlaneStressHandlerStatistics&&) = delete;
+    CastemGenericPlaneStressHandlerStatistics(
+        const CastemGenericPlaneStressHandlerStatistics&) = delete;
+    CastemGenericPlaneStressHandlerStatistics& operator=(
+        CastemGenericPlaneStressHandlerStatistics&&) = delete;
+    CastemGenericPlaneStressHandlerStatistics& operator=(
+        const CastemGenericPlaneStressHandlerStatistics&) = delete;
+    //! \brief number of calls per number of integrations
+    std::array<std::atomic<std::size_t>, histogramSize> histogram;
+    //! \brief total number of integrations
+    std::atomic<std::size_t> integrations;
+    //! \brief number of fallbacks to the secant algorithm
+    std::atomic<std::size_t> fallbacks;
+    //! \brief maximum number of integrations
+    std::atomic<unsigned int> maximum;
+    //! \brief if true, the statistics are printed at exit
+    bool print_at_exit = false;
+  };  // end of struct CastemGenericPlaneStressHandlerStatistics
+
+}  // end of namespace castem
+
+#endif /* LIB_MFRONT_CASTEM_CASTEMGENERICPLANESTRESSHANDLERSTATISTICS_HXX */
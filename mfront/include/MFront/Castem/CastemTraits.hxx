@@ -39,6 +39,7 @@ namespace castem {
     static constexpr bool useTimeSubStepping = false;
     static constexpr bool doSubSteppingOnInvalidResults = false;
     static constexpr unsigned short maximumSubStepping = 0u;
+    static constexpr bool useNewtonGenericPlaneStressAlgorithm = false;
     static constexpr bool requiresStiffnessTensor = false;
     static constexpr bool requiresThermalExpansionCoefficientTensor = false;
     static constexpr unsigned short propertiesOffset = 0u;
@@ -39,6 +39,11 @@ namespace mfront {
     static const char *const doSubSteppingOnInvalidResults;
 
     static const char *const maximumSubStepping;
+    /*!
+     * \brief name of the attribute defining the algorithm used by the
+     * generic plane stress handler (`Secant` or `Newton`)
+     */
+    static const char *const genericPlaneStressAlgorithm;
 
     static std::string getName();
     /*!
@@ -465,6 +465,10 @@ namespace mfront {
     std::pair<std::string, VariableBoundsDescription> readVariableBounds();
     /*!
      * call mfront in a subprocess
+     *
+     * \note each file is only treated once for a given set of interfaces,
+     * even if it is required by several input files treated concurrently.
+     *
      * \param[in] interfaces : list of interfaces
      * \param[in] files      : list of files
      */
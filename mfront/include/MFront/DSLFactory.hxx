@@ -17,6 +17,7 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <mutex>
 #include <memory>
 #include <functional>
 #include "TFEL/Utilities/Data.hxx"
@@ -28,6 +29,10 @@ namespace mfront {
   /*!
    * \brief an abstract factory for the domain specific languages supported by
    * `MFront` implemented using the singleton pattern.
+   *
+   * \note the methods of this class are thread-safe: DSLs may be
+   * registered (for example when loading an external library) while
+   * other threads create new DSLs.
    */
   struct MFRONT_VISIBILITY_EXPORT DSLFactory {
     //! \brief a simple alias
@@ -82,6 +87,8 @@ namespace mfront {
     std::map<std::string, std::vector<std::string>> aliases;
     //! \brief list of descriptions
     std::map<std::string, DescriptionGenerator> descriptions;
+    //! \brief mutex protecting the generators, the aliases and the descriptions
+    mutable std::mutex m;
     //! \brief default constructor
     TFEL_VISIBILITY_LOCAL
     DSLFactory();
@@ -0,0 +1,156 @@
+/*!
+ * \file   mfront/include/MFront/GenerationCache.hxx
+ * \brief  This file declares the GenerationCache class
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERATIONCACHE_HXX
+#define LIB_MFRONT_GENERATIONCACHE_HXX
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+#include "MFront/MFrontConfig.hxx"
+
+namespace mfront {
+
+  // forward declaration
+  struct TargetsDescription;
+
+  /*!
+   * \brief a structure describing the results of previous treatments of
+   * `MFront` files.
+   *
+   * This structure is used to:
+   *
+   * - skip the treatment of input files which did not change since the
+   *   last treatment, including the files that they depend on and the
+   *   options passed to `MFront`.
+   * - preserve the modification time of generated files whose content
+   *   did not change, so that build systems do not recompile them.
+   *
+   * Those informations are stored in the `src/inputs.lst` file, next to
+   * the `src/targets.lst` file.
+   */
+  struct MFRONT_VISIBILITY_EXPORT GenerationCache {
+    //! \brief a simple alias
+    using ModificationTime = std::int64_t;
+    //! \brief description of the last treatment of an input file
+    struct InputDescription {
+      //! \brief hash of the input file, of its dependencies and of the options
+      std::string hash;
+      //! \brief files imported or included by the input file
+      std::vector<std::string> dependencies;
+      //! \brief libraries built from the input file
+      std::vector<std::string> libraries;
+      //! \brief generated sources and headers
+      std::vector<std::string> files;
+    };
+    //! \brief description of a generated file
+    struct GeneratedFileDescription {
+      //! \brief hash of the content of the file
+      std::string hash;
+      //! \brief modification time of the file
+      ModificationTime mtime = 0;
+    };
+    //! \return the path to the file storing the cache
+    static std::string getFilePath();
+    /*!
+     * \return the hash of the given string
+     * \param[in] s: string
+     */
+    static std::string hash(std::string_view);
+    /*!
+     * \return the hash of the content of a file
+     * \param[in] f: file path
+     */
+    static std::string hashFile(const std::string&);
+    /*!
+     * \return the hash associated with the treatment of an input file, or an
+     * empty string if this hash can't be computed (for instance, if one of
+     * the dependencies does not exist anymore or if the input is stored in
+     * a `madnex` file).
+     * \param[in] f: input file
+     * \param[in] deps: dependencies of the input file
+     * \param[in] o: description of the options passed to `MFront`
+     */
+    static std::string hashInput(const std::string&,
+                                 const std::vector<std::string>&,
+                                 const std::string&);
+    /*!
+     * \return the modification time of a file or 0 if the file does not
+     * exist.
+     * \param[in] f: file path
+     */
+    static ModificationTime getModificationTime(const std::string&);
+    /*!
+     * \brief set the modification time of a file
+     * \param[in] f: file path
+     * \param[in] t: modification time
+     */
+    static void setModificationTime(const std::string&, const ModificationTime);
+    /*!
+     * \return the modification times of the existing sources and headers
+     * listed in the given description of the targets.
+     * \param[in] t: description of the targets
+     */
+    static std::map<std::string, ModificationTime> getGeneratedFiles(
+        const TargetsDescription&);
+    /*!
+     * \brief read the cache from the `src/inputs.lst` file.
+     * \return true if the file was successfully read
+     *
+     * \note if the file can't be read, the cache is left empty.
+     */
+    bool read();
+    //! \brief write the cache in the `src/inputs.lst` file
+    void write() const;
+    /*!
+     * \return if the treatment of the given input can be skipped
+     * \param[in] f: input file
+     * \param[in] o: description of the options passed to `MFront`
+     * \param[in] t: description of the targets read from `src/targets.lst`
+     */
+    bool isUpToDate(const std::string&,
+                    const std::string&,
+                    const TargetsDescription&) const;
+    /*!
+     * \brief update the description of a treated input file
+     * \param[in] f: input file
+     * \param[in] deps: dependencies of the input file
+     * \param[in] o: description of the options passed to `MFront`
+     * \param[in] td: description of the targets generated by the input file
+     */
+    void update(const std::string&,
+                const std::vector<std::string>&,
+                const std::string&,
+                const TargetsDescription&);
+    /*!
+     * \brief update the description of the generated files and restore the
+     * modification time of files which were rewritten with the same content.
+     * \param[in] before: modification times of the generated files before the
+     * treatment of the input files
+     * \param[in] after: modification times of the generated files after the
+     * treatment of the input files
+     */
+    void updateGeneratedFiles(
+        const std::map<std::string, ModificationTime>&,
+        const std::map<std::string, ModificationTime>&);
+    //! \brief description of the treated input files
+    std::map<std::string, InputDescription> inputs;
+    //! \brief description of the generated files
+    std::map<std::string, GeneratedFileDescription> generated_files;
+  };  // end of struct GenerationCache
+
+}  // end of namespace mfront
+
+#endif /* LIB_MFRONT_GENERATIONCACHE_HXX */
@@ -0,0 +1,135 @@
+/*!
+ * \file   include/MFront/GenericBehaviour/BatchBehaviourData.h
+ * \brief  This file declares the structure used to integrate a block of
+ * integration points in one call.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICBEHAVIOUR_BATCHBEHAVIOURDATA_H
+#define LIB_MFRONT_GENERICBEHAVIOUR_BATCHBEHAVIOURDATA_H
+
+#include "MFront/GenericBehaviour/Types.h"
+#include "MFront/GenericBehaviour/State.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * \brief strides between the data of two consecutive integration points.
+ *
+ * Each quantity (gradients, thermodynamic forces, etc.) is stored in a
+ * dedicated array. The data associated with the `i`-th integration point
+ * start at position `i * stride` in this array.
+ *
+ * A null stride means that the same values are shared by all integration
+ * points. This is typically used for material properties and external state
+ * variables which are uniform on the block, so that the caller only has to
+ * evaluate them once per block.
+ */
+typedef struct {
+  //! \brief stride of the gradients
+  mfront_gb_size_type gradients;
+  //! \brief stride of the thermodynamic forces
+  mfront_gb_size_type thermodynamic_forces;
+  //! \brief stride of the mass density
+  mfront_gb_size_type mass_density;
+  //! \brief stride of the material properties
+  mfront_gb_size_type material_properties;
+  //! \brief stride of the internal state variables
+  mfront_gb_size_type internal_state_variables;
+  //! \brief stride of the external state variables
+  mfront_gb_size_type external_state_variables;
+  /*!
+   * \brief stride of the stiffness matrices
+   * \note a null stride is only meaningful if no stiffness matrix is
+   * requested.
+   */
+  mfront_gb_size_type K;
+} mfront_gb_BatchStrides;
+
+/*!
+ * \brief structure passed to the integration of a block of integration
+ * points
+ */
+#ifndef MFRONT_GB_BATCHBEHAVIOURDATA_FORWARD_DECLARATION
+typedef struct mfront_gb_BatchBehaviourData mfront_gb_BatchBehaviourData;
+#endif
+
+/*!
+ * \brief structure passed to the integration of a block of integration
+ * points.
+ *
+ * The meaning of each member is the same as in the `mfront_gb_BehaviourData`
+ * structure, except that the pointers refer to the data of the first
+ * integration point. The data of the other integration points are retrieved
+ * using the strides.
+ *
+ * The stored energy, the dissipated energy, the proposed time step increase
+ * factor and the speed of sound are scalars stored contiguously (one value
+ * per integration point).
+ */
+struct mfront_gb_BatchBehaviourData {
+  /*!
+   * \brief pointer to a buffer used to store error message
+   *
+   * \note This pointer can be nullptr. If not null, the pointer must
+   * point to a buffer which is at least 512 characters wide (longer
+   * error message are truncated).
+   */
+  char* error_message;
+  //! \brief time increment
+  mfront_gb_real dt;
+  //! \brief number of integration points
+  mfront_gb_size_type n;
+  /*!
+   * \brief index of the integration point on which the integration failed.
+   *
+   * This value is equal to the number of integration points if all the
+   * integrations succeeded. Otherwise, the state of the integration points
+   * following the failed one is undefined.
+   */
+  mfront_gb_size_type failed_point;
+  //! \brief strides
+  mfront_gb_BatchStrides strides;
+  /*!
+   * \brief the stiffness matrices.
+   *
+   * On input, the first elements of the stiffness matrix associated with
+   * each integration point must contain the type of computation to be
+   * performed, as described in the `mfront_gb_BehaviourData` structure.
+   */
+  mfront_gb_real* K;
+  //! \brief proposed time step increment increase factors
+  mfront_gb_real* rdt;
+  //! \brief speed of sound (only computed if requested)
+  mfront_gb_real* speed_of_sound;
+  //! \brief state at the beginning of the time step
+  mfront_gb_InitialState s0;
+  //! \brief state at the end of the time step
+  mfront_gb_State s1;
+};
+
+#ifdef __cplusplus
+
+namespace mfront::gb {
+
+  //! \brief a simple alias
+  using BatchBehaviourData = ::mfront_gb_BatchBehaviourData;
+
+}  // end of namespace mfront::gb
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LIB_MFRONT_GENERICBEHAVIOUR_BATCHBEHAVIOURDATA_H */
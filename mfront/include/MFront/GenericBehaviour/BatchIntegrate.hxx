@@ -0,0 +1,157 @@
+/*!
+ * \file   mfront/include/MFront/GenericBehaviour/BatchIntegrate.hxx
+ * \brief  This file implements the integration of a block of
+ * integration points by the `generic` interface.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICBEHAVIOUR_BATCHINTEGRATE_HXX
+#define LIB_MFRONT_GENERICBEHAVIOUR_BATCHINTEGRATE_HXX
+
+#include "MFront/GenericBehaviour/Types.hxx"
+#include "MFront/GenericBehaviour/BehaviourData.h"
+#include "MFront/GenericBehaviour/BatchBehaviourData.h"
+
+namespace mfront::gb {
+
+  /*!
+   * \return the increment of a pointer between the data of two consecutive
+   * integration points
+   * \param[in] p: pointer to the data of the first integration point
+   * \param[in] s: stride
+   */
+  template <typename T>
+  mfront_gb_size_type getBatchIncrement(T* const p,
+                                        const mfront_gb_size_type s) {
+    return p == nullptr ? 0 : s;
+  }  // end of getBatchIncrement
+
+  //! \brief increments of the pointers of a state
+  struct BatchStateIncrements {
+    //! \brief increment of the gradients
+    mfront_gb_size_type gradients;
+    //! \brief increment of the thermodynamic forces
+    mfront_gb_size_type thermodynamic_forces;
+    //! \brief increment of the mass density
+    mfront_gb_size_type mass_density;
+    //! \brief increment of the material properties
+    mfront_gb_size_type material_properties;
+    //! \brief increment of the internal state variables
+    mfront_gb_size_type internal_state_variables;
+    //! \brief increment of the stored energy
+    mfront_gb_size_type stored_energy;
+    //! \brief increment of the dissipated energy
+    mfront_gb_size_type dissipated_energy;
+    //! \brief increment of the external state variables
+    mfront_gb_size_type external_state_variables;
+  };  // end of struct BatchStateIncrements
+
+  /*!
+   * \return the increments of the pointers of a state
+   * \param[in] s: state of the first integration point
+   * \param[in] st: strides
+   */
+  template <typename StateType>
+  BatchStateIncrements getBatchStateIncrements(
+      const StateType& s, const mfront_gb_BatchStrides& st) {
+    auto i = BatchStateIncrements{};
+    i.gradients = getBatchIncrement(s.gradients, st.gradients);
+    i.thermodynamic_forces =
+        getBatchIncrement(s.thermodynamic_forces, st.thermodynamic_forces);
+    i.mass_density = getBatchIncrement(s.mass_density, st.mass_density);
+    i.material_properties =
+        getBatchIncrement(s.material_properties, st.material_properties);
+    i.internal_state_variables = getBatchIncrement(
+        s.internal_state_variables, st.internal_state_variables);
+    i.stored_energy = getBatchIncrement(s.stored_energy, 1);
+    i.dissipated_energy = getBatchIncrement(s.dissipated_energy, 1);
+    i.external_state_variables = getBatchIncrement(
+        s.external_state_variables, st.external_state_variables);
+    return i;
+  }  // end of getBatchStateIncrements
+
+  /*!
+   * \brief move the pointers of a state to the next integration point
+   * \param[in,out] s: state
+   * \param[in] i: increments
+   */
+  template <typename StateType>
+  void advanceBatchState(StateType& s, const BatchStateIncrements& i) {
+    s.gradients += i.gradients;
+    s.thermodynamic_forces += i.thermodynamic_forces;
+    s.mass_density += i.mass_density;
+    s.material_properties += i.material_properties;
+    s.internal_state_variables += i.internal_state_variables;
+    s.stored_energy += i.stored_energy;
+    s.dissipated_energy += i.dissipated_energy;
+    s.external_state_variables += i.external_state_variables;
+  }  // end of advanceBatchState
+
+  /*!
+   * \brief integrate a block of integration points using the function
+   * integrating one integration point.
+   *
+   * The increments of the pointers between two integration points are
+   * computed once per block. The integration function is called with a
+   * pointer to the data of the current integration point. The generated
+   * batch functions pass a function object whose block-invariant
+   * arguments (out of bounds policy, etc.) are evaluated once per block.
+   *
+   * The integration stops at the first integration point for which the
+   * integration fails. The index of this integration point is stored in the
+   * `failed_point` member of the batch data. This member is set to the
+   * number of integration points if all integrations succeeded.
+   *
+   * \return the minimum of the values returned for each integration point,
+   * i.e. 1 if all integrations succeeded, 0 if all integrations succeeded but
+   * at least one of them proposed a smaller time step, -1 if one integration
+   * failed.
+   * \param[in,out] bd: batch data
+   * \param[in] integrate: function integrating one integration point
+   */
+  template <typename IntegrationFunction>
+  int integrateBatch(mfront_gb_BatchBehaviourData& bd,
+                     const IntegrationFunction& integrate) {
+    const auto iK = getBatchIncrement(bd.K, bd.strides.K);
+    const auto irdt = getBatchIncrement(bd.rdt, 1);
+    const auto ispeed_of_sound = getBatchIncrement(bd.speed_of_sound, 1);
+    const auto is0 = getBatchStateIncrements(bd.s0, bd.strides);
+    const auto is1 = getBatchStateIncrements(bd.s1, bd.strides);
+    auto d = mfront_gb_BehaviourData{};
+    d.error_message = bd.error_message;
+    d.dt = bd.dt;
+    d.K = bd.K;
+    d.rdt = bd.rdt;
+    d.speed_of_sound = bd.speed_of_sound;
+    d.s0 = bd.s0;
+    d.s1 = bd.s1;
+    auto r = 1;
+    bd.failed_point = bd.n;
+    for (mfront_gb_size_type i = 0; i != bd.n; ++i) {
+      const auto ri = integrate(&d);
+      if (ri < 0) {
+        bd.failed_point = i;
+        return ri;
+      }
+      if (ri < r) {
+        r = ri;
+      }
+      d.K += iK;
+      d.rdt += irdt;
+      d.speed_of_sound += ispeed_of_sound;
+      advanceBatchState(d.s0, is0);
+      advanceBatchState(d.s1, is1);
+    }
+    return r;
+  }  // end of integrateBatch
+
+}  // end of namespace mfront::gb
+
+#endif /* LIB_MFRONT_GENERICBEHAVIOUR_BATCHINTEGRATE_HXX */
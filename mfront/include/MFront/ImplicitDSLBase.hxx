@@ -188,6 +188,8 @@ namespace mfront {
     //! \brief treat the `@PerturbationValueForNumericalJacobianComputation`
     //! keyword
     virtual void treatPerturbationValueForNumericalJacobianComputation();
+    //! \brief treat the `@NumericalJacobianComputationScheme` keyword
+    virtual void treatNumericalJacobianComputationScheme();
     //! \brief treat the `@Algorithm` keyword
     virtual void treatAlgorithm();
     //! \brief treat the `@Predictor` keyword
@@ -206,6 +208,8 @@ namespace mfront {
     virtual void treatMaximumIncrementValuePerIteration();
     //! \brief treat the `@NumericallyComputedJacobianBlocks` keyword
     virtual void treatNumericallyComputedJacobianBlocks();
+    //! \brief treat the `@CondensedIntegrationVariables` keyword
+    virtual void treatCondensedIntegrationVariables();
     /*!
      * \brief set the non linear solver
      * \param[in] s: non linear solver
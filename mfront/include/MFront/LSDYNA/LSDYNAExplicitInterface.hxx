@@ -183,7 +183,7 @@ namespace lsdyna {
       b.setOutOfBoundsPolicy(d.policy);
       b.initialize();
       b.checkBounds();
-      const auto smf = TangentOperatorTraits::LSDYNA;
+      const auto smf = TangentOperatorTraits::ABAQUS;
       const auto r =
           b.computePredictionOperator(smf, Behaviour<H, T, false>::ELASTIC);
       ExtractAndConvertTangentOperator<H>::exe(b, D);
@@ -262,7 +262,7 @@ namespace lsdyna {
       b.setOutOfBoundsPolicy(d.policy);
       b.initialize();
       b.checkBounds();
-      const auto smf = TangentOperatorTraits::LSDYNA;
+      const auto smf = TangentOperatorTraits::ABAQUS;
       auto r_dt = std::numeric_limits<T>::max();
       auto tsf = b.computeAPrioriTimeStepScalingFactor(r_dt);
       if (!tsf.first) {
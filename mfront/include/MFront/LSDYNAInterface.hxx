@@ -34,6 +34,11 @@ namespace mfront {
      * \brief name of the attribute used to store the finite strain strategy.
      */
     static const char* const finiteStrainStrategy;
+    /*!
+     * \brief name of the attribute used to store the parallelization
+     * policy.
+     */
+    static const char* const parallelizationPolicy;
 
     std::pair<bool, tokens_iterator> treatKeyword(
         BehaviourDescription&,
@@ -99,6 +104,43 @@ namespace mfront {
                               const BehaviourDescription&) const override;
     void writeMTestFileGeneratorSetModellingHypothesis(
         std::ostream&) const override;
+    /*!
+     * \brief write the specialisation of the `LSDYNATraits` class
+     * \param[out] out: output stream
+     * \param[in]  mb:  behaviour description
+     * \param[in]  h:   modelling hypothesis
+     */
+    virtual void writeLSDYNABehaviourTraits(std::ostream&,
+                                            const BehaviourDescription&,
+                                            const Hypothesis) const;
+    /*!
+     * \brief write the runtime checks of the sizes of the arrays passed
+     * by the solver
+     * \param[out] out: output stream
+     * \param[in]  mb:  behaviour description
+     * \param[in]  h:   modelling hypothesis
+     */
+    virtual void writeChecks(std::ostream&,
+                             const BehaviourDescription&,
+                             const Hypothesis) const;
+    /*!
+     * \brief write the integration of the block of integration points
+     * \param[out] out: output stream
+     * \param[in]  mb:  behaviour description
+     * \param[in]  h:   modelling hypothesis
+     */
+    virtual void writeNativeBehaviourIntegration(std::ostream&,
+                                                 const BehaviourDescription&,
+                                                 const Hypothesis) const;
+    /*!
+     * \brief write the loop over the integration points, using the
+     * parallelization policy selected by the
+     * `@LSDYNAParallelizationPolicy` keyword.
+     * \param[out] out: output stream
+     * \param[in]  mb:  behaviour description
+     */
+    virtual void writeIntegrateLoop(std::ostream&,
+                                    const BehaviourDescription&) const;
   };
 
 }  // end of namespace mfront
@@ -28,6 +28,9 @@
 
 namespace mfront {
 
+  // forward declaration
+  struct GenerationCache;
+
   /*!
    * \brief the main class of MFront
    */
@@ -48,6 +51,26 @@ namespace mfront {
      * \return the target's description
      */
     virtual TargetsDescription treatFile(const std::string &) const;
+    /*!
+     * \brief treat a file (analyse and generate output files)
+     * \param[out] deps : files imported or included by the treated file
+     * \param[in] f : file name
+     * \return the target's description
+     */
+    virtual TargetsDescription treatFile(std::vector<std::string> &,
+                                         const std::string &) const;
+    /*!
+     * \brief treat the given files concurrently using `jobs` threads
+     * and merge the targets' descriptions in the order of the inputs.
+     * \param[out] errors: files that could not be treated and
+     * associated error messages
+     * \param[in,out] cache: description of the treated files
+     * \param[in] files: files to be treated
+     */
+    virtual void treatFilesConcurrently(
+        std::vector<std::pair<std::string, std::string>> &,
+        GenerationCache &,
+        const std::vector<std::string> &);
     //! \brief execute MFront process
     virtual void exe();
     //! \brief destructor
@@ -103,6 +126,16 @@ namespace mfront {
     virtual void treatListParsers();
 
     virtual void treatListDSLOptions();
+    //! \brief treat the --jobs command line option
+    virtual void treatJobs();
+    //! \brief treat the --force-generation command line option
+    virtual void treatForceGeneration();
+    /*!
+     * \return a description of the options affecting the treatment of the
+     * input files. The treatment of an input file which did not change since
+     * the last call to `MFront` is skipped if this description did not change.
+     */
+    virtual std::string getGenerationOptionsDescription() const;
 
     virtual void registerArgumentCallBacks();
 
@@ -151,7 +184,10 @@ namespace mfront {
     bool buildLibs = false;
 
     bool cleanLibs = false;
-
+    //! \brief number of files treated concurrently
+    std::size_t jobs = 1;
+    //! \brief skip the treatment of the files which did not change
+    bool incremental_generation = true;
   };  // end of class MFront
 
 }  // end of namespace mfront
@@ -52,6 +52,9 @@ namespace mfront {
   MFRONTLOGSTREAM_VISIBILITY_EXPORT void setVerboseMode(const std::string&);
   /*!
    * \return the current logging stream
+   * \note writes to the returned stream are not synchronized. Tasks
+   * executed concurrently shall use a logging stream of their own (see
+   * `setThreadLocalLogStream`).
    */
   MFRONTLOGSTREAM_VISIBILITY_EXPORT std::ostream& getLogStream();
 
@@ -68,6 +71,23 @@ namespace mfront {
    * The user has to take care of it
    */
   MFRONTLOGSTREAM_VISIBILITY_EXPORT void setLogStream(std::ostream&);
+  /*!
+   * \brief set the logging stream used by the current thread.
+   *
+   * This stream overrides the current logging stream in the calling
+   * thread until `resetThreadLocalLogStream` is called. This allows
+   * to buffer the messages of tasks executed concurrently.
+   *
+   * \param os : new logging stream
+   * \warning the stream is not handled by this function.
+   * The user has to take care of it
+   */
+  MFRONTLOGSTREAM_VISIBILITY_EXPORT void setThreadLocalLogStream(
+      std::ostream&);
+  /*!
+   * \brief restore the current logging stream in the calling thread.
+   */
+  MFRONTLOGSTREAM_VISIBILITY_EXPORT void resetThreadLocalLogStream();
 
   /*!
    * \brief set if MFront shall use unicode characters on output.
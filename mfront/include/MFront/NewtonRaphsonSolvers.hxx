@@ -40,6 +40,7 @@ namespace mfront {
     bool allowsJacobianInvertInitialisation() const override;
     bool requiresJacobianToBeReinitialisedToIdentityAtEachIterations()
         const override;
+    bool solvesLinearSystemsWithTheJacobian() const override;
     std::pair<bool, tokens_iterator> treatSpecificKeywords(
         BehaviourDescription&,
         const std::string&,
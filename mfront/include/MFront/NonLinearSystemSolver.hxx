@@ -100,6 +100,12 @@ namespace mfront {
      */
     virtual bool requiresJacobianToBeReinitialisedToIdentityAtEachIterations()
         const = 0;
+    /*!
+     * \return true if the linear systems passed to the `solveLinearSystem`
+     * method are built from the jacobian of the system, i.e. if they share
+     * its sparsity pattern (Newton-Raphson solvers).
+     */
+    virtual bool solvesLinearSystemsWithTheJacobian() const = 0;
     /*!
      * \brief write the algorithm specific members
      * \param[in,out] md  : mechanical description
@@ -55,6 +55,14 @@ namespace mfront {
                                        const SupportedTypes::TypeSize&,
                                        const std::string& = "this->jacobian",
                                        const std::string& = "");
+    /*!
+     * \return if the numerical jacobian shall be computed using forward
+     * finite differences rather than centered ones.
+     * \param[in] mb: mechanical behaviour description
+     * \param[in] h: modelling hypothesis
+     */
+    static bool usesForwardFiniteDifferencesForNumericalJacobian(
+        const BehaviourDescription&, const Hypothesis);
     /*!
      * \return write the code comparing the jacobian to a numerical one
      * \param[in] out : output file
@@ -17,6 +17,7 @@
 #include <set>
 #include <string>
 #include <vector>
+#include <mutex>
 #include <variant>
 
 #include "MFront/MFrontConfig.hxx"
@@ -27,6 +28,8 @@ namespace mfront {
    * structure in charge of:
    * - storing search paths
    * - searching imported mfront file
+   *
+   * \note the methods of this class are thread-safe.
    */
   struct MFRONT_VISIBILITY_EXPORT SearchPathsHandler {
     /*!
@@ -44,6 +47,29 @@ namespace mfront {
      * \return the full path of the file
      */
     static std::string search(const std::string&);
+    /*!
+     * \brief start recording the files returned by the `search` method in
+     * the calling thread.
+     *
+     * This is used to retrieve the dependencies of an input file, i.e. the
+     * files imported or included by this file.
+     */
+    static void startRecordingFoundFiles();
+    /*!
+     * \brief stop recording the files returned by the `search` method in the
+     * calling thread.
+     * \return the files found since the last call to
+     * `startRecordingFoundFiles`
+     *
+     * \note recordings may be nested: the files found are also added to
+     * the enclosing recording, if any.
+     */
+    static std::vector<std::string> stopRecordingFoundFiles();
+    /*!
+     * \brief add the given files to the current recording, if any
+     * \param[in] files: files
+     */
+    static void recordFoundFiles(const std::vector<std::string>&);
     /*!
      * \brief append a madnex search path
      *
@@ -114,8 +140,17 @@ namespace mfront {
     SearchPathsHandler& operator=(SearchPathsHandler&&) = delete;
     //! \brief return the path to a madnex file
     static std::string searchMadnexFile(const std::string&);
+    //! \return a copy of the search paths
+    static TFEL_VISIBILITY_LOCAL std::vector<Path> getPaths();
+    /*!
+     * \brief add a new path at the end of the search paths
+     * \param[in] p: path
+     */
+    static TFEL_VISIBILITY_LOCAL void appendPath(const Path&);
     //! \brief list of search paths
     std::vector<Path> paths;
+    //! \brief mutex protecting the list of search paths
+    std::mutex m;
   };  // end of struct SearchPathsHandler
 
 }  // namespace mfront
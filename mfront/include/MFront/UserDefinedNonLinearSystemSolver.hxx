@@ -34,6 +34,7 @@ namespace mfront {
     bool allowsJacobianInvertInitialisation() const override;
     bool requiresJacobianToBeReinitialisedToIdentityAtEachIterations()
         const override;
+    bool solvesLinearSystemsWithTheJacobian() const override;
     std::pair<bool, tokens_iterator> treatSpecificKeywords(
         BehaviourDescription&,
         const std::string&,
@@ -68,6 +69,7 @@ namespace mfront {
     bool allows_jacobian_invert_initialisation = false;
     bool requires_jacobian_reinitialisation_to_identity_at_each_iterations =
         true;
+    bool solves_linear_systems_with_the_jacobian = false;
   };  // end of struct UserDefinedNonLinearSystemSolver
 
 }  // end of namespace mfront
@@ -1022,21 +1022,13 @@ namespace mfront {
           << "integrate(i);\n"
           << "}\n";
     } else if (ppolicy == "ThreadPool") {
-      out << "auto integrate2 = [&integrate,nblock](const int b, const int "
-             "e){\n"
-          << "for(int i=b;i!=e;++i){\n"
-          << "integrate(i);\n"
-          << "}\n"
-          << "};\n"
-          << "const auto nthreads = pool.getNumberOfThreads();\n"
-          << "const auto ntasks   = nthreads/(*nblock);\n"
-          << "for(tfel::system::ThreadPool::size_type i=0;i!=nthreads;++i){\n"
-          << "pool.addTask(integrate2,i*ntasks,(i+1)*ntasks);\n"
-          << "}\n"
-          << "if(*nblock-ntasks*nthreads!=0){\n"
-          << "pool.addTask(integrate2,nthreads*ntasks,*nblock);\n"
-          << "}\n"
-          << "pool.wait();\n";
+      // each thread treats about four blocks of integration points so that
+      // the load is balanced by work stealing
+      out << "const auto nthreads = "
+             "static_cast<int>(pool.getNumberOfThreads());\n"
+          << "const auto grain = "
+             "std::max((*nblock) / (4 * std::max(nthreads, 1)), 1);\n"
+          << "pool.parallel_for(0, *nblock, grain, integrate);\n";
     } else {
       tfel::raise(
           "AbaqusExplicitInterface::writeIntegrateLoop: "
@@ -91,8 +91,12 @@ namespace mfront {
       "hasPredictionOperator";
   const char* const BehaviourData::compareToNumericalJacobian =
       "compareToNumericalJacobian";
+  const char* const BehaviourData::numericalJacobianComputationScheme =
+      "numericalJacobianComputationScheme";
   const char* const BehaviourData::numericallyComputedJacobianBlocks =
       "numericallyComputedJacobianBlocks";
+  const char* const BehaviourData::condensedIntegrationVariables =
+      "condensedIntegrationVariables";
   const char* const BehaviourData::allowsNewUserDefinedVariables =
       "allowsNewUserDefinedVariables";
   const char* const BehaviourData::algorithm = "algorithm";
@@ -12,7 +12,13 @@
  */
 
 #include <ctime>
+#include <limits>
+#include <cstdlib>
+#include <map>
 #include <string>
+#include <sstream>
+#include <utility>
+#include <fstream>
 #include <iterator>
 #include <iomanip>
 #include <iostream>
@@ -23,16 +29,78 @@
 
 namespace mfront {
 
+  /*!
+   * \brief measures of one thread.
+   *
+   * Those measures are only modified by the thread which owns them,
+   * but may be read by other threads: relaxed atomic operations are
+   * used to avoid data races without any synchronisation cost. The
+   * structure is aligned on cache lines to avoid false sharing.
+   */
+  struct alignas(64) BehaviourProfiler::ThreadMeasures {
+    ThreadMeasures() {
+      for (auto& t : this->times) {
+        t.store(0, std::memory_order_relaxed);
+      }
+      for (auto& c : this->calls) {
+        c.store(0, std::memory_order_relaxed);
+      }
+      for (auto& h : this->histograms) {
+        for (auto& v : h) {
+          v.store(0, std::memory_order_relaxed);
+        }
+      }
+    }  // end of ThreadMeasures
+    //! \brief time spent in each code block (nanoseconds)
+    std::array<std::atomic<std::intmax_t>, nbr_of_code_blocks> times;
+    //! \brief number of calls of each code block
+    std::array<std::atomic<std::intmax_t>, nbr_of_code_blocks> calls;
+    //! \brief histograms of the durations of the calls of each code block
+    std::array<std::array<std::atomic<std::intmax_t>, nbr_of_buckets>,
+               nbr_of_code_blocks>
+        histograms;
+  };  // end of struct BehaviourProfiler::ThreadMeasures
+
+  /*!
+   * \brief increment a counter owned by the current thread
+   * \param[in,out] c: counter
+   * \param[in] v: increment
+   */
+  static inline void increment(std::atomic<std::intmax_t>& c,
+                               const std::intmax_t v) {
+    c.store(c.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+  }  // end of increment
+
+  /*!
+   * \return the bucket of the histograms associated with the given
+   * duration
+   * \param[in] d: duration in nanoseconds
+   */
+  static inline std::size_t getBucket(const std::intmax_t d) {
+    if (d < 2) {
+      return 0;
+    }
+#if defined __GNUC__
+    const auto i = static_cast<std::size_t>(
+        std::numeric_limits<unsigned long long>::digits - 1 -
+        __builtin_clzll(static_cast<unsigned long long>(d)));
+#else
+    auto i = std::size_t{0};
+    for (auto v = d; v > 1; v >>= 1) {
+      ++i;
+    }
+#endif
+    return std::min(i, BehaviourProfiler::nbr_of_buckets - 1);
+  }  // end of getBucket
+
 #if !(defined _WIN32 || defined _WIN64)
   /*!
-   * add a new measure
-   * t     : measure to which the new measure is added
-   * start : start of the measure
-   * end   : end of the measure
+   * \return the duration, in nanoseconds, between two instants
+   * \param[in] start : start of the measure
+   * \param[in] end   : end of the measure
    */
-  static inline void add_measure(std::atomic<intmax_t>& t,
-                                 const timespec& start,
-                                 const timespec& end) {
+  static inline std::intmax_t get_duration(const timespec& start,
+                                           const timespec& end) {
     /* http://www.guyrutenberg.com/2007/09/22/profiling-code-using-clock_gettime
      */
     timespec temp;
@@ -43,8 +111,9 @@ namespace mfront {
       temp.tv_sec = end.tv_sec - start.tv_sec;
       temp.tv_nsec = end.tv_nsec - start.tv_nsec;
     }
-    t += 1000000000 * temp.tv_sec + temp.tv_nsec;
-  }  // end of add_measure
+    return 1000000000 * static_cast<std::intmax_t>(temp.tv_sec) +
+           static_cast<std::intmax_t>(temp.tv_nsec);
+  }  // end of get_duration
 #endif
 
   /*!
@@ -91,7 +160,7 @@ namespace mfront {
     os << t << "nsecs";
   }  // end pf print
 
-  static std::string getCodeBlockName(const unsigned int c) {
+  std::string BehaviourProfiler::getCodeBlockName(const index_type c) {
     auto n = std::string{};
     switch (c) {
       case BehaviourProfiler::FLOWRULE:
@@ -165,14 +234,14 @@ namespace mfront {
         break;
       default:
         tfel::raise(
-            "getCodeBlockName : no name associated "
+            "BehaviourProfiler::getCodeBlockName: no name associated "
             "with the given code block");
     }
     return n;
-  }
+  }  // end of BehaviourProfiler::getCodeBlockName
 
   BehaviourProfiler::Timer::Timer(BehaviourProfiler& t, const unsigned short cn)
-      : gtimer(t), c(cn) {
+      : measures(t.getThreadMeasures()), c(cn) {
 #if !(defined _WIN32 || defined _WIN64)
     ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &(this->start));
 #endif
@@ -181,34 +250,250 @@ namespace mfront {
   BehaviourProfiler::Timer::~Timer() {
 #if !(defined _WIN32 || defined _WIN64)
     ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &(this->end));
-    add_measure(this->gtimer.measures[this->c], this->start, this->end);
+    const auto d = get_duration(this->start, this->end);
+    increment(this->measures.times[this->c], d);
+    increment(this->measures.calls[this->c], 1);
+    increment(this->measures.histograms[this->c][getBucket(d)], 1);
 #endif
   }  // end of BehaviourProfiler::~Timer
 
-  BehaviourProfiler::BehaviourProfiler(const std::string& n) : name(n) {
-    std::fill(begin(measures), end(measures), 0);
+  /*!
+   * \return a new identifier for a profiler
+   */
+  static std::size_t getNewProfilerIdentifier() {
+    static std::atomic<std::size_t> counter{0};
+    return counter++;
+  }  // end of getNewProfilerIdentifier
+
+  BehaviourProfiler::BehaviourProfiler(const std::string& n)
+      : name(n), identifier(getNewProfilerIdentifier()) {
+    const auto* const f = ::getenv("MFRONT_PROFILING_OUTPUT_FILE");
+    if (f != nullptr) {
+      this->setOutputFile(f);
+    }
   }  // end of BehaviourProfiler::BehaviourProfiler
 
-  BehaviourProfiler::~BehaviourProfiler() {
-    using size_type = std::array<std::atomic<std::intmax_t>, 23>::size_type;
-    std::cout << "\nResults of " << this->name << " profiling : ";
-    print_time(std::cout, measures.back());
-    std::cout << '\n';
+  BehaviourProfiler::ThreadMeasures& BehaviourProfiler::getThreadMeasures() {
+    // shards already used by the current thread, indexed by the
+    // identifiers of the profilers
+    thread_local std::vector<std::pair<std::size_t, ThreadMeasures*>> cache;
+    for (const auto& tm : cache) {
+      if (tm.first == this->identifier) {
+        return *(tm.second);
+      }
+    }
+    auto lock = std::lock_guard<std::mutex>(this->m);
+    this->thread_measures.push_back(std::make_unique<ThreadMeasures>());
+    auto* const tm = this->thread_measures.back().get();
+    cache.emplace_back(this->identifier, tm);
+    return *tm;
+  }  // end of BehaviourProfiler::getThreadMeasures
+
+  void BehaviourProfiler::setOutputFile(const std::string& f) {
+    const auto p = std::string{"{behaviour}"};
+    auto r = f;
+    auto pos = r.find(p);
+    while (pos != std::string::npos) {
+      r.replace(pos, p.size(), this->name);
+      pos = r.find(p, pos + this->name.size());
+    }
+    this->output_file = r;
+  }  // end of BehaviourProfiler::setOutputFile
+
+  std::array<BehaviourProfiler::CodeBlockResults,
+             BehaviourProfiler::nbr_of_code_blocks>
+  BehaviourProfiler::getResults() const {
+    auto r = std::array<CodeBlockResults, nbr_of_code_blocks>{};
+    auto lock = std::lock_guard<std::mutex>(this->m);
+    for (const auto& tm : this->thread_measures) {
+      for (std::size_t i = 0; i != nbr_of_code_blocks; ++i) {
+        r[i].time += tm->times[i].load(std::memory_order_relaxed);
+        r[i].calls += tm->calls[i].load(std::memory_order_relaxed);
+        for (std::size_t j = 0; j != nbr_of_buckets; ++j) {
+          r[i].histogram[j] +=
+              tm->histograms[i][j].load(std::memory_order_relaxed);
+        }
+      }
+    }
+    return r;
+  }  // end of BehaviourProfiler::getResults
+
+  std::size_t BehaviourProfiler::getNumberOfThreads() const {
+    auto lock = std::lock_guard<std::mutex>(this->m);
+    return this->thread_measures.size();
+  }  // end of BehaviourProfiler::getNumberOfThreads
+
+  void BehaviourProfiler::print(std::ostream& os) const {
+    const auto r = this->getResults();
+    os << "\nResults of " << this->name << " profiling : ";
+    print_time(os, r[TOTALTIME].time);
+    os << '\n';
     std::string::size_type w{0};
-    for (size_type i = 0; i + 1 != measures.size(); ++i) {
-      if (measures[i] != 0) {
+    for (index_type i = 0; i != TOTALTIME; ++i) {
+      if (r[i].calls != 0) {
         w = std::max(w, getCodeBlockName(i).size());
       }
     }
-    for (size_type i = 0; i + 1 != measures.size(); ++i) {
-      if (measures[i] != 0) {
-        std::cout << "- " << std::setw(w) << std::left << getCodeBlockName(i)
-                  << " : ";
-        print_time(std::cout, measures[i]);
-        std::cout << " (" << measures[i] << " ns)\n";
+    for (index_type i = 0; i != TOTALTIME; ++i) {
+      if (r[i].calls != 0) {
+        os << "- " << std::setw(w) << std::left << getCodeBlockName(i)
+           << " : ";
+        print_time(os, r[i].time);
+        os << " (" << r[i].time << " ns, " << r[i].calls << " calls)\n";
+      }
+    }
+    os << std::endl;
+  }  // end of BehaviourProfiler::print
+
+  /*!
+   * \return the given string escaped for the `JSON` format
+   * \param[in] s: string
+   */
+  static std::string escapeJSONString(const std::string& s) {
+    auto r = std::string{};
+    r.reserve(s.size());
+    for (const auto c : s) {
+      if ((c == '"') || (c == '\\')) {
+        r += '\\';
+        r += c;
+      } else if (static_cast<unsigned char>(c) < 0x20) {
+        const char* const digits = "0123456789abcdef";
+        r += "\\u00";
+        r += digits[(c >> 4) & 0xF];
+        r += digits[c & 0xF];
+      } else {
+        r += c;
+      }
+    }
+    return r;
+  }  // end of escapeJSONString
+
+  void BehaviourProfiler::exportToJSON(std::ostream& os) const {
+    const auto r = this->getResults();
+    os << "{\n"
+       << "  \"behaviour\": \"" << escapeJSONString(this->name) << "\",\n"
+       << "  \"unit\": \"ns\",\n"
+       << "  \"threads\": " << this->getNumberOfThreads() << ",\n"
+       << "  \"code_blocks\": [";
+    auto first = true;
+    for (index_type i = 0; i != nbr_of_code_blocks; ++i) {
+      if (r[i].calls == 0) {
+        continue;
+      }
+      os << (first ? "\n" : ",\n") << "    {\"name\": \""
+         << escapeJSONString(getCodeBlockName(i))
+         << "\", \"calls\": " << r[i].calls
+         << ", \"total_time\": " << r[i].time
+         << ", \"mean_time\": " << r[i].time / r[i].calls
+         << ", \"histogram\": [";
+      for (std::size_t j = 0; j != nbr_of_buckets; ++j) {
+        os << (j == 0 ? "" : ", ") << r[i].histogram[j];
+      }
+      os << "]}";
+      first = false;
+    }
+    os << "\n  ]\n}\n";
+  }  // end of BehaviourProfiler::exportToJSON
+
+  void BehaviourProfiler::exportToCSV(std::ostream& os) const {
+    const auto r = this->getResults();
+    os << "behaviour,code_block,calls,total_time,mean_time";
+    for (std::size_t j = 0; j != nbr_of_buckets; ++j) {
+      os << ",bucket_" << j;
+    }
+    os << '\n';
+    for (index_type i = 0; i != nbr_of_code_blocks; ++i) {
+      if (r[i].calls == 0) {
+        continue;
+      }
+      os << this->name << ',' << getCodeBlockName(i) << ',' << r[i].calls
+         << ',' << r[i].time << ',' << r[i].time / r[i].calls;
+      for (std::size_t j = 0; j != nbr_of_buckets; ++j) {
+        os << ',' << r[i].histogram[j];
+      }
+      os << '\n';
+    }
+  }  // end of BehaviourProfiler::exportToCSV
+
+  /*!
+   * \brief results exported by the profilers in each output file, indexed
+   * by the identifiers of the profilers.
+   */
+  struct ExportedResults {
+    //! \brief mutex protecting the results
+    std::mutex m;
+    //! \brief exported results
+    std::map<std::string, std::map<std::size_t, std::string>> results;
+  };  // end of ExportedResults
+
+  /*!
+   * \return the results exported by the profilers
+   * \note the returned object is never destroyed, so that profilers
+   * destroyed at exit can always use it.
+   */
+  static ExportedResults& getExportedResults() {
+    static auto* const r = new ExportedResults;
+    return *r;
+  }  // end of getExportedResults
+
+  void BehaviourProfiler::exportResults() const {
+    if (this->output_file.empty()) {
+      return;
+    }
+    const auto e = std::string{".csv"};
+    const auto& n = this->output_file;
+    const auto csv = (n.size() >= e.size()) &&
+                     (n.compare(n.size() - e.size(), e.size(), e) == 0);
+    auto os = std::ostringstream{};
+    if (csv) {
+      this->exportToCSV(os);
+    } else {
+      this->exportToJSON(os);
+    }
+    auto& er = getExportedResults();
+    auto lock = std::lock_guard<std::mutex>(er.m);
+    auto& results = er.results[n];
+    results[this->identifier] = os.str();
+    std::ofstream f(n);
+    tfel::raise_if(!f, "BehaviourProfiler::exportResults: "
+                   "can't open file '" + n + "'");
+    if (csv) {
+      auto first = true;
+      for (const auto& r : results) {
+        if (first) {
+          f << r.second;
+        } else {
+          // skipping the header
+          const auto pos = r.second.find('\n');
+          if (pos != std::string::npos) {
+            f << r.second.substr(pos + 1);
+          }
+        }
+        first = false;
+      }
+    } else if (results.size() == 1) {
+      f << results.begin()->second;
+    } else {
+      auto first = true;
+      f << "[\n";
+      for (const auto& r : results) {
+        // the trailing newline is removed
+        f << (first ? "" : ",\n") << r.second.substr(0, r.second.size() - 1);
+        first = false;
       }
+      f << "\n]\n";
+    }
+  }  // end of BehaviourProfiler::exportResults
+
+  BehaviourProfiler::~BehaviourProfiler() {
+    try {
+      this->print(std::cout);
+      this->exportResults();
+    } catch (std::exception& e) {
+      std::cerr << "BehaviourProfiler::~BehaviourProfiler: " << e.what()
+                << '\n';
+    } catch (...) {
     }
-    std::cout << std::endl;
   }  // end of BehaviourProfiler::~BehaviourProfiler
 
 }  // end of namespace mfront
@@ -32,6 +32,10 @@ namespace mfront {
     return false;
   }
 
+  bool BroydenSolverBase::solvesLinearSystemsWithTheJacobian() const {
+    return false;
+  }
+
   void BroydenSolverBase::writeSpecificMembers(std::ostream&,
                                                const BehaviourDescription&,
                                                const Hypothesis) const {
@@ -0,0 +1,122 @@
+/*!
+ * \file  mfront/src/CastemGenericPlaneStressHandlerStatistics.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cstdlib>
+#include <ostream>
+#include <iostream>
+#include <algorithm>
+#include "MFront/Castem/CastemGenericPlaneStressHandlerStatistics.hxx"
+
+namespace castem {
+
+  CastemGenericPlaneStressHandlerStatistics&
+  CastemGenericPlaneStressHandlerStatistics::getStatistics() {
+    static CastemGenericPlaneStressHandlerStatistics s;
+    return s;
+  }  // end of getStatistics
+
+  CastemGenericPlaneStressHandlerStatistics::
+      CastemGenericPlaneStressHandlerStatistics() {
+    this->reset();
+    this->print_at_exit =
+        ::getenv("CASTEM_GENERIC_PLANE_STRESS_STATISTICS") != nullptr;
+  }  // end of CastemGenericPlaneStressHandlerStatistics
+
+  void CastemGenericPlaneStressHandlerStatistics::registerCall(
+      const unsigned int n, const bool b) {
+    const auto i = std::min(static_cast<std::size_t>(n), histogramSize - 1);
+    this->histogram[i].fetch_add(1, std::memory_order_relaxed);
+    this->integrations.fetch_add(n, std::memory_order_relaxed);
+    if (b) {
+      this->fallbacks.fetch_add(1, std::memory_order_relaxed);
+    }
+    auto m = this->maximum.load(std::memory_order_relaxed);
+    while ((n > m) && (!this->maximum.compare_exchange_weak(
+                          m, n, std::memory_order_relaxed))) {
+    }
+  }  // end of registerCall
+
+  std::size_t CastemGenericPlaneStressHandlerStatistics::getNumberOfCalls()
+      const {
+    auto r = std::size_t{};
+    for (const auto& c : this->histogram) {
+      r += c.load(std::memory_order_relaxed);
+    }
+    return r;
+  }  // end of getNumberOfCalls
+
+  std::size_t CastemGenericPlaneStressHandlerStatistics::getNumberOfCalls(
+      const unsigned int n) const {
+    const auto i = std::min(static_cast<std::size_t>(n), histogramSize - 1);
+    return this->histogram[i].load(std::memory_order_relaxed);
+  }  // end of getNumberOfCalls
+
+  std::size_t
+  CastemGenericPlaneStressHandlerStatistics::getNumberOfIntegrations() const {
+    return this->integrations.load(std::memory_order_relaxed);
+  }  // end of getNumberOfIntegrations
+
+  std::size_t CastemGenericPlaneStressHandlerStatistics::getNumberOfFallbacks()
+      const {
+    return this->fallbacks.load(std::memory_order_relaxed);
+  }  // end of getNumberOfFallbacks
+
+  unsigned int
+  CastemGenericPlaneStressHandlerStatistics::getMaximumNumberOfIntegrations()
+      const {
+    return this->maximum.load(std::memory_order_relaxed);
+  }  // end of getMaximumNumberOfIntegrations
+
+  void CastemGenericPlaneStressHandlerStatistics::reset() {
+    for (auto& c : this->histogram) {
+      c.store(0, std::memory_order_relaxed);
+    }
+    this->integrations.store(0, std::memory_order_relaxed);
+    this->fallbacks.store(0, std::memory_order_relaxed);
+    this->maximum.store(0, std::memory_order_relaxed);
+  }  // end of reset
+
+  void CastemGenericPlaneStressHandlerStatistics::print(
+      std::ostream& os) const {
+    const auto nc = this->getNumberOfCalls();
+    const auto ni = this->getNumberOfIntegrations();
+    os << "generic plane stress handler statistics:\n"
+       << "- number of calls: " << nc << '\n'
+       << "- number of integrations: " << ni << '\n';
+    if (nc != 0) {
+      os << "- mean number of integrations: "
+         << static_cast<double>(ni) / static_cast<double>(nc) << '\n';
+    }
+    os << "- maximum number of integrations: "
+       << this->getMaximumNumberOfIntegrations() << '\n'
+       << "- number of fallbacks to the secant algorithm: "
+       << this->getNumberOfFallbacks() << '\n';
+    for (std::size_t i = 0; i != histogramSize; ++i) {
+      const auto c = this->histogram[i].load(std::memory_order_relaxed);
+      if (c != 0) {
+        os << "- calls with " << i
+           << ((i == histogramSize - 1) ? " integrations or more: "
+                                        : " integrations: ")
+           << c << '\n';
+      }
+    }
+  }  // end of print
+
+  CastemGenericPlaneStressHandlerStatistics::
+      ~CastemGenericPlaneStressHandlerStatistics() {
+    if ((this->print_at_exit) && (this->getNumberOfCalls() != 0)) {
+      this->print(std::cerr);
+    }
+  }  // end of ~CastemGenericPlaneStressHandlerStatistics
+
+}  // end of namespace castem
@@ -175,6 +175,9 @@ namespace mfront {
   const char* const CastemInterface::maximumSubStepping =
       "castem::::maximumSubStepping";
 
+  const char* const CastemInterface::genericPlaneStressAlgorithm =
+      "castem::genericPlaneStressAlgorithm";
+
   static void checkFiniteStrainStrategy(const std::string& fs) {
     tfel::raise_if((fs != "None") && (fs != "FiniteRotationSmallStrain") &&
                        (fs != "MieheApelLambrechtLogarithmicStrain") &&
@@ -344,7 +347,9 @@ namespace mfront {
                      (key != "@CastemFiniteStrainStrategy") &&
                      (key != "@UMATFiniteStrainStrategy") &&
                      (key != "@CastemFiniteStrainStrategies") &&
-                     (key != "@UMATFiniteStrainStrategies"),
+                     (key != "@UMATFiniteStrainStrategies") &&
+                     (key != "@CastemGenericPlaneStressAlgorithm") &&
+                     (key != "@UMATGenericPlaneStressAlgorithm"),
                  "unsupported keyword '" + key + "'");
       } else {
         return {false, current};
@@ -387,6 +392,20 @@ namespace mfront {
       bd.setAttribute(CastemInterface::doSubSteppingOnInvalidResults,
                       this->readBooleanValue(key, current, end), false);
       return {true, current};
+    } else if ((key == "@CastemGenericPlaneStressAlgorithm") ||
+               (key == "@UMATGenericPlaneStressAlgorithm")) {
+      throw_if(current == end, "unexpected end of file");
+      const auto a = current->value;
+      throw_if((a != "Secant") && (a != "Newton"),
+               "invalid generic plane stress algorithm '" + a +
+                   "'. Valid algorithms are 'Secant' and 'Newton'");
+      ++(current);
+      throw_if(current == end, "unexpected end of file");
+      throw_if(current->value != ";",
+               "expected ';', read '" + current->value + '\'');
+      ++(current);
+      bd.setAttribute(CastemInterface::genericPlaneStressAlgorithm, a, false);
+      return {true, current};
     } else if ((key == "@CastemFiniteStrainStrategy") ||
                (key == "@UMATFiniteStrainStrategy")) {
       throw_if(bd.hasAttribute(CastemInterface::finiteStrainStrategies),
@@ -760,6 +779,19 @@ namespace mfront {
                "maximum number of substeps defined.\n"
                "Please use the @CastemMaximumSubStepping directive");
     }
+    if ((mb.getAttribute<std::string>(
+             CastemInterface::genericPlaneStressAlgorithm, "Secant") ==
+         "Newton") &&
+        (this->usesGenericPlaneStressAlgorithm(mb))) {
+      throw_if(!mb.getAttribute(ModellingHypothesis::GENERALISEDPLANESTRAIN,
+                                BehaviourData::hasConsistentTangentOperator,
+                                false),
+               "the Newton algorithm of the generic plane stress handler "
+               "requires the behaviour to provide a consistent tangent "
+               "operator in generalised plane strain.\n"
+               "Please use the secant algorithm or define the consistent "
+               "tangent operator");
+    }
 
     systemCall::mkdir("include/MFront");
     systemCall::mkdir("include/MFront/Castem");
@@ -2779,6 +2811,15 @@ namespace mfront {
     } else {
       out << "0u;\n";
     }
+    out << "static " << constexpr_c
+        << " bool useNewtonGenericPlaneStressAlgorithm = ";
+    if (mb.getAttribute<std::string>(
+            CastemInterface::genericPlaneStressAlgorithm, "Secant") ==
+        "Newton") {
+      out << "true;\n";
+    } else {
+      out << "false;\n";
+    }
     if (mb.getAttribute(BehaviourDescription::requiresStiffnessTensor, false)) {
       out << "static " << constexpr_c
           << " bool requiresStiffnessTensor = true;\n";
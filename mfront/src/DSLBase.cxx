@@ -12,7 +12,10 @@
  * project under specific licensing conditions.
  */
 
+#include <map>
+#include <mutex>
 #include <cctype>
+#include <future>
 #include <iterator>
 #include <sstream>
 #include <stdexcept>
@@ -23,6 +26,7 @@
 #endif /* MFRONT_HAVE_MADNEX */
 
 #include "TFEL/Raise.hxx"
+#include "TFEL/System/System.hxx"
 #include "TFEL/Math/IntegerEvaluator.hxx"
 #include "TFEL/UnicodeSupport/UnicodeSupport.hxx"
 #include "TFEL/Utilities/Data.hxx"
@@ -897,14 +901,95 @@ namespace mfront {
     }
   }  // end of treatLink
 
+  //! \brief result of the treatment of an external file
+  struct ExternalMFrontFileTreatment {
+    //! \brief description of the targets
+    TargetsDescription td;
+    //! \brief files imported or included by the external file
+    std::vector<std::string> deps;
+  };  // end of ExternalMFrontFileTreatment
+
+  /*!
+   * \return the key identifying the treatment of an external file
+   * \param[in] interfaces: interfaces
+   * \param[in] f: file
+   */
+  static std::string getExternalMFrontFileKey(
+      const std::vector<std::string>& interfaces, const std::string& f) {
+    auto key = std::string{};
+    try {
+      key = tfel::system::systemCall::getAbsolutePath(
+          SearchPathsHandler::search(f));
+    } catch (...) {
+      // the error, if any, will be reported by the treatment of the file
+      key = f;
+    }
+    auto sorted_interfaces = interfaces;
+    std::sort(sorted_interfaces.begin(), sorted_interfaces.end());
+    for (const auto& i : sorted_interfaces) {
+      key += '\n' + i;
+    }
+    return key;
+  }  // end of getExternalMFrontFileKey
+
+  /*!
+   * \brief treat an external file.
+   *
+   * An external file may be required by several input files, which may be
+   * treated concurrently (see the `--jobs` option of `mfront`). The output
+   * files of an external file must not be generated concurrently, so each
+   * external file is only treated once for a given set of interfaces: the
+   * other callers wait for the first treatment and reuse its result, or
+   * its error.
+   *
+   * \param[in] interfaces: interfaces
+   * \param[in] f: file
+   */
+  static const ExternalMFrontFileTreatment& treatExternalMFrontFile(
+      const std::vector<std::string>& interfaces, const std::string& f) {
+    using Result = std::shared_future<ExternalMFrontFileTreatment>;
+    static std::mutex m;
+    static std::map<std::string, Result> treatments;
+    const auto key = getExternalMFrontFileKey(interfaces, f);
+    auto p = std::promise<ExternalMFrontFileTreatment>{};
+    auto r = Result{};
+    auto first = false;
+    {
+      auto lock = std::lock_guard<std::mutex>(m);
+      const auto pr = treatments.find(key);
+      if (pr == treatments.end()) {
+        r = p.get_future().share();
+        treatments.insert({key, r});
+        first = true;
+      } else {
+        r = pr->second;
+      }
+    }
+    if (first) {
+      try {
+        MFront mf;
+        for (const auto& i : interfaces) {
+          mf.setInterface(i);
+        }
+        auto deps = std::vector<std::string>{};
+        auto td = mf.treatFile(deps, f);
+        p.set_value({std::move(td), std::move(deps)});
+      } catch (...) {
+        p.set_exception(std::current_exception());
+      }
+    }
+    // the shared state is kept alive by the registry of treatments
+    return r.get();
+  }  // end of treatExternalMFrontFile
+
   void DSLBase::callMFront(const std::vector<std::string>& interfaces,
                            const std::vector<std::string>& files) {
-    MFront m;
-    for (const auto& i : interfaces) {
-      m.setInterface(i);
-    }
     for (const auto& f : files) {
-      mergeTargetsDescription(this->td, m.treatFile(f), false);
+      const auto& r = treatExternalMFrontFile(interfaces, f);
+      // the dependencies are recorded even if the file was treated by
+      // another caller
+      SearchPathsHandler::recordFoundFiles(r.deps);
+      mergeTargetsDescription(this->td, r.td, false);
     }
   }  // end of callMFront
 
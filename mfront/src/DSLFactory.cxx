@@ -32,6 +32,7 @@ namespace mfront {
   DSLFactory::DSLFactory() = default;
 
   std::vector<std::string> DSLFactory::getRegistredDSLs(const bool b) const {
+    auto lock = std::lock_guard<std::mutex>(this->m);
     auto res = std::vector<std::string>{};
     for (const auto& p : this->generators) {
       res.push_back(p.first);
@@ -53,6 +54,7 @@ namespace mfront {
       tfel::raise("DSLFactory::registerDSLCreator: a DSL named '" + n +
                   "' has already been registred");
     };
+    auto lock = std::lock_guard<std::mutex>(this->m);
     if (!this->generators.insert({n, f}).second) {
       raise();
     }
@@ -69,9 +71,10 @@ namespace mfront {
 
   void DSLFactory::registerDSLAlias(const std::string& n,
                                     const std::string& a) {
-    auto raise = [](const std::string& m) {
-      tfel::raise("DSLFactory::registerAlias: " + m);
+    auto raise = [](const std::string& msg) {
+      tfel::raise("DSLFactory::registerAlias: " + msg);
     };
+    auto lock = std::lock_guard<std::mutex>(this->m);
     if (this->generators.find(n) == this->generators.end()) {
       tfel::raise("no DSL named '" + n + "' registred");
     }
@@ -89,17 +92,26 @@ namespace mfront {
 
   std::shared_ptr<AbstractDSL> DSLFactory::createNewDSL(
       const std::string& n, const AbstractDSL::DSLOptions& opts) const {
-    const auto rn = [this, &n]() -> const std::string& {
-      for (const auto& as : this->aliases) {
-        if (std::find(as.second.cbegin(), as.second.cend(), n) !=
-            as.second.cend()) {
-          return as.first;
+    // the generator is copied so that the DSL is created without
+    // holding the lock
+    const auto c = [this, &n]() -> DSLGenerator {
+      auto lock = std::lock_guard<std::mutex>(this->m);
+      const auto rn = [this, &n]() -> const std::string& {
+        for (const auto& as : this->aliases) {
+          if (std::find(as.second.cbegin(), as.second.cend(), n) !=
+              as.second.cend()) {
+            return as.first;
+          }
         }
+        return n;
+      }();
+      const auto p = this->generators.find(rn);
+      if (p == this->generators.end()) {
+        return {};
       }
-      return n;
+      return p->second;
     }();
-    const auto p = this->generators.find(rn);
-    if (p == this->generators.end()) {
+    if (!c) {
       auto msg =
           "DSLFactory::createNewDSL: "
           "no DSL named '" +
@@ -109,7 +121,6 @@ namespace mfront {
       }
       tfel::raise(msg);
     }
-    auto c = p->second;
     return c(opts);
   }  // end of createNewDSL
 
@@ -119,23 +130,29 @@ namespace mfront {
   }  // end of createNewParser
 
   std::string DSLFactory::getDSLDescription(const std::string& n) const {
-    const auto rn = [this, &n]() -> const std::string& {
-      for (const auto& as : this->aliases) {
-        if (std::find(as.second.cbegin(), as.second.cend(), n) !=
-            as.second.cend()) {
-          return as.first;
+    const auto c = [this, &n]() -> DescriptionGenerator {
+      auto lock = std::lock_guard<std::mutex>(this->m);
+      const auto rn = [this, &n]() -> const std::string& {
+        for (const auto& as : this->aliases) {
+          if (std::find(as.second.cbegin(), as.second.cend(), n) !=
+              as.second.cend()) {
+            return as.first;
+          }
         }
+        return n;
+      }();
+      const auto p = this->descriptions.find(rn);
+      if (p == this->descriptions.end()) {
+        return {};
       }
-      return n;
+      return p->second;
     }();
-    auto p = this->descriptions.find(rn);
-    if (p == this->descriptions.end()) {
+    if (!c) {
       tfel::raise(
           "DSLFactory::getDSLDescription: "
           "no DSL named '" +
           n + "'");
     }
-    auto c = p->second;
     return c();
   }  // end of getDSLDescription
 
@@ -0,0 +1,310 @@
+/*!
+ * \file   mfront/src/GenerationCache.cxx
+ * \brief  This file implements the GenerationCache class
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cstdio>
+#include <sstream>
+#include <fstream>
+#include <algorithm>
+#include <sys/stat.h>
+#if defined _WIN32 || defined _WIN64
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else /* defined _WIN32 || defined _WIN64 */
+#include <fcntl.h>
+#endif /* defined _WIN32 || defined _WIN64 */
+#include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/StringAlgorithms.hxx"
+#include "TFEL/System/System.hxx"
+#include "MFront/MFrontLock.hxx"
+#include "MFront/TargetsDescription.hxx"
+#include "MFront/GenerationCache.hxx"
+
+namespace mfront {
+
+  //! \brief first line of the file storing the cache
+  static const char* const cache_file_header = "mfront-generation-cache 1";
+
+  std::string GenerationCache::getFilePath() {
+    return "src" + tfel::system::dirStringSeparator() + "inputs.lst";
+  }  // end of getFilePath
+
+  std::string GenerationCache::hash(std::string_view s) {
+    // 64 bits FNV-1a hash
+    auto h = std::uint64_t{14695981039346656037u};
+    for (const auto c : s) {
+      h ^= static_cast<std::uint64_t>(static_cast<unsigned char>(c));
+      h *= std::uint64_t{1099511628211u};
+    }
+    char buffer[17];
+    std::snprintf(buffer, sizeof(buffer), "%016llx",
+                  static_cast<unsigned long long>(h));
+    return buffer;
+  }  // end of hash
+
+  std::string GenerationCache::hashFile(const std::string& f) {
+    std::ifstream file(f, std::ios::binary);
+    tfel::raise_if(!file,
+                   "GenerationCache::hashFile: "
+                   "can't open file '" +
+                       f + "'");
+    auto content = std::ostringstream{};
+    content << file.rdbuf();
+    return GenerationCache::hash(content.str());
+  }  // end of hashFile
+
+  std::string GenerationCache::hashInput(const std::string& f,
+                                         const std::vector<std::string>& deps,
+                                         const std::string& o) {
+    using tfel::utilities::starts_with;
+    if (starts_with(f, "madnex:")) {
+      return "";
+    }
+    try {
+      auto key = "input: " + GenerationCache::hashFile(f) + '\n';
+      for (const auto& d : deps) {
+        if (starts_with(d, "madnex:")) {
+          return "";
+        }
+        key += "dependency: " + d + ' ' + GenerationCache::hashFile(d) + '\n';
+      }
+      key += "options: " + o;
+      return GenerationCache::hash(key);
+    } catch (std::exception&) {
+    }
+    return "";
+  }  // end of hashInput
+
+  GenerationCache::ModificationTime GenerationCache::getModificationTime(
+      const std::string& f) {
+    struct stat s;
+    if (::stat(f.c_str(), &s) != 0) {
+      return 0;
+    }
+#if defined __APPLE__
+    return static_cast<ModificationTime>(s.st_mtimespec.tv_sec) * 1000000000 +
+           static_cast<ModificationTime>(s.st_mtimespec.tv_nsec);
+#elif (defined _WIN32 || defined _WIN64)
+    return static_cast<ModificationTime>(s.st_mtime) * 1000000000;
+#else
+    return static_cast<ModificationTime>(s.st_mtim.tv_sec) * 1000000000 +
+           static_cast<ModificationTime>(s.st_mtim.tv_nsec);
+#endif
+  }  // end of getModificationTime
+
+  void GenerationCache::setModificationTime(const std::string& f,
+                                            const ModificationTime t) {
+#if !(defined _WIN32 || defined _WIN64)
+    struct timespec times[2];
+    // the access time is left unchanged
+    times[0].tv_sec = 0;
+    times[0].tv_nsec = UTIME_OMIT;
+    times[1].tv_sec = static_cast<time_t>(t / 1000000000);
+    times[1].tv_nsec = static_cast<long>(t % 1000000000);
+    ::utimensat(AT_FDCWD, f.c_str(), times, 0);
+#else  /* !(defined _WIN32 || defined _WIN64) */
+    // number of intervals of 100 nanoseconds between the 1st of January
+    // 1601 (origin of the FILETIME structure) and the 1st of January 1970
+    constexpr auto offset = std::int64_t{116444736000000000};
+    const auto h = ::CreateFileA(f.c_str(), FILE_WRITE_ATTRIBUTES,
+                                 FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                                 OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (h == INVALID_HANDLE_VALUE) {
+      return;
+    }
+    const auto v = static_cast<ULONGLONG>(t / 100 + offset);
+    FILETIME ft;
+    ft.dwLowDateTime = static_cast<DWORD>(v & 0xFFFFFFFF);
+    ft.dwHighDateTime = static_cast<DWORD>(v >> 32);
+    // the creation and access times are left unchanged
+    ::SetFileTime(h, nullptr, nullptr, &ft);
+    ::CloseHandle(h);
+#endif /* !(defined _WIN32 || defined _WIN64) */
+  }    // end of setModificationTime
+
+  std::map<std::string, GenerationCache::ModificationTime>
+  GenerationCache::getGeneratedFiles(const TargetsDescription& t) {
+    using tfel::system::dirStringSeparator;
+    auto files = std::map<std::string, ModificationTime>{};
+    auto add = [&files](const std::string& f) {
+      const auto mt = GenerationCache::getModificationTime(f);
+      if (mt != 0) {
+        files[f] = mt;
+      }
+    };
+    for (const auto& l : t.libraries) {
+      for (const auto& s : l.sources) {
+        add("src" + dirStringSeparator() + s);
+      }
+    }
+    for (const auto& h : t.headers) {
+      add("include" + dirStringSeparator() + h);
+    }
+    return files;
+  }  // end of getGeneratedFiles
+
+  bool GenerationCache::read() {
+    MFrontLockGuard lock;
+    this->inputs.clear();
+    this->generated_files.clear();
+    std::ifstream file(GenerationCache::getFilePath());
+    if (!file) {
+      return false;
+    }
+    auto line = std::string{};
+    if ((!std::getline(file, line)) || (line != cache_file_header)) {
+      return false;
+    }
+    auto current = this->inputs.end();
+    while (std::getline(file, line)) {
+      const auto pos = line.find(' ');
+      const auto key = line.substr(0, pos);
+      const auto value =
+          (pos == std::string::npos) ? std::string{} : line.substr(pos + 1);
+      if (key == "input") {
+        current = this->inputs.insert({value, InputDescription{}}).first;
+      } else if (key == "generated_file") {
+        auto is = std::istringstream(value);
+        auto d = GeneratedFileDescription{};
+        auto f = std::string{};
+        is >> d.hash >> d.mtime;
+        is.get();
+        std::getline(is, f);
+        if ((!is) || (f.empty())) {
+          this->inputs.clear();
+          this->generated_files.clear();
+          return false;
+        }
+        this->generated_files[f] = d;
+      } else if ((current != this->inputs.end()) && (key == "hash")) {
+        current->second.hash = value;
+      } else if ((current != this->inputs.end()) && (key == "dependency")) {
+        current->second.dependencies.push_back(value);
+      } else if ((current != this->inputs.end()) && (key == "library")) {
+        current->second.libraries.push_back(value);
+      } else if ((current != this->inputs.end()) && (key == "file")) {
+        current->second.files.push_back(value);
+      } else {
+        this->inputs.clear();
+        this->generated_files.clear();
+        return false;
+      }
+    }
+    return true;
+  }  // end of read
+
+  void GenerationCache::write() const {
+    MFrontLockGuard lock;
+    const auto f = GenerationCache::getFilePath();
+    std::ofstream file(f);
+    tfel::raise_if(!file,
+                   "GenerationCache::write: "
+                   "can't open file '" +
+                       f + "'");
+    file << cache_file_header << '\n';
+    for (const auto& [n, i] : this->inputs) {
+      file << "input " << n << '\n'  //
+           << "hash " << i.hash << '\n';
+      for (const auto& d : i.dependencies) {
+        file << "dependency " << d << '\n';
+      }
+      for (const auto& l : i.libraries) {
+        file << "library " << l << '\n';
+      }
+      for (const auto& g : i.files) {
+        file << "file " << g << '\n';
+      }
+    }
+    for (const auto& [n, d] : this->generated_files) {
+      file << "generated_file " << d.hash << ' ' << d.mtime << ' ' << n
+           << '\n';
+    }
+  }  // end of write
+
+  bool GenerationCache::isUpToDate(const std::string& f,
+                                   const std::string& o,
+                                   const TargetsDescription& t) const {
+    const auto p = this->inputs.find(f);
+    if ((p == this->inputs.end()) || (p->second.hash.empty())) {
+      return false;
+    }
+    const auto& i = p->second;
+    for (const auto& l : i.libraries) {
+      if (!describes(t, l)) {
+        return false;
+      }
+    }
+    for (const auto& g : i.files) {
+      if (GenerationCache::getModificationTime(g) == 0) {
+        return false;
+      }
+    }
+    return GenerationCache::hashInput(f, i.dependencies, o) == i.hash;
+  }  // end of isUpToDate
+
+  void GenerationCache::update(const std::string& f,
+                               const std::vector<std::string>& deps,
+                               const std::string& o,
+                               const TargetsDescription& td) {
+    using tfel::system::dirStringSeparator;
+    auto i = InputDescription{};
+    i.hash = GenerationCache::hashInput(f, deps, o);
+    if (i.hash.empty()) {
+      this->inputs.erase(f);
+      return;
+    }
+    i.dependencies = deps;
+    for (const auto& l : td.libraries) {
+      i.libraries.push_back(l.name);
+      for (const auto& s : l.sources) {
+        i.files.push_back("src" + dirStringSeparator() + s);
+      }
+    }
+    for (const auto& h : td.headers) {
+      i.files.push_back("include" + dirStringSeparator() + h);
+    }
+    this->inputs[f] = std::move(i);
+  }  // end of update
+
+  void GenerationCache::updateGeneratedFiles(
+      const std::map<std::string, ModificationTime>& before,
+      const std::map<std::string, ModificationTime>& after) {
+    auto files = std::map<std::string, GeneratedFileDescription>{};
+    for (const auto& [f, t] : after) {
+      const auto pb = before.find(f);
+      const auto pc = this->generated_files.find(f);
+      if ((pb != before.end()) && (pb->second == t)) {
+        // the file has not been modified
+        if (pc != this->generated_files.end()) {
+          files.insert(*pc);
+        }
+        continue;
+      }
+      try {
+        const auto h = GenerationCache::hashFile(f);
+        if ((pb != before.end()) && (pc != this->generated_files.end()) &&
+            (pc->second.mtime == pb->second) && (pc->second.hash == h)) {
+          // the file has been rewritten with the same content
+          GenerationCache::setModificationTime(f, pb->second);
+          files.insert(*pc);
+        } else {
+          files[f] = GeneratedFileDescription{h, t};
+        }
+      } catch (std::exception&) {
+      }
+    }
+    this->generated_files.swap(files);
+  }  // end of updateGeneratedFiles
+
+}  // end of namespace mfront
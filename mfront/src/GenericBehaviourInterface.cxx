@@ -1024,7 +1024,8 @@ namespace mfront {
     out << "#ifndef " << hg << "\n"
         << "#define " << hg << "\n\n"
         << "#include\"TFEL/Config/TFELConfig.hxx\"\n"
-        << "#include\"MFront/GenericBehaviour/BehaviourData.h\"\n\n";
+        << "#include\"MFront/GenericBehaviour/BehaviourData.h\"\n"
+        << "#include\"MFront/GenericBehaviour/BatchBehaviourData.h\"\n\n";
 
     this->writeVisibilityDefines(out);
     out << "#ifdef __cplusplus\n"
@@ -1053,6 +1054,12 @@ namespace mfront {
           << " */\n"
           << "MFRONT_SHAREDOBJ int " << f
           << "(mfront_gb_BehaviourData* const);\n\n";
+      out << "/*!\n"
+          << " * \\brief integrate a block of integration points\n"
+          << " * \\param[in,out] d: material data\n"
+          << " */\n"
+          << "MFRONT_SHAREDOBJ int " << f
+          << "_integrateBatch(mfront_gb_BatchBehaviourData* const);\n\n";
       // postprocessings
       for (const auto& p : d.getPostProcessings()) {
         out << "/*!\n"
@@ -1120,6 +1127,7 @@ namespace mfront {
       }
     }
     out << "#include\"MFront/GenericBehaviour/GenericBehaviourTraits.hxx\"\n";
+    out << "#include\"MFront/GenericBehaviour/BatchIntegrate.hxx\"\n";
     // behaviour integration
     if ((type == BehaviourDescription::GENERALBEHAVIOUR) ||
         (type == BehaviourDescription::COHESIVEZONEMODEL)) {
@@ -1228,6 +1236,39 @@ namespace mfront {
     this->writeSetOutOfBoundsPolicyFunctionImplementation(out, bd, name);
     // parameters
     this->writeSetParametersFunctionsImplementations(out, bd, name);
+    // call to the integration of one integration point
+    auto integrate_call = [&bd, type, is_finite_strain_through_strain_measure](
+                              const std::string& d,
+                              const std::string& p) -> std::string {
+      if ((type == BehaviourDescription::GENERALBEHAVIOUR) ||
+          (type == BehaviourDescription::COHESIVEZONEMODEL)) {
+        return "mfront::gb::integrate<Behaviour>(" + d +
+               ", Behaviour::STANDARDTANGENTOPERATOR, " + p + ")";
+      } else if (type == BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) {
+        if (is_finite_strain_through_strain_measure) {
+          const auto ms = bd.getStrainMeasure();
+          if (ms == BehaviourDescription::GREENLAGRANGE) {
+            return "mfront::gb::green_lagrange_strain::integrate<Behaviour>(" +
+                   d + ", " + p + ")";
+          } else if (ms == BehaviourDescription::HENCKY) {
+            return "mfront::gb::logarithmic_strain::integrate<Behaviour>(" +
+                   d + ", " + p + ")";
+          }
+          tfel::raise(
+              "GenericBehaviourInterface::endTreatment: "
+              "unsupported strain measure");
+        }
+        return "mfront::gb::integrate<Behaviour>(" + d +
+               ", Behaviour::STANDARDTANGENTOPERATOR, " + p + ")";
+      } else if (type ==
+                 BehaviourDescription::STANDARDFINITESTRAINBEHAVIOUR) {
+        return "mfront::gb::finite_strain::integrate<Behaviour>(" + d + ", " +
+               p + ")";
+      }
+      tfel::raise(
+          "GenericBehaviourInterface::endTreatment: "
+          "unsupported behaviour type");
+    };
     // behaviour implementations
     for (const auto h : mhs) {
       const auto& d = bd.getBehaviourData(h);
@@ -1304,37 +1345,8 @@ namespace mfront {
       if (this->shallGenerateMTestFileOnFailure(bd)) {
         out << "using mfront::SupportedTypes;\n";
       }
-      if ((type == BehaviourDescription::GENERALBEHAVIOUR) ||
-          (type == BehaviourDescription::COHESIVEZONEMODEL)) {
-        out << "const auto r = mfront::gb::integrate<Behaviour>(*d, "
-            << "Behaviour::STANDARDTANGENTOPERATOR, " << name
-            << "_getOutOfBoundsPolicy());\n";
-      } else if (type == BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) {
-        if (is_finite_strain_through_strain_measure) {
-          const auto ms = bd.getStrainMeasure();
-          if (ms == BehaviourDescription::GREENLAGRANGE) {
-            out << "const auto r = "
-                << "mfront::gb::green_lagrange_strain::integrate<Behaviour>("
-                << "*d, " << name << "_getOutOfBoundsPolicy());\n";
-          } else if (ms == BehaviourDescription::HENCKY) {
-            out << "const auto r = "
-                << "mfront::gb::logarithmic_strain::integrate<Behaviour>("
-                << "*d, " << name << "_getOutOfBoundsPolicy());\n";
-          } else {
-            raise("unsupported strain measure");
-          }
-        } else {
-          out << "const auto r = mfront::gb::integrate<Behaviour>(*d, "
-              << "Behaviour::STANDARDTANGENTOPERATOR, " << name
-              << "_getOutOfBoundsPolicy());\n";
-        }
-      } else if (type == BehaviourDescription::STANDARDFINITESTRAINBEHAVIOUR) {
-        out << "const auto r = "
-            << "mfront::gb::finite_strain::integrate<Behaviour>(*d, "  //
-            << name << "_getOutOfBoundsPolicy());\n";
-      } else {
-        raise("unsupported behaviour type");
-      }
+      out << "const auto r = "
+          << integrate_call("*d", name + "_getOutOfBoundsPolicy()") << ";\n";
       if (this->shallGenerateMTestFileOnFailure(bd)) {
         out << "if(r!=1){\n";
         this->generateMTestFile(out, bd, h);
@@ -1342,6 +1354,34 @@ namespace mfront {
       }
       out << "return r;\n"
           << "} // end of " << f << "\n\n";
+      // batch integration. The out of bounds policy is retrieved once per
+      // block. The function integrating one integration point is called
+      // if profiling or the generation of mtest files on failure are
+      // requested, since it handles them.
+      out << "MFRONT_SHAREDOBJ int " << f
+          << "_integrateBatch(mfront_gb_BatchBehaviourData* const d){\n";
+      if ((bd.getAttribute(BehaviourData::profiling, false)) ||
+          (this->shallGenerateMTestFileOnFailure(bd))) {
+        out << "return mfront::gb::integrateBatch(*d, " << f << ");\n";
+      } else {
+        out << "using namespace tfel::material;\n"
+            << "using real = mfront::gb::real;\n"
+            << "constexpr auto h = ModellingHypothesis::"
+            << ModellingHypothesis::toUpperCaseString(h) << ";\n";
+        if (bd.useQt()) {
+          out << "using Behaviour = " << bd.getClassName()
+              << "<h,real,true>;\n";
+        } else {
+          out << "using Behaviour = " << bd.getClassName()
+              << "<h,real,false>;\n";
+        }
+        out << "const auto policy = " << name << "_getOutOfBoundsPolicy();\n"
+            << "return mfront::gb::integrateBatch(*d, "
+            << "[policy](mfront_gb_BehaviourData* const pd){\n"
+            << "return " << integrate_call("*pd", "policy") << ";\n"
+            << "});\n";
+      }
+      out << "} // end of " << f << "_integrateBatch\n\n";
     }
     // postprocessings
     for (const auto h : mhs) {
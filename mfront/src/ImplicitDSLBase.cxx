@@ -83,6 +83,157 @@ namespace mfront {
     }
   }  // end of declareViewsFromArrayOfVariables
 
+  /*!
+   * \brief write the body of the `solveLinearSystem` method when some
+   * integration variables are eliminated by static condensation.
+   *
+   * The jacobian is split in blocks associated with the retained (r) and
+   * the condensed (c) unknowns. The block \(J_{cc}\) is assumed to be
+   * diagonal, so that the linear system is reduced to the Schur
+   * complement \(J_{rr}-J_{rc}\,J_{cc}^{-1}\,J_{cr}\), factorized by
+   * `TinyMatrixSolve`, the condensed unknowns being recovered afterwards.
+   *
+   * The structure of the block \(J_{cc}\) is checked at each call: the
+   * resolution fails if an off-diagonal term of this block is not
+   * negligible compared to the associated diagonal term or if a diagonal
+   * term is negligible compared to the other terms of its row.
+   *
+   * \param[in] os: output stream
+   * \param[in] n: name of the behaviour
+   * \param[in] variables: integration variables
+   * \param[in] cvs: names of the condensed variables
+   */
+  static void writeSolveLinearSystemByStaticCondensation(
+      std::ostream& os,
+      const std::string& n,
+      const VariableDescriptionContainer& variables,
+      const std::vector<std::string>& cvs) {
+    auto nr = SupportedTypes::TypeSize();
+    auto nc = SupportedTypes::TypeSize();
+    auto write_indices = [&os, &variables, &cvs](const std::string& a,
+                                                 const bool condensed) {
+      auto o = SupportedTypes::TypeSize();
+      os << "{\n"
+         << "auto mfront_k = ushort{0};\n";
+      for (const auto& v : variables) {
+        const auto s = SupportedTypes::getTypeSize(v.type, v.arraySize);
+        const auto b = std::find(cvs.begin(), cvs.end(), v.name) != cvs.end();
+        if (b == condensed) {
+          os << "for(ushort mfront_idx = 0; mfront_idx != " << s
+             << "; ++mfront_idx, ++mfront_k){\n"
+             << a << "(mfront_k) = " << o << " + mfront_idx;\n"
+             << "}\n";
+        }
+        o += s;
+      }
+      os << "}\n";
+    };
+    for (const auto& v : variables) {
+      const auto s = SupportedTypes::getTypeSize(v.type, v.arraySize);
+      if (std::find(cvs.begin(), cvs.end(), v.name) != cvs.end()) {
+        nc += s;
+      } else {
+        nr += s;
+      }
+    }
+    auto nt = nr;
+    nt += nc;
+    os << "// static condensation of the integration variables:";
+    for (const auto& v : cvs) {
+      os << " " << v;
+    }
+    os << "\n"
+       << "constexpr auto mfront_nc = ushort(" << nc << ");\n"
+       << "tfel::math::tvector<mfront_nc, ushort> mfront_ci;\n";
+    write_indices("mfront_ci", true);
+    os << "// check of the structure of the condensed block and invert of its "
+          "diagonal\n"
+       << "constexpr auto mfront_eps = "
+       << "10 * std::numeric_limits<NumericType>::epsilon();\n"
+       << "tfel::math::tvector<mfront_nc, NumericType> mfront_id;\n"
+       << "for(ushort mfront_k = 0; mfront_k != mfront_nc; ++mfront_k){\n"
+       << "const auto mfront_ck = mfront_ci(mfront_k);\n"
+       << "const auto mfront_d = "
+       << "tfel::math::abs(mfront_matrix(mfront_ck, mfront_ck));\n"
+       << "for(ushort mfront_l = 0; mfront_l != mfront_nc; ++mfront_l){\n"
+       << "const auto mfront_a = "
+       << "tfel::math::abs(mfront_matrix(mfront_ck, mfront_ci(mfront_l)));\n"
+       << "if((mfront_l != mfront_k) && (mfront_a > mfront_eps * mfront_d)){\n";
+    if (getDebugMode()) {
+      os << "std::cout << \"" << n << "::solveLinearSystem: "
+         << "the jacobian block associated with the condensed integration "
+         << "variables is not diagonal\\n\";\n";
+    }
+    os << "return false;\n"
+       << "}\n"
+       << "}\n"
+       << "auto mfront_m = mfront_d;\n"
+       << "for(ushort mfront_j = 0; mfront_j != " << nt
+       << "; ++mfront_j){\n"
+       << "mfront_m = std::max(mfront_m, "
+       << "tfel::math::abs(mfront_matrix(mfront_ck, mfront_j)));\n"
+       << "}\n"
+       << "if(mfront_d <= mfront_eps * mfront_m){\n"
+       << "return false;\n"
+       << "}\n"
+       << "mfront_id(mfront_k) = 1 / mfront_matrix(mfront_ck, mfront_ck);\n"
+       << "}\n";
+    if (nr.isNull()) {
+      os << "for(ushort mfront_k = 0; mfront_k != mfront_nc; ++mfront_k){\n"
+         << "mfront_vector(mfront_ci(mfront_k)) *= mfront_id(mfront_k);\n"
+         << "}\n";
+      return;
+    }
+    os << "constexpr auto mfront_nr = ushort(" << nr << ");\n"
+       << "tfel::math::tvector<mfront_nr, ushort> mfront_ri;\n";
+    write_indices("mfront_ri", false);
+    os << "// Schur complement and condensed right hand side\n"
+       << "tfel::math::tmatrix<mfront_nr, mfront_nr, NumericType> mfront_S;\n"
+       << "tfel::math::tvector<mfront_nr, NumericType> mfront_g;\n"
+       << "for(ushort mfront_i = 0; mfront_i != mfront_nr; ++mfront_i){\n"
+       << "mfront_g(mfront_i) = mfront_vector(mfront_ri(mfront_i));\n"
+       << "for(ushort mfront_j = 0; mfront_j != mfront_nr; ++mfront_j){\n"
+       << "mfront_S(mfront_i, mfront_j) = "
+       << "mfront_matrix(mfront_ri(mfront_i), mfront_ri(mfront_j));\n"
+       << "}\n"
+       << "}\n"
+       << "for(ushort mfront_k = 0; mfront_k != mfront_nc; ++mfront_k){\n"
+       << "const auto mfront_ck = mfront_ci(mfront_k);\n"
+       << "const auto mfront_yk = "
+       << "mfront_vector(mfront_ck) * mfront_id(mfront_k);\n"
+       << "for(ushort mfront_i = 0; mfront_i != mfront_nr; ++mfront_i){\n"
+       << "const auto mfront_a = mfront_matrix(mfront_ri(mfront_i), "
+          "mfront_ck);\n"
+       << "if(tfel::math::ieee754::fpclassify(mfront_a) == FP_ZERO){\n"
+       << "continue;\n"
+       << "}\n"
+       << "mfront_g(mfront_i) -= mfront_a * mfront_yk;\n"
+       << "const auto mfront_b = mfront_a * mfront_id(mfront_k);\n"
+       << "for(ushort mfront_j = 0; mfront_j != mfront_nr; ++mfront_j){\n"
+       << "mfront_S(mfront_i, mfront_j) -= "
+       << "mfront_b * mfront_matrix(mfront_ck, mfront_ri(mfront_j));\n"
+       << "}\n"
+       << "}\n"
+       << "}\n"
+       << "if(!tfel::math::TinyMatrixSolve<mfront_nr, NumericType, false>"
+       << "::exe(mfront_S, mfront_g)){\n"
+       << "return false;\n"
+       << "}\n"
+       << "// recovering the condensed unknowns\n"
+       << "for(ushort mfront_k = 0; mfront_k != mfront_nc; ++mfront_k){\n"
+       << "const auto mfront_ck = mfront_ci(mfront_k);\n"
+       << "auto mfront_r = mfront_vector(mfront_ck);\n"
+       << "for(ushort mfront_j = 0; mfront_j != mfront_nr; ++mfront_j){\n"
+       << "mfront_r -= mfront_matrix(mfront_ck, mfront_ri(mfront_j)) * "
+          "mfront_g(mfront_j);\n"
+       << "}\n"
+       << "mfront_vector(mfront_ck) = mfront_r * mfront_id(mfront_k);\n"
+       << "}\n"
+       << "for(ushort mfront_i = 0; mfront_i != mfront_nr; ++mfront_i){\n"
+       << "mfront_vector(mfront_ri(mfront_i)) = mfront_g(mfront_i);\n"
+       << "}\n";
+  }  // end of writeSolveLinearSystemByStaticCondensation
+
   ImplicitDSLBase::ImplicitDSLBase(const DSLOptions& opts)
       : BehaviourDSLBase<ImplicitDSLBase>(opts) {
     constexpr auto uh = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
@@ -138,6 +289,9 @@ namespace mfront {
         "@PerturbationValueForNumericalJacobianComputation",
         &ImplicitDSLBase::
             treatPerturbationValueForNumericalJacobianComputation);
+    this->registerNewCallBack(
+        "@NumericalJacobianComputationScheme",
+        &ImplicitDSLBase::treatNumericalJacobianComputationScheme);
     this->registerNewCallBack("@IterMax", &ImplicitDSLBase::treatIterMax);
     this->registerNewCallBack("@MaximumNumberOfIterations",
                               &ImplicitDSLBase::treatIterMax);
@@ -182,6 +336,9 @@ namespace mfront {
     this->registerNewCallBack(
         "@NumericallyComputedJacobianBlocks",
         &ImplicitDSLBase::treatNumericallyComputedJacobianBlocks);
+    this->registerNewCallBack(
+        "@CondensedIntegrationVariables",
+        &ImplicitDSLBase::treatCondensedIntegrationVariables);
     this->registerNewCallBack("@HillTensor", &ImplicitDSLBase::treatHillTensor);
     this->disableCallBack("@ComputedVar");
     //    this->disableCallBack("@UseQt");
@@ -625,6 +782,31 @@ namespace mfront {
     this->mb.setParameterDefaultValue(h, "numerical_jacobian_epsilon", epsilon);
   }  // ImplicitDSLBase::treatEpsilon
 
+  void ImplicitDSLBase::treatNumericalJacobianComputationScheme() {
+    const auto h = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
+    this->checkNotEndOfFile(
+        "ImplicitDSLBase::treatNumericalJacobianComputationScheme",
+        "Expected 'Centered' or 'Forward'.");
+    const auto s = this->current->value;
+    if ((s != "Centered") && (s != "Forward")) {
+      this->throwRuntimeError(
+          "ImplicitDSLBase::treatNumericalJacobianComputationScheme",
+          "Expected to read 'Centered' or 'Forward' instead of '" + s + "'.");
+    }
+    if (this->mb.hasAttribute(
+            h, BehaviourData::numericalJacobianComputationScheme)) {
+      this->throwRuntimeError(
+          "ImplicitDSLBase::treatNumericalJacobianComputationScheme",
+          "the finite difference scheme used to compute the numerical "
+          "jacobian has already been defined");
+    }
+    ++(this->current);
+    this->readSpecifiedToken(
+        "ImplicitDSLBase::treatNumericalJacobianComputationScheme", ";");
+    this->mb.setAttribute(h, BehaviourData::numericalJacobianComputationScheme,
+                          s);
+  }  // end of treatNumericalJacobianComputationScheme
+
   void ImplicitDSLBase::treatIterMax() {
     const auto h = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
     const auto iterMax =
@@ -1109,6 +1291,39 @@ namespace mfront {
     }
   }  // end of treatNumericallyComputedJacobianBlocks
 
+  void ImplicitDSLBase::treatCondensedIntegrationVariables() {
+    const std::string m = "ImplicitDSLBase::treatCondensedIntegrationVariables";
+    auto throw_if = [this, m](const bool b, const std::string& msg) {
+      if (b) {
+        this->throwRuntimeError(m, msg);
+      }
+    };
+    for (const auto& h : this->readHypothesesList()) {
+      const auto vs = this->readList(m, "{", "}", false);
+      this->readSpecifiedToken(m, ";");
+      throw_if(vs.empty(), "no variable defined");
+      auto cvs = std::vector<std::string>{};
+      if (this->mb.hasAttribute(h,
+                                BehaviourData::condensedIntegrationVariables)) {
+        cvs = this->mb.getAttribute<std::vector<std::string>>(
+            h, BehaviourData::condensedIntegrationVariables);
+      }
+      for (const auto& v : vs) {
+        throw_if(std::find(cvs.begin(), cvs.end(), v.value) != cvs.end(),
+                 "variable '" + v.value + "' multiply declared");
+        cvs.push_back(v.value);
+      }
+      if (this->mb.hasAttribute(h,
+                                BehaviourData::condensedIntegrationVariables)) {
+        this->mb.updateAttribute(
+            h, BehaviourData::condensedIntegrationVariables, cvs);
+      } else {
+        this->mb.setAttribute(h, BehaviourData::condensedIntegrationVariables,
+                              cvs);
+      }
+    }
+  }  // end of treatCondensedIntegrationVariables
+
   void ImplicitDSLBase::completeVariableDeclaration() {
     using namespace tfel::glossary;
     const auto uh = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
@@ -1347,6 +1562,22 @@ namespace mfront {
                "@CompareToNumericalJacobian can only be used with solver using "
                "an analytical jacobian (or an approximation of it");
     }
+    for (const auto& h : mh) {
+      if (!this->mb.hasAttribute(
+              h, BehaviourData::condensedIntegrationVariables)) {
+        continue;
+      }
+      throw_if(!this->solver->solvesLinearSystemsWithTheJacobian(),
+               "the static condensation of integration variables can only be "
+               "used with solvers based on the Newton-Raphson algorithm");
+      const auto& d = this->mb.getBehaviourData(h);
+      for (const auto& v : this->mb.getAttribute<std::vector<std::string>>(
+               h, BehaviourData::condensedIntegrationVariables)) {
+        throw_if(!d.isIntegrationVariableName(v),
+                 "invalid condensed variable '" + v +
+                     "', '" + v + "' is not an integration variable");
+      }
+    }
     // create the compute final stress code is necessary
     this->setComputeFinalThermodynamicForcesFromComputeFinalThermodynamicForcesCandidateIfNecessary();
     // correct prediction to take into account normalisation factors
@@ -2317,6 +2548,8 @@ namespace mfront {
       std::ostream& os, const Hypothesis h) const {
     const auto& d = this->mb.getBehaviourData(h);
     const auto n = d.getIntegrationVariables().getTypeSize();
+    const auto forward = NonLinearSystemSolverBase::
+        usesForwardFiniteDifferencesForNumericalJacobian(this->mb, h);
     this->checkBehaviourFile(os);
     os << "void computeNumericalJacobian("
        << "tfel::math::tmatrix<" << n << "," << n
@@ -2327,25 +2560,45 @@ namespace mfront {
        << "tvector<" << n << ", NumericType> tzeros(this->zeros);\n"
        << "tvector<" << n << ", NumericType> tfzeros(this->fzeros);\n"
        << "tmatrix<" << n << "," << n
-       << ", NumericType> tjacobian(this->jacobian);\n"
-       << "for(ushort mfront_idx = 0; mfront_idx != " << n
-       << "; ++mfront_idx){\n"
-       << "this->zeros(mfront_idx) -= this->numerical_jacobian_epsilon;\n";
-    if (this->mb.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
-      os << "this->computeThermodynamicForces();\n";
-    }
-    os << "this->computeFdF(true);\n"
-       << "this->zeros = tzeros;\n"
-       << "tvector<" << n << ", NumericType> tfzeros2(this->fzeros);\n"
-       << "this->zeros(mfront_idx) += this->numerical_jacobian_epsilon;\n";
-    if (this->mb.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
-      os << "this->computeThermodynamicForces();\n";
-    }
-    os << "this->computeFdF(true);\n"
-       << "this->fzeros = "
-          "(this->fzeros-tfzeros2) / (2 * "
-          "(this->numerical_jacobian_epsilon));\n"
-       << "for(ushort mfront_idx2 = 0; mfront_idx2!= " << n
+       << ", NumericType> tjacobian(this->jacobian);\n";
+    if (forward) {
+      // the residual at the current estimate is evaluated once, since
+      // `fzeros` is not guaranteed to be up to date when this method is
+      // called by the user (in `@InitializeJacobian` for instance)
+      if (this->mb.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
+        os << "this->computeThermodynamicForces();\n";
+      }
+      os << "this->computeFdF(true);\n"
+         << "tvector<" << n << ", NumericType> tfzeros2(this->fzeros);\n"
+         << "for(ushort mfront_idx = 0; mfront_idx != " << n
+         << "; ++mfront_idx){\n"
+         << "this->zeros(mfront_idx) += this->numerical_jacobian_epsilon;\n";
+      if (this->mb.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
+        os << "this->computeThermodynamicForces();\n";
+      }
+      os << "this->computeFdF(true);\n"
+         << "this->fzeros = "
+            "(this->fzeros-tfzeros2) / (this->numerical_jacobian_epsilon);\n";
+    } else {
+      os << "for(ushort mfront_idx = 0; mfront_idx != " << n
+         << "; ++mfront_idx){\n"
+         << "this->zeros(mfront_idx) -= this->numerical_jacobian_epsilon;\n";
+      if (this->mb.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
+        os << "this->computeThermodynamicForces();\n";
+      }
+      os << "this->computeFdF(true);\n"
+         << "this->zeros = tzeros;\n"
+         << "tvector<" << n << ", NumericType> tfzeros2(this->fzeros);\n"
+         << "this->zeros(mfront_idx) += this->numerical_jacobian_epsilon;\n";
+      if (this->mb.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
+        os << "this->computeThermodynamicForces();\n";
+      }
+      os << "this->computeFdF(true);\n"
+         << "this->fzeros = "
+            "(this->fzeros-tfzeros2) / (2 * "
+            "(this->numerical_jacobian_epsilon));\n";
+    }
+    os << "for(ushort mfront_idx2 = 0; mfront_idx2!= " << n
        << "; ++mfront_idx2){\n"
        << "njacobian(mfront_idx2,mfront_idx) = this->fzeros(mfront_idx2);\n"
        << "}\n"
@@ -2676,9 +2929,18 @@ namespace mfront {
       writeStandardPerformanceProfilingBegin(os, mb.getClassName(),
                                              "TinyMatrixSolve", "lu");
     }
-    os << "mfront_success = "
-       << this->solver->getExternalAlgorithmClassName(this->mb, h)
-       << "::solveLinearSystem(mfront_matrix, mfront_vector);\n";
+    if (this->mb.hasAttribute(h,
+                              BehaviourData::condensedIntegrationVariables)) {
+      writeSolveLinearSystemByStaticCondensation(
+          os, this->mb.getClassName(),
+          this->mb.getBehaviourData(h).getIntegrationVariables(),
+          this->mb.getAttribute<std::vector<std::string>>(
+              h, BehaviourData::condensedIntegrationVariables));
+    } else {
+      os << "mfront_success = "
+         << this->solver->getExternalAlgorithmClassName(this->mb, h)
+         << "::solveLinearSystem(mfront_matrix, mfront_vector);\n";
+    }
     if (mb.getAttribute(BehaviourData::profiling, false)) {
       writeStandardPerformanceProfilingEnd(os);
     }
@@ -22,6 +22,7 @@
 #include "MFront/MFrontLock.hxx"
 #include "MFront/FileDescription.hxx"
 #include "MFront/TargetsDescription.hxx"
+#include "MFront/LSDYNASymbolsGenerator.hxx"
 #include "MFront/LSDYNAInterface.hxx"
 
 namespace mfront {
@@ -168,27 +169,57 @@ namespace mfront {
           << "const lsdyna::LSDYNAInt *const nstatev,\n"
           << "const lsdyna::LSDYNAInt *const nfieldv,\n"
           << "const lsdyna::LSDYNAInt *const nprops,\n"
-          << "const lsdyna::LSDYNAInt * const lanneal,\n"
-          << "const double* const stepTime,\n"
-          << "const int)";
+          << "const lsdyna::LSDYNAReal *const dt,\n"
+          << "const lsdyna::LSDYNAReal *const props,\n"
+          << "const lsdyna::LSDYNAReal *const density,\n"
+          << "      lsdyna::LSDYNAReal *const strainInc,\n"
+          << "const lsdyna::LSDYNAReal *const tempOld,\n"
+          << "const lsdyna::LSDYNAReal *const fieldOld,\n"
+          << "const lsdyna::LSDYNAReal *const stressOld,\n"
+          << "const lsdyna::LSDYNAReal *const stateOld,\n"
+          << "const lsdyna::LSDYNAReal *const enerInternOld,\n"
+          << "const lsdyna::LSDYNAReal *const enerInelasOld,\n"
+          << "const lsdyna::LSDYNAReal *const tempNew,\n"
+          << "const lsdyna::LSDYNAReal *const fieldNew,\n"
+          << "lsdyna::LSDYNAReal *const stressNew,\n"
+          << "lsdyna::LSDYNAReal *const stateNew,\n"
+          << "lsdyna::LSDYNAReal *const enerInternNew,\n"
+          << "lsdyna::LSDYNAReal *const enerInelasNew)";
     } else {
-      out << "(const lsdyna::LSDYNAInt *const nblock,\n"
-          << "const int)";
+      out << "(const lsdyna::LSDYNAInt *const,\n"
+          << "const lsdyna::LSDYNAInt *const,\n"
+          << "const lsdyna::LSDYNAInt *const,\n"
+          << "const lsdyna::LSDYNAInt *const,\n"
+          << "const lsdyna::LSDYNAInt *const,\n"
+          << "const lsdyna::LSDYNAInt *const,\n"
+          << "const lsdyna::LSDYNAReal *const,\n"
+          << "const lsdyna::LSDYNAReal *const,\n"
+          << "const lsdyna::LSDYNAReal *const,\n"
+          << "      lsdyna::LSDYNAReal *const,\n"
+          << "const lsdyna::LSDYNAReal *const,\n"
+          << "const lsdyna::LSDYNAReal *const,\n"
+          << "const lsdyna::LSDYNAReal *const,\n"
+          << "const lsdyna::LSDYNAReal *const,\n"
+          << "const lsdyna::LSDYNAReal *const,\n"
+          << "const lsdyna::LSDYNAReal *const,\n"
+          << "const lsdyna::LSDYNAReal *const,\n"
+          << "const lsdyna::LSDYNAReal *const,\n"
+          << "lsdyna::LSDYNAReal *const,\n"
+          << "lsdyna::LSDYNAReal *const,\n"
+          << "lsdyna::LSDYNAReal *const,\n"
+          << "lsdyna::LSDYNAReal *const)";
     }
   }  // end of writeLSDYNAArguments
 
-  static void writeLSDYNAArguments(std::ostream& out) {
-    out << "(const lsdyna::LSDYNAInt *const,\n"
-        << "const double* const,\n"
-        << "const int)";
-  }  // end of writeLSDYNAArguments
-
   const char* const LSDYNAInterface::finiteStrainStrategy =
       "lsdyna::finiteStrainStrategy";
 
   const char* const LSDYNAInterface::orthotropyManagementPolicy =
       "lsdyna::orthotropyManagementPolicy";
 
+  const char* const LSDYNAInterface::parallelizationPolicy =
+      "lsdyna::parallelizationPolicy";
+
   std::set<LSDYNAInterface::Hypothesis>
   LSDYNAInterface::getModellingHypothesesToBeTreated(
       const BehaviourDescription& bd) const {
@@ -248,19 +279,34 @@ namespace mfront {
   std::string LSDYNAInterface::getName() { return "lsdyna"; }
 
   std::pair<bool, LSDYNAInterface::tokens_iterator>
-  LSDYNAInterface::treatKeyword(BehaviourDescription&,
+  LSDYNAInterface::treatKeyword(BehaviourDescription& bd,
                                 const std::string& key,
                                 const std::vector<std::string>& i,
                                 tokens_iterator current,
-                                const tokens_iterator) {
+                                const tokens_iterator end) {
+    auto throw_if = [](const bool c, const std::string& m) {
+      tfel::raise_if(c, "LSDYNAInterface::treatKeyword: " + m);
+    };
     if (!i.empty()) {
       if (std::find(i.begin(), i.end(), this->getName()) == i.end()) {
         return {false, current};
       }
-      tfel::raise(
-          "LSDYNAInterface::treatKeyword: "
-          "unsupported key '" +
-          key + "'");
+      throw_if(key != "@LSDYNAParallelizationPolicy",
+               "unsupported key '" + key + "'");
+    }
+    if (key == "@LSDYNAParallelizationPolicy") {
+      throw_if(bd.hasAttribute(LSDYNAInterface::parallelizationPolicy),
+               "parallelization policy already defined");
+      throw_if(current == end, "unexpected end of file");
+      throw_if((current->value != "None") && (current->value != "ThreadPool"),
+               "invalid parallelization policy '" + current->value + "'");
+      bd.setAttribute(LSDYNAInterface::parallelizationPolicy, current->value,
+                      false);
+      throw_if(++current == end, "unexpected end of file");
+      throw_if(current->value != ";",
+               "expected ';', read '" + current->value + '\'');
+      ++(current);
+      return {true, current};
     }
     return {false, current};
   }  // end of LSDYNAInterface::treatKeyword
@@ -280,9 +326,17 @@ namespace mfront {
     insert_if(l.link_directories,
               "$(shell " + tfel_config + " --library-path)");
     insert_if(l.link_libraries, tfel::getLibraryInstallName("LSDYNAInterface"));
-    insert_if(l.link_libraries, "$(shell " + tfel_config +
-                                    " --library-dependency "
-                                    "--material --mfront-profiling)");
+    if (bd.getAttribute<std::string>(LSDYNAInterface::parallelizationPolicy,
+                                     "None") == "ThreadPool") {
+      insert_if(l.link_libraries,
+                "$(shell " + tfel_config +
+                    " --library-dependency "
+                    "--material --system --mfront-profiling)");
+    } else {
+      insert_if(l.link_libraries, "$(shell " + tfel_config +
+                                      " --library-dependency "
+                                      "--material --mfront-profiling)");
+    }
     for (const auto h : this->getModellingHypothesesToBeTreated(bd)) {
       insert_if(l.epts, this->getFunctionNameForHypothesis(name, h));
     }
@@ -290,7 +344,7 @@ namespace mfront {
 
   void LSDYNAInterface::writeInterfaceSpecificIncludes(
       std::ostream& out, const BehaviourDescription&) const {
-    out << "#include\"MFront/LSDYNA/LSDYNAInterface.hxx\"\n\n";
+    out << "#include\"MFront/LSDYNA/LSDYNAExplicitInterface.hxx\"\n\n";
   }  // end of LSDYNAInterface::writeInterfaceSpecificIncludes
 
   void LSDYNAInterface::endTreatment(const BehaviourDescription& mb,
@@ -299,383 +353,649 @@ namespace mfront {
       tfel::raise_if(b, "LSDYNAInterface::endTreatment: " + m);
     };
     this->checkIfTemperatureIsDefinedAsTheFirstExternalStateVariable(mb);
-    //    checkOrthotropyManagementPolicyConsistency(mb);
-    throw_if(!((mb.getBehaviourType() ==
-                BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) ||
-               (mb.getBehaviourType() ==
-                BehaviourDescription::STANDARDFINITESTRAINBEHAVIOUR)),
-             "the LSDYNA interface only supports small and "
-             "finite strain behaviours");
-    //     throw_if((mb.getBehaviourType() ==
-    //               BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) &&
-    //                  (!hasFiniteStrainStrategy(mb)),
-    //              "behaviours written in the small strain framework "
-    //              "must be embedded in a strain strategy. See the "
-    //              "'@LSDYNAFiniteStrainStrategy' keyword");
+    throw_if(mb.getBehaviourType() !=
+                 BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR,
+             "the LSDYNA interface only supports small strain behaviours");
+    throw_if(hasFiniteStrainStrategy(mb) &&
+                 (getFiniteStrainStrategy(mb) != "Native"),
+             "the LSDYNA interface only supports the 'Native' "
+             "finite strain strategy");
+    throw_if(usesMFrontOrthotropyManagementPolicy(mb),
+             "the 'MFront' orthotropy management policy is not supported");
     // get the modelling hypotheses to be treated
     const auto& mh = this->getModellingHypothesesToBeTreated(mb);
     const auto name = mb.getLibrary() + mb.getClassName();
+    const auto ppolicy = mb.getAttribute<std::string>(
+        LSDYNAInterface::parallelizationPolicy, "None");
     // output directories
     tfel::system::systemCall::mkdir("include/MFront");
     tfel::system::systemCall::mkdir("include/MFront/LSDYNA");
     tfel::system::systemCall::mkdir("lsdyna");
     copyLSDYNAFiles();
-    //     // header
-    //     auto fname = "lsdyna" + name + ".hxx";
-    //     std::ofstream out("include/MFront/LSDYNA/" + fname);
-    //     throw_if(!out, "could not open file '" + fname + "'");
-    //
-    //     out << "/*!\n"
-    //         << "* \\file   " << fname << '\n'
-    //         << "* \\brief  This file declares the lsdyna
-    //         interface
-    //         for "
-    //            "the "
-    //         << mb.getClassName() << " behaviour law\n"
-    //         << "* \\author " << fd.authorName << '\n'
-    //         << "* \\date   " << fd.date << '\n'
-    //         << "*/\n\n";
-    //
-    //     const auto header = this->getHeaderGuard(mb);
-    //     out << "#ifndef " << header << "\n"
-    //         << "#define " << header << "\n\n"
-    //         << "#include\"TFEL/Config/TFELConfig.hxx\"\n"
-    //         << "#include\"MFront/LSDYNA/LSDYNA.hxx\"\n\n"
-    //         << "#ifdef __cplusplus\n"
-    //         << "#include\"MFront/LSDYNA/LSDYNATraits.hxx\"\n";
-    //     if (mb.getSymmetryType() == mfront::ORTHOTROPIC) {
-    //       out <<
-    //       "#include\"MFront/LSDYNA/LSDYNAOrthotropicBehaviour.hxx\"\n";
-    //     }
-    //     out << "#include\"TFEL/Material/" << mb.getClassName() <<
-    //     ".hxx\"\n"
-    //         << "#endif /* __cplusplus */\n\n";
-    //
-    //     this->writeVisibilityDefines(out);
-    //
-    //     out << "#ifdef __cplusplus\n\n"
-    //         << "namespace lsdyna{\n\n";
-    //
-    //     if (!mb.areAllMechanicalDataSpecialised(mh)) {
-    //       this->writeLSDYNABehaviourTraits(
-    //           out, mb, ModellingHypothesis::UNDEFINEDHYPOTHESIS);
-    //     }
-    //     for (const auto& h : mh) {
-    //       if (mb.hasSpecialisedMechanicalData(h)) {
-    //         this->writeLSDYNABehaviourTraits(out, mb, h);
-    //       }
-    //     }
-    //
-    //     out << "} // end of namespace lsdyna\n\n"
-    //         << "#endif /* __cplusplus */\n\n"
-    //         << "#ifdef __cplusplus\n"
-    //         << "extern \"C\"{\n"
-    //         << "#endif /* __cplusplus */\n\n";
-    //
-    //     this->writeSetOutOfBoundsPolicyFunctionDeclaration(out, name);
-    //     this->writeSetParametersFunctionsDeclarations(out, name, mb);
-    //
-    //     for (const auto& h : mh) {
-    //       out << "MFRONT_SHAREDOBJ void\n"
-    //           << this->getFunctionNameForHypothesis(name, h) << "_f";
-    //       writeLSDYNAArguments(out, "float");
-    //       out << ";\n\n";
-    //
-    //       out << "MFRONT_SHAREDOBJ void\n"
-    //           << this->getFunctionNameForHypothesis(name, h);
-    //       writeLSDYNAArguments(out, "double");
-    //       out << ";\n\n";
-    //     }
-    //
-    //     out << "#ifdef __cplusplus\n"
-    //         << "}\n"
-    //         << "#endif /* __cplusplus */\n\n"
-    //         << "#endif /* " << header << " */\n";
-    //
-    //     out.close();
-    //
-    //     fname = "lsdyna" + name + ".cxx";
-    //     out.open("src/" + fname);
-    //     throw_if(!out, "could not open file '" + fname + "'");
-    //
-    //     out << "/*!\n"
-    //         << "* \\file   " << fname << '\n'
-    //         << "* \\brief  This file implements the lsdyna
-    //         interface
-    //         for "
-    //            "the "
-    //         << mb.getClassName() << " behaviour law\n"
-    //         << "* \\author " << fd.authorName << '\n'
-    //         << "* \\date   " << fd.date << '\n'
-    //         << "*/\n\n";
-    //
-    //     out << "#include<cmath>\n"
-    //         << "#include<limits>\n"
-    //         << "#include<cstdlib>\n";
-    //     this->getExtraSrcIncludes(out, mb);
-    //
-    //     if (ppolicy == "ThreadPool") {
-    //       out << "#include\"TFEL/System/ThreadPool.hxx\"\n";
-    //     }
-    //     out << "#include\"TFEL/Material/OutOfBoundsPolicy.hxx\"\n"
-    //         << "#include\"TFEL/Material/" << mb.getClassName() <<
-    //         ".hxx\"\n";
-    //     if (mb.getAttribute(BehaviourData::profiling, false)) {
-    //       out << "#include\"MFront/BehaviourProfiler.hxx\"\n\n";
-    //     }
-    //     if (usesMFrontOrthotropyManagementPolicy(mb)) {
-    //       out << "#include\"MFront/LSDYNA/LSDYNARotation.hxx\"\n\n";
-    //     }
-    //     out <<
-    //     "#include\"MFront/LSDYNA/LSDYNAStressFreeExpansionHandler.hxx\"\n\n"
-    //         << "#include\"MFront/LSDYNA/LSDYNAInterface.hxx\"\n\n"
-    //         << "#include\"MFront/LSDYNA/lsdyna" << name <<
-    //         ".hxx\"\n\n";
-    //
-    //     this->writeGetOutOfBoundsPolicyFunctionImplementation(out, mb,
-    //     name);
-    //
-    //     if (ppolicy == "ThreadPool") {
-    //       out << "static size_t getLSDYNANumberOfThreads(){\n"
-    //           << "const auto nthreads =
-    //           ::getenv(\"LSDYNAEXPLICIT_NTHREADS\");\n"
-    //           << "if(nthreads==nullptr){\n"
-    //           << "return 4;\n"
-    //           << "}\n"
-    //           << "return std::stoi(nthreads);\n"
-    //           << "}\n\n";
-    //     }
-    //
-    //     out << "extern \"C\"{\n\n";
-    //
-    //     this->generateGeneralSymbols(out, name, mb, fd);
-    //     if (!mb.areAllMechanicalDataSpecialised(mh)) {
-    //       const auto uh = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
-    //       this->generateSymbols(out, name, uh, mb, fd);
-    //     }
-    //     for (const auto& h : mh) {
-    //       if (mb.hasSpecialisedMechanicalData(h)) {
-    //         this->generateSymbols(out, name, h, mb, fd);
-    //       }
-    //     }
-    //
-    //     this->writeSetParametersFunctionsImplementations(out, name, mb);
-    //     this->writeSetOutOfBoundsPolicyFunctionImplementation(out, mb,
-    //     name);
-    //
-    //     for (const auto h : mh) {
-    //       for (const std::string t : {"float", "double"}) {
-    //         out << "MFRONT_SHAREDOBJ void\n"
-    //             << this->getFunctionNameForHypothesis(name, h);
-    //         if (t == "float") {
-    //           out << "_f";
-    //         }
-    //         writeLSDYNAArguments(out, t, false);
-    //         out << "{\n"
-    //             << "using namespace tfel::math;\n"
-    //             << "using ModellingHypothesis = "
-    //                "tfel::material::ModellingHypothesis;\n"
-    //             << "using lsdyna::LSDYNATraits;\n"
-    //             << "using tfel::material::" << mb.getClassName() <<
-    //             ";\n"
-    //             << "using LSDYNAData = lsdyna::LSDYNAData<" << t <<
-    //             ">;\n"
-    //             << "constexpr const auto cste = Cste<" << t <<
-    //             ">::sqrt2;\n"
-    //             << "auto view = [&nblock](" << t << "* v){\n"
-    //             << "  return LSDYNAData::strided_iterator(v,*nblock);\n"
-    //             << "};\n"
-    //             << "auto cview = [&nblock](const " << t << "* v){\n"
-    //             << "  return
-    //             LSDYNAData::strided_const_iterator(v,*nblock);\n"
-    //             << "};\n"
-    //             << "auto cdiffview = [&nblock](const " << t << "* v1,\n"
-    //             << "                           const " << t << "*
-    //             v2){\n"
-    //             << "  return "
-    //                "LSDYNAData::diff_strided_const_iterator(LSDYNAData::strided_"
-    //                "const_iterator(v1,*nblock),\n"
-    //             << " "
-    //                "LSDYNAData::strided_const_iterator(v2,*nblock));\n"
-    //             << "};\n";
-    //         if (mb.getAttribute(BehaviourData::profiling, false)) {
-    //           out << "using mfront::BehaviourProfiler;\n"
-    //               << "using tfel::material::" << mb.getClassName() <<
-    //               "Profiler;\n"
-    //               << "BehaviourProfiler::Timer total_timer(" <<
-    //               mb.getClassName()
-    //               << "Profiler::getProfiler(),\n"
-    //               << "BehaviourProfiler::TOTALTIME);\n";
-    //         }
-    //         if (ppolicy == "ThreadPool") {
-    //           out << "static tfel::system::ThreadPool "
-    //                  "pool(getLSDYNANumberOfThreads());\n";
-    //         }
-    //         this->writeChecks(out, mb, t, h);
-    //         if (mb.getBehaviourType() ==
-    //             BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) {
-    //           throw_if(!hasFiniteStrainStrategy(mb),
-    //                    "no finite strain strategy defined");
-    //           const auto fs =
-    //           getFiniteStrainStrategy(mb);
-    //           if (fs == "Native") {
-    //             this->writeNativeBehaviourCall(out, mb, t, h);
-    //           } else if (fs == "FiniteRotationSmallStrain") {
-    //             this->writeFiniteRotationSmallStrainBehaviourCall(out,
-    //             mb, t,
-    //             h);
-    //           } else if (fs == "MieheApelLambrechtLogarithmicStrain") {
-    //             this->writeLogarithmicStrainBehaviourCall(out, mb, t,
-    //             h);
-    //           } else {
-    //             throw_if(true,
-    //                      "unsupported finite strain strategy (internal
-    //                      error)");
-    //           }
-    //         } else if (mb.getBehaviourType() ==
-    //                    BehaviourDescription::STANDARDFINITESTRAINBEHAVIOUR)
-    //                    {
-    //           this->writeFiniteStrainBehaviourCall(out, mb, t, h);
-    //         } else {
-    //           throw_if(true,
-    //                    "the LS-DYNA interface "
-    //                    "only supports small "
-    //                    "and finite strain behaviours");
-    //         }
-    //         out << "}\n\n";
-    //       }
-    //     }
-    //     out << "} // end of extern \"C\"\n";
-    //     out.close();
-    //     this->writeInputFileExample(mb, fd, false);
-  }
+    // header
+    auto fname = "lsdyna" + name + ".hxx";
+    std::ofstream out("include/MFront/LSDYNA/" + fname);
+    throw_if(!out, "could not open file '" + fname + "'");
+
+    out << "/*!\n"
+        << "* \\file   " << fname << '\n'
+        << "* \\brief  This file declares the lsdyna interface for the "
+        << mb.getClassName() << " behaviour law\n"
+        << "* \\author " << fd.authorName << '\n'
+        << "* \\date   " << fd.date << '\n'
+        << "*/\n\n";
+
+    const auto header = this->getHeaderGuard(mb);
+    out << "#ifndef " << header << "\n"
+        << "#define " << header << "\n\n"
+        << "#include\"TFEL/Config/TFELConfig.hxx\"\n"
+        << "#include\"MFront/LSDYNA/LSDYNA.hxx\"\n\n"
+        << "#ifdef __cplusplus\n"
+        << "#include\"MFront/LSDYNA/LSDYNATraits.hxx\"\n";
+    if (mb.getSymmetryType() == mfront::ORTHOTROPIC) {
+      out << "#include\"MFront/LSDYNA/LSDYNAOrthotropicBehaviour.hxx\"\n";
+    }
+    out << "#include\"TFEL/Material/" << mb.getClassName() << ".hxx\"\n"
+        << "#endif /* __cplusplus */\n\n";
+
+    this->writeVisibilityDefines(out);
+
+    out << "#ifdef __cplusplus\n\n"
+        << "namespace lsdyna{\n\n";
+
+    if (!mb.areAllMechanicalDataSpecialised(mh)) {
+      this->writeLSDYNABehaviourTraits(
+          out, mb, ModellingHypothesis::UNDEFINEDHYPOTHESIS);
+    }
+    for (const auto& h : mh) {
+      if (mb.hasSpecialisedMechanicalData(h)) {
+        this->writeLSDYNABehaviourTraits(out, mb, h);
+      }
+    }
+
+    out << "} // end of namespace lsdyna\n\n"
+        << "#endif /* __cplusplus */\n\n"
+        << "#ifdef __cplusplus\n"
+        << "extern \"C\"{\n"
+        << "#endif /* __cplusplus */\n\n";
+
+    this->writeSetParametersFunctionsDeclarations(out, mb, name);
+    this->writeSetOutOfBoundsPolicyFunctionDeclaration(out, name);
+
+    for (const auto& h : mh) {
+      out << "MFRONT_SHAREDOBJ void\n"
+          << this->getFunctionNameForHypothesis(name, h);
+      writeLSDYNAArguments(out, false);
+      out << ";\n\n";
+    }
 
-  //   static void writeGetRotationMatrix(std::ostream& out,
-  //                                      const LSDYNAInterface::Hypothesis h) {
-  //     if ((h == LSDYNAInterface::ModellingHypothesis::PLANESTRESS) ||
-  //         (h == LSDYNAInterface::ModellingHypothesis::AXISYMMETRICAL) ||
-  //         (h == LSDYNAInterface::ModellingHypothesis::PLANESTRAIN)) {
-  //       out << "const auto R =
-  //       lsdyna::getRotationMatrix2D(cview(stateOld+i));\n";
-  //     } else if (h == LSDYNAInterface::ModellingHypothesis::TRIDIMENSIONAL) {
-  //       out << "const auto R =
-  //       lsdyna::getRotationMatrix3D(cview(stateOld+i));\n";
-  //     } else {
-  //       tfel::raise("writeGetRotationMatrix: unsupported hypothesis");
-  //     }
-  //   }
+    out << "#ifdef __cplusplus\n"
+        << "}\n"
+        << "#endif /* __cplusplus */\n\n"
+        << "#endif /* " << header << " */\n";
+
+    out.close();
+
+    fname = "lsdyna" + name + ".cxx";
+    out.open("src/" + fname);
+    throw_if(!out, "could not open file '" + fname + "'");
+
+    out << "/*!\n"
+        << "* \\file   " << fname << '\n'
+        << "* \\brief  This file implements the lsdyna interface for the "
+        << mb.getClassName() << " behaviour law\n"
+        << "* \\author " << fd.authorName << '\n'
+        << "* \\date   " << fd.date << '\n'
+        << "*/\n\n";
+
+    out << "#include<cmath>\n"
+        << "#include<limits>\n"
+        << "#include<string>\n"
+        << "#include<vector>\n"
+        << "#include<utility>\n"
+        << "#include<cstdlib>\n"
+        << "#include<iostream>\n";
+    this->getExtraSrcIncludes(out, mb);
+
+    if (ppolicy == "ThreadPool") {
+      out << "#include\"TFEL/System/ThreadPool.hxx\"\n";
+    }
+    out << "#include\"TFEL/Material/OutOfBoundsPolicy.hxx\"\n"
+        << "#include\"TFEL/Material/" << mb.getClassName() << ".hxx\"\n";
+    if (mb.getAttribute(BehaviourData::profiling, false)) {
+      out << "#include\"MFront/BehaviourProfiler.hxx\"\n\n";
+    }
+    out << "#include\"MFront/LSDYNA/LSDYNAExplicitInterface.hxx\"\n\n"
+        << "#include\"MFront/LSDYNA/lsdyna" << name << ".hxx\"\n\n";
+
+    this->writeGetOutOfBoundsPolicyFunctionImplementation(out, mb, name);
+
+    if (ppolicy == "ThreadPool") {
+      out << "static size_t getLSDYNANumberOfThreads(){\n"
+          << "const auto nthreads = ::getenv(\"LSDYNAEXPLICIT_NTHREADS\");\n"
+          << "if(nthreads==nullptr){\n"
+          << "return 4;\n"
+          << "}\n"
+          << "return static_cast<size_t>(std::max(std::stoi(nthreads),1));\n"
+          << "}\n\n";
+    }
+
+    out << "extern \"C\"{\n\n";
+    LSDYNASymbolsGenerator sg;
+    sg.generateGeneralSymbols(out, *this, mb, fd, mh, name);
+    if (!mb.areAllMechanicalDataSpecialised(mh)) {
+      const auto uh = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
+      sg.generateSymbols(out, *this, mb, fd, name, uh);
+    }
+    for (const auto& h : mh) {
+      if (mb.hasSpecialisedMechanicalData(h)) {
+        sg.generateSymbols(out, *this, mb, fd, name, h);
+      }
+    }
+
+    this->writeSetParametersFunctionsImplementations(out, mb, name);
+    this->writeSetOutOfBoundsPolicyFunctionImplementation(out, mb, name);
+
+    for (const auto h : mh) {
+      out << "MFRONT_SHAREDOBJ void\n"
+          << this->getFunctionNameForHypothesis(name, h);
+      writeLSDYNAArguments(out, true);
+      out << "{\n"
+          << "using namespace tfel::math;\n"
+          << "using ModellingHypothesis = "
+             "tfel::material::ModellingHypothesis;\n"
+          << "using lsdyna::LSDYNATraits;\n"
+          << "using tfel::material::" << mb.getClassName() << ";\n"
+          << "using LSDYNAExplicitData = "
+             "lsdyna::LSDYNAExplicitData<lsdyna::LSDYNAReal>;\n"
+          << "constexpr const auto cste = "
+             "Cste<lsdyna::LSDYNAReal>::sqrt2;\n"
+          << "auto view = [&nblock](lsdyna::LSDYNAReal* v){\n"
+          << "  return LSDYNAExplicitData::strided_iterator(v,*nblock);\n"
+          << "};\n"
+          << "auto cview = [&nblock](const lsdyna::LSDYNAReal* v){\n"
+          << "  return "
+             "LSDYNAExplicitData::strided_const_iterator(v,*nblock);\n"
+          << "};\n"
+          << "auto cdiffview = [&nblock](const lsdyna::LSDYNAReal* v1,\n"
+          << "                           const lsdyna::LSDYNAReal* v2){\n"
+          << "  return "
+             "LSDYNAExplicitData::diff_strided_const_iterator("
+             "LSDYNAExplicitData::strided_const_iterator(v1,*nblock),\n"
+          << "                                                         "
+             "LSDYNAExplicitData::strided_const_iterator(v2,*nblock));\n"
+          << "};\n";
+      if (mb.getAttribute(BehaviourData::profiling, false)) {
+        out << "using mfront::BehaviourProfiler;\n"
+            << "using tfel::material::" << mb.getClassName() << "Profiler;\n"
+            << "BehaviourProfiler::Timer total_timer(" << mb.getClassName()
+            << "Profiler::getProfiler(),\n"
+            << "BehaviourProfiler::TOTALTIME);\n";
+      }
+      if (ppolicy == "ThreadPool") {
+        out << "static tfel::system::ThreadPool "
+               "pool(getLSDYNANumberOfThreads());\n";
+      }
+      this->writeChecks(out, mb, h);
+      this->writeNativeBehaviourIntegration(out, mb, h);
+      out << "}\n\n";
+    }
+    out << "} // end of extern \"C\"\n";
+    out.close();
+  }  // end of LSDYNAInterface::endTreatment
+
+  void LSDYNAInterface::writeLSDYNABehaviourTraits(
+      std::ostream& out,
+      const BehaviourDescription& mb,
+      const Hypothesis h) const {
+    const auto mvs = mb.getMainVariablesSize();
+    const auto mprops = this->buildMaterialPropertiesList(mb, h);
+    if (h == ModellingHypothesis::UNDEFINEDHYPOTHESIS) {
+      out << "template<tfel::material::ModellingHypothesis::Hypothesis "
+             "H,typename NumericType";
+    } else {
+      out << "template<typename NumericType";
+    }
+    if (mb.useQt()) {
+      out << ",bool use_qt";
+    }
+    out << ">\n"
+        << "struct LSDYNATraits<tfel::material::" << mb.getClassName() << "<";
+    if (h == ModellingHypothesis::UNDEFINEDHYPOTHESIS) {
+      out << "H";
+    } else {
+      out << "tfel::material::ModellingHypothesis::"
+          << ModellingHypothesis::toUpperCaseString(h);
+    }
+    out << ", NumericType," << (mb.useQt() ? "use_qt" : "false") << "> >\n"
+        << "{\n"
+        << "//! behaviour type\n"
+        << "static constexpr LSDYNABehaviourType btype = "
+           "lsdyna::STANDARDSTRAINBASEDBEHAVIOUR;\n"
+        << "//! space dimension\n";
+    if (h == ModellingHypothesis::UNDEFINEDHYPOTHESIS) {
+      out << "static constexpr unsigned short N = "
+             "tfel::material::ModellingHypothesisToSpaceDimension<H>::value;\n";
+    } else {
+      out << "static constexpr unsigned short N = "
+             "tfel::material::ModellingHypothesisToSpaceDimension<"
+          << "tfel::material::ModellingHypothesis::"
+          << ModellingHypothesis::toUpperCaseString(h) << ">::value;\n";
+    }
+    out << "// tiny vector size\n"
+        << "static constexpr unsigned short TVectorSize = N;\n"
+        << "// symmetric tensor size\n"
+        << "static constexpr unsigned short StensorSize = "
+           "tfel::math::StensorDimeToSize<N>::value;\n"
+        << "// tensor size\n"
+        << "static constexpr unsigned short TensorSize  = "
+           "tfel::math::TensorDimeToSize<N>::value;\n"
+        << "// size of the driving variable array\n"
+        << "static constexpr unsigned short GradientSize = " << mvs.first
+        << ";\n"
+        << "// size of the thermodynamic force variable array (STRESS)\n"
+        << "static constexpr unsigned short ThermodynamicForceVariableSize = "
+        << mvs.second << ";\n";
+    auto write_bool = [&out, &mb](const char* const n, const char* const a) {
+      out << "static constexpr bool " << n << " = "
+          << (mb.getAttribute(a, false) ? "true" : "false") << ";\n";
+    };
+    write_bool("requiresUnAlteredStiffnessTensor",
+               BehaviourDescription::requiresUnAlteredStiffnessTensor);
+    write_bool("requiresStiffnessTensor",
+               BehaviourDescription::requiresStiffnessTensor);
+    write_bool("requiresThermalExpansionCoefficientTensor",
+               BehaviourDescription::requiresThermalExpansionCoefficientTensor);
+    const auto bs =
+        mb.getAttribute(BehaviourDescription::requiresStiffnessTensor, false);
+    const auto ba = mb.getAttribute(
+        BehaviourDescription::requiresThermalExpansionCoefficientTensor, false);
+    if (mb.getSymmetryType() == mfront::ISOTROPIC) {
+      out << "static constexpr LSDYNASymmetryType type = lsdyna::ISOTROPIC;\n";
+    } else if (mb.getSymmetryType() == mfront::ORTHOTROPIC) {
+      out << "static constexpr LSDYNASymmetryType type = "
+             "lsdyna::ORTHOTROPIC;\n";
+    } else {
+      tfel::raise(
+          "LSDYNAInterface::writeLSDYNABehaviourTraits: "
+          "the LSDYNA interface only supports isotropic or "
+          "orthotropic behaviours");
+    }
+    // computing material properties size
+    auto msize = SupportedTypes::TypeSize{};
+    if (!mprops.first.empty()) {
+      const auto& m = mprops.first.back();
+      msize = m.offset;
+      msize += SupportedTypes::getTypeSize(m.type, m.arraySize);
+      msize -= mprops.second;
+    }
+    out << "static constexpr unsigned short material_properties_nb = "
+        << msize << ";\n";
+    if (mb.getElasticSymmetryType() == mfront::ISOTROPIC) {
+      out << "static constexpr LSDYNASymmetryType etype = lsdyna::ISOTROPIC;\n"
+          << "static constexpr unsigned short elasticPropertiesOffset = "
+          << (bs ? "2u" : "0u") << ";\n"
+          << "static constexpr unsigned short "
+             "thermalExpansionPropertiesOffset = "
+          << (ba ? "1u" : "0u") << ";\n";
+    } else if (mb.getElasticSymmetryType() == mfront::ORTHOTROPIC) {
+      out << "static constexpr LSDYNASymmetryType etype = "
+             "lsdyna::ORTHOTROPIC;\n"
+          << "static constexpr unsigned short elasticPropertiesOffset = "
+          << (bs ? "LSDYNAOrthotropicElasticPropertiesOffset<N>::value"
+                 : "0u")
+          << ";\n"
+          << "static constexpr unsigned short "
+             "thermalExpansionPropertiesOffset = "
+          << (ba ? "3u" : "0u") << ";\n";
+    } else {
+      tfel::raise(
+          "LSDYNAInterface::writeLSDYNABehaviourTraits: "
+          "the LSDYNA interface only supports isotropic or "
+          "orthotropic elastic behaviours");
+    }
+    out << "}; // end of class LSDYNATraits\n\n";
+  }  // end of LSDYNAInterface::writeLSDYNABehaviourTraits
+
+  void LSDYNAInterface::writeChecks(std::ostream& out,
+                                    const BehaviourDescription& mb,
+                                    const Hypothesis h) const {
+    out << "using BV = " << mb.getClassName()
+        << "<ModellingHypothesis::" << ModellingHypothesis::toUpperCaseString(h)
+        << ",lsdyna::LSDYNAReal,false>;\n"
+        << "constexpr unsigned short offset  = "
+           "(LSDYNATraits<BV>::elasticPropertiesOffset+\n"
+        << "                                          "
+           "LSDYNATraits<BV>::thermalExpansionPropertiesOffset);\n"
+        << "#ifndef MFRONT_LSDYNA_NORUNTIMECHECKS\n"
+        << "using Traits = tfel::material::MechanicalBehaviourTraits<BV>;\n"
+        << "constexpr unsigned short nprops_  = "
+           "LSDYNATraits<BV>::material_properties_nb;\n"
+        << "constexpr unsigned short NPROPS_  = offset+nprops_;\n"
+        << "constexpr unsigned short nstatev_ = "
+           "Traits::internal_variables_nb;\n"
+        << "constexpr unsigned short nfieldv_ = "
+           "Traits::external_variables_nb2;\n";
+    if (h == ModellingHypothesis::PLANESTRESS) {
+      out << "if(*ndir+*nshr!=4){\n"
+          << "std::cerr << \"" << mb.getClassName() << ":"
+          << " invalid number of components for symmetric tensors "
+          << "(\" << *ndir+*nshr << \" given, \" << 4 << \" expected)\\n\";\n"
+          << "::exit(-1);\n"
+          << "}\n";
+    } else if (h == ModellingHypothesis::TRIDIMENSIONAL) {
+      out << "if(*ndir+*nshr!=6){\n"
+          << "std::cerr << \"" << mb.getClassName() << ":"
+          << " invalid number of components for symmetric tensors "
+          << "(\" << *ndir+*nshr << \" given, \" << 6 << \" expected)\\n\";\n"
+          << "::exit(-1);\n"
+          << "}\n";
+    } else {
+      tfel::raise(
+          "LSDYNAInterface::writeChecks: "
+          "unsupported hypothesis");
+    }
+    out << "if(*nprops!=NPROPS_){\n"
+        << "std::cerr << \"" << mb.getClassName() << ":"
+        << " unmatched number of material properties "
+        << "(\" << *nprops << \" given, \" << NPROPS_ << \" expected)\\n\";\n"
+        << "::exit(-1);\n"
+        << "}\n"
+        << "if(*nstatev!=nstatev_){\n"
+        << "std::cerr << \"" << mb.getClassName() << ":"
+        << " unmatched number of internal state variables "
+        << "(\" << *nstatev << \" given, \" << nstatev_ << \" expected)\\n\";\n"
+        << "::exit(-1);\n"
+        << "}\n"
+        << "if(*nfieldv!=nfieldv_){\n"
+        << "std::cerr << \"" << mb.getClassName() << ":"
+        << " unmatched number of external state variables "
+        << "(\" << *nfieldv << \" given, \" << nfieldv_ << \" expected)\\n\";\n"
+        << "::exit(-1);\n"
+        << "}\n"
+        << "#else  /* MFRONT_LSDYNA_NORUNTIMECHECKS */\n"
+        << "static_cast<void>(ndir);\n"
+        << "static_cast<void>(nshr);\n"
+        << "static_cast<void>(nstatev);\n"
+        << "static_cast<void>(nfieldv);\n"
+        << "static_cast<void>(nprops);\n"
+        << "#endif /* MFRONT_LSDYNA_NORUNTIMECHECKS */\n";
+  }  // end of LSDYNAInterface::writeChecks
+
+  void LSDYNAInterface::writeNativeBehaviourIntegration(
+      std::ostream& out,
+      const BehaviourDescription& mb,
+      const Hypothesis h) const {
+    const auto name = mb.getLibrary() + mb.getClassName();
+    const auto n = this->getFunctionNameBasis(name);
+    if (h == ModellingHypothesis::PLANESTRESS) {
+      // axial strain !
+      const auto v = this->checkIfAxialStrainIsDefinedAndGetItsOffset(mb, h);
+      if (!v.first) {
+        // no axial strain
+        out << "std::cerr << \"no state variable standing for "
+            << "the axial strain (variable with the "
+            << "glossary name 'AxialStrain')\" << std::endl;\n";
+        out << "::exit(-1);\n";
+        return;
+      }
+    }
+    out << "// integration of the ith integration point\n"
+        << "auto integrate = [&](const int i){\n"
+        << "const LSDYNAExplicitData d = "
+           "{*dt,props+offset,props,*(density+i),\n"
+        << "                              *(tempOld+i),\n"
+        << "                              cview(fieldOld+i),\n"
+        << "                              cview(stateOld+i),\n"
+        << "                              *(enerInternOld+i),\n"
+        << "                              *(enerInelasOld+i),\n"
+        << "                              *(tempNew+i),\n"
+        << "                              cdiffview(fieldNew+i,fieldOld+i),\n"
+        << "                              view(stateNew+i),\n"
+        << "                              *(enerInternNew+i),\n"
+        << "                              *(enerInelasNew+i),\n"
+        << "                              " << n << "_getOutOfBoundsPolicy()"
+        << "};\n"
+        << "constexpr const lsdyna::LSDYNAReal zero = "
+           "lsdyna::LSDYNAReal(0);\n";
+    if (h == ModellingHypothesis::PLANESTRESS) {
+      const auto v = this->checkIfAxialStrainIsDefinedAndGetItsOffset(mb, h);
+      out << "const lsdyna::LSDYNAReal ezz_old = "
+          << "stateOld[i+" << v.second.getValueForDimension(2)
+          << "*(*nblock)];\n"
+          << "const stensor<2u,lsdyna::LSDYNAReal> eto  = "
+             "{zero,zero,zero,zero};\n"
+          << "const stensor<2u,lsdyna::LSDYNAReal> deto = "
+             "{*(strainInc+i),*(strainInc+i+*nblock),\n"
+          << "                                     "
+             "zero,cste*(*(strainInc+i+3*(*nblock)))};\n"
+          << "stensor<2u,lsdyna::LSDYNAReal> s    = "
+             "{*(stressOld+i),*(stressOld+i+*nblock),\n"
+          << "                                "
+             "zero,cste*(*(stressOld+i+3*(*nblock)))};\n"
+          << "auto sfeh = [](tfel::math::stensor<2u,lsdyna::LSDYNAReal>&,\n"
+          << "tfel::math::stensor<2u,lsdyna::LSDYNAReal>& de,\n"
+          << "const tfel::math::stensor<2u,lsdyna::LSDYNAReal>& dl0_l0,\n"
+          << "const tfel::math::stensor<2u,lsdyna::LSDYNAReal>& dl1_l0){\n"
+          << "de-=dl1_l0-dl0_l0;\n"
+          << "};\n";
+    } else if (h == ModellingHypothesis::TRIDIMENSIONAL) {
+      out << "const stensor<3u,lsdyna::LSDYNAReal> eto  = "
+             "{zero,zero,zero,zero,zero,zero};\n"
+          << "const stensor<3u,lsdyna::LSDYNAReal> deto = "
+             "{*(strainInc+i),*(strainInc+i+*nblock),\n"
+          << "                                      "
+             "*(strainInc+i+2*(*nblock)),cste*(*(strainInc+i+3*(*nblock))),\n"
+          << "                                      "
+             "cste*(*(strainInc+i+5*(*nblock))),cste*(*(strainInc+i+4*(*nblock)"
+             "))};\n"
+          << "stensor<3u,lsdyna::LSDYNAReal> s  = "
+             "{*(stressOld+i),*(stressOld+i+*nblock),\n"
+          << "                              "
+             "*(stressOld+i+2*(*nblock)),cste*(*(stressOld+i+3*(*nblock))),\n"
+          << "                              "
+             "cste*(*(stressOld+i+5*(*nblock))),cste*(*(stressOld+i+4*(*nblock)"
+             "))};\n"
+          << "auto sfeh = [](tfel::math::stensor<3u,lsdyna::LSDYNAReal>&,\n"
+          << "tfel::math::stensor<3u,lsdyna::LSDYNAReal>& de,\n"
+          << "const tfel::math::stensor<3u,lsdyna::LSDYNAReal>& dl0_l0,\n"
+          << "const tfel::math::stensor<3u,lsdyna::LSDYNAReal>& dl1_l0){\n"
+          << "de-=dl1_l0-dl0_l0;\n"
+          << "};\n";
+    } else {
+      tfel::raise(
+          "LSDYNAInterface::writeNativeBehaviourIntegration: "
+          "internal error, unsupported hypothesis");
+    }
+    out << "if(lsdyna::LSDYNAExplicitInterface<ModellingHypothesis::"
+        << ModellingHypothesis::toUpperCaseString(h)
+        << ",lsdyna::LSDYNAReal," << mb.getClassName()
+        << ">::integrate(s,d,eto,deto,sfeh)!=0){\n"
+        << "return false;\n"
+        << "}\n";
+    if (h == ModellingHypothesis::PLANESTRESS) {
+      const auto v = this->checkIfAxialStrainIsDefinedAndGetItsOffset(mb, h);
+      out << "const lsdyna::LSDYNAReal ezz_new = "
+          << "stateNew[i+" << v.second.getValueForDimension(2)
+          << "*(*nblock)];\n"
+          << "//strain update\n"
+          << "*(strainInc+i+2*(*(nblock))) = ezz_new-ezz_old;\n"
+          << "*(stressNew+i)               = s[0];\n"
+          << "*(stressNew+i+   *(nblock))  = s[1];\n"
+          << "*(stressNew+i+2*(*(nblock))) = zero;\n"
+          << "*(stressNew+i+3*(*(nblock))) = s[3]/cste;\n";
+    } else {
+      out << "*(stressNew+i)               = s[0];\n"
+          << "*(stressNew+i+   *(nblock))  = s[1];\n"
+          << "*(stressNew+i+2*(*(nblock))) = s[2];\n"
+          << "*(stressNew+i+3*(*(nblock))) = s[3]/cste;\n"
+          << "*(stressNew+i+4*(*(nblock))) = s[5]/cste;\n"
+          << "*(stressNew+i+5*(*(nblock))) = s[4]/cste;\n";
+    }
+    out << "return true;\n"
+        << "};\n";
+    this->writeIntegrateLoop(out, mb);
+  }  // end of LSDYNAInterface::writeNativeBehaviourIntegration
+
+  void LSDYNAInterface::writeIntegrateLoop(
+      std::ostream& out, const BehaviourDescription& mb) const {
+    const auto ppolicy = mb.getAttribute<std::string>(
+        LSDYNAInterface::parallelizationPolicy, "None");
+    // the integration points of a sub-block are treated until the first
+    // failure, which is returned with its description.
+    out << "auto integrate_sub_block = [&integrate](const int ib, "
+           "const int ie){\n"
+        << "for(int i=ib;i!=ie;++i){\n"
+        << "try{\n"
+        << "if(!integrate(i)){\n"
+        << "return std::make_pair(i,std::string(\"behaviour integration "
+           "failed\"));\n"
+        << "}\n"
+        << "} catch(std::exception& e){\n"
+        << "return std::make_pair(i,std::string(e.what()));\n"
+        << "} catch(...){\n"
+        << "return std::make_pair(i,std::string(\"unknown exception\"));\n"
+        << "}\n"
+        << "}\n"
+        << "return std::make_pair(-1,std::string());\n"
+        << "};\n"
+        << "auto report = [](const std::pair<int,std::string>& r){\n"
+        << "if(r.first==-1){\n"
+        << "return true;\n"
+        << "}\n"
+        << "std::cerr << \"" << mb.getClassName()
+        << ": \" << r.second << \" (integration point \" << r.first << "
+           "\")\\n\";\n"
+        << "return false;\n"
+        << "};\n";
+    if (ppolicy == "None") {
+      out << "if(!report(integrate_sub_block(0,*nblock))){\n"
+          << "::exit(-1);\n"
+          << "}\n";
+    } else if (ppolicy == "ThreadPool") {
+      // each thread treats about four sub-blocks. Every sub-block reports
+      // its own failure, so that all the failures of the block are
+      // reported before exiting.
+      out << "const auto nthreads = "
+             "std::max(static_cast<int>(pool.getNumberOfThreads()),1);\n"
+          << "const auto nsb = std::max(std::min(*nblock,4*nthreads),1);\n"
+          << "using SubBlockResult = "
+             "tfel::system::ThreadedTaskResult<std::pair<int,std::string>>;\n"
+          << "auto results = std::vector<std::future<SubBlockResult>>{};\n"
+          << "results.reserve(nsb);\n"
+          << "for(int b=0;b!=nsb;++b){\n"
+          << "const auto ib = ((*nblock)*b)/nsb;\n"
+          << "const auto ie = ((*nblock)*(b+1))/nsb;\n"
+          << "results.push_back(pool.addTask([&integrate_sub_block,ib,ie]{\n"
+          << "  return integrate_sub_block(ib,ie);\n"
+          << "}));\n"
+          << "}\n"
+          << "auto success = true;\n"
+          << "for(auto& f : results){\n"
+          << "auto r = f.get();\n"
+          << "success = report(*r) && success;\n"
+          << "}\n"
+          << "if(!success){\n"
+          << "::exit(-1);\n"
+          << "}\n";
+    } else {
+      tfel::raise(
+          "LSDYNAInterface::writeIntegrateLoop: "
+          "internal error (unsupported parallelization policy)");
+    }
+  }  // end of LSDYNAInterface::writeIntegrateLoop
 
   void LSDYNAInterface::writeBehaviourConstructorHeader(
       std::ostream& out,
       const BehaviourDescription& mb,
       const Hypothesis,
       const std::string& initStateVarsIncrements) const {
-    //     const auto iprefix = makeUpperCase(this->getInterfaceName());
-    //     const auto av = this->getBehaviourConstructorsAdditionalVariables();
-    //     const auto abdv =
-    //     this->getBehaviourDataConstructorAdditionalVariables();
-    //     const auto aidv =
-    //     this->getIntegrationDataConstructorAdditionalVariables();
-    //     out << "/*\n"
-    //         << " * \\brief constructor for the LS-DYNA interface\n"
-    //         << " * \\param[in] " << iprefix << "d : data\n"
-    //         << " */\n"
-    //         << mb.getClassName() << "(const lsdyna::LSDYNAData<NumericType>&
-    //         " << iprefix
-    //         << "d)\n";
-    //     if (mb.useQt()) {
-    //       out << ": " << mb.getClassName()
-    //           << "BehaviourData<hypothesis, NumericType,use_qt>(" << iprefix
-    //           << "d),\n"
-    //           << mb.getClassName() <<
-    //           "IntegrationData<hypothesis, NumericType,use_qt>("
-    //           << iprefix << "d)\n";
-    //     } else {
-    //       out << ": " << mb.getClassName()
-    //           << "BehaviourData<hypothesis, NumericType,false>(" << iprefix
-    //           << "d),\n"
-    //           << mb.getClassName() <<
-    //           "IntegrationData<hypothesis, NumericType,false>("
-    //           << iprefix << "d)\n";
-    //     }
-    //     if (!initStateVarsIncrements.empty()) {
-    //       out << ",\n" << initStateVarsIncrements;
-    //     }
+    const auto iprefix = makeUpperCase(this->getInterfaceName());
+    const auto qt = mb.useQt() ? "use_qt" : "false";
+    out << "/*\n"
+        << " * \\brief constructor for the LS-DYNA interface\n"
+        << " * \\param[in] " << iprefix << "d : data\n"
+        << " */\n"
+        << mb.getClassName()
+        << "(const lsdyna::LSDYNAExplicitData<NumericType>& " << iprefix
+        << "d)\n"
+        << ": " << mb.getClassName() << "BehaviourData<hypothesis, NumericType,"
+        << qt << ">(" << iprefix << "d),\n"
+        << mb.getClassName() << "IntegrationData<hypothesis, NumericType,"
+        << qt << ">(" << iprefix << "d)\n";
+    if (!initStateVarsIncrements.empty()) {
+      out << ",\n" << initStateVarsIncrements;
+    }
   }  // end of LSDYNAInterface::writeBehaviourConstructorHeader
 
   void LSDYNAInterface::writeBehaviourDataConstructor(
       std::ostream& out,
       const Hypothesis h,
       const BehaviourDescription& mb) const {
-    //     const auto& d = mb.getBehaviourData(h);
-    //     const auto iprefix = makeUpperCase(this->getInterfaceName());
-    //     const auto mprops = this->buildMaterialPropertiesList(mb, h);
-    //     const auto& persistentVarsHolder = d.getPersistentVariables();
-    //     const auto& externalStateVarsHolder = d.getExternalStateVariables();
-    //     out << "/*\n"
-    //         << " * \\brief constructor for the LS-DYNA interface\n"
-    //         << " * \\param[in] " << iprefix << "d : data\n"
-    //         << " */\n"
-    //         << mb.getClassName() << "BehaviourData"
-    //         << "(const lsdyna::LSDYNAData<NumericType>& " << iprefix <<
-    //         "d)\n: ";
-    //     bool first = true;
-    //     this->writeMaterialPropertiesInitializersInBehaviourDataConstructorI(
-    //         out, first, h, mb, mprops.first, mprops.second, iprefix +
-    //         "d.props", "",
-    //         "");
-    //     this->writeVariableInitializersInBehaviourDataConstructorI(
-    //         out, first, persistentVarsHolder, iprefix + "d.stateOld", "",
-    //         "");
-    //     if (!first) {
-    //       out << ",\n";
-    //     }
-    //     first = false;
-    //     out << "T(" << iprefix << "d.tempOld)";
-    //     this->writeVariableInitializersInBehaviourDataConstructorI(
-    //         out, first, std::next(externalStateVarsHolder.begin()),
-    //         externalStateVarsHolder.end(), iprefix + "d.fieldOld", "", "");
-    //     out << "\n{\n";
-    //     this->writeMaterialPropertiesInitializersInBehaviourDataConstructorII(
-    //         out, h, mb, mprops.first, mprops.second, iprefix + "d.props", "",
-    //         "");
-    //     this->writeVariableInitializersInBehaviourDataConstructorII(
-    //         out, mb, persistentVarsHolder, iprefix + "d.stateOld", "", "");
-    //     this->writeVariableInitializersInBehaviourDataConstructorII(
-    //         out, mb, std::next(externalStateVarsHolder.begin()),
-    //         externalStateVarsHolder.end(), iprefix + "d.fieldOld", "", "");
-    //     this->completeBehaviourDataConstructor(out, h, mb);
-    //     out << "}\n\n";
-  }
+    const auto& d = mb.getBehaviourData(h);
+    const auto iprefix = makeUpperCase(this->getInterfaceName());
+    const auto mprops = this->buildMaterialPropertiesList(mb, h);
+    const auto& persistentVarsHolder = d.getPersistentVariables();
+    const auto& externalStateVarsHolder = d.getExternalStateVariables();
+    out << "/*\n"
+        << " * \\brief constructor for the LS-DYNA interface\n"
+        << " * \\param[in] " << iprefix << "d : data\n"
+        << " */\n"
+        << mb.getClassName() << "BehaviourData"
+        << "(const lsdyna::LSDYNAExplicitData<NumericType>& " << iprefix
+        << "d)\n: ";
+    bool first = true;
+    this->writeMaterialPropertiesInitializersInBehaviourDataConstructorI(
+        out, first, h, mb, mprops.first, mprops.second, iprefix + "d.props", "",
+        "");
+    this->writeVariableInitializersInBehaviourDataConstructorI(
+        out, first, persistentVarsHolder, iprefix + "d.stateOld", "", "");
+    if (!first) {
+      out << ",\n";
+    }
+    first = false;
+    out << "T(" << iprefix << "d.tempOld)";
+    this->writeVariableInitializersInBehaviourDataConstructorI(
+        out, first, std::next(externalStateVarsHolder.begin()),
+        externalStateVarsHolder.end(), iprefix + "d.fieldOld", "", "");
+    out << "\n{\n";
+    this->writeMaterialPropertiesInitializersInBehaviourDataConstructorII(
+        out, h, mb, mprops.first, mprops.second, iprefix + "d.props", "", "");
+    this->writeVariableInitializersInBehaviourDataConstructorII(
+        out, mb, persistentVarsHolder, iprefix + "d.stateOld", "", "");
+    this->writeVariableInitializersInBehaviourDataConstructorII(
+        out, mb, std::next(externalStateVarsHolder.begin()),
+        externalStateVarsHolder.end(), iprefix + "d.fieldOld", "", "");
+    this->completeBehaviourDataConstructor(out, h, mb);
+    out << "}\n\n";
+  }  // end of LSDYNAInterface::writeBehaviourDataConstructor
 
   void LSDYNAInterface::writeIntegrationDataConstructor(
       std::ostream& out,
       const Hypothesis h,
       const BehaviourDescription& mb) const {
-    //     const auto av = this->getBehaviourConstructorsAdditionalVariables();
-    //     const auto aidv =
-    //     this->getIntegrationDataConstructorAdditionalVariables();
-    //     const auto& d = mb.getBehaviourData(h);
-    //     const auto iprefix = makeUpperCase(this->getInterfaceName());
-    //     const auto& externalStateVarsHolder = d.getExternalStateVariables();
-    //     out << "/*\n"
-    //         << " * \\brief constructor for the LS-DYNA interface\n"
-    //         << " * \\param[in] " << iprefix << "d : data"
-    //         << " */\n"
-    //         << mb.getClassName() << "IntegrationData"
-    //         << "(const lsdyna::LSDYNAData<NumericType>& " << iprefix << "d)"
-    //         << ": dt(" << iprefix << "d.dt),\n"
-    //         << "  dT(" << iprefix << "d.tempNew-" << iprefix << "d.tempOld)";
-    //     bool first = false;
-    //     this->writeVariableInitializersInBehaviourDataConstructorI(
-    //         out, first, std::next(externalStateVarsHolder.begin()),
-    //         externalStateVarsHolder.end(), iprefix + "d.dfield", "d", "");
-    //     out << "\n{\n";
-    //     this->writeVariableInitializersInBehaviourDataConstructorII(
-    //         out, mb, std::next(externalStateVarsHolder.begin()),
-    //         externalStateVarsHolder.end(), iprefix + "d.dfield", "d", "");
-    //     out << "}\n\n";
-  }
+    const auto& d = mb.getBehaviourData(h);
+    const auto iprefix = makeUpperCase(this->getInterfaceName());
+    const auto& externalStateVarsHolder = d.getExternalStateVariables();
+    out << "/*\n"
+        << " * \\brief constructor for the LS-DYNA interface\n"
+        << " * \\param[in] " << iprefix << "d : data"
+        << " */\n"
+        << mb.getClassName() << "IntegrationData"
+        << "(const lsdyna::LSDYNAExplicitData<NumericType>& " << iprefix
+        << "d)"
+        << ": dt(" << iprefix << "d.dt),\n"
+        << "  dT(" << iprefix << "d.tempNew-" << iprefix << "d.tempOld)";
+    bool first = false;
+    this->writeVariableInitializersInBehaviourDataConstructorI(
+        out, first, std::next(externalStateVarsHolder.begin()),
+        externalStateVarsHolder.end(), iprefix + "d.dfield", "d", "");
+    out << "\n{\n";
+    this->writeVariableInitializersInBehaviourDataConstructorII(
+        out, mb, std::next(externalStateVarsHolder.begin()),
+        externalStateVarsHolder.end(), iprefix + "d.dfield", "d", "");
+    out << "}\n\n";
+  }  // end of LSDYNAInterface::writeIntegrationDataConstructor
 
   void LSDYNAInterface::writeBehaviourDataMainVariablesSetters(
       std::ostream& os, const BehaviourDescription& mb) const {
@@ -772,12 +1092,13 @@ namespace mfront {
     if (!ivs.empty()) {
       out << "void exportStateData("
           << "Stensor& "
-          << iprefix + "s, const lsdyna::LSDYNAData<NumericType>& "
+          << iprefix + "s, const lsdyna::LSDYNAExplicitData<NumericType>& "
           << iprefix + "d) const\n";
     } else {
       out << "void exportStateData("
           << "Stensor& "
-          << iprefix + "s, const lsdyna::LSDYNAData<NumericType>&) const\n";
+          << iprefix +
+                 "s, const lsdyna::LSDYNAExplicitData<NumericType>&) const\n";
     }
     out << "{\n"
         << "using namespace tfel::math;\n"
@@ -789,85 +1110,6 @@ namespace mfront {
     out << "} // end of " << iprefix << "exportStateData\n\n";
   }
 
-  //   void LSDYNAInterface::writeChecks(std::ostream& out,
-  //                                     const BehaviourDescription& mb,
-  //                                     const std::string& t,
-  //                                     const Hypothesis h) const {
-  //     out << "#ifndef MFRONT_LSDYNA_NORUNTIMECHECKS\n"
-  //         << "using BV = " << mb.getClassName()
-  //         << "<ModellingHypothesis::" <<
-  //         ModellingHypothesis::toUpperCaseString(h)
-  //         << "," << t << ",false>;\n"
-  //         << "using Traits =
-  //         tfel::material::MechanicalBehaviourTraits<BV>;\n"
-  //         << "constexpr unsigned short offset  = "
-  //            "(LSDYNATraits<BV>::elasticPropertiesOffset+\n"
-  //         << "                                          "
-  //            "LSDYNATraits<BV>::thermalExpansionPropertiesOffset);\n"
-  //         << "constexpr unsigned short nprops_  = "
-  //            "LSDYNATraits<BV>::material_properties_nb;\n"
-  //         << "constexpr unsigned short NPROPS_  = offset+nprops_;\n"
-  //         << "constexpr unsigned short nstatev_ = "
-  //            "Traits::internal_variables_nb;\n"
-  //         << "constexpr unsigned short nfieldv_ = "
-  //            "Traits::external_variables_nb2;\n";
-  //     if ((h == ModellingHypothesis::AXISYMMETRICAL) ||
-  //         (h == ModellingHypothesis::PLANESTRAIN) ||
-  //         (h == ModellingHypothesis::PLANESTRESS)) {
-  //       out << "if(*ndir+*nshr!=4){\n"
-  //           << "std::cerr << \"" << mb.getClassName() << ":"
-  //           << " invalid number of components for symmetric tensors "
-  //           << "(\" << *ndir+*nshr << \" given, \" << 4 << \"
-  //           expected)\\n\";\n"
-  //           << "::exit(-1);\n"
-  //           << "}\n";
-  //     } else if (h == ModellingHypothesis::TRIDIMENSIONAL) {
-  //       out << "if(*ndir+*nshr!=6){\n"
-  //           << "std::cerr << \"" << mb.getClassName() << ":"
-  //           << " invalid number of components for symmetric tensors "
-  //           << "(\" << *ndir+*nshr << \" given, \" << 6 << \"
-  //           expected)\\n\";\n"
-  //           << "::exit(-1);\n"
-  //           << "}\n";
-  //     } else {
-  //       tfel::raise(
-  //           "LSDYNAInterface::writeChecks: "
-  //           "unsupported hypothesis");
-  //     }
-  //     out << "if(*nprops!=NPROPS_){\n"
-  //         << "std::cerr << \"" << mb.getClassName() << ":"
-  //         << " unmatched number of material properties "
-  //         << "(\" << *nprops << \" given, \" << NPROPS_ << \"
-  //         expected)\\n\";\n"
-  //         << "::exit(-1);\n"
-  //         << "}\n";
-  //     const auto o = this->getStateVariablesOffset(mb, h);
-  //     if (o == 0u) {
-  //       out << "if(*nstatev!=nstatev_){\n";
-  //     } else {
-  //       out << "if(*nstatev!=nstatev_+" << o << "){\n";
-  //     }
-  //     out << "std::cerr << \"" << mb.getClassName() << ":"
-  //         << " unmatched number of internal state variables ";
-  //     if (o == 0u) {
-  //       out << "(\" << *nstatev << \" given, \" << nstatev_ << \" "
-  //              "expected)\\n\";\n";
-  //     } else {
-  //       out << "(\" << *nstatev << \" given, \" << nstatev_+" << o
-  //           << " << \" expected)\\n\";\n";
-  //     }
-  //     out << "::exit(-1);\n"
-  //         << "}\n"
-  //         << "if(*nfieldv!=nfieldv_){\n"
-  //         << "std::cerr << \"" << mb.getClassName() << ":"
-  //         << " unmatched number of external state variables "
-  //         << "(\" << *nfieldv << \" given, \" << nfieldv_ << \"
-  //         expected)\\n\";\n"
-  //         << "::exit(-1);\n"
-  //         << "}\n"
-  //         << "#endif /* MFRONT_LSDYNA_NORUNTIMECHECKS */\n";
-  //  }  // end of LSDYNAInterface::writeChecks
-
   std::string LSDYNAInterface::getModellingHypothesisTest(
       const Hypothesis) const {
     return {};
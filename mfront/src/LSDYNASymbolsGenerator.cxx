@@ -13,6 +13,7 @@
 
 #include <ostream>
 #include "TFEL/Raise.hxx"
+#include "MFront/DSLUtilities.hxx"
 #include "MFront/BehaviourDescription.hxx"
 #include "MFront/StandardBehaviourInterface.hxx"
 #include "MFront/LSDYNASymbolsGenerator.hxx"
@@ -32,56 +33,31 @@ namespace mfront {
 
   void LSDYNASymbolsGenerator::writeBehaviourTypeSymbols(
       std::ostream& out,
-      const StandardBehaviourInterface&,
+      const StandardBehaviourInterface& i,
       const BehaviourDescription& mb,
       const std::string& name) const {
-    //     out << "MFRONT_SHAREDOBJ unsigned short " <<
-    //     this->getFunctionName(name)
-    //         << "_BehaviourType = ";
-    //     if (mb.getBehaviourType() ==
-    //         BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) {
-    //       tfel::raise_if(!hasFiniteStrainStrategy(mb),
-    //                      "LSDYNASymbolsGenerator::writeBehaviourTypeSymbols:
-    //                      "
-    //                      "behaviours written in the small strain framework
-    //                      "
-    //                      "must be embedded in a strain strategy");
-    //       out << "2u;\n\n";
-    //     } else if (mb.getBehaviourType() ==
-    //                BehaviourDescription::STANDARDFINITESTRAINBEHAVIOUR) {
-    //       out << "2u;\n\n";
-    //     } else {
-    //       tfel::raise(
-    //           "LSDYNASymbolsGenerator::writeBehaviourTypeSymbols: "
-    //           "unsupported behaviour type");
-    //     }
+    tfel::raise_if(mb.getBehaviourType() !=
+                       BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR,
+                   "LSDYNASymbolsGenerator::writeBehaviourTypeSymbols: "
+                   "unsupported behaviour type");
+    // small strain behaviours are treated in the corotational frame
+    // by the solver, as with the `Native` finite strain strategy of the
+    // abaqus explicit interface
+    exportUnsignedShortSymbol(
+        out, i.getFunctionNameBasis(name) + "_BehaviourType", 2u);
   }  // end of LSDYNASymbolsGenerator::writeBehaviourTypeSymbols
 
   void LSDYNASymbolsGenerator::writeBehaviourKinematicSymbols(
       std::ostream& out,
-      const StandardBehaviourInterface&,
+      const StandardBehaviourInterface& i,
       const BehaviourDescription& mb,
       const std::string& name) const {
-    //     out << "MFRONT_SHAREDOBJ unsigned short " <<
-    //     this->getFunctionName(name)
-    //         << "_BehaviourKinematic = ";
-    //     if (mb.getBehaviourType() ==
-    //         BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) {
-    //       tfel::raise_if(!hasFiniteStrainStrategy(mb),
-    //                      "LSDYNASymbolsGenerator::writeBehaviourKinematicSymbols:
-    //                      "
-    //                      "behaviours written in the small strain framework "
-    //                      "must be embedded in a strain strategy");
-    //       out << "3u;\n\n";
-    //     } else if (mb.getBehaviourType() ==
-    //                BehaviourDescription::STANDARDFINITESTRAINBEHAVIOUR) {
-    //       out << "3u;\n\n";
-    //     } else {
-    //       tfel::raise(
-    //           "LSDYNASymbolsGenerator::writeBehaviourKinematicSymbols:
-    //           "
-    //           "unsupported behaviour type");
-    //     }
+    tfel::raise_if(mb.getBehaviourType() !=
+                       BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR,
+                   "LSDYNASymbolsGenerator::writeBehaviourKinematicSymbols: "
+                   "unsupported behaviour type");
+    exportUnsignedShortSymbol(
+        out, i.getFunctionNameBasis(name) + "_BehaviourKinematic", 3u);
   }  // end of LSDYNASymbolsGenerator::writeBehaviourKinematicSymbols
 
   bool LSDYNASymbolsGenerator::handleStrainMeasure() const {
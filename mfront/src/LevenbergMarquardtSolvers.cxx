@@ -105,6 +105,10 @@ namespace mfront {
   }  // end of
      // LevenbergMarquardtSolverBase::requiresJacobianToBeReinitialisedToIdentityAtEachIterations
 
+  bool LevenbergMarquardtSolverBase::solvesLinearSystemsWithTheJacobian() const {
+    return false;
+  }  // end of solvesLinearSystemsWithTheJacobian
+
   std::pair<bool, LevenbergMarquardtSolverBase::tokens_iterator>
   LevenbergMarquardtSolverBase::treatSpecificKeywords(BehaviourDescription&,
                                                       const std::string&,
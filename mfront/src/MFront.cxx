@@ -24,15 +24,23 @@
 #include <string>
 #include <cerrno>
 #include <memory>
+#include <thread>
+#include <future>
+#include <optional>
 
 #include "TFEL/Raise.hxx"
 #include "TFEL/Config/GetInstallPath.hxx"
 #include "TFEL/Utilities/TerminalColors.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "TFEL/System/System.hxx"
+#include "TFEL/System/ThreadPool.hxx"
 #include "TFEL/System/ExternalLibraryManager.hxx"
 
 #include "MFront/MFrontHeader.hxx"
+#include "MFront/PedanticMode.hxx"
+#include "MFront/GenerationCache.hxx"
+#include "MFront/SearchPathsHandler.hxx"
+#include "MFront/GlobalDomainSpecificLanguageOptionsManager.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MFront/TargetsDescription.hxx"
 #include "MFront/DSLFactory.hxx"
@@ -138,6 +146,49 @@ namespace mfront {
     exit(EXIT_SUCCESS);
   }  // end of displayHelp
 
+  /*!
+   * \brief write a data in a stream, in a deterministic way
+   * \param[out] os: output stream
+   * \param[in] d: data
+   */
+  static void writeData(std::ostream& os, const tfel::utilities::Data& d) {
+    using namespace tfel::utilities;
+    if (d.is<bool>()) {
+      os << (d.get<bool>() ? "true" : "false");
+    } else if (d.is<int>()) {
+      os << d.get<int>();
+    } else if (d.is<double>()) {
+      os << d.get<double>();
+    } else if (d.is<std::string>()) {
+      os << '"' << d.get<std::string>() << '"';
+    } else if (d.is<std::vector<Data>>()) {
+      os << '[';
+      for (const auto& v : d.get<std::vector<Data>>()) {
+        writeData(os, v);
+        os << ',';
+      }
+      os << ']';
+    } else if (d.is<std::map<double, double>>()) {
+      os << '{';
+      for (const auto& [k, v] : d.get<std::map<double, double>>()) {
+        os << k << ':' << v << ',';
+      }
+      os << '}';
+    } else if (d.is<DataMap>()) {
+      os << '{';
+      for (const auto& [k, v] : d.get<DataMap>()) {
+        os << '"' << k << "\":";
+        writeData(os, v);
+        os << ',';
+      }
+      os << '}';
+    } else if (d.is<DataStructure>()) {
+      const auto& ds = d.get<DataStructure>();
+      os << ds.name;
+      writeData(os, ds.data);
+    }
+  }  // end of writeData
+
   std::string MFront::getVersionDescription() const {
     return MFrontHeader::getHeader();
   }
@@ -482,6 +533,15 @@ namespace mfront {
                               "generate build file and clean libraries");
     this->registerNewCallBack("--generator", "-G", &MFront::treatGenerator,
                               "choose build system", true);
+    this->registerNewCallBack(
+        "--jobs", "-j", &MFront::treatJobs,
+        "number of files treated concurrently. If no value is given, "
+        "the number of concurrent threads supported by the system is used",
+        true);
+    this->registerNewCallBack(
+        "--force-generation", &MFront::treatForceGeneration,
+        "treat all input files, even those which did not change since the "
+        "last call to mfront");
 
     this->registerCallBack(
         "--list-material-property-interfaces",
@@ -745,6 +805,69 @@ namespace mfront {
     this->opts.nodeps = true;
   }  // end of MFront::treatNoDeps
 
+  void MFront::treatJobs() {
+    const auto& o = this->currentArgument->getOption();
+    if (o.empty()) {
+      this->jobs = std::max(std::thread::hardware_concurrency(), 1u);
+      return;
+    }
+    const auto n = [&o] {
+      try {
+        auto pos = std::size_t{};
+        const auto v = std::stoi(o, &pos);
+        if (pos == o.size()) {
+          return v;
+        }
+      } catch (std::exception&) {
+      }
+      return 0;
+    }();
+    tfel::raise_if(n <= 0,
+                   "MFront::treatJobs: "
+                   "invalid number of jobs '" +
+                       o + "'");
+    this->jobs = static_cast<std::size_t>(n);
+  }  // end of MFront::treatJobs
+
+  void MFront::treatForceGeneration() {
+    this->incremental_generation = false;
+  }  // end of MFront::treatForceGeneration
+
+  std::string MFront::getGenerationOptionsDescription() const {
+    const auto& dsl_options = GlobalDomainSpecificLanguageOptionsManager::get();
+    auto os = std::ostringstream{};
+    os.precision(17);
+    os << "version: " << MFrontHeader::getVersionNumber() << '\n';
+    os << "interfaces:";
+    for (const auto& i : this->interfaces) {
+      os << ' ' << i;
+    }
+    os << "\necmds:";
+    for (const auto& c : this->ecmds) {
+      os << ' ' << c;
+    }
+    os << "\nsubstitutions:";
+    for (const auto& [k, v] : this->substitutions) {
+      os << ' ' << k << '=' << v;
+    }
+    os << "\ndefines:";
+    for (const auto& d : this->defines) {
+      os << ' ' << d;
+    }
+    os << "\nidentifiers: " << this->material_identifier << ' '
+       << this->material_property_identifier << ' '
+       << this->behaviour_identifier << ' ' << this->model_identifier;
+    os << "\ndebug: " << getDebugMode() << '\n'
+       << "pedantic: " << getPedanticMode() << '\n';
+    os << "material property dsl options: ";
+    writeData(os, dsl_options.getMaterialPropertyDSLOptions());
+    os << "\nbehaviour dsl options: ";
+    writeData(os, dsl_options.getBehaviourDSLOptions());
+    os << "\nmodel dsl options: ";
+    writeData(os, dsl_options.getModelDSLOptions());
+    return os.str();
+  }  // end of MFront::getGenerationOptionsDescription
+
   void MFront::treatNoMelt() {
     this->opts.melt = false;
   }  // end of MFront::treatNoMelt
@@ -788,6 +911,72 @@ namespace mfront {
     return td;
   }  // end of MFront::treatFile()
 
+  TargetsDescription MFront::treatFile(std::vector<std::string>& deps,
+                                       const std::string& f) const {
+    SearchPathsHandler::startRecordingFoundFiles();
+    try {
+      auto td = this->treatFile(f);
+      deps = SearchPathsHandler::stopRecordingFoundFiles();
+      return td;
+    } catch (...) {
+      SearchPathsHandler::stopRecordingFoundFiles();
+      throw;
+    }
+  }  // end of MFront::treatFile()
+
+  void MFront::treatFilesConcurrently(
+      std::vector<std::pair<std::string, std::string>>& errors,
+      GenerationCache& cache,
+      const std::vector<std::string>& files) {
+    using TaskResult = tfel::system::ThreadedTaskResult<void>;
+    // redirect the logging stream of a worker to a buffer during the
+    // treatment of a file
+    struct LogStreamRedirection {
+      explicit LogStreamRedirection(std::ostream& os) {
+        setThreadLocalLogStream(os);
+      }
+      ~LogStreamRedirection() { resetThreadLocalLogStream(); }
+    };
+    const auto o = this->getGenerationOptionsDescription();
+    auto logs = std::vector<std::ostringstream>(files.size());
+    auto deps = std::vector<std::vector<std::string>>(files.size());
+    // TargetsDescription is not assignable
+    auto results = std::vector<std::optional<TargetsDescription>>(files.size());
+    auto tasks = std::vector<std::future<TaskResult>>{};
+    tasks.reserve(files.size());
+    {
+      tfel::system::ThreadPool pool(std::min(this->jobs, files.size()));
+      for (decltype(files.size()) i = 0; i != files.size(); ++i) {
+        tasks.push_back(
+            pool.addTask([this, &files, &logs, &deps, &results, i] {
+              LogStreamRedirection r(logs[i]);
+              results[i].emplace(this->treatFile(deps[i], files[i]));
+            }));
+      }
+      pool.wait();
+    }
+    // the results are merged in the order of the inputs, so that the
+    // final description of the targets does not depend on the order in
+    // which the files were treated
+    auto& log = getLogStream();
+    for (decltype(files.size()) i = 0; i != files.size(); ++i) {
+      log << logs[i].str();
+      auto r = tasks[i].get();
+      if (r) {
+        mergeTargetsDescription(this->targets, *(results[i]), true);
+        cache.update(files[i], deps[i], o, *(results[i]));
+        continue;
+      }
+      cache.inputs.erase(files[i]);
+      try {
+        r.rethrow();
+      } catch (std::exception& e) {
+        errors.push_back({files[i], e.what()});
+      }
+    }
+    log.flush();
+  }  // end of MFront::treatFilesConcurrently
+
   void MFront::analyseTargetsFile() {
     using tfel::system::dirStringSeparator;
     MFrontLockGuard lock;
@@ -884,12 +1073,35 @@ namespace mfront {
     this->analyseTargetsFile();
     auto errors = std::vector<std::pair<std::string, std::string>>{};
     if (!this->inputs.empty()) {
+      // skip the files which did not change since the last call to mfront
+      auto cache = GenerationCache{};
+      cache.read();
+      const auto o = this->getGenerationOptionsDescription();
+      const auto before = GenerationCache::getGeneratedFiles(this->targets);
+      auto files = std::vector<std::string>{};
       for (const auto& i : this->inputs) {
-        try {
-          const auto td = this->treatFile(i);
-          mergeTargetsDescription(this->targets, td, true);
-        } catch (std::exception& e) {
-          errors.push_back({i, e.what()});
+        if ((this->incremental_generation) &&
+            (cache.isUpToDate(i, o, this->targets))) {
+          if (getVerboseMode() >= VERBOSE_LEVEL1) {
+            getLogStream() << "File '" << i << "' is up to date" << std::endl;
+          }
+          continue;
+        }
+        files.push_back(i);
+      }
+      if ((this->jobs > 1) && (files.size() > 1)) {
+        this->treatFilesConcurrently(errors, cache, files);
+      } else {
+        for (const auto& i : files) {
+          try {
+            auto deps = std::vector<std::string>{};
+            const auto td = this->treatFile(deps, i);
+            mergeTargetsDescription(this->targets, td, true);
+            cache.update(i, deps, o, td);
+          } catch (std::exception& e) {
+            cache.inputs.erase(i);
+            errors.push_back({i, e.what()});
+          }
         }
       }
       for (auto& t : this->targets.specific_targets) {
@@ -914,6 +1126,11 @@ namespace mfront {
       }
       // save all
       this->writeTargetsDescription();
+      // preserve the modification time of the generated files whose
+      // content did not change and update the cache
+      cache.updateGeneratedFiles(
+          before, GenerationCache::getGeneratedFiles(this->targets));
+      cache.write();
     }
     if (!errors.empty()) {
       auto msg = std::string{};
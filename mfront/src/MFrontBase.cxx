@@ -11,6 +11,7 @@
  * project under specific licensing conditions.
  */
 
+#include <mutex>
 #include <sstream>
 #include <iterator>
 #include <stdexcept>
@@ -110,6 +111,10 @@ namespace mfront {
       auto& lm = ExternalLibraryManager::getExternalLibraryManager();
       try {
         if (!library.empty()) {
+          // the ExternalLibraryManager is not thread-safe and
+          // files may be treated concurrently
+          static std::mutex m;
+          auto lock = std::lock_guard<std::mutex>(m);
           lm.loadLibrary(library);
         }
       } catch (std::exception& e) {
@@ -32,6 +32,15 @@ namespace mfront {
     std::shared_ptr<std::ofstream> ps;
   };  // end of struct LogStream
 
+  /*!
+   * \brief logging stream specific to the current thread, if any.
+   *
+   * \note the global logging stream is not protected against concurrent
+   * writes: tasks executed concurrently shall log in a stream of their
+   * own, set by `setThreadLocalLogStream`.
+   */
+  static thread_local std::ostream* thread_local_log_stream = nullptr;
+
   LogStream::LogStream() : s(&std::cout) {}  // end of LogStream::LogStream()
 
   void LogStream::setLogStream(std::ostream& os) {
@@ -98,6 +107,9 @@ namespace mfront {
   }  // end of setVerboseMode
 
   std::ostream& getLogStream() {
+    if (thread_local_log_stream != nullptr) {
+      return *thread_local_log_stream;
+    }
     auto& log = LogStream::getLogStream();
     return log.getStream();
   }  // end of function getLogStream
@@ -112,6 +124,14 @@ namespace mfront {
     log.setLogStream(os);
   }  // end of function setLogStream
 
+  void setThreadLocalLogStream(std::ostream& os) {
+    thread_local_log_stream = &os;
+  }  // end of function setThreadLocalLogStream
+
+  void resetThreadLocalLogStream() {
+    thread_local_log_stream = nullptr;
+  }  // end of function resetThreadLocalLogStream
+
   namespace internals {
 
     static bool& getUnicodeOutputOption() {
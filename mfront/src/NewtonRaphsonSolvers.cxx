@@ -43,6 +43,10 @@ namespace mfront {
     return !this->requiresNumericalJacobian();
   }  // end of requiresJacobianToBeReinitialisedToIdentityAtEachIterations
 
+  bool NewtonRaphsonSolverBase::solvesLinearSystemsWithTheJacobian() const {
+    return true;
+  }  // end of solvesLinearSystemsWithTheJacobian
+
   std::pair<bool, NewtonRaphsonSolverBase::tokens_iterator>
   NewtonRaphsonSolverBase::treatSpecificKeywords(BehaviourDescription&,
                                                  const std::string&,
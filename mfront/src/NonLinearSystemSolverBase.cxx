@@ -75,6 +75,14 @@ namespace mfront {
     return d.str();
   }  // end of NonLinearSystemSolverBase::getJacobianPart
 
+  bool NonLinearSystemSolverBase::
+      usesForwardFiniteDifferencesForNumericalJacobian(
+          const BehaviourDescription& mb, const Hypothesis h) {
+    return mb.getAttribute<std::string>(
+               h, BehaviourData::numericalJacobianComputationScheme,
+               "Centered") == "Forward";
+  }  // end of usesForwardFiniteDifferencesForNumericalJacobian
+
   void NonLinearSystemSolverBase::writeEvaluateNumericallyComputedBlocks(
       std::ostream& out, const BehaviourDescription& mb, const Hypothesis h) {
     auto throw_if = [](const bool c, const std::string& m) {
@@ -131,6 +139,18 @@ namespace mfront {
         << ",real> tjacobian(this->jacobian);\n"
         << "tfel::math::tvector<" << n << ",real> tfzeros(this->fzeros);\n"
         << "tfel::math::tvector<" << n << ",real> zeros_safe(this->zeros);\n";
+    const auto forward =
+        usesForwardFiniteDifferencesForNumericalJacobian(mb, h);
+    if (forward) {
+      // the residual at the current estimate is evaluated once and shared
+      // by all the perturbations
+      if (d.hasCode(BehaviourData::ComputeThermodynamicForces)) {
+        out << "this->computeThermodynamicForces();\n";
+      }
+      out << "this->computeFdF(true);\n"
+          << "const tfel::math::tvector<" << n
+          << ",real> fzeros_safe(this->fzeros);\n";
+    }
     bool first = true;
     for (const auto& b : blocs) {
       auto getPositionAndSize = [&ivs](const std::string& v)
@@ -169,27 +189,37 @@ namespace mfront {
           }
         }
       };
-      auto compute_perturbation = [&out, &update_jacobian, &d,
-                                   &n](const std::string& j) {
-        out << "this->zeros(" << j
-            << ") -= this->numerical_jacobian_epsilon;\n";
-        if (d.hasCode(BehaviourData::ComputeThermodynamicForces)) {
-          out << "this->computeThermodynamicForces();\n";
+      auto compute_perturbation = [&out, &update_jacobian, &d, &n,
+                                   forward](const std::string& j) {
+        if (!forward) {
+          out << "this->zeros(" << j
+              << ") -= this->numerical_jacobian_epsilon;\n";
+          if (d.hasCode(BehaviourData::ComputeThermodynamicForces)) {
+            out << "this->computeThermodynamicForces();\n";
+          }
+          out << "this->computeFdF(true);\n"
+              << "this->zeros = zeros_safe;\n"
+              << "tfel::math::tvector<" << n
+              << ",real> tfzeros2(this->fzeros);\n";
         }
-        out << "this->computeFdF(true);\n"
-            << "this->zeros = zeros_safe;\n"
-            << "tfel::math::tvector<" << n << ",real> tfzeros2(this->fzeros);\n"
-            << "this->zeros(" << j
+        out << "this->zeros(" << j
             << ") += this->numerical_jacobian_epsilon;\n";
         if (d.hasCode(BehaviourData::ComputeThermodynamicForces)) {
           out << "this->computeThermodynamicForces();\n";
         }
         out << "this->computeFdF(true);\n"
-            << "this->zeros  = zeros_safe;\n"
-            << "this->fzeros = "
-               "(this->fzeros-tfzeros2)/"
-               "(2*(this->numerical_jacobian_epsilon));\n"
-            << "// update jacobian\n";
+            << "this->zeros  = zeros_safe;\n";
+        if (forward) {
+          // fzeros_safe holds the residual at the current estimate
+          out << "this->fzeros = "
+                 "(this->fzeros-fzeros_safe)/"
+                 "(this->numerical_jacobian_epsilon);\n";
+        } else {
+          out << "this->fzeros = "
+                 "(this->fzeros-tfzeros2)/"
+                 "(2*(this->numerical_jacobian_epsilon));\n";
+        }
+        out << "// update jacobian\n";
         update_jacobian(j);
       };
       if (!first) {
@@ -22,6 +22,7 @@
 #define F_OK 0 /* Test for existence.  */
 #endif
 #include <cstdlib>
+#include <vector>
 #include <algorithm>
 // #include <filesystem>
 #ifdef MFRONT_HAVE_MADNEX
@@ -67,13 +68,78 @@ namespace mfront {
     return true;
   }  // end of isDirectory
 
+  /*!
+   * \brief lists of files found by the `search` method in the current
+   * thread, one per active recording. Recordings may be nested, for
+   * example when an external file is treated while treating an input
+   * file.
+   */
+  static thread_local std::vector<std::vector<std::string>> found_files;
+
+  /*!
+   * \brief add a file to a list of files, if not already present
+   * \param[in,out] files: list of files
+   * \param[in] f: file
+   */
+  static void insertFoundFile(std::vector<std::string>& files,
+                              const std::string& f) {
+    if (std::find(files.begin(), files.end(), f) == files.end()) {
+      files.push_back(f);
+    }
+  }  // end of insertFoundFile
+
+  /*!
+   * \brief record a file found by the `search` method, if requested
+   * \param[in] f: file
+   * \return the file
+   */
+  static const std::string& recordFoundFile(const std::string& f) {
+    if (!found_files.empty()) {
+      insertFoundFile(found_files.back(), f);
+    }
+    return f;
+  }  // end of recordFoundFile
+
+  void SearchPathsHandler::startRecordingFoundFiles() {
+    found_files.emplace_back();
+  }  // end of startRecordingFoundFiles
+
+  std::vector<std::string> SearchPathsHandler::stopRecordingFoundFiles() {
+    if (found_files.empty()) {
+      return {};
+    }
+    auto files = std::move(found_files.back());
+    found_files.pop_back();
+    // the enclosing recording, if any, also depends on those files
+    SearchPathsHandler::recordFoundFiles(files);
+    return files;
+  }  // end of stopRecordingFoundFiles
+
+  void SearchPathsHandler::recordFoundFiles(
+      const std::vector<std::string>& files) {
+    for (const auto& f : files) {
+      recordFoundFile(f);
+    }
+  }  // end of recordFoundFiles
+
+  std::vector<SearchPathsHandler::Path> SearchPathsHandler::getPaths() {
+    auto& msf = SearchPathsHandler::getSearchPathsHandler();
+    auto lock = std::lock_guard<std::mutex>(msf.m);
+    return msf.paths;
+  }  // end of getPaths
+
+  void SearchPathsHandler::appendPath(const Path& p) {
+    auto& msf = SearchPathsHandler::getSearchPathsHandler();
+    auto lock = std::lock_guard<std::mutex>(msf.m);
+    msf.paths.push_back(p);
+  }  // end of appendPath
+
   std::string SearchPathsHandler::searchMadnexFile(const std::string& f) {
     using namespace tfel::system;
-    auto& msf = SearchPathsHandler::getSearchPathsHandler();
     if (fileExistsAndIsReadable(f)) {
       return f;
     }
-    for (const auto& p : msf.paths) {
+    for (const auto& p : SearchPathsHandler::getPaths()) {
       if (!std::holds_alternative<std::string>(p)) {
         continue;
       }
@@ -108,11 +174,10 @@ namespace mfront {
 
   std::string SearchPathsHandler::search(const std::string& f) {
     using namespace tfel::system;
-    auto& msf = SearchPathsHandler::getSearchPathsHandler();
     if (fileExistsAndIsReadable(f)) {
-      return f;
+      return recordFoundFile(f);
     }
-    for (const auto& p : msf.paths) {
+    for (const auto& p : SearchPathsHandler::getPaths()) {
       if (std::holds_alternative<MadnexPath>(p)) {
 #ifdef MFRONT_HAVE_MADNEX
         using ptr = std::vector<std::string>  //
@@ -150,7 +215,7 @@ namespace mfront {
               db, madnex_path.file_path, madnex_path.material, name, "Model");
         }
         if (!mpath.empty()) {
-          return mpath;
+          return recordFoundFile(mpath);
         }
 #else  /* MFRONT_HAVE_MADNEX */
         tfel::raise(
@@ -159,7 +224,7 @@ namespace mfront {
       } else {
         const auto file = std::get<std::string>(p) + dirSeparator() + f;
         if (fileExistsAndIsReadable(file)) {
-          return file;
+          return recordFoundFile(file);
         }
       }
     }
@@ -184,8 +249,7 @@ namespace mfront {
           p + "'");
     }
     // check if the madnex file exists
-    auto& msf = SearchPathsHandler::getSearchPathsHandler();
-    const auto file_path = msf.searchMadnexFile(details[0]);
+    const auto file_path = SearchPathsHandler::searchMadnexFile(details[0]);
     const auto ext = getFileExtension(file_path);
     if (!((ext == "madnex") || (ext == "mdnx") || (ext == "edf"))) {
       tfel::raise(
@@ -220,7 +284,7 @@ namespace mfront {
         MadnexPath path;
         path.file_path = file_path;
         path.mkt = mkt;
-        msf.paths.push_back(path);
+        SearchPathsHandler::appendPath(path);
       } else {
         const auto db = madnex::MFrontDataBase{file_path};
         const auto materials = madnex::getMatchingMaterials(db, material_id);
@@ -228,13 +292,13 @@ namespace mfront {
           MadnexPath path;
           path.file_path = file_path;
           path.material = material;
-          msf.paths.push_back(path);
+          SearchPathsHandler::appendPath(path);
         }
       }
     } else {
       MadnexPath path;
       path.file_path = file_path;
-      msf.paths.push_back(path);
+      SearchPathsHandler::appendPath(path);
     }
 #else  /* MFRONT_HAVE_MADNEX */
     static_cast<void>(p);
@@ -259,6 +323,7 @@ namespace mfront {
             path + "' is not a directory");
       }
     }
+    auto lock = std::lock_guard<std::mutex>(msf.m);
     msf.paths.insert(msf.paths.begin(), npaths.begin(), npaths.end());
   }  // end of addSearchPaths
 
@@ -279,6 +344,7 @@ namespace mfront {
 
   std::vector<std::string> SearchPathsHandler::getSearchPaths() {
     auto& msf = SearchPathsHandler::getSearchPathsHandler();
+    auto lock = std::lock_guard<std::mutex>(msf.m);
     auto directories = std::vector<std::string>{};
     for (const auto& path : msf.paths) {
       if (std::holds_alternative<std::string>(path)) {
@@ -52,6 +52,10 @@ namespace mfront {
 
   bool SecondBroydenSolver::requiresNumericalJacobian() const { return false; }
 
+  bool SecondBroydenSolver::solvesLinearSystemsWithTheJacobian() const {
+    return false;
+  }  // end of solvesLinearSystemsWithTheJacobian
+
   std::pair<bool, SecondBroydenSolver::tokens_iterator>
   SecondBroydenSolver::treatSpecificKeywords(BehaviourDescription&,
                                              const std::string&,
@@ -33,7 +33,8 @@ namespace mfront {
         "allows_jacobian_initialisation",
         "allows_jacobian_invert_initialisation",
         "requires_jacobian_reinitialisation_to_identity_at_each_"
-        "iterations"};
+        "iterations",
+        "solves_linear_systems_with_the_jacobian"};
     for (auto& kv : d) {
       if (std::find(authorised_keys.begin(), authorised_keys.end(), kv.first) ==
           authorised_keys.end()) {
@@ -83,6 +84,8 @@ namespace mfront {
     assign_if(
         this->requires_jacobian_reinitialisation_to_identity_at_each_iterations,
         "requires_jacobian_reinitialisation_to_identity_at_each_iterations");
+    assign_if(this->solves_linear_systems_with_the_jacobian,
+              "solves_linear_systems_with_the_jacobian");
   }  // end of UserDefinedNonLinearSystemSolver
 
   std::string UserDefinedNonLinearSystemSolver::getExternalAlgorithmClassName(
@@ -123,6 +126,10 @@ namespace mfront {
         ->requires_jacobian_reinitialisation_to_identity_at_each_iterations;
   }  // end of requiresJacobianToBeReinitialisedToIdentityAtEachIterations
 
+  bool UserDefinedNonLinearSystemSolver::solvesLinearSystemsWithTheJacobian() const {
+    return this->solves_linear_systems_with_the_jacobian;
+  }  // end of solvesLinearSystemsWithTheJacobian
+
   std::pair<bool, UserDefinedNonLinearSystemSolver::tokens_iterator>
   UserDefinedNonLinearSystemSolver::treatSpecificKeywords(
       BehaviourDescription&,
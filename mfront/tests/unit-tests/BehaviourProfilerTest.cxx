@@ -0,0 +1,187 @@
+/*!
+ * \file   mfront/tests/unit-tests/BehaviourProfilerTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <thread>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <iterator>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "MFront/BehaviourProfiler.hxx"
+
+struct BehaviourProfilerTest final : public tfel::tests::TestCase {
+  BehaviourProfilerTest()
+      : tfel::tests::TestCase("MFront", "BehaviourProfilerTest") {
+  }  // end of BehaviourProfilerTest
+  tfel::tests::TestResult execute() override {
+#if !(defined _WIN32 || defined _WIN64)
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+#endif
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief number of threads
+  static constexpr int nthreads = 4;
+  //! \brief number of calls per thread
+  static constexpr int ncalls = 1000;
+  //! \brief run timers in concurrent threads
+  static void run(mfront::BehaviourProfiler& p) {
+    using mfront::BehaviourProfiler;
+    auto threads = std::vector<std::thread>{};
+    for (int i = 0; i != nthreads; ++i) {
+      threads.emplace_back([&p] {
+        auto v = double{0};
+        for (int j = 0; j != ncalls; ++j) {
+          BehaviourProfiler::Timer t(p, BehaviourProfiler::INTEGRATOR);
+          {
+            BehaviourProfiler::Timer t2(p, BehaviourProfiler::COMPUTEFDF);
+            v += std::sin(static_cast<double>(j));
+          }
+        }
+        // prevent the compiler from removing the loop
+        if (v > 2 * ncalls) {
+          std::abort();
+        }
+      });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+  }  // end of run
+  void test1() {
+    using mfront::BehaviourProfiler;
+    auto p = BehaviourProfiler("Test");
+    p.setOutputFile("");
+    run(p);
+    TFEL_TESTS_ASSERT(p.getNumberOfThreads() == nthreads);
+    const auto r = p.getResults();
+    for (const auto c :
+         {BehaviourProfiler::INTEGRATOR, BehaviourProfiler::COMPUTEFDF}) {
+      TFEL_TESTS_ASSERT(r[c].calls == nthreads * ncalls);
+      TFEL_TESTS_ASSERT(std::accumulate(r[c].histogram.begin(),
+                                        r[c].histogram.end(),
+                                        std::intmax_t{0}) == r[c].calls);
+    }
+    TFEL_TESTS_ASSERT(r[BehaviourProfiler::INTEGRATOR].time >=
+                      r[BehaviourProfiler::COMPUTEFDF].time);
+    TFEL_TESTS_ASSERT(r[BehaviourProfiler::FLOWRULE].calls == 0);
+    TFEL_TESTS_ASSERT(r[BehaviourProfiler::FLOWRULE].time == 0);
+  }  // end of test1
+  void test2() {
+    using mfront::BehaviourProfiler;
+    auto p = BehaviourProfiler("Test");
+    p.setOutputFile("");
+    run(p);
+    auto json = std::ostringstream{};
+    p.exportToJSON(json);
+    TFEL_TESTS_ASSERT(json.str().find("\"behaviour\": \"Test\"") !=
+                      std::string::npos);
+    TFEL_TESTS_ASSERT(json.str().find("\"name\": \"Integrator::ComputeFdF\"") !=
+                      std::string::npos);
+    TFEL_TESTS_ASSERT(json.str().find("\"calls\": 4000") != std::string::npos);
+    TFEL_TESTS_ASSERT(json.str().find("FlowRule") == std::string::npos);
+    auto csv = std::istringstream{};
+    {
+      auto os = std::ostringstream{};
+      p.exportToCSV(os);
+      csv.str(os.str());
+    }
+    auto lines = std::vector<std::string>{};
+    for (std::string l; std::getline(csv, l);) {
+      lines.push_back(l);
+    }
+    // header, Integrator and Integrator::ComputeFdF
+    TFEL_TESTS_ASSERT(lines.size() == 3);
+    TFEL_TESTS_ASSERT(lines[0].compare(0, 16, "behaviour,code_b") == 0);
+    TFEL_TESTS_ASSERT(lines[1].compare(0, 21, "Test,Integrator,4000,") == 0);
+  }  // end of test2
+  void test3() {
+    // escaping of the name of the behaviour
+    using mfront::BehaviourProfiler;
+    auto p = BehaviourProfiler("Te\"s\\t");
+    p.setOutputFile("");
+    run(p);
+    auto json = std::ostringstream{};
+    p.exportToJSON(json);
+    TFEL_TESTS_ASSERT(json.str().find("\"behaviour\": \"Te\\\"s\\\\t\"") !=
+                      std::string::npos);
+  }  // end of test3
+  void test4() {
+    // several profilers exporting their results in the same file
+    using mfront::BehaviourProfiler;
+    auto read = [](const std::string& f) {
+      std::ifstream in(f);
+      return std::string(std::istreambuf_iterator<char>(in),
+                         std::istreambuf_iterator<char>());
+    };
+    auto count = [](const std::string& s, const std::string& p) {
+      auto n = std::size_t{};
+      for (auto pos = s.find(p); pos != std::string::npos;
+           pos = s.find(p, pos + p.size())) {
+        ++n;
+      }
+      return n;
+    };
+    for (const auto& f : {std::string("BehaviourProfilerTest-shared.csv"),
+                          std::string("BehaviourProfilerTest-shared.json")}) {
+      auto p1 = BehaviourProfiler("A");
+      auto p2 = BehaviourProfiler("B");
+      p1.setOutputFile(f);
+      p2.setOutputFile(f);
+      run(p1);
+      run(p2);
+      p1.exportResults();
+      p2.exportResults();
+      // exporting twice the same results shall not duplicate them
+      p1.exportResults();
+      const auto c = read(f);
+      if (f.back() == 'v') {
+        TFEL_TESTS_ASSERT(count(c, "behaviour,code_block") == 1);
+        TFEL_TESTS_ASSERT(count(c, "\nA,Integrator,") == 1);
+        TFEL_TESTS_ASSERT(count(c, "\nB,Integrator,") == 1);
+      } else {
+        TFEL_TESTS_ASSERT(c.compare(0, 2, "[\n") == 0);
+        TFEL_TESTS_ASSERT(count(c, "\"behaviour\": \"A\"") == 1);
+        TFEL_TESTS_ASSERT(count(c, "\"behaviour\": \"B\"") == 1);
+      }
+      p1.setOutputFile("");
+      p2.setOutputFile("");
+    }
+  }  // end of test4
+};
+
+TFEL_TESTS_GENERATE_PROXY(BehaviourProfilerTest, "BehaviourProfilerTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("BehaviourProfilerTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
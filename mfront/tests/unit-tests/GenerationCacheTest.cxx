@@ -0,0 +1,140 @@
+/*!
+ * \file   GenerationCacheTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/System.hxx"
+#include "MFront/InitDSLs.hxx"
+#include "MFront/InitInterfaces.hxx"
+#include "MFront/MFrontLogStream.hxx"
+#include "MFront/MFront.hxx"
+#include "MFront/GenerationCache.hxx"
+
+struct GenerationCacheTest final : public tfel::tests::TestCase {
+  GenerationCacheTest()
+      : tfel::tests::TestCase("MFront", "GenerationCacheTest") {
+  }  // end of GenerationCacheTest
+  tfel::tests::TestResult execute() override {
+    using tfel::system::systemCall;
+    mfront::initDSLs();
+    mfront::initInterfaces();
+    const auto cwd = systemCall::getCurrentWorkingDirectory();
+    systemCall::mkdir("GenerationCacheTest");
+    systemCall::changeCurrentWorkingDirectory("GenerationCacheTest");
+    try {
+      this->test();
+    } catch (...) {
+      systemCall::changeCurrentWorkingDirectory(cwd);
+      throw;
+    }
+    systemCall::changeCurrentWorkingDirectory(cwd);
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief name of the input file
+  static constexpr const char* input = "GenerationCacheTest.mfront";
+  /*!
+   * \brief call `MFront` on the input file
+   * \return the messages logged during the treatment
+   * \param[in] o: additional command line option
+   */
+  static std::string generate(const std::string& o = "") {
+    auto args = std::vector<const char*>{"mfront", "--interface=c",
+                                         "--verbose=level1"};
+    if (!o.empty()) {
+      args.push_back(o.c_str());
+    }
+    args.push_back(input);
+    auto log = std::ostringstream{};
+    mfront::setThreadLocalLogStream(log);
+    try {
+      mfront::MFront m(static_cast<int>(args.size()), args.data());
+      m.exe();
+    } catch (...) {
+      mfront::resetThreadLocalLogStream();
+      throw;
+    }
+    mfront::resetThreadLocalLogStream();
+    return log.str();
+  }  // end of generate
+  //! \return the modification times of the generated files
+  static std::map<std::string, mfront::GenerationCache::ModificationTime>
+  getModificationTimes() {
+    auto c = mfront::GenerationCache{};
+    c.read();
+    auto r = std::map<std::string, mfront::GenerationCache::ModificationTime>{};
+    for (const auto& f : c.generated_files) {
+      r[f.first] = mfront::GenerationCache::getModificationTime(f.first);
+    }
+    return r;
+  }  // end of getModificationTimes
+  void test() {
+    using mfront::GenerationCache;
+    {
+      std::ofstream f(input);
+      f << "@DSL MaterialLaw;\n"
+        << "@Law GenerationCacheTest;\n"
+        << "@Input T;\n"
+        << "@Function{\n"
+        << "  res = 2 * T;\n"
+        << "}\n";
+    }
+    generate("--force-generation");
+    // a file which is not generated by MFront
+    const auto o = "src" + tfel::system::dirStringSeparator() +
+                   "GenerationCacheTest.o";
+    {
+      std::ofstream f(o);
+      f << "not a generated file\n";
+    }
+    const auto t1 = getModificationTimes();
+    TFEL_TESTS_ASSERT(!t1.empty());
+    TFEL_TESTS_ASSERT(t1.count(o) == 0);
+    for (const auto& f : t1) {
+      TFEL_TESTS_ASSERT(f.second != 0);
+    }
+    // second call: the input is up to date
+    const auto log = generate();
+    TFEL_TESTS_ASSERT(log.find("File '" + std::string{input} +
+                               "' is up to date") != std::string::npos);
+    TFEL_TESTS_ASSERT(getModificationTimes() == t1);
+    // forced generation: the files are rewritten with the same content and
+    // their modification times are restored
+    generate("--force-generation");
+    TFEL_TESTS_ASSERT(getModificationTimes() == t1);
+  }  // end of test
+};
+
+TFEL_TESTS_GENERATE_PROXY(GenerationCacheTest, "GenerationCacheTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("GenerationCacheTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,134 @@
+/*!
+ * \file   mtest/include/MTest/AsynchronousOutputWriter.hxx
+ * \brief  This file declares the AsynchronousOutputWriter class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MTEST_ASYNCHRONOUSOUTPUTWRITER_HXX
+#define LIB_MTEST_ASYNCHRONOUSOUTPUTWRITER_HXX
+
+#include <deque>
+#include <mutex>
+#include <vector>
+#include <thread>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+#include "MTest/Types.hxx"
+#include "MTest/Config.hxx"
+
+namespace mtest {
+
+  /*!
+   * \brief a class writing results in a background thread.
+   *
+   * The caller only copies the values to be written in a record of a
+   * bounded circular queue. The records are formatted and written by
+   * a background thread, in the order in which they were added, using
+   * the functions associated with each output. The buffers of the
+   * records are recycled, so that no memory allocation is required
+   * once the queue has been filled.
+   *
+   * The caller only waits if the queue is full.
+   *
+   * Exceptions thrown by the background thread are reported by the
+   * next call to the `write` or `flush` methods.
+   */
+  struct MTEST_VISIBILITY_EXPORT AsynchronousOutputWriter {
+    //! a simple alias
+    using size_type = std::size_t;
+    //! \brief function writing the values of a record
+    using Writer = std::function<void(const std::vector<real>&)>;
+    //! \brief function flushing an output
+    using Flusher = std::function<void()>;
+    /*!
+     * \brief constructor
+     * \param[in] n: maximum number of records in the queue
+     * \param[in] f: number of records after which the background thread
+     * flushes all the outputs. If null, the outputs are only flushed
+     * by the `flush` method.
+     */
+    AsynchronousOutputWriter(const size_type = 1024, const size_type = 0);
+    /*!
+     * \brief register a new output
+     * \return the identifier of the output
+     * \param[in] w: function writing a record
+     * \param[in] f: function flushing the output. This function may
+     * be empty if the output does not need to be flushed.
+     */
+    size_type addOutput(Writer, Flusher);
+    /*!
+     * \brief add a record
+     * \param[in] o: identifier of the output
+     * \param[in] v: values
+     */
+    void write(const size_type, const std::vector<real>&);
+    /*!
+     * \brief wait until all the records have been written and flush all
+     * the outputs.
+     */
+    void flush();
+    //! \brief destructor
+    ~AsynchronousOutputWriter();
+
+   private:
+    //! \brief a record
+    struct Record {
+      //! \brief identifier of the output
+      size_type output;
+      //! \brief values
+      std::vector<real> values;
+    };
+    //! \brief an output
+    struct Output {
+      //! \brief function writing a record
+      Writer write;
+      //! \brief function flushing the output, if any
+      Flusher flush;
+    };
+    AsynchronousOutputWriter(AsynchronousOutputWriter&&) = delete;
+    AsynchronousOutputWriter(const AsynchronousOutputWriter&) = delete;
+    AsynchronousOutputWriter& operator=(AsynchronousOutputWriter&&) = delete;
+    AsynchronousOutputWriter& operator=(const AsynchronousOutputWriter&) =
+        delete;
+    //! \brief function executed by the background thread
+    void run();
+    //! \brief rethrow the exception reported by the background thread, if any
+    void checkError();
+    //! \brief circular queue of records
+    std::vector<Record> records;
+    //! \brief registred outputs
+    std::deque<Output> outputs;
+    //! \brief mutex protecting the queue
+    std::mutex m;
+    //! \brief condition used to signal that a record has been added
+    std::condition_variable not_empty;
+    //! \brief condition used to signal that a record has been written
+    std::condition_variable not_full;
+    //! \brief exception thrown by the background thread
+    std::exception_ptr error;
+    //! \brief position of the first record in the queue
+    size_type first = 0;
+    //! \brief number of records in the queue
+    size_type nrecords = 0;
+    //! \brief number of records after which the outputs are flushed
+    size_type flush_frequency;
+    //! \brief boolean stating if a record is being written
+    bool busy = false;
+    //! \brief boolean stating if the background thread shall stop
+    bool stop = false;
+    //! \brief background thread
+    std::thread thread;
+  };  // end of struct AsynchronousOutputWriter
+
+}  // end of namespace mtest
+
+#endif /* LIB_MTEST_ASYNCHRONOUSOUTPUTWRITER_HXX */
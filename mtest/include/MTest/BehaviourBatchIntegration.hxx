@@ -0,0 +1,114 @@
+/*!
+ * \file   mtest/include/MTest/BehaviourBatchIntegration.hxx
+ * \brief  This file declares a function integrating a behaviour over a
+ * time step on a set of independent integration points.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MTEST_BEHAVIOURBATCHINTEGRATION_HXX
+#define LIB_MTEST_BEHAVIOURBATCHINTEGRATION_HXX
+
+#include <cstddef>
+#include <utility>
+#include "MTest/Config.hxx"
+#include "MTest/Types.hxx"
+#include "MTest/SolverOptions.hxx"
+
+namespace mtest {
+
+  // forward declaration
+  struct Behaviour;
+
+  /*!
+   * \brief inputs of the integration of a behaviour on a set of
+   * independent integration points.
+   *
+   * All arrays are stored point by point: the values associated with
+   * the `i`-th integration point of an array containing `m` values per
+   * point begin at the offset `i * m`.
+   *
+   * The optional arrays may be null. In this case, the associated values
+   * are set to zero.
+   */
+  struct BehaviourBatchIntegrationInputs {
+    //! \brief number of integration points
+    std::size_t n = 0;
+    //! \brief values of the gradients at the beginning of the time step
+    const real* gradients0 = nullptr;
+    //! \brief values of the gradients at the end of the time step
+    const real* gradients1 = nullptr;
+    //! \brief thermodynamic forces at the beginning of the time step
+    const real* thermodynamic_forces0 = nullptr;
+    //! \brief material properties at the end of the time step
+    const real* material_properties = nullptr;
+    //! \brief internal state variables at the beginning of the time step
+    const real* internal_state_variables0 = nullptr;
+    //! \brief external state variables at the beginning of the time step
+    const real* external_state_variables0 = nullptr;
+    //! \brief increments of the external state variables
+    const real* external_state_variables_increments = nullptr;
+  };  // end of struct BehaviourBatchIntegrationInputs
+
+  /*!
+   * \brief outputs of the integration of a behaviour on a set of
+   * independent integration points.
+   *
+   * The arrays are stored as described in the documentation of the
+   * `BehaviourBatchIntegrationInputs` structure. The tangent operator
+   * associated with each integration point is stored in row-major
+   * order. This array is not used if null.
+   */
+  struct BehaviourBatchIntegrationOutputs {
+    //! \brief thermodynamic forces at the end of the time step
+    real* thermodynamic_forces1 = nullptr;
+    //! \brief internal state variables at the end of the time step
+    real* internal_state_variables1 = nullptr;
+    //! \brief tangent operators
+    real* tangent_operators = nullptr;
+    /*!
+     * \brief status of the integration of each integration point: `1`
+     * on success, `0` on failure
+     */
+    int* status = nullptr;
+  };  // end of struct BehaviourBatchIntegrationOutputs
+
+  /*!
+   * \return the number of rows and the number of columns of the
+   * tangent operator computed by the behaviour at one integration point
+   * \param[in] b: behaviour
+   */
+  MTEST_VISIBILITY_EXPORT std::pair<std::size_t, std::size_t>
+  getTangentOperatorSizes(const Behaviour&);
+  /*!
+   * \brief integrate the behaviour on a set of independent integration
+   * points.
+   *
+   * The integration points are split in contiguous ranges treated by
+   * different threads. Each thread uses its own workspace.
+   *
+   * \return true if the integration succeeded on all integration points
+   * \param[out] o: outputs
+   * \param[in] b: behaviour
+   * \param[in] i: inputs
+   * \param[in] dt: time increment
+   * \param[in] ktype: type of the stiffness matrix
+   * \param[in] nthreads: number of threads
+   */
+  MTEST_VISIBILITY_EXPORT bool integrate(
+      const BehaviourBatchIntegrationOutputs&,
+      const Behaviour&,
+      const BehaviourBatchIntegrationInputs&,
+      const real,
+      const StiffnessMatrixType,
+      const std::size_t = 1);
+
+}  // end of namespace mtest
+
+#endif /* LIB_MTEST_BEHAVIOURBATCHINTEGRATION_HXX */
@@ -0,0 +1,150 @@
+/*!
+ * \file   mtest/include/MTest/BorderedBandMatrix.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MTEST_BORDEREDBANDMATRIX_HXX
+#define LIB_MTEST_BORDEREDBANDMATRIX_HXX
+
+#include <vector>
+#include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/matrix.hxx"
+#include "TFEL/Math/LU/Permutation.hxx"
+#include "MTest/Config.hxx"
+#include "MTest/Types.hxx"
+
+namespace mtest {
+
+  /*!
+   * \brief a square matrix made of a band matrix bordered by a few dense
+   * rows and columns:
+   *
+   * \f[
+   * \left(
+   * \begin{array}{cc}
+   * A & B \\
+   * C & D
+   * \end{array}
+   * \right)
+   * \f]
+   *
+   * where \f$A\f$ is a band matrix and \f$B\f$, \f$C\f$ and \f$D\f$ are
+   * dense.
+   *
+   * Such matrices typically arise in one dimensional finite element
+   * problems, such as pipes, for which the last unknowns (axial strain,
+   * etc.) are coupled to all the nodal unknowns.
+   *
+   * The linear system is solved by a LU decomposition of \f$A\f$ without
+   * pivoting and the LU decomposition, with partial pivoting, of the Schur
+   * complement \f$D-C\,A^{-1}\,B\f$. The cost of the factorisation and of
+   * the resolution is proportional to the size of the matrix.
+   */
+  struct MTEST_VISIBILITY_EXPORT BorderedBandMatrix {
+    //! \brief a simple alias
+    using size_type = tfel::math::matrix<real>::size_type;
+    //! \brief default constructor
+    BorderedBandMatrix();
+    /*!
+     * \brief resize the matrix. All the values are set to zero.
+     * \param[in] n: size of the matrix
+     * \param[in] b: half bandwidth of the band part
+     * \param[in] m: number of bordered rows and columns
+     */
+    void resize(const size_type, const size_type, const size_type);
+    //! \brief set all the values to zero
+    void reset();
+    //! \brief clear the matrix
+    void clear();
+    //! \return the number of rows
+    size_type getNbRows() const;
+    //! \return the number of columns
+    size_type getNbCols() const;
+    //! \return the half bandwidth of the band part
+    size_type getHalfBandWidth() const;
+    //! \return the number of bordered rows and columns
+    size_type getBorderSize() const;
+    /*!
+     * \return the value at the given position
+     * \param[in] i: row index
+     * \param[in] j: column index
+     * \note an exception is thrown if this value is outside the sparsity
+     * pattern of the matrix
+     */
+    real& operator()(const size_type, const size_type);
+    /*!
+     * \return the value at the given position. Values outside the
+     * sparsity pattern of the matrix are null.
+     * \param[in] i: row index
+     * \param[in] j: column index
+     */
+    real operator()(const size_type, const size_type) const;
+    /*!
+     * \brief compute, in place, the LU decomposition of the matrix
+     * \note a `tfel::math::LUNullPivot` exception is thrown if a null
+     * pivot is encountered
+     */
+    void factorize();
+    /*!
+     * \brief solve the linear system. The matrix must have been
+     * factorized.
+     * \param[in,out] x: on input, the right hand side. On output, the
+     * solution
+     */
+    void solve(tfel::math::vector<real>&) const;
+    //! \brief destructor
+    ~BorderedBandMatrix();
+
+   private:
+    //! \return the size of the band part
+    size_type getBandSize() const;
+    /*!
+     * \brief solve the linear system associated with the band part,
+     * which must have been factorized.
+     * \param[in,out] x: on input, the right hand side. On output, the
+     * solution
+     */
+    void solveBand(real* const) const;
+    //! \brief size of the matrix
+    size_type n = 0;
+    //! \brief half bandwidth of the band part
+    size_type b = 0;
+    //! \brief number of bordered rows and columns
+    size_type m = 0;
+    /*!
+     * \brief values of the band part, stored row by row. Each row
+     * contains `2 * b + 1` values.
+     */
+    std::vector<real> A;
+    /*!
+     * \brief values of the bordered columns of the band part, stored
+     * column by column. After factorization, those values are
+     * overwritten by \f$A^{-1}\,B\f$.
+     */
+    std::vector<real> B;
+    //! \brief values of the bordered rows of the band part, stored row by row
+    std::vector<real> C;
+    /*!
+     * \brief values of the last block. After factorization, this matrix
+     * is overwritten by the LU decomposition of the Schur complement.
+     */
+    tfel::math::matrix<real> D;
+    //! \brief permutation associated with the decomposition of `D`
+    mutable tfel::math::Permutation<size_type> p;
+    //! \brief temporary vector
+    mutable tfel::math::vector<real> tmp;
+    //! \brief temporary vector
+    mutable tfel::math::vector<real> tmp2;
+  };  // end of struct BorderedBandMatrix
+
+}  // end of namespace mtest
+
+#endif /* LIB_MTEST_BORDEREDBANDMATRIX_HXX */
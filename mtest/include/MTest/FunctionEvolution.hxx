@@ -14,6 +14,7 @@
 #ifndef LIB_MTEST_MTESTFUNCTIONEVOLUTION_HXX
 #define LIB_MTEST_MTESTFUNCTIONEVOLUTION_HXX
 
+#include <vector>
 #include "TFEL/Math/Evaluator.hxx"
 
 #include "MTest/Config.hxx"
@@ -22,6 +23,24 @@
 
 namespace mtest {
 
+  /*!
+   * \brief an evolution defined by a formula depending on the time and
+   * on other evolutions.
+   *
+   * The positions of the variables of the formula are resolved at the
+   * first evaluation, since the evolutions on which the formula depends
+   * may be defined after this one. Those evolutions are looked up by name
+   * at each evaluation, so that an evolution replaced or removed in the
+   * manager is never referenced afterwards.
+   *
+   * The last result is kept and reused as long as the values of the
+   * arguments of the formula, i.e. the time and the values of the
+   * evolutions on which the formula depends, do not change. Hence, a graph
+   * of dependent evolutions is only evaluated once for a given time, and
+   * any change of the value of an evolution (see `setValue`) or of the
+   * evolution itself invalidates the result of the evolutions depending on
+   * it.
+   */
   struct MTEST_VISIBILITY_EXPORT FunctionEvolution : public Evolution {
     /*!
      * constructor
@@ -54,10 +73,36 @@ namespace mtest {
     ~FunctionEvolution() override;
 
    private:
+    //! \brief description of an argument of the formula
+    struct Argument {
+      //! \brief name of the variable
+      std::string name;
+      //! \brief position of the variable in the evaluator
+      std::vector<double>::size_type position;
+      //! \brief if true, the variable is the time
+      bool is_time;
+      //! \brief value of the variable used for the last evaluation
+      real value;
+    };
+    //! \brief resolve the positions of the variables of the formula
+    void resolveArguments() const;
+    /*!
+     * \return the evolution associated with the given variable
+     * \param[in] n: name of the variable
+     */
+    const Evolution& getEvolution(const std::string&) const;
     //! externally defined evolutions
     const EvolutionManager& evm;
     //! Evaluator
     mutable tfel::math::Evaluator f;
+    //! \brief arguments of the formula
+    mutable std::vector<Argument> arguments;
+    //! \brief result of the last evaluation
+    mutable real value = real(0);
+    //! \brief if true, the arguments have been resolved
+    mutable bool resolved = false;
+    //! \brief if true, the result of the last evaluation is valid
+    mutable bool has_value = false;
   };
 
 }  // end of namespace mtest
@@ -16,6 +16,7 @@
 
 #include "TFEL/System/ExternalFunctionsPrototypes.hxx"
 #include "MFront/GenericBehaviour/BehaviourData.hxx"
+#include "MFront/GenericBehaviour/BatchBehaviourData.h"
 #include "MTest/StandardBehaviourBase.hxx"
 
 namespace mtest {
@@ -66,10 +67,30 @@ namespace mtest {
         const tfel::math::tmatrix<3u, 3u, real>&) const override;
 
     void allocateWorkSpace(BehaviourWorkSpace&) const override;
+    /*!
+     * \return true if the library exports a function integrating a block of
+     * integration points.
+     */
+    bool hasBatchIntegrationFunction() const;
+    /*!
+     * \brief integrate a block of integration points in one call
+     * \return the value returned by the batch integration function
+     * \param[in,out] d: batch data
+     */
+    int integrateBatch(mfront::gb::BatchBehaviourData&) const;
     //! destructor
     ~GenericBehaviour() override;
 
    protected:
+    /*!
+     * \brief call the batch integration function on
+     * `batch_integration_size` copies of the given integration point.
+     * \return the value returned by the batch integration function
+     * \param[in,out] d: behaviour data
+     * \param[in] nK: size of the stiffness matrix
+     */
+    virtual int callBatchIntegrationFunction(mfront::gb::BehaviourData&,
+                                             const size_t) const;
     /*!
      * \brief integrate the mechanical behaviour over the time step
      * \return a pair. The first member is true if the integration was
@@ -104,6 +125,26 @@ namespace mtest {
 
     //! \brief pointer to the function
     tfel::system::GenericBehaviourFctPtr fct;
+    /*!
+     * \brief pointer to the function integrating a block of integration
+     * points, if exported by the library
+     */
+    tfel::system::GenericBehaviourBatchFctPtr batch_fct = nullptr;
+    /*!
+     * \brief if true, the behaviour is called through the batch integration
+     * function (with only one integration point). This is mostly meant to
+     * test the batch integration function.
+     */
+    bool use_batch_integration = false;
+    /*!
+     * \brief number of copies of the integration point passed to the batch
+     * integration function. If greater than one, the gradients, the
+     * thermodynamic forces, the internal state variables and the stiffness
+     * matrix are replicated while the material properties and the external
+     * state variables are shared by all the copies (null stride). The
+     * results of all the copies must be identical.
+     */
+    mfront_gb_size_type batch_integration_size = 1;
     /*!
      * \brief pointer to the function in charge of rotating the gradients from
      * the global frame to the material frame
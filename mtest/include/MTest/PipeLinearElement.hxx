@@ -29,6 +29,10 @@ namespace mtest {
   struct Behaviour;
   // forward declaration
   struct StructureCurrentState;
+  // forward declaration
+  struct BehaviourWorkSpace;
+  // forward declaration
+  struct BorderedBandMatrix;
 
   /*!
    * \brief structure describing a linear element for pipes
@@ -89,6 +93,72 @@ namespace mtest {
                               const tfel::math::vector<real>&,
                               const size_t,
                               const bool);
+    //! \brief number of Gauss points
+    static constexpr size_t number_of_gauss_points = 2;
+    /*!
+     * \brief integrate the behaviour at the given Gauss point
+     * \return a pair containing a boolean stating if the integration
+     * succeeded and a scaling factor for the time step.
+     * \param[out] scs: structure current state
+     * \param[out] bwk: behaviour workspace
+     * \param[in]  b:   behaviour
+     * \param[in]  dt:  time increment
+     * \param[in]  mt:  stiffness matrix type
+     * \param[in]  i:   element number
+     * \param[in]  g:   Gauss point number
+     *
+     * \note the strain at the end of the time step must have been
+     * computed by the `computeStrain` method.
+     * \note this method may be called concurrently on distinct
+     * elements as long as each thread uses its own workspace.
+     */
+    static std::pair<bool, real> integrate(StructureCurrentState&,
+                                           BehaviourWorkSpace&,
+                                           const Behaviour&,
+                                           const real,
+                                           const StiffnessMatrixType,
+                                           const size_t,
+                                           const size_t);
+    /*!
+     * \brief add the contribution of the given Gauss point to the
+     * stiffness matrix and the inner forces
+     * \param[out] k:   stiffness matrix
+     * \param[out] r:   residual
+     * \param[in]  scs: structure current state
+     * \param[in]  bk:  consistent tangent operator at the Gauss point
+     * \param[in]  m:   pipe mesh
+     * \param[in]  mt:  stiffness matrix type
+     * \param[in]  i:   element number
+     * \param[in]  g:   Gauss point number
+     */
+    static void assemble(tfel::math::matrix<real>&,
+                         tfel::math::vector<real>&,
+                         const StructureCurrentState&,
+                         const tfel::math::matrix<real>&,
+                         const PipeMesh&,
+                         const StiffnessMatrixType,
+                         const size_t,
+                         const size_t);
+    /*!
+     * \brief add the contribution of the given Gauss point to the
+     * stiffness matrix and the inner forces
+     * \param[out] k:   stiffness matrix
+     * \param[out] r:   residual
+     * \param[in]  scs: structure current state
+     * \param[in]  bk:  consistent tangent operator at the Gauss point
+     * \param[in]  m:   pipe mesh
+     * \param[in]  mt:  stiffness matrix type
+     * \param[in]  i:   element number
+     * \param[in]  g:   Gauss point number
+     */
+    static void assemble(BorderedBandMatrix&,
+                         tfel::math::vector<real>&,
+                         const StructureCurrentState&,
+                         const tfel::math::matrix<real>&,
+                         const PipeMesh&,
+                         const StiffnessMatrixType,
+                         const size_t,
+                         const size_t);
     /*!
      * \return a pair containing:
      * - a boolean syaing if the behaviour integration shall be
@@ -117,6 +187,60 @@ namespace mtest {
         const real,
         const StiffnessMatrixType,
         const size_t);
+    /*!
+     * \return a pair containing:
+     * - a boolean syaing if the behaviour integration shall be
+     *   performed
+     * - a scaling factor that can be used to:
+     *     - increase the time step if the integration was successfull
+     *     - decrease the time step if the integration failed or if the
+     *       results were not reliable (time step too large).
+     * \param[out] k:   stiffness matrix
+     * \param[out] r:   residual
+     * \param[out] scs: structure current state
+     * \param[in]  u1:  current displacement estimation
+     * \param[in]  m:   pipe mesh
+     * \param[in]  b:   behaviour
+     * \param[in]  dt:  time increment
+     * \param[in]  mt:  stiffness matrix type
+     * \param[in]  i:   element number
+     */
+    static std::pair<bool, real> updateStiffnessMatrixAndInnerForces(
+        BorderedBandMatrix&,
+        tfel::math::vector<real>&,
+        StructureCurrentState&,
+        const Behaviour&,
+        const tfel::math::vector<real>&,
+        const PipeMesh&,
+        const real,
+        const StiffnessMatrixType,
+        const size_t);
+
+   private:
+    //! \brief implementation of the `assemble` methods
+    template <typename StiffnessMatrix>
+    static void assembleImplementation(StiffnessMatrix&,
+                                       tfel::math::vector<real>&,
+                                       const StructureCurrentState&,
+                                       const tfel::math::matrix<real>&,
+                                       const PipeMesh&,
+                                       const StiffnessMatrixType,
+                                       const size_t,
+                                       const size_t);
+    //! \brief implementation of the `updateStiffnessMatrixAndInnerForces`
+    //! methods
+    template <typename StiffnessMatrix>
+    static std::pair<bool, real>
+    updateStiffnessMatrixAndInnerForcesImplementation(
+        StiffnessMatrix&,
+        tfel::math::vector<real>&,
+        StructureCurrentState&,
+        const Behaviour&,
+        const tfel::math::vector<real>&,
+        const PipeMesh&,
+        const real,
+        const StiffnessMatrixType,
+        const size_t);
   };  // end of struct PipeLinearElement
 
 }  // end of namespace mtest
@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/matrix.hxx"
 #include "TFEL/Material/ModellingHypothesis.hxx"
 
 #include "MTest/Config.hxx"
@@ -31,12 +32,19 @@ namespace tfel::utilities {
   struct TextData;
 }  // namespace tfel::utilities
 
+namespace tfel::system {
+  // forward declaration
+  struct ThreadPool;
+}  // namespace tfel::system
+
 namespace mtest {
 
   // forward declaration
   struct PipeProfileHandler;
   // forward declaration
   struct GasEquationOfState;
+  // forward declaration
+  struct StructureCurrentState;
 
   //! \brief a study describing mechanical tests on pipes
   struct MTEST_VISIBILITY_EXPORT PipeTest : public SingleStructureScheme {
@@ -127,6 +135,20 @@ namespace mtest {
      * \param[in] n: number of elements
      */
     virtual void setNumberOfElements(const int);
+    /*!
+     * \brief set the number of threads used to integrate the behaviour
+     * over the elements.
+     *
+     * If greater than one, the elements are integrated concurrently by a
+     * pool of threads, each thread using its own behaviour workspace.
+     * The assembly of the stiffness matrix and of the residual is still
+     * performed sequentially in the order of the elements, so that the
+     * results do not depend on the number of threads.
+     *
+     * \note the behaviour must be thread-safe.
+     * \param[in] n: number of threads
+     */
+    virtual void setNumberOfThreads(const int);
     /*!
      * \brief set the element type
      * \param[in] e: element type
@@ -294,6 +316,29 @@ namespace mtest {
         const real,
         const real,
         const StiffnessMatrixType) const override;
+    /*!
+     * \brief compute the stiffness matrix and the residual stored in the
+     * given workspace. The stiffness matrix is stored as a bordered band
+     * matrix (see the `initializeWorkSpace` method).
+     * \return a pair containing:
+     * - a boolean syaing if the behaviour integration shall be
+     *   performed
+     * - a scaling factor that can be used to:
+     *     - increase the time step if the integration was successfull
+     *     - decrease the time step if the integration failed or if the
+     *       results were not reliable (time step too large).
+     * \param[out] s:   current structure state
+     * \param[out] wk:  solver workspace
+     * \param[in]  t:   current time
+     * \param[in]  dt:  time increment
+     * \param[in]  smt: type of tangent operator
+     */
+    std::pair<bool, real> computeLinearSystem(
+        StudyCurrentState&,
+        SolverWorkSpace&,
+        const real,
+        const real,
+        const StiffnessMatrixType) const override;
     /*!
      * \param[in] : du unknows increment difference between two iterations
      */
@@ -514,12 +559,50 @@ namespace mtest {
      */
     void setGaussPointPositionForEvolutionsEvaluation(
         const CurrentState&) const override;
+    /*!
+     * \brief integrate the behaviour on all the elements using the thread
+     * pool, then assemble the stiffness matrix and the inner forces.
+     * \return a pair containing a boolean stating if the integration
+     * succeeded and a scaling factor for the time step.
+     * \param[out] k:   stiffness matrix
+     * \param[out] r:   residual
+     * \param[out] scs: structure current state
+     * \param[in]  u1:  current estimate of the unknowns
+     * \param[in]  dt:  time increment
+     * \param[in]  mt:  type of stiffness matrix
+     */
+    template <typename StiffnessMatrix>
+    std::pair<bool, real> computeStiffnessMatrixAndInnerForcesInParallel(
+        StiffnessMatrix&,
+        tfel::math::vector<real>&,
+        StructureCurrentState&,
+        const tfel::math::vector<real>&,
+        const real,
+        const StiffnessMatrixType) const;
+    /*!
+     * \brief implementation of the `computeStiffnessMatrixAndResidual`
+     * and `computeLinearSystem` methods.
+     * \param[out] s:   current structure state
+     * \param[out] k:   stiffness matrix
+     * \param[out] r:   residual
+     * \param[in]  t:   current time
+     * \param[in]  dt:  time increment
+     * \param[in]  mt:  type of stiffness matrix
+     */
+    template <typename StiffnessMatrix>
+    std::pair<bool, real> computeStiffnessMatrixAndResidualImplementation(
+        StudyCurrentState&,
+        StiffnessMatrix&,
+        tfel::math::vector<real>&,
+        const real,
+        const real,
+        const StiffnessMatrixType) const;
     //! \brief description of an additional
     struct AdditionalOutput {
       //! \brief description
       std::string d;
       //! \brief functor
-      std::function<void(std::ostream&, const StudyCurrentState&)> f;
+      std::function<real(const StudyCurrentState&)> f;
     };
     //! \brief additional outputs
     std::vector<AdditionalOutput> aoutputs;
@@ -560,6 +643,20 @@ namespace mtest {
     //! \brief element type
     //! \brief small strain hypothesis
     bool hpp = false;
+    //! \brief number of threads used to integrate the behaviour
+    int number_of_threads = 1;
+    //! \brief thread pool used to integrate the behaviour
+    std::unique_ptr<tfel::system::ThreadPool> pool;
+    /*!
+     * \brief results of the behaviour integration at each Gauss point
+     * (only used by the parallel integration)
+     */
+    mutable std::vector<std::pair<bool, real>> integration_results;
+    /*!
+     * \brief consistent tangent operators at each Gauss point (only used
+     * by the parallel integration)
+     */
+    mutable std::vector<tfel::math::matrix<real>> tangent_operators;
   };  // end of struct PipeTest
 
 }  // end of namespace mtest
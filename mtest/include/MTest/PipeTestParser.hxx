@@ -105,6 +105,12 @@ namespace mtest {
      * \param[in,out] p: position in the input file
      */
     virtual void handleNumberOfElements(PipeTest&, tokens_iterator&);
+    /*!
+     * \brief handle the `@NumberOfThreads` keyword
+     * \param[out]    t: test
+     * \param[in,out] p: position in the input file
+     */
+    virtual void handleNumberOfThreads(PipeTest&, tokens_iterator&);
     /*!
      * \brief handle the `@ElementType` keyword
      * \param[out]    t: test
@@ -28,8 +28,17 @@
 #include "MTest/Scheme.hxx"
 #include "MTest/SolverOptions.hxx"
 
+namespace tfel::system {
+
+  // forward declaration
+  struct ColumnarBinaryWriter;
+
+}  // end of namespace tfel::system
+
 namespace mtest {
 
+  // forward declaration
+  struct AsynchronousOutputWriter;
   // forward declaration
   struct AccelerationAlgorithm;
 
@@ -39,6 +48,16 @@ namespace mtest {
       USERDEFINEDTIMES,
       EVERYPERIOD
     };  // end of enum OutputFrequency
+    //! \brief supported formats of the output file
+    enum OutputFileFormat {
+      //! \brief text file with one line per output time
+      TEXTOUTPUTFILEFORMAT,
+      /*!
+       * \brief binary file using the columnar binary format described in
+       * `TFEL/Utilities/ColumnarBinaryFormat.hxx`
+       */
+      BINARYOUTPUTFILEFORMAT
+    };  // end of enum OutputFileFormat
     //! a simple alias
     using ModellingHypothesis = tfel::material::ModellingHypothesis;
     //! a simple alias
@@ -80,6 +99,28 @@ namespace mtest {
      * \param[in] p : precision
      */
     virtual void setOutputFilePrecision(const unsigned int);
+    /*!
+     * \brief set the output file format
+     * \param[in] f : file format
+     */
+    virtual void setOutputFileFormat(const OutputFileFormat);
+    /*!
+     * \brief if true, the output file, the residual file and the files
+     * associated with user defined post-processings are written by a
+     * background thread. The computation thread only copies the values
+     * to be written.
+     * \param[in] b: boolean
+     */
+    virtual void setAsynchronousOutput(const bool);
+    /*!
+     * \brief set the number of records after which the background
+     * thread flushes the output files. If null, which is the default,
+     * the files are only flushed at the end of the computation.
+     * \param[in] n: flush frequency
+     * \note this option is only meaningful if the results are written
+     * asynchronously.
+     */
+    virtual void setOutputFlushFrequency(const unsigned int);
     /*!
      * \brief set the residual file
      * \param[in] f : file name
@@ -228,6 +269,12 @@ namespace mtest {
      * \brief close and reopen the output files
      */
     virtual void resetOutputFile();
+    /*!
+     * \brief flush the output file. If the results are written
+     * asynchronously, this method waits until all the pending records
+     * have been written.
+     */
+    virtual void flushOutputFile() const;
     /*!
      * complete the initialisation. This method must be called once.
      * \note this method must be called by the derived class.
@@ -237,6 +284,37 @@ namespace mtest {
     ~SchemeBase() override;
 
    protected:
+    /*!
+     * \brief open the output file if the binary format is used. This
+     * method does nothing if the text format is used.
+     * \param[in] c: names of the columns
+     */
+    virtual void openBinaryOutputFile(const std::vector<std::string>&);
+    /*!
+     * \brief write the values stored in the `output_row` data member
+     * in the output file, if any.
+     */
+    virtual void writeOutputFileRow() const;
+    /*!
+     * \brief write the values stored in the `residual_row` data member
+     * in the residual file, if any. Those values are the iteration
+     * number, the norms of the correction and of the residual and,
+     * optionally, the values of the unknowns.
+     */
+    virtual void writeResidualFileRow() const;
+    /*!
+     * \brief write in the residual file a comment line announcing the
+     * resolution of a new time step
+     * \param[in] t: time at the beginning of the time step
+     * \param[in] dt: time increment
+     */
+    virtual void writeResidualFileTimeStep(const real, const real) const;
+    /*!
+     * \return the object writing the results in a background thread,
+     * or a null pointer if the results are written synchronously.
+     */
+    std::shared_ptr<AsynchronousOutputWriter> getAsynchronousOutputWriter()
+        const;
     //! \return the default stiffness matrix type
     virtual StiffnessMatrixType getDefaultStiffnessMatrixType() const = 0;
     /*!
@@ -272,6 +350,16 @@ namespace mtest {
     std::string output;
     //! output file
     mutable std::ofstream out;
+    //! output file format
+    OutputFileFormat output_file_format = TEXTOUTPUTFILEFORMAT;
+    //! names of the columns of the binary output file
+    std::vector<std::string> binary_output_columns;
+    //! binary output file
+    mutable std::shared_ptr<tfel::system::ColumnarBinaryWriter> binary_output;
+    //! values of the current row of the output file
+    mutable std::vector<real> output_row;
+    //! values of the current row of the residual file
+    mutable std::vector<real> residual_row;
     //! residual file name
     std::string residualFileName;
     //! xml file name
@@ -285,6 +373,42 @@ namespace mtest {
     int oprec = -1;
     //! residual file precision
     int rprec = -1;
+    //! write the results asynchronously
+    bool asynchronous_output = false;
+    //! number of records after which the output files are flushed
+    unsigned int output_flush_frequency = 0;
+
+   private:
+    /*!
+     * \brief write the given values in the output file
+     * \param[in] v: values
+     */
+    void printOutputFileRow(const std::vector<real>&) const;
+    /*!
+     * \brief write the given values in the residual file
+     * \param[in] v: values
+     */
+    void printResidualFileRow(const std::vector<real>&) const;
+    /*!
+     * \brief write the comment line announcing a new time step in the
+     * residual file
+     * \param[in] v: times at the beginning and at the end of the time step
+     */
+    void printResidualFileTimeStep(const std::vector<real>&) const;
+    //! identifier of the output file in the asynchronous writer
+    std::size_t output_file_id = 0;
+    //! identifier of the residual file in the asynchronous writer
+    std::size_t residual_file_id = 0;
+    /*!
+     * identifier of the comments announcing new time steps in the residual
+     * file in the asynchronous writer
+     */
+    std::size_t residual_file_time_step_id = 0;
+    /*!
+     * \brief asynchronous writer. This member is declared last so that
+     * the pending records are written before the files are closed.
+     */
+    std::shared_ptr<AsynchronousOutputWriter> output_writer;
   };  // end of struct SchemeBase
 
 }  // end of namespace mtest
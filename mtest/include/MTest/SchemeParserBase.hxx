@@ -183,6 +183,21 @@ namespace mtest {
      * \param[in,out] p : position in the input file
      */
     virtual void handleOutputFilePrecision(SchemeBase&, tokens_iterator&);
+    /*!
+     * \brief handle the `@OutputFileFormat` keyword
+     * \param[in,out] p : position in the input file
+     */
+    virtual void handleOutputFileFormat(SchemeBase&, tokens_iterator&);
+    /*!
+     * \brief handle the `@OutputFlushFrequency` keyword
+     * \param[in,out] p : position in the input file
+     */
+    virtual void handleOutputFlushFrequency(SchemeBase&, tokens_iterator&);
+    /*!
+     * \brief handle the `@AsynchronousOutput` keyword
+     * \param[in,out] p : position in the input file
+     */
+    virtual void handleAsynchronousOutput(SchemeBase&, tokens_iterator&);
     /*!
      * \brief handle the `@ResidualFile` keyword
      * \param[in,out] p : position in the input file
@@ -20,6 +20,7 @@
 
 #include "MTest/Config.hxx"
 #include "MTest/Types.hxx"
+#include "MTest/BorderedBandMatrix.hxx"
 
 namespace mtest {
 
@@ -39,6 +40,13 @@ namespace mtest {
     tfel::math::Permutation<size_type> p_lu;
     // temporary vector used by the LUSolve::exe function
     tfel::math::vector<real> x;
+    /*!
+     * \brief stiffness matrix used if the `use_bordered_band_matrix` flag
+     * is true. In this case, the `K` matrix is not used.
+     */
+    BorderedBandMatrix bK;
+    //! \brief flag stating if the stiffness matrix is stored in `bK`
+    bool use_bordered_band_matrix = false;
   };  // end of struct SolverWorkSpace
 
   /*!
@@ -47,6 +55,23 @@ namespace mtest {
    */
   MTEST_VISIBILITY_EXPORT void initialize(SolverWorkSpace&,
                                           const SolverWorkSpace::size_type);
+  /*!
+   * \brief factorize the stiffness matrix and solve the linear system
+   * \param[in,out] wk: workspace
+   * \param[in,out] x: on input, the right hand side. On output, the
+   * solution.
+   */
+  MTEST_VISIBILITY_EXPORT void solve(SolverWorkSpace&,
+                                     tfel::math::vector<real>&);
+  /*!
+   * \brief solve the linear system using the stiffness matrix factorized
+   * by a previous call to the `solve` function.
+   * \param[in,out] wk: workspace
+   * \param[in,out] x: on input, the right hand side. On output, the
+   * solution.
+   */
+  MTEST_VISIBILITY_EXPORT void back_substitute(SolverWorkSpace&,
+                                               tfel::math::vector<real>&);
 
 }  // namespace mtest
 
@@ -65,6 +65,15 @@ namespace mtest {
      * \return the behaviour workspace associated to the current thread.
      */
     BehaviourWorkSpace& getBehaviourWorkSpace() const;
+    /*!
+     * \return the `i`-th behaviour workspace. The workspaces are allocated
+     * on demand.
+     * \param[in] i: index of the workspace
+     *
+     * \note this method is not thread-safe: the workspaces used by
+     * concurrent threads must be allocated before launching them.
+     */
+    BehaviourWorkSpace& getBehaviourWorkSpace(const std::size_t) const;
     //! \return the behaviour associated to the structure
     const Behaviour& getBehaviour() const;
     //! \brief destructor
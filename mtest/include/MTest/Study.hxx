@@ -124,6 +124,36 @@ namespace mtest {
         const real,
         const real,
         const StiffnessMatrixType) const = 0;
+    /*!
+     * \brief compute the stiffness matrix and the residual stored in the
+     * given workspace.
+     *
+     * The default implementation calls the
+     * `computeStiffnessMatrixAndResidual` method with the dense stiffness
+     * matrix of the workspace. Studies which selects another storage of
+     * the stiffness matrix in the `initializeWorkSpace` method must
+     * override this method.
+     *
+     * \return a pair containing:
+     * - a boolean syaing if the behaviour integration shall be
+     *   performed
+     * - a scaling factor that can be used to:
+     *     - increase the time step if the integration was successfull
+     *     - decrease the time step if the integration failed or if the
+     *       results were not reliable (time step too large).
+     * \param[out] s:   current structure state
+     * \param[out] wk:  solver workspace
+     * \param[in]  t:   current time
+     * \param[in]  dt:  time increment
+     * \param[in]  smt: type of tangent operator
+     * \note the memory has already been allocated
+     */
+    virtual std::pair<bool, real> computeLinearSystem(
+        StudyCurrentState&,
+        SolverWorkSpace&,
+        const real,
+        const real,
+        const StiffnessMatrixType) const;
     /*!
      * \param[in] : du unknows increment difference between two iterations
      */
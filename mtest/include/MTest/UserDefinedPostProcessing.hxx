@@ -17,6 +17,8 @@ namespace mtest {
 
   // forward declaration
   struct Behaviour;
+  // forward declaration
+  struct AsynchronousOutputWriter;
 
   //! \brief class handling a user defined postprocessing
   struct UserDefinedPostProcessing {
@@ -37,6 +39,13 @@ namespace mtest {
      * \param[in] dt : time increment
      */
     void exe(const CurrentState&, const real, const real);
+    /*!
+     * \brief write the results using the given asynchronous writer. The
+     * post-processings are still evaluated by the calling thread.
+     * \param[in] w: writer
+     */
+    void setAsynchronousOutputWriter(
+        const std::shared_ptr<AsynchronousOutputWriter>&);
     //! destructor
     ~UserDefinedPostProcessing();
 
@@ -47,8 +56,14 @@ namespace mtest {
     std::map<std::string, std::function<real(const CurrentState&)>> extractors;
     //! evolution manager
     const EvolutionManager& evm;
-    //! output file
-    std::ofstream out;
+    //! output file, shared with the asynchronous writer, if any
+    std::shared_ptr<std::ofstream> out;
+    //! values of the current row
+    std::vector<real> values;
+    //! asynchronous writer
+    std::shared_ptr<AsynchronousOutputWriter> writer;
+    //! identifier of the output file in the asynchronous writer
+    std::size_t output_id = 0;
   };  // end of UserDefinedPostProcessing
 
 }  // end of namespace mtest
@@ -0,0 +1,141 @@
+/*!
+ * \file   mtest/src/AsynchronousOutputWriter.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <utility>
+#include "TFEL/Raise.hxx"
+#include "MTest/AsynchronousOutputWriter.hxx"
+
+namespace mtest {
+
+  AsynchronousOutputWriter::AsynchronousOutputWriter(const size_type n,
+                                                     const size_type f)
+      : flush_frequency(f) {
+    tfel::raise_if(n == 0,
+                   "AsynchronousOutputWriter::AsynchronousOutputWriter: "
+                   "invalid queue size");
+    this->records.resize(n);
+    this->thread = std::thread([this] { this->run(); });
+  }  // end of AsynchronousOutputWriter
+
+  AsynchronousOutputWriter::size_type AsynchronousOutputWriter::addOutput(
+      Writer w, Flusher f) {
+    // the outputs are only modified when the background thread is idle
+    auto lock = std::unique_lock<std::mutex>(this->m);
+    this->not_full.wait(
+        lock, [this] { return (this->nrecords == 0) && (!this->busy); });
+    this->outputs.push_back({std::move(w), std::move(f)});
+    return this->outputs.size() - 1;
+  }  // end of addOutput
+
+  void AsynchronousOutputWriter::write(const size_type o,
+                                       const std::vector<real>& v) {
+    {
+      auto lock = std::unique_lock<std::mutex>(this->m);
+      this->checkError();
+      tfel::raise_if(o >= this->outputs.size(),
+                     "AsynchronousOutputWriter::write: invalid output");
+      this->not_full.wait(
+          lock, [this] { return this->nrecords != this->records.size(); });
+      auto& r = this->records[(this->first + this->nrecords) %
+                              this->records.size()];
+      r.output = o;
+      r.values.assign(v.begin(), v.end());
+      ++(this->nrecords);
+    }
+    this->not_empty.notify_one();
+  }  // end of write
+
+  void AsynchronousOutputWriter::flush() {
+    auto lock = std::unique_lock<std::mutex>(this->m);
+    this->not_full.wait(
+        lock, [this] { return (this->nrecords == 0) && (!this->busy); });
+    this->checkError();
+    for (const auto& o : this->outputs) {
+      if (o.flush) {
+        o.flush();
+      }
+    }
+  }  // end of flush
+
+  void AsynchronousOutputWriter::checkError() {
+    if (this->error != nullptr) {
+      std::rethrow_exception(this->error);
+    }
+  }  // end of checkError
+
+  void AsynchronousOutputWriter::run() {
+    // buffer exchanged with the one of the record being written
+    auto values = std::vector<real>{};
+    auto nwritten = size_type{};
+    auto lock = std::unique_lock<std::mutex>(this->m);
+    while (true) {
+      this->not_empty.wait(
+          lock, [this] { return (this->stop) || (this->nrecords != 0); });
+      if (this->nrecords == 0) {
+        return;
+      }
+      auto& r = this->records[this->first];
+      const auto o = r.output;
+      values.swap(r.values);
+      this->first = (this->first + 1) % this->records.size();
+      --(this->nrecords);
+      this->busy = true;
+      const auto failed = this->error != nullptr;
+      lock.unlock();
+      this->not_full.notify_all();
+      auto e = std::exception_ptr{};
+      if (!failed) {
+        try {
+          this->outputs[o].write(values);
+          ++nwritten;
+          if ((this->flush_frequency != 0) &&
+              (nwritten % this->flush_frequency == 0)) {
+            for (const auto& output : this->outputs) {
+              if (output.flush) {
+                output.flush();
+              }
+            }
+          }
+        } catch (...) {
+          e = std::current_exception();
+        }
+      }
+      lock.lock();
+      if (e != nullptr) {
+        this->error = e;
+      }
+      this->busy = false;
+      this->not_full.notify_all();
+    }
+  }  // end of run
+
+  AsynchronousOutputWriter::~AsynchronousOutputWriter() {
+    {
+      auto lock = std::unique_lock<std::mutex>(this->m);
+      this->stop = true;
+    }
+    this->not_empty.notify_one();
+    this->thread.join();
+    if (this->error == nullptr) {
+      try {
+        for (const auto& o : this->outputs) {
+          if (o.flush) {
+            o.flush();
+          }
+        }
+      } catch (...) {
+      }
+    }
+  }  // end of ~AsynchronousOutputWriter
+
+}  // end of namespace mtest
@@ -0,0 +1,176 @@
+/*!
+ * \file   mtest/src/BehaviourBatchIntegration.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <future>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "TFEL/System/ThreadPool.hxx"
+#include "MTest/RoundingMode.hxx"
+#include "MTest/Behaviour.hxx"
+#include "MTest/CurrentState.hxx"
+#include "MTest/BehaviourWorkSpace.hxx"
+#include "MTest/BehaviourBatchIntegration.hxx"
+
+namespace mtest {
+
+  /*!
+   * \brief copy the values associated with an integration point
+   * \param[out] v: destination
+   * \param[in] values: array of values associated with all the
+   * integration points. If null, the destination is set to zero.
+   * \param[in] i: index of the integration point
+   */
+  static void copyIntegrationPointValues(tfel::math::vector<real>& v,
+                                         const real* const values,
+                                         const std::size_t i) {
+    if (values == nullptr) {
+      std::fill(v.begin(), v.end(), real(0));
+      return;
+    }
+    const auto* const b = values + i * v.size();
+    std::copy(b, b + v.size(), v.begin());
+  }  // end of copyIntegrationPointValues
+
+  /*!
+   * \brief integrate the behaviour on the integration points in the
+   * range `[ib, ie[`.
+   * \return true if the integration succeeded on all integration points
+   * \param[out] o: outputs
+   * \param[out] s: current state used to perform the integration
+   * \param[out] wk: workspace
+   * \param[in] b: behaviour
+   * \param[in] i: inputs
+   * \param[in] dt: time increment
+   * \param[in] ktype: type of the stiffness matrix
+   * \param[in] ib: index of the first integration point
+   * \param[in] ie: index past the last integration point
+   */
+  static bool integrateRange(const BehaviourBatchIntegrationOutputs& o,
+                             CurrentState& s,
+                             BehaviourWorkSpace& wk,
+                             const Behaviour& b,
+                             const BehaviourBatchIntegrationInputs& i,
+                             const real dt,
+                             const StiffnessMatrixType ktype,
+                             const std::size_t ib,
+                             const std::size_t ie) {
+    auto success = true;
+    for (auto p = ib; p != ie; ++p) {
+      copyIntegrationPointValues(s.e0, i.gradients0, p);
+      copyIntegrationPointValues(s.e1, i.gradients1, p);
+      copyIntegrationPointValues(s.s0, i.thermodynamic_forces0, p);
+      copyIntegrationPointValues(s.mprops1, i.material_properties, p);
+      copyIntegrationPointValues(s.iv0, i.internal_state_variables0, p);
+      copyIntegrationPointValues(s.esv0, i.external_state_variables0, p);
+      copyIntegrationPointValues(s.desv, i.external_state_variables_increments,
+                                 p);
+      s.s1 = s.s0;
+      s.iv1 = s.iv0;
+      auto ok = b.doPackagingStep(s, wk);
+      if (ok) {
+        setRoundingMode();
+        ok = b.integrate(s, wk, dt, ktype).first;
+        setRoundingMode();
+      }
+      if (o.status != nullptr) {
+        o.status[p] = ok ? 1 : 0;
+      }
+      if (!ok) {
+        success = false;
+        continue;
+      }
+      if (o.thermodynamic_forces1 != nullptr) {
+        std::copy(s.s1.begin(), s.s1.end(),
+                  o.thermodynamic_forces1 + p * s.s1.size());
+      }
+      if (o.internal_state_variables1 != nullptr) {
+        std::copy(s.iv1.begin(), s.iv1.end(),
+                  o.internal_state_variables1 + p * s.iv1.size());
+      }
+      if ((o.tangent_operators != nullptr) &&
+          (ktype != StiffnessMatrixType::NOSTIFFNESS)) {
+        const auto nr = wk.k.getNbRows();
+        const auto nc = wk.k.getNbCols();
+        auto* const k = o.tangent_operators + p * nr * nc;
+        for (std::size_t r = 0; r != nr; ++r) {
+          for (std::size_t c = 0; c != nc; ++c) {
+            k[r * nc + c] = wk.k(r, c);
+          }
+        }
+      }
+    }
+    return success;
+  }  // end of integrateRange
+
+  std::pair<std::size_t, std::size_t> getTangentOperatorSizes(
+      const Behaviour& b) {
+    BehaviourWorkSpace wk;
+    b.allocateWorkSpace(wk);
+    return {wk.k.getNbRows(), wk.k.getNbCols()};
+  }  // end of getTangentOperatorSizes
+
+  bool integrate(const BehaviourBatchIntegrationOutputs& o,
+                 const Behaviour& b,
+                 const BehaviourBatchIntegrationInputs& i,
+                 const real dt,
+                 const StiffnessMatrixType ktype,
+                 const std::size_t nthreads) {
+    tfel::raise_if(((i.n != 0) &&
+                    ((i.gradients0 == nullptr) || (i.gradients1 == nullptr))),
+                   "mtest::integrate: the gradients at the beginning and at "
+                   "the end of the time step must be given");
+    tfel::raise_if(nthreads == 0, "mtest::integrate: invalid number of threads");
+    const auto nt = std::max(std::min(nthreads, i.n), std::size_t(1));
+    // the workspaces and the states are allocated before launching the
+    // tasks as this operation is not thread-safe
+    auto states = std::vector<CurrentState>(nt);
+    auto wks = std::vector<std::unique_ptr<BehaviourWorkSpace>>{};
+    wks.reserve(nt);
+    for (std::size_t t = 0; t != nt; ++t) {
+      wks.push_back(std::make_unique<BehaviourWorkSpace>());
+      b.allocateWorkSpace(*(wks[t]));
+      b.allocateCurrentState(states[t]);
+      for (unsigned short r = 0; r != 3; ++r) {
+        for (unsigned short c = 0; c != 3; ++c) {
+          states[t].r(r, c) = (r == c) ? real(1) : real(0);
+        }
+      }
+    }
+    if (nt == 1) {
+      return integrateRange(o, states[0], *(wks[0]), b, i, dt, ktype, 0, i.n);
+    }
+    tfel::system::ThreadPool pool(nt);
+    auto tasks = std::vector<
+        std::future<tfel::system::ThreadedTaskResult<bool>>>{};
+    tasks.reserve(nt);
+    for (std::size_t t = 0; t != nt; ++t) {
+      tasks.push_back(pool.addTask([&, t] {
+        return integrateRange(o, states[t], *(wks[t]), b, i, dt, ktype,
+                              (t * i.n) / nt, ((t + 1) * i.n) / nt);
+      }));
+    }
+    pool.wait();
+    auto success = true;
+    for (auto& task : tasks) {
+      auto r = task.get();
+      if (!r) {
+        r.rethrow();
+      }
+      success = success && *r;
+    }
+    return success;
+  }  // end of integrate
+
+}  // end of namespace mtest
@@ -0,0 +1,227 @@
+/*!
+ * \file   mtest/src/BorderedBandMatrix.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Math/LUSolve.hxx"
+#include "TFEL/Math/LU/LUDecomp.hxx"
+#include "TFEL/Math/LU/LUException.hxx"
+#include "MTest/BorderedBandMatrix.hxx"
+
+namespace mtest {
+
+  BorderedBandMatrix::BorderedBandMatrix() = default;
+
+  void BorderedBandMatrix::resize(const size_type n_,
+                                  const size_type b_,
+                                  const size_type m_) {
+    tfel::raise_if(m_ > n_,
+                   "BorderedBandMatrix::resize: "
+                   "the number of bordered rows and columns is greater "
+                   "than the size of the matrix");
+    this->n = n_;
+    this->b = b_;
+    this->m = m_;
+    const auto nb = this->getBandSize();
+    this->A.assign(nb * (2 * this->b + 1), real(0));
+    this->B.assign(nb * this->m, real(0));
+    this->C.assign(nb * this->m, real(0));
+    this->D.resize(this->m, this->m);
+    std::fill(this->D.begin(), this->D.end(), real(0));
+    this->p.resize(this->m);
+    this->tmp.resize(this->m);
+    this->tmp2.resize(this->m);
+  }  // end of resize
+
+  void BorderedBandMatrix::reset() {
+    std::fill(this->A.begin(), this->A.end(), real(0));
+    std::fill(this->B.begin(), this->B.end(), real(0));
+    std::fill(this->C.begin(), this->C.end(), real(0));
+    std::fill(this->D.begin(), this->D.end(), real(0));
+  }  // end of reset
+
+  void BorderedBandMatrix::clear() {
+    this->n = this->b = this->m = 0;
+    this->A.clear();
+    this->B.clear();
+    this->C.clear();
+    this->D.clear();
+    this->p.clear();
+    this->tmp.clear();
+    this->tmp2.clear();
+  }  // end of clear
+
+  BorderedBandMatrix::size_type BorderedBandMatrix::getNbRows() const {
+    return this->n;
+  }  // end of getNbRows
+
+  BorderedBandMatrix::size_type BorderedBandMatrix::getNbCols() const {
+    return this->n;
+  }  // end of getNbCols
+
+  BorderedBandMatrix::size_type BorderedBandMatrix::getHalfBandWidth() const {
+    return this->b;
+  }  // end of getHalfBandWidth
+
+  BorderedBandMatrix::size_type BorderedBandMatrix::getBorderSize() const {
+    return this->m;
+  }  // end of getBorderSize
+
+  BorderedBandMatrix::size_type BorderedBandMatrix::getBandSize() const {
+    return this->n - this->m;
+  }  // end of getBandSize
+
+  real& BorderedBandMatrix::operator()(const size_type i, const size_type j) {
+    const auto nb = this->getBandSize();
+    if ((i < nb) && (j < nb)) {
+      tfel::raise_if(((i > j) ? i - j : j - i) > this->b,
+                     "BorderedBandMatrix::operator(): "
+                     "entry outside the band");
+      return this->A[i * (2 * this->b + 1) + j + this->b - i];
+    }
+    tfel::raise_if((i >= this->n) || (j >= this->n),
+                   "BorderedBandMatrix::operator(): "
+                   "invalid index");
+    if (i < nb) {
+      return this->B[(j - nb) * nb + i];
+    }
+    if (j < nb) {
+      return this->C[(i - nb) * nb + j];
+    }
+    return this->D(i - nb, j - nb);
+  }  // end of operator()
+
+  real BorderedBandMatrix::operator()(const size_type i,
+                                      const size_type j) const {
+    const auto nb = this->getBandSize();
+    if ((i < nb) && (j < nb)) {
+      if (((i > j) ? i - j : j - i) > this->b) {
+        return real(0);
+      }
+      return this->A[i * (2 * this->b + 1) + j + this->b - i];
+    }
+    if (i < nb) {
+      return this->B[(j - nb) * nb + i];
+    }
+    if (j < nb) {
+      return this->C[(i - nb) * nb + j];
+    }
+    return this->D(i - nb, j - nb);
+  }  // end of operator()
+
+  void BorderedBandMatrix::factorize() {
+    constexpr auto eps = 100 * std::numeric_limits<real>::min();
+    if (this->n == 0) {
+      tfel::raise<tfel::math::LUInvalidMatrixSize>();
+    }
+    const auto nb = this->getBandSize();
+    const auto w = 2 * this->b + 1;
+    // LU decomposition of the band part
+    for (size_type k = 0; k != nb; ++k) {
+      const auto* const Uk = this->A.data() + k * w + this->b - k;
+      const auto piv = Uk[k];
+      if (std::abs(piv) < eps) {
+        tfel::raise<tfel::math::LUNullPivot>();
+      }
+      const auto ie = std::min(nb, k + this->b + 1);
+      for (size_type i = k + 1; i != ie; ++i) {
+        auto* const Ai = this->A.data() + i * w + this->b - i;
+        Ai[k] /= piv;
+        const auto l = Ai[k];
+        for (size_type j = k + 1; j != ie; ++j) {
+          Ai[j] -= l * Uk[j];
+        }
+      }
+    }
+    if (this->m == 0) {
+      return;
+    }
+    // computation of the Schur complement
+    for (size_type c = 0; c != this->m; ++c) {
+      this->solveBand(this->B.data() + c * nb);
+    }
+    for (size_type r = 0; r != this->m; ++r) {
+      const auto* const Cr = this->C.data() + r * nb;
+      for (size_type c = 0; c != this->m; ++c) {
+        const auto* const Xc = this->B.data() + c * nb;
+        auto v = real(0);
+        for (size_type j = 0; j != nb; ++j) {
+          v += Cr[j] * Xc[j];
+        }
+        this->D(r, c) -= v;
+      }
+    }
+    this->p.reset();
+    tfel::math::LUDecomp<true>::exe(this->D, this->p);
+  }  // end of factorize
+
+  void BorderedBandMatrix::solveBand(real* const x) const {
+    const auto nb = this->getBandSize();
+    const auto w = 2 * this->b + 1;
+    // forward substitution
+    for (size_type i = 0; i != nb; ++i) {
+      const auto* const Ai = this->A.data() + i * w + this->b - i;
+      const auto jb = (i > this->b) ? i - this->b : size_type(0);
+      for (size_type j = jb; j != i; ++j) {
+        x[i] -= Ai[j] * x[j];
+      }
+    }
+    // backward substitution
+    for (size_type i = nb; i != 0; --i) {
+      const auto k = i - 1;
+      const auto* const Ak = this->A.data() + k * w + this->b - k;
+      const auto je = std::min(nb, k + this->b + 1);
+      for (size_type j = k + 1; j != je; ++j) {
+        x[k] -= Ak[j] * x[j];
+      }
+      x[k] /= Ak[k];
+    }
+  }  // end of solveBand
+
+  void BorderedBandMatrix::solve(tfel::math::vector<real>& x) const {
+    if (x.size() != this->n) {
+      tfel::raise<tfel::math::LUUnmatchedSize>();
+    }
+    if (this->n == 0) {
+      tfel::raise<tfel::math::LUInvalidMatrixSize>();
+    }
+    const auto nb = this->getBandSize();
+    this->solveBand(x.data());
+    if (this->m == 0) {
+      return;
+    }
+    for (size_type r = 0; r != this->m; ++r) {
+      const auto* const Cr = this->C.data() + r * nb;
+      auto v = x[nb + r];
+      for (size_type j = 0; j != nb; ++j) {
+        v -= Cr[j] * x[j];
+      }
+      this->tmp[r] = v;
+    }
+    tfel::math::LUSolve::back_substitute(this->D, this->tmp, this->tmp2,
+                                         this->p);
+    for (size_type c = 0; c != this->m; ++c) {
+      const auto* const Xc = this->B.data() + c * nb;
+      const auto xc = this->tmp[c];
+      for (size_type i = 0; i != nb; ++i) {
+        x[i] -= Xc[i] * xc;
+      }
+      x[nb + c] = xc;
+    }
+  }  // end of solve
+
+  BorderedBandMatrix::~BorderedBandMatrix() = default;
+
+}  // end of namespace mtest
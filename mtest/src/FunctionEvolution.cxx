@@ -11,6 +11,7 @@
  * project under specific licensing conditions.
  */
 
+#include <cstring>
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
 #include "MTest/FunctionEvolution.hxx"
@@ -23,41 +24,61 @@ namespace mtest {
         f(f_, buildExternalFunctionManagerFromConstantEvolutions(evm_)) {
   }  // end of FunctionEvolution::FunctionEvolution
 
+  void FunctionEvolution::resolveArguments() const {
+    this->arguments.clear();
+    for (const auto& n : this->f.getVariablesNames()) {
+      const auto pos = this->f.getVariablePosition(n);
+      this->arguments.push_back(Argument{n, pos, n == "t", real(0)});
+    }
+    this->resolved = true;
+    this->has_value = false;
+  }  // end of resolveArguments
+
+  const Evolution& FunctionEvolution::getEvolution(
+      const std::string& n) const {
+    const auto pev = this->evm.find(n);
+    // the error message is only built if required, since this method is
+    // called at each evaluation
+    if (pev == this->evm.end()) {
+      tfel::raise(
+          "FunctionEvolution::getEvolution: "
+          "can't evaluate argument '" +
+          n + "'");
+    }
+    return *(pev->second);
+  }  // end of getEvolution
+
   real FunctionEvolution::operator()(const real t) const {
-    const auto& args = this->f.getVariablesNames();
-    std::vector<std::string>::size_type i;
-    for (i = 0; i != args.size(); ++i) {
-      if (args[i] == "t") {
-        this->f.setVariableValue("t", t);
-      } else {
-        auto pev = evm.find(args[i]);
-        tfel::raise_if(pev == evm.end(),
-                       "FunctionEvolution::operator(): "
-                       "can't evaluate argument '" +
-                           args[i] + "'");
-        const auto& ev = *(pev->second);
-        this->f.setVariableValue(args[i], ev(t));
+    if (!this->resolved) {
+      this->resolveArguments();
+    }
+    auto update = !this->has_value;
+    for (auto& a : this->arguments) {
+      const auto v = a.is_time ? t : this->getEvolution(a.name)(t);
+      // exact identity of the values is checked
+      if (std::memcmp(&v, &(a.value), sizeof(real)) != 0) {
+        a.value = v;
+        update = true;
+      }
+    }
+    if (update) {
+      this->has_value = false;
+      for (const auto& a : this->arguments) {
+        this->f.setVariableValue(a.position, a.value);
       }
+      this->value = this->f.getValue();
+      this->has_value = true;
     }
-    return this->f.getValue();
+    return this->value;
   }  // end of FunctionEvolution::operator()
 
   bool FunctionEvolution::isConstant() const {
-    const auto& args = this->f.getVariablesNames();
-    std::vector<std::string>::size_type i;
-    for (i = 0; i != args.size(); ++i) {
-      if (args[i] == "t") {
+    if (!this->resolved) {
+      this->resolveArguments();
+    }
+    for (const auto& a : this->arguments) {
+      if ((a.is_time) || (!this->getEvolution(a.name).isConstant())) {
         return false;
-      } else {
-        auto pev = evm.find(args[i]);
-        tfel::raise_if(pev == evm.end(),
-                       "FunctionEvolution::operator(): "
-                       "can't evaluate argument '" +
-                           args[i] + "'");
-        const auto& ev = *(pev->second);
-        if (!ev.isConstant()) {
-          return false;
-        }
       }
     }
     return true;
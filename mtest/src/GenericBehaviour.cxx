@@ -14,6 +14,7 @@
 #include <cmath>
 #include <limits>
 #include <cstring>
+#include <vector>
 #include <ostream>
 #include <algorithm>
 
@@ -120,6 +121,9 @@ namespace mtest {
     auto& elm = ExternalLibraryManager::getExternalLibraryManager();
     const auto f = b + "_" + ModellingHypothesis::toString(h);
     this->fct = elm.getGenericBehaviourFunction(l, f);
+    if (elm.hasGenericBehaviourBatchFunction(l, f)) {
+      this->batch_fct = elm.getGenericBehaviourBatchFunction(l, f);
+    }
     if (this->stype == 1u) {
       // load the rotation functions
       this->rg_fct = elm.getGenericBehaviourRotateGradientsFunction(
@@ -198,13 +202,39 @@ namespace mtest {
                                      const std::string& b,
                                      const ParametersMap& params)
       : GenericBehaviour(h, l, b) {
-    if (params.empty()) {
-      return;
-    }
-    tfel::raise_if(this->btype != 2u,
-                   "GenericBehaviour::GenericBehaviour: "
-                   "no parameter expected");
     for (const auto& p : params) {
+      if (p.first == "batch_integration") {
+        tfel::raise_if(!p.second.is<bool>(),
+                       "GenericBehaviour::GenericBehaviour: "
+                       "unexpected type for parameter 'batch_integration'");
+        this->use_batch_integration = p.second.get<bool>();
+        tfel::raise_if(
+            (this->use_batch_integration) && (this->batch_fct == nullptr),
+            "GenericBehaviour::GenericBehaviour: "
+            "no batch integration function exported by the library");
+        continue;
+      }
+      if (p.first == "batch_integration_size") {
+        tfel::raise_if(!p.second.is<int>(),
+                       "GenericBehaviour::GenericBehaviour: "
+                       "unexpected type for parameter "
+                       "'batch_integration_size'");
+        const auto n = p.second.get<int>();
+        tfel::raise_if(n <= 0,
+                       "GenericBehaviour::GenericBehaviour: "
+                       "invalid value for parameter 'batch_integration_size'");
+        tfel::raise_if(this->batch_fct == nullptr,
+                       "GenericBehaviour::GenericBehaviour: "
+                       "no batch integration function exported by the "
+                       "library");
+        this->use_batch_integration = true;
+        this->batch_integration_size = static_cast<mfront_gb_size_type>(n);
+        continue;
+      }
+      tfel::raise_if(this->btype != 2u,
+                     "GenericBehaviour::GenericBehaviour: "
+                     "unexpected parameter '" +
+                         p.first + "'");
       if ((p.first != "stress_measure") && (p.first != "tangent_operator")) {
         tfel::raise(
             "GenericBehaviour::GenericBehaviour: "
@@ -305,6 +335,110 @@ namespace mtest {
     }
   }  // end of allocateWorkSpace
 
+  bool GenericBehaviour::hasBatchIntegrationFunction() const {
+    return this->batch_fct != nullptr;
+  }  // end of hasBatchIntegrationFunction
+
+  int GenericBehaviour::integrateBatch(mfront::gb::BatchBehaviourData& d) const {
+    tfel::raise_if(this->batch_fct == nullptr,
+                   "GenericBehaviour::integrateBatch: "
+                   "no batch integration function exported by the library");
+    return (this->batch_fct)(&d);
+  }  // end of integrateBatch
+
+  int GenericBehaviour::callBatchIntegrationFunction(
+      mfront::gb::BehaviourData& d, const size_t nK) const {
+    auto bd = mfront::gb::BatchBehaviourData{};
+    bd.error_message = d.error_message;
+    bd.dt = d.dt;
+    bd.n = this->batch_integration_size;
+    bd.s0.mass_density = d.s0.mass_density;
+    bd.s1.mass_density = d.s1.mass_density;
+    // material properties and external state variables are shared
+    bd.strides.mass_density = 0;
+    bd.strides.material_properties = 0;
+    bd.strides.external_state_variables = 0;
+    bd.s0.material_properties = d.s0.material_properties;
+    bd.s1.material_properties = d.s1.material_properties;
+    bd.s0.external_state_variables = d.s0.external_state_variables;
+    bd.s1.external_state_variables = d.s1.external_state_variables;
+    if (bd.n == 1) {
+      bd.K = d.K;
+      bd.rdt = d.rdt;
+      bd.speed_of_sound = d.speed_of_sound;
+      bd.s0 = d.s0;
+      bd.s1 = d.s1;
+      return this->integrateBatch(bd);
+    }
+    // the other quantities are replicated
+    const auto n = bd.n;
+    const auto ng = static_cast<size_t>(this->getGradientsSize());
+    const auto nth = static_cast<size_t>(this->getThermodynamicForcesSize());
+    const auto nisvs = this->getInternalStateVariablesSize();
+    auto replicate = [n](std::vector<real>& v, const real* const p,
+                         const size_t s) -> real* {
+      if ((p == nullptr) || (s == 0)) {
+        return nullptr;
+      }
+      v.resize(n * s);
+      for (mfront_gb_size_type i = 0; i != n; ++i) {
+        std::copy(p, p + s, v.begin() + i * s);
+      }
+      return v.data();
+    };
+    std::vector<real> K, rdt, sos, g0, g1, th0, th1, isvs0, isvs1, se0, se1,
+        de0, de1;
+    bd.strides.gradients = ng;
+    bd.strides.thermodynamic_forces = nth;
+    bd.strides.internal_state_variables = nisvs;
+    bd.strides.K = nK;
+    bd.K = replicate(K, d.K, nK);
+    bd.rdt = replicate(rdt, d.rdt, 1);
+    bd.speed_of_sound = replicate(sos, d.speed_of_sound, 1);
+    bd.s0.gradients = replicate(g0, d.s0.gradients, ng);
+    bd.s1.gradients = replicate(g1, d.s1.gradients, ng);
+    bd.s0.thermodynamic_forces = replicate(th0, d.s0.thermodynamic_forces, nth);
+    bd.s1.thermodynamic_forces = replicate(th1, d.s1.thermodynamic_forces, nth);
+    bd.s0.internal_state_variables =
+        replicate(isvs0, d.s0.internal_state_variables, nisvs);
+    bd.s1.internal_state_variables =
+        replicate(isvs1, d.s1.internal_state_variables, nisvs);
+    bd.s0.stored_energy = replicate(se0, d.s0.stored_energy, 1);
+    bd.s1.stored_energy = replicate(se1, d.s1.stored_energy, 1);
+    bd.s0.dissipated_energy = replicate(de0, d.s0.dissipated_energy, 1);
+    bd.s1.dissipated_energy = replicate(de1, d.s1.dissipated_energy, 1);
+    const auto r = this->integrateBatch(bd);
+    if (r < 0) {
+      return r;
+    }
+    tfel::raise_if(bd.failed_point != n,
+                   "GenericBehaviour::callBatchIntegrationFunction: "
+                   "invalid index of the failed integration point");
+    // results of the last copy are checked against the ones of the other
+    // copies and copied back
+    auto check_and_copy = [n](real* const p, const std::vector<real>& v,
+                              const size_t s) {
+      if (v.empty()) {
+        return;
+      }
+      const auto l = v.begin() + (n - 1) * s;
+      for (mfront_gb_size_type i = 0; i + 1 != n; ++i) {
+        tfel::raise_if(std::memcmp(&v[i * s], &*l, s * sizeof(real)) != 0,
+                       "GenericBehaviour::callBatchIntegrationFunction: "
+                       "inconsistent results between the integration points");
+      }
+      std::copy(l, l + s, p);
+    };
+    check_and_copy(d.K, K, nK);
+    check_and_copy(d.rdt, rdt, 1);
+    check_and_copy(d.speed_of_sound, sos, 1);
+    check_and_copy(d.s1.thermodynamic_forces, th1, nth);
+    check_and_copy(d.s1.internal_state_variables, isvs1, nisvs);
+    check_and_copy(d.s1.stored_energy, se1, 1);
+    check_and_copy(d.s1.dissipated_energy, de1, 1);
+    return r;
+  }  // end of callBatchIntegrationFunction
+
   void GenericBehaviour::getGradientsDefaultInitialValues(
       tfel::math::vector<real>& v) const {
     std::fill(v.begin(), v.end(), real(0));
@@ -391,7 +525,7 @@ namespace mtest {
                "the memory has not been allocated correctly");
     }
     std::fill(wk.D.begin(), wk.D.end(), 0.);
-    mfront::gb::BehaviourData d;
+    auto d = mfront::gb::BehaviourData{};
     d.error_message = error_message;
     if (this->stype == 1u) {
       // orthotropic behaviour
@@ -462,7 +596,13 @@ namespace mtest {
       this->executeFiniteStrainBehaviourTangentOperatorPreProcessing(d, ktype);
     }
     // calling the behaviour
-    const auto r = (this->fct)(&d);
+    const auto r = [this, &d, &wk] {
+      if (!this->use_batch_integration) {
+        return (this->fct)(&d);
+      }
+      return this->callBatchIntegrationFunction(
+          d, wk.D.getNbRows() * wk.D.getNbCols());
+    }();
     if (r != 1) {
       mfront::getLogStream() << error_message << '\n';
       return {false, rdt};
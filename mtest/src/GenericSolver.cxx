@@ -38,6 +38,24 @@ namespace mtest {
     log << '\n';
   }
 
+  /*!
+   * \brief print the stiffness matrix in the log stream
+   * \param[in] K: stiffness matrix
+   */
+  template <typename StiffnessMatrix>
+  static void printStiffnessMatrix(const StiffnessMatrix& K) {
+    using size_type = tfel::math::matrix<real>::size_type;
+    auto& log = mfront::getLogStream();
+    log << "Stiffness matrix:\n";
+    for (size_type i = 0; i != K.getNbRows(); ++i) {
+      for (size_type j = 0; j != K.getNbCols(); ++j) {
+        log << K(i, j) << " ";
+      }
+      log << '\n';
+    }
+    log << '\n';
+  }  // end of printStiffnessMatrix
+
   static std::pair<bool, real> iterate2(StudyCurrentState& scs,
                                         SolverWorkSpace& wk,
                                         const Study& s,
@@ -58,8 +76,7 @@ namespace mtest {
         }
       }
     }
-    const auto r =
-        s.computeStiffnessMatrixAndResidual(scs, wk.K, wk.r, t, dt, o.ktype);
+    const auto r = s.computeLinearSystem(scs, wk, t, dt, o.ktype);
     if (!r.first) {
       return r;
     }
@@ -145,23 +162,18 @@ namespace mtest {
       ++iter;
       nep2 = nep;
       nep = ne;
-      auto r =
-          s.computeStiffnessMatrixAndResidual(scs, wk.K, wk.r, t, dt, o.ktype);
+      auto r = s.computeLinearSystem(scs, wk, t, dt, o.ktype);
       if (!r.first) {
         return r;
       }
       r_dt = r.second;
       if ((mfront::getVerboseMode() >= mfront::VERBOSE_DEBUG) &&
           (o.ktype != StiffnessMatrixType::NOSTIFFNESS)) {
-        auto& log = mfront::getLogStream();
-        log << "Stiffness matrix:\n";
-        for (size_type i = 0; i != wk.K.getNbRows(); ++i) {
-          for (size_type j = 0; j != wk.K.getNbCols(); ++j) {
-            log << wk.K(i, j) << " ";
-          }
-          log << '\n';
+        if (wk.use_bordered_band_matrix) {
+          printStiffnessMatrix(wk.bK);
+        } else {
+          printStiffnessMatrix(wk.K);
         }
-        log << '\n';
       }
       if (mfront::getVerboseMode() >= mfront::VERBOSE_DEBUG) {
         auto& log = mfront::getLogStream();
@@ -173,7 +185,7 @@ namespace mtest {
       }
       wk.du = wk.r;
       setRoundingMode();
-      LUSolve::exe(wk.K, wk.du, wk.x, wk.p_lu);
+      solve(wk, wk.du);
       setRoundingMode();
       u1 -= wk.du;
       converged =
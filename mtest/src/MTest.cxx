@@ -297,7 +297,7 @@ namespace mtest {
     unsigned short cnbr = 2;
     const char* dvn;
     const char* thn;
-    if (this->out) {
+    if (this->out.is_open()) {
       this->out << "# first column: time\n";
       if (this->b->getBehaviourType() ==
           MechanicalBehaviourBase::STANDARDSTRAINBASEDBEHAVIOUR) {
@@ -343,6 +343,25 @@ namespace mtest {
       this->out << "# " << cnbr + 1 << " column: disspated energy\n";
       ++cnbr;
     }
+    if (this->output_file_format == BINARYOUTPUTFILEFORMAT) {
+      auto columns = std::vector<std::string>{"t"};
+      for (const auto& c : this->b->getGradientsComponents()) {
+        columns.push_back(c);
+      }
+      for (const auto& c : this->b->getThermodynamicForcesComponents()) {
+        columns.push_back(c);
+      }
+      const auto ivnames = this->b->expandInternalStateVariablesNames();
+      tfel::raise_if(ivnames.size() != this->b->getInternalStateVariablesSize(),
+                     "MTest::completeInitialisation : internal error "
+                     "(the number of names given by "
+                     "the mechanical behaviour don't match "
+                     "the number of internal state variables)");
+      columns.insert(columns.end(), ivnames.begin(), ivnames.end());
+      columns.push_back("StoredEnergy");
+      columns.push_back("DissipatedEnergy");
+      this->openBinaryOutputFile(columns);
+    }
     // convergence criterion value for driving variables
     if (this->options.eeps < 0) {
       this->options.eeps = 1.e-12;
@@ -381,6 +400,10 @@ namespace mtest {
                      << "#The following columns are the components of the "
                         "driving variable\n";
     }
+    // user defined post-processings
+    for (const auto& up : this->upostprocessings) {
+      up->setAsynchronousOutputWriter(this->getAsynchronousOutputWriter());
+    }
   }
 
   void MTest::initializeCurrentState(StudyCurrentState& s) const {
@@ -520,15 +543,15 @@ namespace mtest {
         ++pt2;
       }
     } catch (std::exception& e) {
-      this->out.flush();
+      this->flushOutputFile();
       report(e.what(), state, false);
       throw;
     } catch (...) {
-      this->out.flush();
+      this->flushOutputFile();
       report(nullptr, state, false);
       throw;
     }
-    this->out.flush();
+    this->flushOutputFile();
     report(nullptr, state, true);
     tfel::tests::TestResult tr;
     for (const auto& t : this->tests) {
@@ -834,8 +857,16 @@ namespace mtest {
       auto& log = mfront::getLogStream();
       report(log, ndv, ne, nr);
     }
-    if (this->residual) {
-      report(this->residual, ndv, ne, nr);
+    if (this->residual.is_open()) {
+      auto& v = this->residual_row;
+      v.resize(3 + ndv);
+      v[0] = static_cast<real>(iter);
+      v[1] = ne;
+      v[2] = nr;
+      for (size_type i = 0; i != ndv; ++i) {
+        v[3 + i] = state.u1(i);
+      }
+      this->writeResidualFileRow();
     }
     if ((!tfel::math::ieee754::isfinite(ne)) ||
         (!tfel::math::ieee754::isfinite(nr))) {
@@ -941,25 +972,26 @@ namespace mtest {
     if ((!o) && (this->output_frequency == USERDEFINEDTIMES)) {
       return;
     }
-    if (this->out) {
-      auto& cs = s.getStructureCurrentState("").istates[0];
-      // number of components of the driving variables and the thermodynamic
-      // forces
-      const auto ndv = this->b->getGradientsSize();
-      const auto nth = this->b->getThermodynamicForcesSize();
-      unsigned short i;
-      this->out << t << " ";
-      for (i = 0; i != ndv; ++i) {
-        this->out << s.u0[i] << " ";
-      }
-      for (i = 0; i != nth; ++i) {
-        this->out << cs.s0[i] << " ";
-      }
-      std::copy(cs.iv0.begin(), cs.iv0.end(),
-                std::ostream_iterator<real>(this->out, " "));
-      // stored and dissipated energies
-      this->out << cs.se0 << " " << cs.de0 << '\n';
+    if (this->output.empty()) {
+      return;
     }
+    const auto& cs = s.getStructureCurrentState("").istates[0];
+    // number of components of the driving variables and the thermodynamic
+    // forces
+    const auto ndv = this->b->getGradientsSize();
+    const auto nth = this->b->getThermodynamicForcesSize();
+    // the values are only copied here, the formatting being done by
+    // `writeOutputFileRow`, possibly in a background thread
+    this->output_row.resize(ndv + nth + cs.iv0.size() + 3);
+    auto p = this->output_row.begin();
+    *p = t;
+    p = std::copy(s.u0.begin(), s.u0.begin() + ndv, p + 1);
+    p = std::copy(cs.s0.begin(), cs.s0.begin() + nth, p);
+    p = std::copy(cs.iv0.begin(), cs.iv0.end(), p);
+    // stored and dissipated energies
+    *p = cs.se0;
+    *(p + 1) = cs.de0;
+    this->writeOutputFileRow();
   }  // end of MTest::printOutput
 
   void MTest::addEvent(const std::string& e,
@@ -971,9 +1003,10 @@ namespace mtest {
 
   void MTest::addUserDefinedPostProcessing(const std::string& f,
                                            const std::vector<std::string>& p) {
-    this->upostprocessings.push_back(
-        std::make_shared<UserDefinedPostProcessing>(
-            *(this->getBehaviour()), this->getEvolutions(), f, p));
+    auto up = std::make_shared<UserDefinedPostProcessing>(
+        *(this->getBehaviour()), this->getEvolutions(), f, p);
+    up->setAsynchronousOutputWriter(this->getAsynchronousOutputWriter());
+    this->upostprocessings.push_back(up);
   }  // end of MTest::addUserDefinedPostProcessing
 
   MTest::~MTest() = default;
@@ -15,9 +15,13 @@
 #include <regex>
 #include <string>
 #include <vector>
+#include <thread>
 #include <cstdlib>
+#include <fstream>
+#include <sstream>
 #include <utility>
 #include <iostream>
+#include <algorithm>
 
 #if defined _WIN32 || defined _WIN64
 #ifndef NOMINMAX
@@ -39,10 +43,14 @@
 #endif
 
 #include "TFEL/Raise.hxx"
+#include "TFEL/Tests/TestSuite.hxx"
 #include "TFEL/Tests/TestManager.hxx"
 #include "TFEL/Tests/XMLTestOutput.hxx"
+#include "TFEL/Tests/StdStreamTestOutput.hxx"
+#include "TFEL/Tests/MultipleTestOutputs.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "TFEL/Utilities/ArgumentParserBase.hxx"
+#include "TFEL/System/ThreadPool.hxx"
 
 #if !(defined _WIN32 || defined _WIN64 || defined __CYGWIN__)
 #include "TFEL/System/SignalManager.hxx"
@@ -59,6 +67,38 @@
 
 namespace mtest {
 
+  /*!
+   * \brief a test output storing the results of the tests. Those
+   * results are used to build the report requested by the
+   * `--xml-report` option.
+   */
+  struct TestResultsRecorder final : tfel::tests::TestOutput {
+    //! \brief result of a test
+    struct Entry {
+      //! \brief name of the test suite
+      std::string suite;
+      //! \brief group of the test
+      std::string group;
+      //! \brief name of the test
+      std::string name;
+      //! \brief result of the test
+      tfel::tests::TestResult result;
+    };
+    void beginTestSuite(const std::string& n) override { this->suite = n; }
+    void addTest(const std::string& g,
+                 const std::string& n,
+                 const tfel::tests::TestResult& r) override {
+      this->results.push_back({this->suite, g, n, r});
+    }
+    void endTestSuite(const tfel::tests::TestResult&) override {}
+    //! \brief recorded results
+    std::vector<Entry> results;
+
+   private:
+    //! \brief name of the current test suite
+    std::string suite;
+  };  // end of struct TestResultsRecorder
+
   struct MTestMain : tfel::utilities::ArgumentParserBase<MTestMain> {
     MTestMain(const int, const char* const* const);
     /*!
@@ -85,6 +125,10 @@ namespace mtest {
     void treatEnableFloatingPointExceptions();
     //! treat the `--rounding-direction-mode` option
     void treatRoundingDirectionMode();
+    //! treat the `--jobs` option
+    void treatJobs();
+    //! treat the `--xml-report` option
+    void treatXMLReport();
 #if !(defined _WIN32 || defined _WIN64 || defined __CYGWIN__)
     //! treat the `--backtrace` option
     void treatBacktrace();
@@ -98,6 +142,13 @@ namespace mtest {
      * \param[in] n: name of the test
      */
     void addTest(std::shared_ptr<SchemeBase>, const std::string&);
+    /*!
+     * \brief execute the tests stored in the `tests` member concurrently
+     * \return the results of all tests
+     */
+    tfel::tests::TestResult executeTestsConcurrently();
+    //! \brief write the report requested by the `--xml-report` option
+    void writeXMLReport() const;
     std::shared_ptr<SchemeBase> createMTestTest(const std::string&);
     std::shared_ptr<SchemeBase> createPTestTest(const std::string&);
     void treatMadnexInputFile(const std::string&);
@@ -136,6 +187,17 @@ namespace mtest {
     bool result_file_output = true;
     // generate residual file
     bool residual_file_output = false;
+    //! \brief floating point exceptions are handled through SIGFPE signals
+    bool fpe = false;
+    //! \brief number of tests executed concurrently
+    std::size_t jobs = 1;
+    //! \brief tests executed concurrently, in the order of the inputs
+    std::vector<std::pair<std::string, std::shared_ptr<SchemeBase>>> tests;
+    //! \brief name of the file gathering the results of all the tests
+    std::string xml_report;
+    //! \brief results of all the tests, used to write the xml report
+    std::shared_ptr<TestResultsRecorder> recorder =
+        std::make_shared<TestResultsRecorder>();
   };
 
   MTestMain::MTestMain(const int argc, const char* const* const argv)
@@ -160,6 +222,16 @@ namespace mtest {
     this->registerNewCallBack("--residual-file-output",
                               &MTestMain::treatResidualFileOutput,
                               "control residual output (default no)", true);
+    this->registerNewCallBack(
+        "--jobs", "-j", &MTestMain::treatJobs,
+        "number of tests executed concurrently. If no value is given, "
+        "the number of concurrent threads supported by the system is used",
+        true);
+    this->registerNewCallBack(
+        "--xml-report", &MTestMain::treatXMLReport,
+        "write the results of all the tests in the given file "
+        "using the JUnit format",
+        true);
     this->registerNewCallBack(
         "--help-keywords", &MTestMain::treatHelpCommands,
         "display the help of all available commands and exit.");
@@ -290,7 +362,13 @@ namespace mtest {
     }
   }  // end of MTestMain::treatScheme
 
-  void MTestMain::treatEnableFloatingPointExceptions() {
+  /*!
+   * \brief enable floating point exceptions in the calling thread.
+   *
+   * \note the floating point environment is local to each thread. This
+   * function must thus be called by every thread executing a test.
+   */
+  static void enableFloatingPointExceptions() {
     // mathematical
 #ifdef HAVE_FENV
     ::feclearexcept(FE_ALL_EXCEPT);
@@ -299,6 +377,11 @@ namespace mtest {
     ::feenableexcept(FE_INVALID);    // invalid operation
 #endif                               /* __GLIBC__ */
 #endif                               /* HAVE_FENV */
+  }  // end of enableFloatingPointExceptions
+
+  void MTestMain::treatEnableFloatingPointExceptions() {
+    this->fpe = true;
+    enableFloatingPointExceptions();
   }  // end of MTestMain::treatEnableFloatingPointExceptions
 
   void MTestMain::treatRoundingDirectionMode() {
@@ -309,6 +392,41 @@ namespace mtest {
     mtest::setRoundingMode(o);
   }  // end of MTestMain::setRoundingDirectionMode
 
+  void MTestMain::treatJobs() {
+    const auto& o = this->currentArgument->getOption();
+    if (o.empty()) {
+      this->jobs = std::max(std::thread::hardware_concurrency(), 1u);
+      return;
+    }
+    const auto n = [&o] {
+      try {
+        auto pos = std::size_t{};
+        const auto v = std::stoi(o, &pos);
+        if (pos == o.size()) {
+          return v;
+        }
+      } catch (std::exception&) {
+      }
+      return 0;
+    }();
+    tfel::raise_if(n <= 0,
+                   "MTestMain::treatJobs: "
+                   "invalid number of jobs '" +
+                       o + "'");
+    this->jobs = static_cast<std::size_t>(n);
+  }  // end of MTestMain::treatJobs
+
+  void MTestMain::treatXMLReport() {
+    const auto& o = this->currentArgument->getOption();
+    tfel::raise_if(o.empty(),
+                   "MTestMain::treatXMLReport: "
+                   "no file name given");
+    tfel::raise_if(!this->xml_report.empty(),
+                   "MTestMain::treatXMLReport: "
+                   "xml report already defined");
+    this->xml_report = o;
+  }  // end of MTestMain::treatXMLReport
+
 #if !(defined _WIN32 || defined _WIN64 || defined __CYGWIN__)
   void MTestMain::treatBacktrace() {
     using namespace tfel::system;
@@ -506,11 +624,197 @@ namespace mtest {
         }
       }
     }
-    auto& tm = tfel::tests::TestManager::getTestManager();
-    const auto r = tm.execute();
+    const auto r = [this] {
+      if (this->jobs > 1) {
+        return this->executeTestsConcurrently();
+      }
+      auto& tm = tfel::tests::TestManager::getTestManager();
+      return tm.execute();
+    }();
+    if (!this->xml_report.empty()) {
+      this->writeXMLReport();
+    }
     return r.success() ? EXIT_SUCCESS : EXIT_FAILURE;
   }  // end of execute
 
+  tfel::tests::TestResult MTestMain::executeTestsConcurrently() {
+    using TaskResult =
+        tfel::system::ThreadedTaskResult<tfel::tests::TestResult>;
+    // redirect the logging stream of a worker to a buffer during the
+    // execution of a test
+    struct LogStreamRedirection {
+      explicit LogStreamRedirection(std::ostream& os) {
+        mfront::setThreadLocalLogStream(os);
+      }
+      ~LogStreamRedirection() { mfront::resetThreadLocalLogStream(); }
+    };
+    const auto ntests = this->tests.size();
+    auto outputs = std::vector<std::ostringstream>(ntests);
+    auto logs = std::vector<std::ostringstream>(ntests);
+    auto recorders = std::vector<std::shared_ptr<TestResultsRecorder>>(ntests);
+    auto tasks = std::vector<std::future<TaskResult>>{};
+    tasks.reserve(ntests);
+    // the floating point environment is local to each thread and must
+    // be set up by the workers
+    const auto rounding_mode = std::fegetround();
+    {
+      tfel::system::ThreadPool pool(std::min(this->jobs, ntests));
+      for (decltype(this->tests.size()) i = 0; i != ntests; ++i) {
+        recorders[i] = std::make_shared<TestResultsRecorder>();
+        tasks.push_back(pool.addTask([this, &outputs, &logs, &recorders,
+                                      rounding_mode, i] {
+          LogStreamRedirection r(logs[i]);
+          std::fesetround(rounding_mode);
+          if (this->fpe) {
+            enableFloatingPointExceptions();
+          }
+          const auto& [n, t] = this->tests[i];
+          auto o = tfel::tests::MultipleTestOutputs{};
+          o.addTestOutput(recorders[i]);
+          if (this->xml_output) {
+            const auto f = t->isXMLOutputFileNameDefined()
+                               ? t->getXMLOutputFileName()
+                               : n + ".xml";
+            o.addTestOutput(std::make_shared<tfel::tests::XMLTestOutput>(f));
+          }
+          o.addTestOutput(
+              std::make_shared<tfel::tests::StdStreamTestOutput>(outputs[i]));
+          auto s = tfel::tests::TestSuite("MTest/" + n);
+          s.add(t);
+          return s.execute(o);
+        }));
+      }
+      pool.wait();
+    }
+    // outputs are printed in the order of the inputs, so that they do
+    // not depend on the order in which the tests were executed
+    auto results = tfel::tests::TestResult{};
+    auto& log = mfront::getLogStream();
+    for (decltype(this->tests.size()) i = 0; i != ntests; ++i) {
+      log << logs[i].str();
+      log.flush();
+      std::cout << outputs[i].str();
+      auto r = tasks[i].get();
+      if (r) {
+        results.append(*r);
+        this->recorder->results.insert(this->recorder->results.end(),
+                                       recorders[i]->results.begin(),
+                                       recorders[i]->results.end());
+        continue;
+      }
+      try {
+        r.rethrow();
+      } catch (std::exception& e) {
+        const auto& n = this->tests[i].first;
+        std::cerr << "MTestMain::executeTestsConcurrently: "
+                  << "execution of test '" << n << "' failed (" << e.what()
+                  << ")\n";
+        results.append(tfel::tests::TestResult(false));
+      }
+    }
+    std::cout.flush();
+    return results;
+  }  // end of MTestMain::executeTestsConcurrently
+
+  /*!
+   * \brief escape the characters having a special meaning in xml
+   * \param[in] s: string
+   */
+  static std::string escapeXML(const std::string& s) {
+    auto r = std::string{};
+    r.reserve(s.size());
+    for (const auto c : s) {
+      if (c == '&') {
+        r += "&amp;";
+      } else if (c == '<') {
+        r += "&lt;";
+      } else if (c == '>') {
+        r += "&gt;";
+      } else if (c == '"') {
+        r += "&quot;";
+      } else if (c == '\'') {
+        r += "&apos;";
+      } else {
+        r += c;
+      }
+    }
+    return r;
+  }  // end of escapeXML
+
+  /*!
+   * \brief write the description of a test result and of its sub-results
+   * \param[in] os: output stream
+   * \param[in] r: test result
+   */
+  static void writeTestResultDescription(std::ostream& os,
+                                         const tfel::tests::TestResult& r) {
+    if (!r.getDescription().empty()) {
+      os << (r.success() ? "SUCCESS : " : "FAILURE : ")
+         << escapeXML(r.getDescription()) << '\n';
+    }
+    if (!r.getFailureDescription().empty()) {
+      os << escapeXML(r.getFailureDescription()) << '\n';
+    }
+    for (const auto& sr : r) {
+      writeTestResultDescription(os, sr);
+    }
+  }  // end of writeTestResultDescription
+
+  void MTestMain::writeXMLReport() const {
+    const auto& results = this->recorder->results;
+    std::ofstream os(this->xml_report);
+    tfel::raise_if(!os,
+                   "MTestMain::writeXMLReport: "
+                   "can't open file '" +
+                       this->xml_report + "'");
+    const auto nfailures =
+        std::count_if(results.begin(), results.end(),
+                      [](const auto& e) { return !e.result.success(); });
+    auto time = double{};
+    for (const auto& e : results) {
+      time += e.result.duration();
+    }
+    os << "<?xml version=\"1.0\" ?>\n"
+       << "<testsuites name=\"mtest\" tests=\"" << results.size()
+       << "\" failures=\"" << nfailures << "\" time=\"" << time << "\">\n";
+    auto p = results.begin();
+    while (p != results.end()) {
+      // consecutive results belonging to the same test suite
+      const auto pe = std::find_if(
+          p, results.end(), [&p](const auto& e) { return e.suite != p->suite; });
+      const auto sfailures = std::count_if(
+          p, pe, [](const auto& e) { return !e.result.success(); });
+      auto stime = double{};
+      for (auto p2 = p; p2 != pe; ++p2) {
+        stime += p2->result.duration();
+      }
+      os << "<testsuite name=\"" << escapeXML(p->suite) << "\" tests=\""
+         << (pe - p) << "\" failures=\"" << sfailures << "\" time=\"" << stime
+         << "\">\n";
+      for (; p != pe; ++p) {
+        os << "<testcase classname=\"" << escapeXML(p->group) << "\" name=\""
+           << escapeXML(p->name) << "\" time=\"" << p->result.duration()
+           << "\">\n";
+        if (p->result.success()) {
+          os << "<system-out>\n";
+          writeTestResultDescription(os, p->result);
+          os << "</system-out>\n";
+        } else {
+          os << "<failure message=\"test failed\">\n";
+          writeTestResultDescription(os, p->result);
+          os << "</failure>\n";
+        }
+        os << "</testcase>\n";
+      }
+      os << "</testsuite>\n";
+    }
+    os << "</testsuites>\n";
+    tfel::raise_if(!os,
+                   "MTestMain::writeXMLReport: "
+                   "error while writing file '" +
+                       this->xml_report + "'");
+  }  // end of MTestMain::writeXMLReport
+
   std::shared_ptr<SchemeBase> MTestMain::createMTestTest(
       const std::string& path) {
     auto t = std::make_shared<MTest>();
@@ -696,7 +1000,15 @@ namespace mtest {
         t->setResidualFileName(n + "-residual.res");
       }
     }
+    if (this->jobs > 1) {
+      // outputs are handled by `executeTestsConcurrently`
+      this->tests.push_back({n, t});
+      return;
+    }
     tm.addTest("MTest/" + n, t);
+    if (!this->xml_report.empty()) {
+      tm.addTestOutput("MTest/" + n, this->recorder);
+    }
     if (this->xml_output) {
       std::shared_ptr<tfel::tests::TestOutput> o;
       if (!t->isXMLOutputFileNameDefined()) {
@@ -19,6 +19,7 @@
 #include "MTest/BehaviourWorkSpace.hxx"
 #include "MTest/CurrentState.hxx"
 #include "MTest/StructureCurrentState.hxx"
+#include "MTest/BorderedBandMatrix.hxx"
 #include "MTest/PipeCubicElement.hxx"
 
 namespace mtest {
@@ -212,16 +213,31 @@ namespace mtest {
     }
   }  // end of PipeCubicElement::computeStrain
 
-  std::pair<bool, real> PipeCubicElement::updateStiffnessMatrixAndInnerForces(
-      tfel::math::matrix<real>& k,
-      tfel::math::vector<real>& r,
+  std::pair<bool, real> PipeCubicElement::integrate(
       StructureCurrentState& scs,
+      BehaviourWorkSpace& bwk,
       const Behaviour& b,
-      const tfel::math::vector<real>& u1,
-      const PipeMesh& m,
       const real dt,
       const StiffnessMatrixType mt,
-      const size_t i) {
+      const size_t i,
+      const size_t g) {
+    auto& s = scs.istates[number_of_gauss_points * i + g];
+    setRoundingMode();
+    const auto rb = b.integrate(s, bwk, dt, mt);
+    setRoundingMode();
+    return rb;
+  }  // end of PipeCubicElement::integrate
+
+  template <typename StiffnessMatrix>
+  void PipeCubicElement::assembleImplementation(
+      StiffnessMatrix& k,
+      tfel::math::vector<real>& r,
+      const StructureCurrentState& scs,
+      const tfel::math::matrix<real>& bk,
+      const PipeMesh& m,
+      const StiffnessMatrixType mt,
+      const size_t i,
+      const size_t g) {
     //! a simple alias
     constexpr real pi = 3.14159265358979323846;
     // number of elements
@@ -242,26 +258,90 @@ namespace mtest {
     const auto r2 = r0 + 2 * dr / 3;
     // radial position of the fourth node
     const auto r3 = r0 + dr;
-    /* inner forces */
+    // Gauss point position in the reference element
+    const auto pg = pg_radii[g];
+    // current state
+    const auto& s = scs.istates[number_of_gauss_points * i + g];
+    // radial position of the Gauss point
+    const auto rg = s.position;
+    const real sfv[4] = {sf0(rg), sf1(rg), sf2(rg), sf3(rg)};
+    const real dsfv[4] = {dsf0(rg), dsf1(rg), dsf2(rg), dsf3(rg)};
+    // jacobian of the transformation
+    const auto J = PipeCubicElement::jacobian(r0, r1, r2, r3, pg);
+    // stress tensor
+    const auto pi_rr = s.s1[0];
+    const auto pi_zz = s.s1[1];
+    const auto pi_tt = s.s1[2];
+    const auto w = 2 * pi * wg[g] * J;
+    // innner forces
+    for (const auto j : {0, 1, 2, 3}) {
+      r[3 * i + j] += w * (rg * pi_rr * dsfv[j] / J + pi_tt * sfv[j]);
+    }
+    // axial forces
+    r[n] += w * rg * pi_zz;
+    // jacobian matrix
+    if (mt != StiffnessMatrixType::NOSTIFFNESS) {
+      for (const auto l : {0, 1, 2, 3}) {
+        for (const auto j : {0, 1, 2, 3}) {
+          const auto de0_du = dsfv[j] / J;
+          const auto de2_du = sfv[j] / rg;
+          k(3 * i + l, 3 * i + j) +=
+              w * (rg * dsfv[l] / J * (bk(0, 0) * de0_du + bk(0, 2) * de2_du) +
+                   sfv[l] * (bk(2, 0) * de0_du + bk(2, 2) * de2_du));
+        }
+        k(3 * i + l, n) +=
+            w * (rg * dsfv[l] / J * bk(0, 1) + bk(2, 1) * sfv[l]);
+      }  // loop over nodes
+      for (const auto j : {0, 1, 2, 3}) {
+        const auto de0_du = dsfv[j] / J;
+        const auto de2_du = sfv[j] / rg;
+        k(n, 3 * i + j) += w * rg * (bk(1, 0) * de0_du + bk(1, 2) * de2_du);
+      }
+      k(n, n) += w * rg * bk(1, 1);
+    }
+  }  // end of PipeCubicElement::assembleImplementation
+
+  void PipeCubicElement::assemble(tfel::math::matrix<real>& k,
+                                  tfel::math::vector<real>& r,
+                                  const StructureCurrentState& scs,
+                                  const tfel::math::matrix<real>& bk,
+                                  const PipeMesh& m,
+                                  const StiffnessMatrixType mt,
+                                  const size_t i,
+                                  const size_t g) {
+    assembleImplementation(k, r, scs, bk, m, mt, i, g);
+  }  // end of PipeCubicElement::assemble
+
+  void PipeCubicElement::assemble(BorderedBandMatrix& k,
+                                  tfel::math::vector<real>& r,
+                                  const StructureCurrentState& scs,
+                                  const tfel::math::matrix<real>& bk,
+                                  const PipeMesh& m,
+                                  const StiffnessMatrixType mt,
+                                  const size_t i,
+                                  const size_t g) {
+    assembleImplementation(k, r, scs, bk, m, mt, i, g);
+  }  // end of PipeCubicElement::assemble
+
+  template <typename StiffnessMatrix>
+  std::pair<bool, real>
+  PipeCubicElement::updateStiffnessMatrixAndInnerForcesImplementation(
+      StiffnessMatrix& k,
+      tfel::math::vector<real>& r,
+      StructureCurrentState& scs,
+      const Behaviour& b,
+      const tfel::math::vector<real>& u1,
+      const PipeMesh& m,
+      const real dt,
+      const StiffnessMatrixType mt,
+      const size_t i) {
     auto& bwk = scs.getBehaviourWorkSpace();
     // compute the strain
     computeStrain(scs, m, u1, i, true);
-    // loop over Gauss point
     auto r_dt = real{};
-    for (const auto g : {0, 1, 2, 3}) {
-      // Gauss point position in the reference element
-      const auto pg = pg_radii[g];
-      // current state
-      auto& s = scs.istates[4 * i + g];
-      // radial position of the Gauss point
-      const auto rg = s.position;
-      const real sfv[4] = {sf0(rg), sf1(rg), sf2(rg), sf3(rg)};
-      const real dsfv[4] = {dsf0(rg), dsf1(rg), dsf2(rg), dsf3(rg)};
-      // jacobian of the transformation
-      const auto J = PipeCubicElement::jacobian(r0, r1, r2, r3, pg);
-      setRoundingMode();
-      const auto rb = b.integrate(s, bwk, dt, mt);
-      setRoundingMode();
+    // loop over Gauss point
+    for (size_t g = 0; g != number_of_gauss_points; ++g) {
+      const auto rb = integrate(scs, bwk, b, dt, mt, i, g);
       r_dt = (g == 0) ? rb.second : std::min(rb.second, r_dt);
       if (!rb.first) {
         if (mfront::getVerboseMode() > mfront::VERBOSE_QUIET) {
@@ -271,41 +351,37 @@ namespace mtest {
         }
         return {false, r_dt};
       }
-      // stress tensor
-      const auto pi_rr = s.s1[0];
-      const auto pi_zz = s.s1[1];
-      const auto pi_tt = s.s1[2];
-      const auto w = 2 * pi * wg[g] * J;
-      // innner forces
-      for (const auto j : {0, 1, 2, 3}) {
-        r[3 * i + j] += w * (rg * pi_rr * dsfv[j] / J + pi_tt * sfv[j]);
-      }
-      // axial forces
-      r[n] += w * rg * pi_zz;
-      // jacobian matrix
-      if (mt != StiffnessMatrixType::NOSTIFFNESS) {
-        const auto& bk = bwk.k;
-        for (const auto l : {0, 1, 2, 3}) {
-          for (const auto j : {0, 1, 2, 3}) {
-            const auto de0_du = dsfv[j] / J;
-            const auto de2_du = sfv[j] / rg;
-            k(3 * i + l, 3 * i + j) +=
-                w *
-                (rg * dsfv[l] / J * (bk(0, 0) * de0_du + bk(0, 2) * de2_du) +
-                 sfv[l] * (bk(2, 0) * de0_du + bk(2, 2) * de2_du));
-          }
-          k(3 * i + l, n) +=
-              w * (rg * dsfv[l] / J * bk(0, 1) + bk(2, 1) * sfv[l]);
-        }  // loop over nodes
-        for (const auto j : {0, 1, 2, 3}) {
-          const auto de0_du = dsfv[j] / J;
-          const auto de2_du = sfv[j] / rg;
-          k(n, 3 * i + j) += w * rg * (bk(1, 0) * de0_du + bk(1, 2) * de2_du);
-        }
-        k(n, n) += w * rg * bk(1, 1);
-      }
-    }  // loop over gauss point
+      assemble(k, r, scs, bwk.k, m, mt, i, g);
+    }
     return {true, r_dt};
-  }
+  }  // end of updateStiffnessMatrixAndInnerForcesImplementation
+
+  std::pair<bool, real> PipeCubicElement::updateStiffnessMatrixAndInnerForces(
+      tfel::math::matrix<real>& k,
+      tfel::math::vector<real>& r,
+      StructureCurrentState& scs,
+      const Behaviour& b,
+      const tfel::math::vector<real>& u1,
+      const PipeMesh& m,
+      const real dt,
+      const StiffnessMatrixType mt,
+      const size_t i) {
+    return updateStiffnessMatrixAndInnerForcesImplementation(k, r, scs, b, u1,
+                                                             m, dt, mt, i);
+  }  // end of PipeCubicElement::updateStiffnessMatrixAndInnerForces
+
+  std::pair<bool, real> PipeCubicElement::updateStiffnessMatrixAndInnerForces(
+      BorderedBandMatrix& k,
+      tfel::math::vector<real>& r,
+      StructureCurrentState& scs,
+      const Behaviour& b,
+      const tfel::math::vector<real>& u1,
+      const PipeMesh& m,
+      const real dt,
+      const StiffnessMatrixType mt,
+      const size_t i) {
+    return updateStiffnessMatrixAndInnerForcesImplementation(k, r, scs, b, u1,
+                                                             m, dt, mt, i);
+  }  // end of PipeCubicElement::updateStiffnessMatrixAndInnerForces
 
 }  // end of namespace mtest
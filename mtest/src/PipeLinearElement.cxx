@@ -19,6 +19,7 @@
 #include "MTest/BehaviourWorkSpace.hxx"
 #include "MTest/CurrentState.hxx"
 #include "MTest/StructureCurrentState.hxx"
+#include "MTest/BorderedBandMatrix.hxx"
 #include "MTest/PipeLinearElement.hxx"
 
 namespace mtest {
@@ -149,16 +150,31 @@ namespace mtest {
     }
   }  // end of PipeLinearElement::computeStrain
 
-  std::pair<bool, real> PipeLinearElement::updateStiffnessMatrixAndInnerForces(
-      tfel::math::matrix<real>& k,
-      tfel::math::vector<real>& r,
+  std::pair<bool, real> PipeLinearElement::integrate(
       StructureCurrentState& scs,
+      BehaviourWorkSpace& bwk,
       const Behaviour& b,
-      const tfel::math::vector<real>& u1,
-      const PipeMesh& m,
       const real dt,
       const StiffnessMatrixType mt,
-      const size_t i) {
+      const size_t i,
+      const size_t g) {
+    auto& s = scs.istates[number_of_gauss_points * i + g];
+    setRoundingMode();
+    const auto rb = b.integrate(s, bwk, dt, mt);
+    setRoundingMode();
+    return rb;
+  }  // end of PipeLinearElement::integrate
+
+  template <typename StiffnessMatrix>
+  void PipeLinearElement::assembleImplementation(
+      StiffnessMatrix& k,
+      tfel::math::vector<real>& r,
+      const StructureCurrentState& scs,
+      const tfel::math::matrix<real>& bk,
+      const PipeMesh& m,
+      const StiffnessMatrixType mt,
+      const size_t i,
+      const size_t g) {
     //! a simple alias
     constexpr real pi = 3.14159265358979323846;
     // number of elements
@@ -177,22 +193,94 @@ namespace mtest {
     const auto r1 = Ri + dr * (i + 1);
     // jacobian of the transformation
     const auto J = dr / 2;
-    /* inner forces */
+    // Gauss point position in the reference element
+    const auto pg = pg_radii[g];
+    // radial position of the Gauss point
+    const auto rg = interpolate(r0, r1, pg);
+    // current state
+    const auto& s = scs.istates[number_of_gauss_points * i + g];
+    // stress tensor
+    const auto pi_rr = s.s1[0];
+    const auto pi_zz = s.s1[1];
+    const auto pi_tt = s.s1[2];
+    const auto w = 2 * pi * wg * J;
+    // innner forces
+    r[i] += w * (pi_rr * (-rg / dr) + pi_tt * (1 - pg) / 2);
+    r[i + 1] += w * (pi_rr * (rg / dr) + pi_tt * (1 + pg) / 2);
+    // axial forces
+    r[n] += w * rg * pi_zz;
+    // jacobian matrix
+    if (mt != StiffnessMatrixType::NOSTIFFNESS) {
+      const real de10_dur0 = -1 / dr;
+      const real de12_dur0 = (1 - pg) / (2 * rg);
+      const real de10_dur1 = 1 / dr;
+      const real de12_dur1 = (1 + pg) / (2 * rg);
+      k(i, i) += w * (bk(0, 0) * de10_dur0 * (-rg / dr) +
+                      bk(0, 2) * de12_dur0 * (-rg / dr) +
+                      bk(2, 0) * de10_dur0 * (1 - pg) / 2 +
+                      bk(2, 2) * de12_dur0 * (1 - pg) / 2);
+      k(i, i + 1) += w * (bk(0, 0) * de10_dur1 * (-rg / dr) +
+                          bk(0, 2) * de12_dur1 * (-rg / dr) +
+                          bk(2, 0) * de10_dur1 * (1 - pg) / 2 +
+                          bk(2, 2) * de12_dur1 * (1 - pg) / 2);
+      k(i, n) += w * (bk(0, 1) * (-rg / dr) + bk(2, 1) * (1 - pg) / 2);
+      k(i + 1, i) += w * (bk(0, 0) * de10_dur0 * (rg / dr) +
+                          bk(0, 2) * de12_dur0 * (rg / dr) +
+                          bk(2, 0) * de10_dur0 * (1 + pg) / 2 +
+                          bk(2, 2) * de12_dur0 * (1 + pg) / 2);
+      k(i + 1, i + 1) += w * (bk(0, 0) * de10_dur1 * (rg / dr) +
+                              bk(0, 2) * de12_dur1 * (rg / dr) +
+                              bk(2, 0) * de10_dur1 * (1 + pg) / 2 +
+                              bk(2, 2) * de12_dur1 * (1 + pg) / 2);
+      k(i + 1, n) += w * (bk(0, 1) * (rg / dr) + bk(2, 1) * (1 + pg) / 2);
+      // axial forces
+      k(n, i) += w * rg * (bk(1, 0) * de10_dur0 + bk(1, 2) * de12_dur0);
+      k(n, i + 1) += w * rg * (bk(1, 0) * de10_dur1 + bk(1, 2) * de12_dur1);
+      k(n, n) += w * rg * bk(1, 1);
+    }
+  }  // end of PipeLinearElement::assembleImplementation
+
+  void PipeLinearElement::assemble(tfel::math::matrix<real>& k,
+                                   tfel::math::vector<real>& r,
+                                   const StructureCurrentState& scs,
+                                   const tfel::math::matrix<real>& bk,
+                                   const PipeMesh& m,
+                                   const StiffnessMatrixType mt,
+                                   const size_t i,
+                                   const size_t g) {
+    assembleImplementation(k, r, scs, bk, m, mt, i, g);
+  }  // end of PipeLinearElement::assemble
+
+  void PipeLinearElement::assemble(BorderedBandMatrix& k,
+                                   tfel::math::vector<real>& r,
+                                   const StructureCurrentState& scs,
+                                   const tfel::math::matrix<real>& bk,
+                                   const PipeMesh& m,
+                                   const StiffnessMatrixType mt,
+                                   const size_t i,
+                                   const size_t g) {
+    assembleImplementation(k, r, scs, bk, m, mt, i, g);
+  }  // end of PipeLinearElement::assemble
+
+  template <typename StiffnessMatrix>
+  std::pair<bool, real>
+  PipeLinearElement::updateStiffnessMatrixAndInnerForcesImplementation(
+      StiffnessMatrix& k,
+      tfel::math::vector<real>& r,
+      StructureCurrentState& scs,
+      const Behaviour& b,
+      const tfel::math::vector<real>& u1,
+      const PipeMesh& m,
+      const real dt,
+      const StiffnessMatrixType mt,
+      const size_t i) {
     auto& bwk = scs.getBehaviourWorkSpace();
     // compute the strain
     computeStrain(scs, m, u1, i, true);
     auto r_dt = real{};
     // loop over Gauss point
-    for (const auto g : {0, 1}) {
-      // Gauss point position in the reference element
-      const auto pg = pg_radii[g];
-      // radial position of the Gauss point
-      const auto rg = interpolate(r0, r1, pg);
-      // current state
-      auto& s = scs.istates[2 * i + g];
-      setRoundingMode();
-      const auto rb = b.integrate(s, bwk, dt, mt);
-      setRoundingMode();
+    for (size_t g = 0; g != number_of_gauss_points; ++g) {
+      const auto rb = integrate(scs, bwk, b, dt, mt, i, g);
       r_dt = (g == 0) ? rb.second : std::min(rb.second, r_dt);
       if (!rb.first) {
         if (mfront::getVerboseMode() > mfront::VERBOSE_QUIET) {
@@ -202,48 +290,37 @@ namespace mtest {
         }
         return {false, r_dt};
       }
-      // stress tensor
-      const auto pi_rr = s.s1[0];
-      const auto pi_zz = s.s1[1];
-      const auto pi_tt = s.s1[2];
-      const auto w = 2 * pi * wg * J;
-      // innner forces
-      r[i] += w * (pi_rr * (-rg / dr) + pi_tt * (1 - pg) / 2);
-      r[i + 1] += w * (pi_rr * (rg / dr) + pi_tt * (1 + pg) / 2);
-      // axial forces
-      r[n] += w * rg * pi_zz;
-      // jacobian matrix
-      if (mt != StiffnessMatrixType::NOSTIFFNESS) {
-        const auto& bk = bwk.k;
-        const real de10_dur0 = -1 / dr;
-        const real de12_dur0 = (1 - pg) / (2 * rg);
-        const real de10_dur1 = 1 / dr;
-        const real de12_dur1 = (1 + pg) / (2 * rg);
-        k(i, i) += w * (bk(0, 0) * de10_dur0 * (-rg / dr) +
-                        bk(0, 2) * de12_dur0 * (-rg / dr) +
-                        bk(2, 0) * de10_dur0 * (1 - pg) / 2 +
-                        bk(2, 2) * de12_dur0 * (1 - pg) / 2);
-        k(i, i + 1) += w * (bk(0, 0) * de10_dur1 * (-rg / dr) +
-                            bk(0, 2) * de12_dur1 * (-rg / dr) +
-                            bk(2, 0) * de10_dur1 * (1 - pg) / 2 +
-                            bk(2, 2) * de12_dur1 * (1 - pg) / 2);
-        k(i, n) += w * (bk(0, 1) * (-rg / dr) + bk(2, 1) * (1 - pg) / 2);
-        k(i + 1, i) += w * (bk(0, 0) * de10_dur0 * (rg / dr) +
-                            bk(0, 2) * de12_dur0 * (rg / dr) +
-                            bk(2, 0) * de10_dur0 * (1 + pg) / 2 +
-                            bk(2, 2) * de12_dur0 * (1 + pg) / 2);
-        k(i + 1, i + 1) += w * (bk(0, 0) * de10_dur1 * (rg / dr) +
-                                bk(0, 2) * de12_dur1 * (rg / dr) +
-                                bk(2, 0) * de10_dur1 * (1 + pg) / 2 +
-                                bk(2, 2) * de12_dur1 * (1 + pg) / 2);
-        k(i + 1, n) += w * (bk(0, 1) * (rg / dr) + bk(2, 1) * (1 + pg) / 2);
-        // axial forces
-        k(n, i) += w * rg * (bk(1, 0) * de10_dur0 + bk(1, 2) * de12_dur0);
-        k(n, i + 1) += w * rg * (bk(1, 0) * de10_dur1 + bk(1, 2) * de12_dur1);
-        k(n, n) += w * rg * bk(1, 1);
-      }
+      assemble(k, r, scs, bwk.k, m, mt, i, g);
     }
     return {true, r_dt};
-  }
+  }  // end of updateStiffnessMatrixAndInnerForcesImplementation
+
+  std::pair<bool, real> PipeLinearElement::updateStiffnessMatrixAndInnerForces(
+      tfel::math::matrix<real>& k,
+      tfel::math::vector<real>& r,
+      StructureCurrentState& scs,
+      const Behaviour& b,
+      const tfel::math::vector<real>& u1,
+      const PipeMesh& m,
+      const real dt,
+      const StiffnessMatrixType mt,
+      const size_t i) {
+    return updateStiffnessMatrixAndInnerForcesImplementation(k, r, scs, b, u1,
+                                                             m, dt, mt, i);
+  }  // end of PipeLinearElement::updateStiffnessMatrixAndInnerForces
+
+  std::pair<bool, real> PipeLinearElement::updateStiffnessMatrixAndInnerForces(
+      BorderedBandMatrix& k,
+      tfel::math::vector<real>& r,
+      StructureCurrentState& scs,
+      const Behaviour& b,
+      const tfel::math::vector<real>& u1,
+      const PipeMesh& m,
+      const real dt,
+      const StiffnessMatrixType mt,
+      const size_t i) {
+    return updateStiffnessMatrixAndInnerForcesImplementation(k, r, scs, b, u1,
+                                                             m, dt, mt, i);
+  }  // end of PipeLinearElement::updateStiffnessMatrixAndInnerForces
 
 }  // end of namespace mtest
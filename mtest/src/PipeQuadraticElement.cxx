@@ -19,6 +19,7 @@
 #include "MTest/BehaviourWorkSpace.hxx"
 #include "MTest/CurrentState.hxx"
 #include "MTest/StructureCurrentState.hxx"
+#include "MTest/BorderedBandMatrix.hxx"
 #include "MTest/PipeQuadraticElement.hxx"
 
 namespace mtest {
@@ -158,17 +159,31 @@ namespace mtest {
     }
   }  // end of PipeQuadraticElement::computeStrain
 
-  std::pair<bool, real>
-  PipeQuadraticElement::updateStiffnessMatrixAndInnerForces(
-      tfel::math::matrix<real>& k,
-      tfel::math::vector<real>& r,
+  std::pair<bool, real> PipeQuadraticElement::integrate(
       StructureCurrentState& scs,
+      BehaviourWorkSpace& bwk,
       const Behaviour& b,
-      const tfel::math::vector<real>& u1,
-      const PipeMesh& m,
       const real dt,
       const StiffnessMatrixType mt,
-      const size_t i) {
+      const size_t i,
+      const size_t g) {
+    auto& s = scs.istates[number_of_gauss_points * i + g];
+    setRoundingMode();
+    const auto rb = b.integrate(s, bwk, dt, mt);
+    setRoundingMode();
+    return rb;
+  }  // end of PipeQuadraticElement::integrate
+
+  template <typename StiffnessMatrix>
+  void PipeQuadraticElement::assembleImplementation(
+      StiffnessMatrix& k,
+      tfel::math::vector<real>& r,
+      const StructureCurrentState& scs,
+      const tfel::math::matrix<real>& bk,
+      const PipeMesh& m,
+      const StiffnessMatrixType mt,
+      const size_t i,
+      const size_t g) {
     //! a simple alias
     constexpr real pi = 3.14159265358979323846;
     // number of elements
@@ -187,30 +202,92 @@ namespace mtest {
     const auto r1 = r0 + dr / 2;
     // radial position of the thrid node
     const auto r2 = r0 + dr;
-    /* inner forces */
+    // Gauss point position in the reference element
+    const auto pg = pg_radii[g];
+    // radial position of the Gauss point
+    const auto rg = interpolate(r0, r1, r2, pg);
+    // jacobian of the transformation
+    const auto J = r0 * (pg - 0.5) + r2 * (pg + 0.5) - 2 * r1 * pg;
+    // shape function value
+    const real sf[3] = {-0.5 * (1. - pg) * pg, (1. + pg) * (1. - pg),
+                        0.5 * (1 + pg) * pg};
+    // shape function derivative
+    const real dsf[3] = {pg - 0.5, -2. * pg, pg + 0.5};
+    // current state
+    const auto& s = scs.istates[number_of_gauss_points * i + g];
+    // stress tensor
+    const auto pi_rr = s.s1[0];
+    const auto pi_zz = s.s1[1];
+    const auto pi_tt = s.s1[2];
+    const auto w = 2 * pi * wg[g] * J;
+    // innner forces
+    for (const auto j : {0, 1, 2}) {
+      r[2 * i + j] += w * (rg * pi_rr * dsf[j] / J + pi_tt * sf[j]);
+    }
+    // axial forces
+    r[n] += w * rg * pi_zz;
+    // jacobian matrix
+    if (mt != StiffnessMatrixType::NOSTIFFNESS) {
+      for (const auto l : {0, 1, 2}) {
+        for (const auto j : {0, 1, 2}) {
+          const auto de0_du = dsf[j] / J;
+          const auto de2_du = sf[j] / rg;
+          k(2 * i + l, 2 * i + j) +=
+              w * (rg * dsf[l] / J * (bk(0, 0) * de0_du + bk(0, 2) * de2_du) +
+                   sf[l] * (bk(2, 0) * de0_du + bk(2, 2) * de2_du));
+        }
+        k(2 * i + l, n) += w * (rg * dsf[l] / J * bk(0, 1) + bk(2, 1) * sf[l]);
+      }  // loop over nodes
+      for (const auto j : {0, 1, 2}) {
+        const auto de0_du = dsf[j] / J;
+        const auto de2_du = sf[j] / rg;
+        k(n, 2 * i + j) += w * rg * (bk(1, 0) * de0_du + bk(1, 2) * de2_du);
+      }
+      k(n, n) += w * rg * bk(1, 1);
+    }
+  }  // end of PipeQuadraticElement::assembleImplementation
+
+  void PipeQuadraticElement::assemble(tfel::math::matrix<real>& k,
+                                      tfel::math::vector<real>& r,
+                                      const StructureCurrentState& scs,
+                                      const tfel::math::matrix<real>& bk,
+                                      const PipeMesh& m,
+                                      const StiffnessMatrixType mt,
+                                      const size_t i,
+                                      const size_t g) {
+    assembleImplementation(k, r, scs, bk, m, mt, i, g);
+  }  // end of PipeQuadraticElement::assemble
+
+  void PipeQuadraticElement::assemble(BorderedBandMatrix& k,
+                                      tfel::math::vector<real>& r,
+                                      const StructureCurrentState& scs,
+                                      const tfel::math::matrix<real>& bk,
+                                      const PipeMesh& m,
+                                      const StiffnessMatrixType mt,
+                                      const size_t i,
+                                      const size_t g) {
+    assembleImplementation(k, r, scs, bk, m, mt, i, g);
+  }  // end of PipeQuadraticElement::assemble
+
+  template <typename StiffnessMatrix>
+  std::pair<bool, real>
+  PipeQuadraticElement::updateStiffnessMatrixAndInnerForcesImplementation(
+      StiffnessMatrix& k,
+      tfel::math::vector<real>& r,
+      StructureCurrentState& scs,
+      const Behaviour& b,
+      const tfel::math::vector<real>& u1,
+      const PipeMesh& m,
+      const real dt,
+      const StiffnessMatrixType mt,
+      const size_t i) {
     auto& bwk = scs.getBehaviourWorkSpace();
     // compute the strain
     computeStrain(scs, m, u1, i, true);
     auto r_dt = real{};
     // loop over Gauss point
-    for (const auto g : {0, 1, 2}) {
-      setRoundingMode();
-      // Gauss point position in the reference element
-      const auto pg = pg_radii[g];
-      // radial position of the Gauss point
-      const auto rg = interpolate(r0, r1, r2, pg);
-      // jacobian of the transformation
-      const auto J = r0 * (pg - 0.5) + r2 * (pg + 0.5) - 2 * r1 * pg;
-      // shape function value
-      const real sf[3] = {-0.5 * (1. - pg) * pg, (1. + pg) * (1. - pg),
-                          0.5 * (1 + pg) * pg};
-      // shape function derivative
-      const real dsf[3] = {pg - 0.5, -2. * pg, pg + 0.5};
-      // current state
-      auto& s = scs.istates[3 * i + g];
-      setRoundingMode();
-      const auto rb = b.integrate(s, bwk, dt, mt);
-      setRoundingMode();
+    for (size_t g = 0; g != number_of_gauss_points; ++g) {
+      const auto rb = integrate(scs, bwk, b, dt, mt, i, g);
       r_dt = (g == 0) ? rb.second : std::min(rb.second, r_dt);
       if (!rb.first) {
         if (mfront::getVerboseMode() > mfront::VERBOSE_QUIET) {
@@ -220,40 +297,39 @@ namespace mtest {
         }
         return {false, r_dt};
       }
-      // stress tensor
-      const auto pi_rr = s.s1[0];
-      const auto pi_zz = s.s1[1];
-      const auto pi_tt = s.s1[2];
-      const auto w = 2 * pi * wg[g] * J;
-      // innner forces
-      for (const auto j : {0, 1, 2}) {
-        r[2 * i + j] += w * (rg * pi_rr * dsf[j] / J + pi_tt * sf[j]);
-      }
-      // axial forces
-      r[n] += w * rg * pi_zz;
-      // jacobian matrix
-      if (mt != StiffnessMatrixType::NOSTIFFNESS) {
-        const auto& bk = bwk.k;
-        for (const auto l : {0, 1, 2}) {
-          for (const auto j : {0, 1, 2}) {
-            const auto de0_du = dsf[j] / J;
-            const auto de2_du = sf[j] / rg;
-            k(2 * i + l, 2 * i + j) +=
-                w * (rg * dsf[l] / J * (bk(0, 0) * de0_du + bk(0, 2) * de2_du) +
-                     sf[l] * (bk(2, 0) * de0_du + bk(2, 2) * de2_du));
-          }
-          k(2 * i + l, n) +=
-              w * (rg * dsf[l] / J * bk(0, 1) + bk(2, 1) * sf[l]);
-        }  // loop over nodes
-        for (const auto j : {0, 1, 2}) {
-          const auto de0_du = dsf[j] / J;
-          const auto de2_du = sf[j] / rg;
-          k(n, 2 * i + j) += w * rg * (bk(1, 0) * de0_du + bk(1, 2) * de2_du);
-        }
-        k(n, n) += w * rg * bk(1, 1);
-      }
-    }  // loop over gauss point
+      assemble(k, r, scs, bwk.k, m, mt, i, g);
+    }
     return {true, r_dt};
-  }
+  }  // end of updateStiffnessMatrixAndInnerForcesImplementation
+
+  std::pair<bool, real>
+  PipeQuadraticElement::updateStiffnessMatrixAndInnerForces(
+      tfel::math::matrix<real>& k,
+      tfel::math::vector<real>& r,
+      StructureCurrentState& scs,
+      const Behaviour& b,
+      const tfel::math::vector<real>& u1,
+      const PipeMesh& m,
+      const real dt,
+      const StiffnessMatrixType mt,
+      const size_t i) {
+    return updateStiffnessMatrixAndInnerForcesImplementation(k, r, scs, b, u1,
+                                                             m, dt, mt, i);
+  }  // end of PipeQuadraticElement::updateStiffnessMatrixAndInnerForces
+
+  std::pair<bool, real>
+  PipeQuadraticElement::updateStiffnessMatrixAndInnerForces(
+      BorderedBandMatrix& k,
+      tfel::math::vector<real>& r,
+      StructureCurrentState& scs,
+      const Behaviour& b,
+      const tfel::math::vector<real>& u1,
+      const PipeMesh& m,
+      const real dt,
+      const StiffnessMatrixType mt,
+      const size_t i) {
+    return updateStiffnessMatrixAndInnerForcesImplementation(k, r, scs, b, u1,
+                                                             m, dt, mt, i);
+  }  // end of PipeQuadraticElement::updateStiffnessMatrixAndInnerForces
 
 }  // end of namespace mtest
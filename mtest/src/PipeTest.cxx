@@ -12,6 +12,7 @@
  */
 
 #include <memory>
+#include <future>
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
@@ -20,11 +21,14 @@
 #include "TFEL/Math/General/IEEE754.hxx"
 #include "TFEL/Math/LUSolve.hxx"
 #include "TFEL/Utilities/TextData.hxx"
+#include "TFEL/System/ThreadPool.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MTest/RoundingMode.hxx"
 #include "MTest/Evolution.hxx"
+#include "MTest/BorderedBandMatrix.hxx"
 #include "MTest/SolverWorkSpace.hxx"
 #include "MTest/Behaviour.hxx"
+#include "MTest/BehaviourWorkSpace.hxx"
 #include "MTest/CurrentState.hxx"
 #include "MTest/StudyCurrentState.hxx"
 #include "MTest/StructureCurrentState.hxx"
@@ -318,6 +322,13 @@ namespace mtest {
                  "number of elements", r, false);
   }  // end of setNumberOfElements
 
+  void PipeTest::setNumberOfThreads(const int n) {
+    tfel::raise_if(n <= 0,
+                   "PipeTest::setNumberOfThreads: "
+                   "invalid number of threads");
+    this->number_of_threads = n;
+  }  // end of setNumberOfThreads
+
   const PipeMesh& PipeTest::getMesh() const { return this->mesh; }
 
   template <typename T>
@@ -477,7 +488,7 @@ namespace mtest {
                      "PipeTest::completeInitialisation: "
                      "filling temperature not set");
     }
-    if (this->out) {
+    if (this->out.is_open()) {
       unsigned short c = 7;
       this->out << "# first  column : time\n"
                    "# second column : inner radius\n"
@@ -508,6 +519,31 @@ namespace mtest {
         ++c;
       }
     }
+    if (this->output_file_format == BINARYOUTPUTFILEFORMAT) {
+      auto columns = std::vector<std::string>{
+          "t",
+          "InnerRadius",
+          "OuterRadius",
+          "InnerRadiusDisplacement",
+          "OuterRadiusDisplacement",
+          "AxialDisplacement"};
+      if ((this->rl == IMPOSEDOUTERRADIUS) ||
+          (this->rl == IMPOSEDINNERRADIUS) || (this->rl == TIGHTPIPE) ||
+          (this->mandrel_radius_evolution != nullptr)) {
+        columns.push_back("InnerPressure");
+      }
+      if ((this->al == IMPOSEDAXIALGROWTH) ||
+          (this->mandrel_axial_growth_evolution != nullptr)) {
+        columns.push_back("AxialForce");
+      }
+      if (this->mandrel_radius_evolution != nullptr) {
+        columns.push_back("MandrelContactIndicator");
+      }
+      for (const auto& ao : this->aoutputs) {
+        columns.push_back(ao.d);
+      }
+      this->openBinaryOutputFile(columns);
+    }
     if (this->rl == TIGHTPIPE) {
       if (this->gseq != nullptr) {
         constexpr real pi = 3.14159265358979323846;
@@ -516,6 +552,10 @@ namespace mtest {
         this->n0 = this->gseq->computeNumberOfMoles(this->P0, V, this->T0);
       }
     }
+    if (this->number_of_threads > 1) {
+      this->pool = std::make_unique<tfel::system::ThreadPool>(
+          size_type(this->number_of_threads));
+    }
   }  // end of completeInitialisation
 
   PipeTest::size_type PipeTest::getNumberOfNodes() const {
@@ -739,14 +779,15 @@ namespace mtest {
         ++pt2;
       }
     } catch (std::exception& e) {
-      this->out.flush();
+      this->flushOutputFile();
       report(e.what(), state, false);
       throw;
     } catch (...) {
-      this->out.flush();
+      this->flushOutputFile();
       report(nullptr, state, false);
       throw;
     }
+    this->flushOutputFile();
     report(nullptr, state, true);
     tfel::tests::TestResult tr;
     for (const auto& t : this->tests) {
@@ -792,14 +833,29 @@ namespace mtest {
     const auto psz = this->getNumberOfUnknowns();
     // clear
     wk.K.clear();
+    wk.bK.clear();
     wk.p_lu.clear();
     wk.x.clear();
     wk.r.clear();
     wk.du.clear();
+    // The stiffness matrix is made of a band matrix associated with the
+    // radial displacements bordered by the row and column associated with
+    // the axial strain. The half bandwidth is given by the number of
+    // nodes per element minus one.
+    const auto hbw = [this]() -> size_type {
+      if (this->mesh.etype == PipeMesh::LINEAR) {
+        return 1;
+      } else if (this->mesh.etype == PipeMesh::QUADRATIC) {
+        return 2;
+      }
+      tfel::raise_if(this->mesh.etype != PipeMesh::CUBIC,
+                     "PipeTest::initializeWorkSpace: "
+                     "unknown element type");
+      return 3;
+    }();
+    wk.use_bordered_band_matrix = true;
     // resizing
-    wk.K.resize(psz, psz);
-    wk.p_lu.resize(psz);
-    wk.x.resize(psz);
+    wk.bK.resize(psz, hbw, 1);
     wk.r.resize(psz, 0.);
     wk.du.resize(psz, 0.);
   }  // end of initializeWorkSpace
@@ -873,6 +929,22 @@ namespace mtest {
     return {false, 1};
   }  // end of PipeTest
 
+  /*!
+   * \brief set all the values of the stiffness matrix to zero
+   * \param[out] k: stiffness matrix
+   */
+  static void resetStiffnessMatrix(tfel::math::matrix<real>& k) {
+    std::fill(k.begin(), k.end(), real(0));
+  }  // end of resetStiffnessMatrix
+
+  /*!
+   * \brief set all the values of the stiffness matrix to zero
+   * \param[out] k: stiffness matrix
+   */
+  static void resetStiffnessMatrix(BorderedBandMatrix& k) {
+    k.reset();
+  }  // end of resetStiffnessMatrix
+
   std::pair<bool, real> PipeTest::computeStiffnessMatrixAndResidual(
       StudyCurrentState& state,
       tfel::math::matrix<real>& k,
@@ -880,6 +952,33 @@ namespace mtest {
       const real t,
       const real dt,
       const StiffnessMatrixType mt) const {
+    return this->computeStiffnessMatrixAndResidualImplementation(state, k, r,
+                                                                 t, dt, mt);
+  }  // end of computeStiffnessMatrixAndResidual
+
+  std::pair<bool, real> PipeTest::computeLinearSystem(
+      StudyCurrentState& state,
+      SolverWorkSpace& wk,
+      const real t,
+      const real dt,
+      const StiffnessMatrixType mt) const {
+    if (!wk.use_bordered_band_matrix) {
+      return this->computeStiffnessMatrixAndResidualImplementation(
+          state, wk.K, wk.r, t, dt, mt);
+    }
+    return this->computeStiffnessMatrixAndResidualImplementation(
+        state, wk.bK, wk.r, t, dt, mt);
+  }  // end of computeLinearSystem
+
+  template <typename StiffnessMatrix>
+  std::pair<bool, real>
+  PipeTest::computeStiffnessMatrixAndResidualImplementation(
+      StudyCurrentState& state,
+      StiffnessMatrix& k,
+      tfel::math::vector<real>& r,
+      const real t,
+      const real dt,
+      const StiffnessMatrixType mt) const {
     using LE = PipeLinearElement;
     using QE = PipeQuadraticElement;
     using CE = PipeCubicElement;
@@ -887,7 +986,7 @@ namespace mtest {
     // reset r and k
     std::fill(r.begin(), r.end(), real(0));
     if (mt != StiffnessMatrixType::NOSTIFFNESS) {
-      std::fill(k.begin(), k.end(), real(0));
+      resetStiffnessMatrix(k);
     }
     // current pipe state
     auto& scs = state.getStructureCurrentState("");
@@ -1052,6 +1151,10 @@ namespace mtest {
         r(n) -= state.getEvolution("AxialForce")(t + dt);
       }
     }
+    if (this->pool != nullptr) {
+      return this->computeStiffnessMatrixAndInnerForcesInParallel(
+          k, r, scs, state.u1, dt, mt);
+    }
     // loop over the elements
     auto r_dt = real{};
     for (size_type i = 0; i != ne; ++i) {
@@ -1079,7 +1182,159 @@ namespace mtest {
       }
     }
     return {true, r_dt};
-  }  // end of computeStiffnessMatrixAndResidual
+  }  // end of computeStiffnessMatrixAndResidualImplementation
+
+  /*!
+   * \brief integrate the behaviour on a range of elements.
+   *
+   * The integration stops at the first Gauss point for which the
+   * behaviour integration fails.
+   *
+   * \param[out] results: results of the integration at each Gauss point
+   * \param[out] tangents: consistent tangent operators at each Gauss point
+   * \param[out] scs: structure current state
+   * \param[out] bwk: behaviour workspace
+   * \param[in]  b: behaviour
+   * \param[in]  u1: current estimate of the unknowns
+   * \param[in]  m: mesh
+   * \param[in]  dt: time increment
+   * \param[in]  mt: type of stiffness matrix
+   * \param[in]  ib: index of the first element
+   * \param[in]  ie: index past the last element
+   */
+  template <typename Element>
+  static void integrateElements(
+      std::vector<std::pair<bool, real>>& results,
+      std::vector<tfel::math::matrix<real>>& tangents,
+      StructureCurrentState& scs,
+      BehaviourWorkSpace& bwk,
+      const Behaviour& b,
+      const tfel::math::vector<real>& u1,
+      const PipeMesh& m,
+      const real dt,
+      const StiffnessMatrixType mt,
+      const size_t ib,
+      const size_t ie) {
+    constexpr auto ng = Element::number_of_gauss_points;
+    for (auto i = ib; i != ie; ++i) {
+      Element::computeStrain(scs, m, u1, i, true);
+      for (size_t g = 0; g != ng; ++g) {
+        const auto rb = Element::integrate(scs, bwk, b, dt, mt, i, g);
+        results[ng * i + g] = rb;
+        if (!rb.first) {
+          return;
+        }
+        if (mt != StiffnessMatrixType::NOSTIFFNESS) {
+          tangents[ng * i + g] = bwk.k;
+        }
+      }
+    }
+  }  // end of integrateElements
+
+  /*!
+   * \brief integrate the behaviour on all the elements using a thread pool
+   * and then assemble the stiffness matrix and the inner forces
+   * sequentially in the order of the elements.
+   *
+   * The returned time step scaling factor and the failure status are the
+   * ones that would have been obtained by a sequential integration.
+   */
+  template <typename Element, typename StiffnessMatrix>
+  static std::pair<bool, real> integrateAndAssembleInParallel(
+      StiffnessMatrix& k,
+      tfel::math::vector<real>& r,
+      std::vector<std::pair<bool, real>>& results,
+      std::vector<tfel::math::matrix<real>>& tangents,
+      tfel::system::ThreadPool& pool,
+      StructureCurrentState& scs,
+      const Behaviour& b,
+      const tfel::math::vector<real>& u1,
+      const PipeMesh& m,
+      const real dt,
+      const StiffnessMatrixType mt) {
+    constexpr auto ng = Element::number_of_gauss_points;
+    const auto ne = size_t(m.number_of_elements);
+    const auto nt = std::min(size_t(pool.getNumberOfThreads()), ne);
+    results.resize(ng * ne);
+    if (mt != StiffnessMatrixType::NOSTIFFNESS) {
+      tangents.resize(ng * ne);
+    }
+    // the workspaces are allocated before launching the tasks as this
+    // operation is not thread-safe
+    for (size_t t = 0; t != nt; ++t) {
+      scs.getBehaviourWorkSpace(t);
+    }
+    auto tasks = std::vector<
+        std::future<tfel::system::ThreadedTaskResult<void>>>{};
+    tasks.reserve(nt);
+    for (size_t t = 0; t != nt; ++t) {
+      tasks.push_back(pool.addTask([&, t] {
+        integrateElements<Element>(results, tangents, scs,
+                                   scs.getBehaviourWorkSpace(t), b, u1, m, dt,
+                                   mt, (t * ne) / nt, ((t + 1) * ne) / nt);
+      }));
+    }
+    pool.wait();
+    for (auto& task : tasks) {
+      auto tr = task.get();
+      if (!tr) {
+        tr.rethrow();
+      }
+    }
+    // sequential assembly
+    auto r_dt = real{};
+    for (size_t i = 0; i != ne; ++i) {
+      for (size_t g = 0; g != ng; ++g) {
+        const auto& rb = results[ng * i + g];
+        r_dt = ((i == 0) && (g == 0)) ? rb.second : std::min(rb.second, r_dt);
+        if (!rb.first) {
+          if (mfront::getVerboseMode() > mfront::VERBOSE_QUIET) {
+            auto& log = mfront::getLogStream();
+            log << "PipeTest::computeStiffnessMatrixAndResidual : "
+                << "behaviour intregration failed" << std::endl;
+          }
+          return {false, r_dt};
+        }
+        if (mt != StiffnessMatrixType::NOSTIFFNESS) {
+          Element::assemble(k, r, scs, tangents[ng * i + g], m, mt, i, g);
+        } else {
+          Element::assemble(k, r, scs, tfel::math::matrix<real>{}, m, mt, i,
+                            g);
+        }
+      }
+    }
+    return {true, r_dt};
+  }  // end of integrateAndAssembleInParallel
+
+  template <typename StiffnessMatrix>
+  std::pair<bool, real>
+  PipeTest::computeStiffnessMatrixAndInnerForcesInParallel(
+      StiffnessMatrix& k,
+      tfel::math::vector<real>& r,
+      StructureCurrentState& scs,
+      const tfel::math::vector<real>& u1,
+      const real dt,
+      const StiffnessMatrixType mt) const {
+    if (this->mesh.etype == PipeMesh::LINEAR) {
+      return integrateAndAssembleInParallel<
+          PipeLinearElement>(k, r, this->integration_results,
+                             this->tangent_operators, *(this->pool), scs,
+                             *(this->b), u1, this->mesh, dt, mt);
+    } else if (this->mesh.etype == PipeMesh::QUADRATIC) {
+      return integrateAndAssembleInParallel<
+          PipeQuadraticElement>(k, r, this->integration_results,
+                                this->tangent_operators, *(this->pool), scs,
+                                *(this->b), u1, this->mesh, dt, mt);
+    } else if (this->mesh.etype != PipeMesh::CUBIC) {
+      tfel::raise(
+          "PipeTest::computeStiffnessMatrixAndInnerForcesInParallel: "
+          "unknown element type");
+    }
+    return integrateAndAssembleInParallel<
+        PipeCubicElement>(k, r, this->integration_results,
+                          this->tangent_operators, *(this->pool), scs,
+                          *(this->b), u1, this->mesh, dt, mt);
+  }  // end of computeStiffnessMatrixAndInnerForcesInParallel
 
   void PipeTest::checkBehaviourConsistency(
       const std::shared_ptr<Behaviour>& bp) {
@@ -1149,8 +1404,9 @@ namespace mtest {
       auto& log = mfront::getLogStream();
       report(log, nu, nr);
     }
-    if (this->residual) {
-      report(this->residual, nu, nr);
+    if (this->residual.is_open()) {
+      this->residual_row.assign({static_cast<real>(iter), nu, nr});
+      this->writeResidualFileRow();
     }
     if ((!tfel::math::ieee754::isfinite(nu)) ||
         (!tfel::math::ieee754::isfinite(nr))) {
@@ -1349,7 +1605,7 @@ namespace mtest {
         du(n) += pi * Ri_ * Ri_;
       }
       setRoundingMode();
-      tfel::math::LUSolve::back_substitute(wk.K, du, wk.x, wk.p_lu);
+      back_substitute(wk, du);
       setRoundingMode();
       const real due_dp = *(du.rbegin() + 1);
       auto& Pi = state.getEvolution("InnerPressure");
@@ -1372,7 +1628,7 @@ namespace mtest {
         du(n) += pi * Ri_ * Ri_;
       }
       setRoundingMode();
-      tfel::math::LUSolve::back_substitute(wk.K, du, wk.x, wk.p_lu);
+      back_substitute(wk, du);
       setRoundingMode();
       const real du_dp = du[0];
       auto& Pi = state.getEvolution("InnerPressure");
@@ -1398,7 +1654,7 @@ namespace mtest {
       std::fill(du.begin(), du.end(), real(0));
       du(n) = 1;
       setRoundingMode();
-      tfel::math::LUSolve::back_substitute(wk.K, du, wk.x, wk.p_lu);
+      back_substitute(wk, du);
       setRoundingMode();
       const real dezz_dF = du(n);
       auto& F = state.getEvolution("AxialForce");
@@ -1494,39 +1750,39 @@ namespace mtest {
     if (t == "minimum_value") {
       this->aoutputs.push_back(
           {"minimum value of '" + n + "'",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMinimumValue(s, n);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMinimumValue(s, n);
            }});
     } else if (t == "maximum_value") {
       this->aoutputs.push_back(
           {"maximum value of '" + n + "'",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMaximumValue(s, n);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMaximumValue(s, n);
            }});
     } else if (t == "integral_value_initial_configuration") {
       this->aoutputs.push_back(
           {"integral value of '" + n + "' in the initial configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeIntegralValue(s, n);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeIntegralValue(s, n);
            }});
     } else if (t == "integral_value_current_configuration") {
       this->aoutputs.push_back(
           {"integral value of '" + n + "' in the current configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeIntegralValue(
+           [this, n](const StudyCurrentState& s) {
+             return this->computeIntegralValue(
                  s, n, Configuration::CURRENT_CONFIGURATION);
            }});
     } else if (t == "mean_value_initial_configuration") {
       this->aoutputs.push_back(
           {"mean value of '" + n + "' in the initial configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMeanValue(s, n);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMeanValue(s, n);
            }});
     } else if (t == "mean_value_current_configuration") {
       this->aoutputs.push_back(
           {"mean value of '" + n + "' in the current configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMeanValue(s, n,
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMeanValue(s, n,
                                           Configuration::CURRENT_CONFIGURATION);
            }});
     } else {
@@ -1864,41 +2120,37 @@ namespace mtest {
     if ((!o) && (this->output_frequency == USERDEFINEDTIMES)) {
       return;
     }
-    if (this->out) {
-      const auto& u1 = state.u1;
-      const auto n = this->getNumberOfNodes();
-      // inner radius
-      const auto Ri = this->mesh.inner_radius;
-      // outer radius
-      const auto Re = this->mesh.outer_radius;
-      this->out << t << " " << Ri + u1[0] << " " << Re + u1[n - 1] << " "
-                << u1[0] << " " << u1[n - 1] << " " << u1[n];
-      if ((this->rl == IMPOSEDOUTERRADIUS) ||
-          (this->rl == IMPOSEDINNERRADIUS) || (this->rl == TIGHTPIPE) ||
-          (this->mandrel_radius_evolution != nullptr)) {
-        this->out << " " << state.getEvolution("InnerPressure")(t);
-      }
-      if ((this->al == IMPOSEDAXIALGROWTH) ||
-          (this->mandrel_axial_growth_evolution != nullptr)) {
-        this->out << " " << state.getEvolution("AxialForce")(t);
-      }
-      if (this->mandrel_radius_evolution != nullptr) {
-        if (state.containsParameter("MandrelContactStateAtEndOfTimeStep")) {
-          if (state.getParameter<bool>("MandrelContactStateAtEndOfTimeStep")) {
-            this->out << " " << 1;
-          } else {
-            this->out << " " << 0;
-          }
-        } else {
-          this->out << " " << 0;
-        }
-      }
-      for (const auto& ao : this->aoutputs) {
-        this->out << " ";
-        ao.f(out, state);
-      }
-      this->out << '\n';
+    if (this->output.empty()) {
+      return;
+    }
+    const auto& u1 = state.u1;
+    const auto n = this->getNumberOfNodes();
+    // inner radius
+    const auto Ri = this->mesh.inner_radius;
+    // outer radius
+    const auto Re = this->mesh.outer_radius;
+    auto& v = this->output_row;
+    v.clear();
+    v.insert(v.end(), {t, Ri + u1[0], Re + u1[n - 1], u1[0], u1[n - 1], u1[n]});
+    if ((this->rl == IMPOSEDOUTERRADIUS) || (this->rl == IMPOSEDINNERRADIUS) ||
+        (this->rl == TIGHTPIPE) ||
+        (this->mandrel_radius_evolution != nullptr)) {
+      v.push_back(state.getEvolution("InnerPressure")(t));
+    }
+    if ((this->al == IMPOSEDAXIALGROWTH) ||
+        (this->mandrel_axial_growth_evolution != nullptr)) {
+      v.push_back(state.getEvolution("AxialForce")(t));
+    }
+    if (this->mandrel_radius_evolution != nullptr) {
+      const auto contact =
+          (state.containsParameter("MandrelContactStateAtEndOfTimeStep")) &&
+          (state.getParameter<bool>("MandrelContactStateAtEndOfTimeStep"));
+      v.push_back(contact ? real(1) : real(0));
+    }
+    for (const auto& ao : this->aoutputs) {
+      v.push_back(ao.f(state));
     }
+    this->writeOutputFileRow();
   }  // end of printOutput
 
   PipeTest::~PipeTest() = default;
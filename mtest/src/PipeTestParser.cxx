@@ -226,6 +226,8 @@ namespace mtest {
     this->registerCallBack("@OuterRadius", &PipeTestParser::handleOuterRadius);
     this->registerCallBack("@NumberOfElements",
                            &PipeTestParser::handleNumberOfElements);
+    this->registerCallBack("@NumberOfThreads",
+                           &PipeTestParser::handleNumberOfThreads);
     this->registerCallBack("@ElementType", &PipeTestParser::handleElementType);
     this->registerCallBack("@MandrelRadiusEvolution",
                            &PipeTestParser::handleMandrelRadiusEvolution);
@@ -351,6 +353,16 @@ namespace mtest {
                              this->tokens.end());
   }  // end of PipeTestParser::handleNumberOfElements
 
+  void PipeTestParser::handleNumberOfThreads(PipeTest& t, tokens_iterator& p) {
+    this->checkNotEndOfLine("PipeTestParser::handleNumberOfThreads", p,
+                            this->tokens.end());
+    t.setNumberOfThreads(this->readInt(p, this->tokens.end()));
+    this->checkNotEndOfLine("PipeTestParser::handleNumberOfThreads", p,
+                            this->tokens.end());
+    this->readSpecifiedToken("PipeTestParser::handleNumberOfThreads", ";", p,
+                             this->tokens.end());
+  }  // end of PipeTestParser::handleNumberOfThreads
+
   void PipeTestParser::handleElementType(PipeTest& t, tokens_iterator& p) {
     this->checkNotEndOfLine("PipeTestParser::handleElementType", p,
                             this->tokens.end());
@@ -15,10 +15,14 @@
 #include <algorithm>
 
 #include "TFEL/Raise.hxx"
+#if !(defined _WIN32 || defined _WIN64)
+#include "TFEL/System/ColumnarBinaryWriter.hxx"
+#endif /* !(defined _WIN32 || defined _WIN64) */
 #include "MFront/MFrontLogStream.hxx"
 #include "MTest/AccelerationAlgorithmFactory.hxx"
 #include "MTest/CastemAccelerationAlgorithm.hxx"
 #include "MTest/Evolution.hxx"
+#include "MTest/AsynchronousOutputWriter.hxx"
 #include "MTest/SchemeBase.hxx"
 
 namespace mtest {
@@ -311,8 +315,17 @@ namespace mtest {
   }  // end of SchemeBase::setStiffnessUpdatingPolicy
 
   void SchemeBase::resetOutputFile() {
+    // pending records must be written before the files are closed
+    if (this->output_writer != nullptr) {
+      this->output_writer->flush();
+    }
     // output file
-    if (!this->output.empty()) {
+    if (this->output_file_format == BINARYOUTPUTFILEFORMAT) {
+      this->binary_output.reset();
+      if ((!this->output.empty()) && (!this->binary_output_columns.empty())) {
+        this->openBinaryOutputFile(this->binary_output_columns);
+      }
+    } else if (!this->output.empty()) {
       this->out.close();
       this->out.open(this->output.c_str());
       tfel::raise_if(!this->out,
@@ -341,6 +354,35 @@ namespace mtest {
         }
       }
     }
+    // asynchronous writer
+    if ((this->asynchronous_output) && (this->output_writer == nullptr)) {
+      this->output_writer = std::make_shared<AsynchronousOutputWriter>(
+          1024, this->output_flush_frequency);
+      this->output_file_id = this->output_writer->addOutput(
+          [this](const std::vector<real>& v) { this->printOutputFileRow(v); },
+          [this] {
+#if !(defined _WIN32 || defined _WIN64)
+            if (this->binary_output != nullptr) {
+              this->binary_output->flush();
+            }
+#endif /* !(defined _WIN32 || defined _WIN64) */
+            if (this->out.is_open()) {
+              this->out.flush();
+            }
+          });
+      this->residual_file_id = this->output_writer->addOutput(
+          [this](const std::vector<real>& v) { this->printResidualFileRow(v); },
+          [this] {
+            if (this->residual.is_open()) {
+              this->residual.flush();
+            }
+          });
+      this->residual_file_time_step_id = this->output_writer->addOutput(
+          [this](const std::vector<real>& v) {
+            this->printResidualFileTimeStep(v);
+          },
+          nullptr);
+    }
   }  // end of resetOutputFile
 
   void SchemeBase::completeInitialisation() {
@@ -445,6 +487,138 @@ namespace mtest {
     this->oprec = static_cast<int>(p);
   }
 
+  void SchemeBase::setOutputFileFormat(const OutputFileFormat f) {
+#if defined _WIN32 || defined _WIN64
+    tfel::raise_if(f == BINARYOUTPUTFILEFORMAT,
+                   "SchemeBase::setOutputFileFormat: "
+                   "the binary format is not supported on this system");
+#endif /* defined _WIN32 || defined _WIN64 */
+    this->output_file_format = f;
+  }  // end of SchemeBase::setOutputFileFormat
+
+  void SchemeBase::setAsynchronousOutput(const bool b) {
+    tfel::raise_if(this->initialisationFinished,
+                   "SchemeBase::setAsynchronousOutput: "
+                   "this method must be called before the end of the "
+                   "initialisation");
+    this->asynchronous_output = b;
+  }  // end of SchemeBase::setAsynchronousOutput
+
+  void SchemeBase::setOutputFlushFrequency(const unsigned int n) {
+    tfel::raise_if(this->initialisationFinished,
+                   "SchemeBase::setOutputFlushFrequency: "
+                   "this method must be called before the end of the "
+                   "initialisation");
+    this->output_flush_frequency = n;
+  }  // end of SchemeBase::setOutputFlushFrequency
+
+  std::shared_ptr<AsynchronousOutputWriter>
+  SchemeBase::getAsynchronousOutputWriter() const {
+    return this->output_writer;
+  }  // end of SchemeBase::getAsynchronousOutputWriter
+
+  void SchemeBase::openBinaryOutputFile(const std::vector<std::string>& c) {
+    if ((this->output_file_format != BINARYOUTPUTFILEFORMAT) ||
+        (this->output.empty())) {
+      return;
+    }
+    this->binary_output_columns = c;
+    this->output_row.resize(c.size());
+    if (this->output_writer != nullptr) {
+      this->output_writer->flush();
+    }
+#if !(defined _WIN32 || defined _WIN64)
+    this->binary_output.reset();
+    this->binary_output =
+        std::make_shared<tfel::system::ColumnarBinaryWriter>(this->output, c);
+#endif /* !(defined _WIN32 || defined _WIN64) */
+  }  // end of SchemeBase::openBinaryOutputFile
+
+  void SchemeBase::writeOutputFileRow() const {
+    if (this->output_writer != nullptr) {
+      this->output_writer->write(this->output_file_id, this->output_row);
+    } else {
+      this->printOutputFileRow(this->output_row);
+    }
+  }  // end of SchemeBase::writeOutputFileRow
+
+  void SchemeBase::writeResidualFileRow() const {
+    if (this->output_writer != nullptr) {
+      this->output_writer->write(this->residual_file_id, this->residual_row);
+    } else {
+      this->printResidualFileRow(this->residual_row);
+    }
+  }  // end of SchemeBase::writeResidualFileRow
+
+  void SchemeBase::writeResidualFileTimeStep(const real t,
+                                             const real dt) const {
+    if (this->output_writer != nullptr) {
+      this->output_writer->write(this->residual_file_time_step_id,
+                                 {t, t + dt});
+    } else {
+      this->printResidualFileTimeStep({t, t + dt});
+    }
+  }  // end of SchemeBase::writeResidualFileTimeStep
+
+  void SchemeBase::printOutputFileRow(const std::vector<real>& v) const {
+    if (v.empty()) {
+      return;
+    }
+#if !(defined _WIN32 || defined _WIN64)
+    if (this->binary_output != nullptr) {
+      this->binary_output->write(v);
+      return;
+    }
+#endif /* !(defined _WIN32 || defined _WIN64) */
+    if (this->out.is_open()) {
+      this->out << v[0];
+      for (decltype(v.size()) i = 1; i != v.size(); ++i) {
+        this->out << " " << v[i];
+      }
+      this->out << '\n';
+    }
+  }  // end of SchemeBase::printOutputFileRow
+
+  void SchemeBase::printResidualFileRow(const std::vector<real>& v) const {
+    if ((!this->residual.is_open()) || (v.size() < 3)) {
+      return;
+    }
+    this->residual << "iteration " << static_cast<unsigned int>(v[0])
+                   << " : " << v[1] << " " << v[2];
+    if (v.size() > 3) {
+      this->residual << " (" << v[3];
+      for (decltype(v.size()) i = 4; i != v.size(); ++i) {
+        this->residual << " " << v[i];
+      }
+      this->residual << ")";
+    }
+    this->residual << '\n';
+  }  // end of SchemeBase::printResidualFileRow
+
+  void SchemeBase::printResidualFileTimeStep(
+      const std::vector<real>& v) const {
+    if ((!this->residual.is_open()) || (v.size() != 2)) {
+      return;
+    }
+    this->residual << '\n'
+                   << "#resolution from " << v[0] << " to " << v[1] << '\n';
+  }  // end of SchemeBase::printResidualFileTimeStep
+
+  void SchemeBase::flushOutputFile() const {
+    if (this->output_writer != nullptr) {
+      this->output_writer->flush();
+      return;
+    }
+#if !(defined _WIN32 || defined _WIN64)
+    if (this->binary_output != nullptr) {
+      this->binary_output->flush();
+    }
+#endif /* !(defined _WIN32 || defined _WIN64) */
+    if (this->out.is_open()) {
+      this->out.flush();
+    }
+  }  // end of SchemeBase::flushOutputFile
+
   void SchemeBase::setResidualFileName(const std::string& o) {
     tfel::raise_if(!this->residualFileName.empty(),
                    "SchemeBase::setResidualFileName : "
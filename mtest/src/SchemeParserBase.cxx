@@ -189,6 +189,50 @@ namespace mtest {
                              ";", p, this->tokens.end());
   }  // end of SchemeParserBase::handleOutputFilePrecision
 
+  void SchemeParserBase::handleOutputFileFormat(SchemeBase& t,
+                                                tokens_iterator& p) {
+    const auto f = this->readString(p, this->tokens.end());
+    if (f == "text") {
+      t.setOutputFileFormat(SchemeBase::TEXTOUTPUTFILEFORMAT);
+    } else if (f == "binary") {
+      t.setOutputFileFormat(SchemeBase::BINARYOUTPUTFILEFORMAT);
+    } else {
+      tfel::raise(
+          "SchemeParserBase::handleOutputFileFormat: "
+          "invalid format '" +
+          f + "' (expected 'text' or 'binary')");
+    }
+    this->readSpecifiedToken("SchemeParserBase::handleOutputFileFormat", ";",
+                             p, this->tokens.end());
+  }  // end of SchemeParserBase::handleOutputFileFormat
+
+  void SchemeParserBase::handleOutputFlushFrequency(SchemeBase& t,
+                                                    tokens_iterator& p) {
+    t.setOutputFlushFrequency(this->readUnsignedInt(p, this->tokens.end()));
+    this->readSpecifiedToken("SchemeParserBase::handleOutputFlushFrequency",
+                             ";", p, this->tokens.end());
+  }  // end of SchemeParserBase::handleOutputFlushFrequency
+
+  void SchemeParserBase::handleAsynchronousOutput(SchemeBase& t,
+                                                  tokens_iterator& p) {
+    this->checkNotEndOfLine("SchemeParserBase::handleAsynchronousOutput", p,
+                            this->tokens.end());
+    if (p->value == "true") {
+      t.setAsynchronousOutput(true);
+    } else if (p->value == "false") {
+      t.setAsynchronousOutput(false);
+    } else {
+      tfel::raise(
+          "SchemeParserBase::handleAsynchronousOutput: "
+          "unexpected value (expected 'true' or 'false', "
+          "read '" +
+          p->value + "')");
+    }
+    ++p;
+    this->readSpecifiedToken("SchemeParserBase::handleAsynchronousOutput", ";",
+                             p, this->tokens.end());
+  }  // end of SchemeParserBase::handleAsynchronousOutput
+
   void SchemeParserBase::handleResidualFile(SchemeBase& t, tokens_iterator& p) {
     t.setResidualFileName(this->readString(p, this->tokens.end()));
     this->readSpecifiedToken("SchemeParserBase::handleResidualFiles", ";", p,
@@ -746,6 +790,10 @@ namespace mtest {
     add("@XMLOutputFile", &SchemeParserBase::handleXMLOutputFile);
     add("@OutputFrequency", &SchemeParserBase::handleOutputFrequency);
     add("@OutputFilePrecision", &SchemeParserBase::handleOutputFilePrecision);
+    add("@OutputFileFormat", &SchemeParserBase::handleOutputFileFormat);
+    add("@OutputFlushFrequency",
+        &SchemeParserBase::handleOutputFlushFrequency);
+    add("@AsynchronousOutput", &SchemeParserBase::handleAsynchronousOutput);
     add("@ResidualFile", &SchemeParserBase::handleResidualFile);
     add("@ResidualFilePrecision",
         &SchemeParserBase::handleResidualFilePrecision);
@@ -381,9 +381,8 @@ namespace mtest {
       auto& log = mfront::getLogStream();
       log << "resolution from " << t << " to " << t + dt << '\n';
     }
-    if (this->residual) {
-      this->residual << '\n'
-                     << "#resolution from " << t << " to " << t + dt << '\n';
+    if (this->residual.is_open()) {
+      this->writeResidualFileTimeStep(t, dt);
     }
   }  // end of SingleStructureScheme::prepare
 
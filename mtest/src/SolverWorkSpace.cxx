@@ -0,0 +1,36 @@
+/*!
+ * \file   mtest/src/SolverWorkSpace.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include "TFEL/Math/LUSolve.hxx"
+#include "MTest/SolverWorkSpace.hxx"
+
+namespace mtest {
+
+  void solve(SolverWorkSpace& wk, tfel::math::vector<real>& x) {
+    if (wk.use_bordered_band_matrix) {
+      wk.bK.factorize();
+      wk.bK.solve(x);
+    } else {
+      tfel::math::LUSolve::exe(wk.K, x, wk.x, wk.p_lu);
+    }
+  }  // end of solve
+
+  void back_substitute(SolverWorkSpace& wk, tfel::math::vector<real>& x) {
+    if (wk.use_bordered_band_matrix) {
+      wk.bK.solve(x);
+    } else {
+      tfel::math::LUSolve::back_substitute(wk.K, x, wk.x, wk.p_lu);
+    }
+  }  // end of back_substitute
+
+}  // end of namespace mtest
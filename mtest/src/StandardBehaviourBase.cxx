@@ -17,6 +17,7 @@
 #include "TFEL/Math/tmatrix.hxx"
 #include "TFEL/Math/st2tost2.hxx"
 #include "TFEL/System/ExternalLibraryManager.hxx"
+#include "TFEL/System/ExternalBehaviourDescription.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MTest/BehaviourWorkSpace.hxx"
 #include "MTest/StandardBehaviourBase.hxx"
@@ -53,7 +54,9 @@ namespace mtest {
   StandardBehaviourDescription::StandardBehaviourDescription(
       const std::string& l, const std::string& b, const std::string& h) {
     using namespace tfel::system;
-    ExternalBehaviourData::operator=(ExternalBehaviourDescription(l, b, h));
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    ExternalBehaviourData::operator=(
+        *(elm.getExternalBehaviourDescription(l, b, h)));
   }  // end of StandardBehaviourDescription
 
   void StandardBehaviourBase::allocateCurrentState(CurrentState& s) const {
@@ -11,10 +11,24 @@
  * project under specific licensing conditions.
  */
 
+#include "TFEL/Raise.hxx"
+#include "MTest/SolverWorkSpace.hxx"
 #include "MTest/Study.hxx"
 
 namespace mtest {
 
+  std::pair<bool, real> Study::computeLinearSystem(
+      StudyCurrentState& s,
+      SolverWorkSpace& wk,
+      const real t,
+      const real dt,
+      const StiffnessMatrixType mt) const {
+    tfel::raise_if(wk.use_bordered_band_matrix,
+                   "Study::computeLinearSystem: "
+                   "unsupported storage of the stiffness matrix");
+    return this->computeStiffnessMatrixAndResidual(s, wk.K, wk.r, t, dt, mt);
+  }  // end of computeLinearSystem
+
   Study::~Study() = default;
 
 }  // end of namespace mtest
@@ -8,17 +8,32 @@
 #include "TFEL/Raise.hxx"
 #include "MTest/Behaviour.hxx"
 #include "MTest/Evolution.hxx"
+#include "MTest/AsynchronousOutputWriter.hxx"
 #include "MTest/UserDefinedPostProcessing.hxx"
 
 namespace mtest {
 
+  /*!
+   * \brief write the values of the post-processings
+   * \param[in] os: output stream
+   * \param[in] v: time followed by the values of the post-processings
+   */
+  static void UserDefinedPostProcessing_print(std::ostream& os,
+                                              const std::vector<real>& v) {
+    os << v[0] << " ";
+    for (decltype(v.size()) i = 1; i != v.size(); ++i) {
+      os << " " << v[i];
+    }
+    os << '\n';
+  }  // end of UserDefinedPostProcessing_print
+
   UserDefinedPostProcessing::UserDefinedPostProcessing(
       const Behaviour& b,
       const EvolutionManager& e,
       const std::string& f,
       const std::vector<std::string>& ps)
-      : evm(e), out(f) {
-    if (!this->out) {
+      : evm(e), out(std::make_shared<std::ofstream>(f)) {
+    if (!(*(this->out))) {
       tfel::raise(
           "UserDefinedPostProcessing::UserDefinedPostProcessing: "
           "can't open file '" +
@@ -44,10 +59,10 @@ namespace mtest {
       }
       this->postprocessings.push_back(eval);
     }
-    this->out << "# first column : time\n";
+    *(this->out) << "# first column : time\n";
     auto cnbr = int{2};
     for (const auto& p : ps) {
-      this->out << "# " << cnbr << " column : " << p << '\n';
+      *(this->out) << "# " << cnbr << " column : " << p << '\n';
       ++cnbr;
     }
   }  // end of UserDefinedPostProcessing::UserDefinedPostProcessing
@@ -55,7 +70,8 @@ namespace mtest {
   void UserDefinedPostProcessing::exe(const CurrentState& s,
                                       const real t,
                                       const real dt) {
-    this->out << t + dt << " ";
+    this->values.clear();
+    this->values.push_back(t + dt);
     for (const auto& p : this->postprocessings) {
       const auto& vns = p->getVariablesNames();
       for (const auto& vn : vns) {
@@ -72,11 +88,32 @@ namespace mtest {
           p->setVariableValue(vn, ev(t + dt));
         }
       }
-      this->out << " " << p->getValue();
+      this->values.push_back(p->getValue());
+    }
+    if (this->writer != nullptr) {
+      this->writer->write(this->output_id, this->values);
+    } else {
+      UserDefinedPostProcessing_print(*(this->out), this->values);
+      this->out->flush();
     }
-    this->out << std::endl;
   }  // end of UserDefinedPostProcessing::exe
 
+  void UserDefinedPostProcessing::setAsynchronousOutputWriter(
+      const std::shared_ptr<AsynchronousOutputWriter>& w) {
+    if ((w == nullptr) || (this->writer == w)) {
+      return;
+    }
+    // the file is captured by the writer, so it outlives this object
+    // if records are still pending
+    auto f = this->out;
+    this->output_id = w->addOutput(
+        [f](const std::vector<real>& v) {
+          UserDefinedPostProcessing_print(*f, v);
+        },
+        [f] { f->flush(); });
+    this->writer = w;
+  }  // end of UserDefinedPostProcessing::setAsynchronousOutputWriter
+
   UserDefinedPostProcessing::~UserDefinedPostProcessing() = default;
 
 }  // end of namespace mtest
@@ -0,0 +1,130 @@
+/*!
+ * \file   mtest/tests/unit-tests/AsynchronousOutputWriterTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <vector>
+#include <cstdlib>
+#include <utility>
+#include <iostream>
+#include <stdexcept>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "MTest/AsynchronousOutputWriter.hxx"
+
+struct AsynchronousOutputWriterTest final : public tfel::tests::TestCase {
+  AsynchronousOutputWriterTest()
+      : tfel::tests::TestCase("MTest", "AsynchronousOutputWriterTest") {
+  }  // end of AsynchronousOutputWriterTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief records are written in order, whatever the output
+  void test1() {
+    using mtest::real;
+    using size_type = mtest::AsynchronousOutputWriter::size_type;
+    constexpr size_type n = 1000;
+    auto log = std::vector<std::pair<size_type, real>>{};
+    auto nflushes = size_type{};
+    {
+      // a small queue to test the case where the queue is full
+      auto w = mtest::AsynchronousOutputWriter(4);
+      const auto o1 = w.addOutput(
+          [&log](const std::vector<real>& v) { log.push_back({0, v[0]}); },
+          [&nflushes]() noexcept { ++nflushes; });
+      const auto o2 = w.addOutput(
+          [&log](const std::vector<real>& v) {
+            log.push_back({1, v[0] + v[1]});
+          },
+          nullptr);
+      for (size_type i = 0; i != n; ++i) {
+        if (i % 3 == 0) {
+          w.write(o2, {real(i), real(1)});
+        } else {
+          w.write(o1, {real(i)});
+        }
+        if (i == n / 2) {
+          w.flush();
+          TFEL_TESTS_ASSERT(log.size() == n / 2 + 1);
+          TFEL_TESTS_ASSERT(nflushes == 1);
+        }
+      }
+      TFEL_TESTS_CHECK_THROW(w.write(2, {real(0)}), std::runtime_error);
+    }
+    // pending records are written by the destructor
+    TFEL_TESTS_ASSERT(log.size() == n);
+    TFEL_TESTS_ASSERT(nflushes == 2);
+    auto ok = log.size() == n;
+    for (size_type i = 0; (ok) && (i != n); ++i) {
+      const auto expected =
+          (i % 3 == 0) ? std::pair<size_type, real>{1, real(i + 1)}
+                       : std::pair<size_type, real>{0, real(i)};
+      ok = log[i] == expected;
+    }
+    TFEL_TESTS_ASSERT(ok);
+  }  // end of test1
+  //! \brief periodic flushes
+  void test2() {
+    using mtest::real;
+    using size_type = mtest::AsynchronousOutputWriter::size_type;
+    auto nwritten = size_type{};
+    auto nflushes = size_type{};
+    auto w = mtest::AsynchronousOutputWriter(16, 10);
+    const auto o = w.addOutput(
+        [&nwritten](const std::vector<real>&) noexcept { ++nwritten; },
+        [&nflushes]() noexcept { ++nflushes; });
+    for (size_type i = 0; i != 105; ++i) {
+      w.write(o, {real(i)});
+    }
+    w.flush();
+    TFEL_TESTS_ASSERT(nwritten == 105);
+    TFEL_TESTS_ASSERT(nflushes == 11);
+  }  // end of test2
+  //! \brief errors are reported to the calling thread
+  void test3() {
+    using mtest::real;
+    using size_type = mtest::AsynchronousOutputWriter::size_type;
+    auto nwritten = size_type{};
+    auto w = mtest::AsynchronousOutputWriter(8);
+    const auto o = w.addOutput(
+        [&nwritten](const std::vector<real>& v) {
+          if (v[0] > 2) {
+            throw(std::runtime_error("invalid value"));
+          }
+          ++nwritten;
+        },
+        nullptr);
+    // the last record is invalid
+    for (size_type i = 0; i != 4; ++i) {
+      w.write(o, {real(i)});
+    }
+    TFEL_TESTS_CHECK_THROW(w.flush(), std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(w.write(o, {real(0)}), std::runtime_error);
+    TFEL_TESTS_ASSERT(nwritten == 3);
+  }  // end of test3
+};
+
+TFEL_TESTS_GENERATE_PROXY(AsynchronousOutputWriterTest,
+                          "AsynchronousOutputWriterTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("AsynchronousOutputWriterTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
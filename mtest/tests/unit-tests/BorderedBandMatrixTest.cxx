@@ -0,0 +1,115 @@
+/*!
+ * \file   mtest/tests/unit-tests/BorderedBandMatrixTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Math/matrix.hxx"
+#include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/LUSolve.hxx"
+#include "MTest/BorderedBandMatrix.hxx"
+
+struct BorderedBandMatrixTest final : public tfel::tests::TestCase {
+  BorderedBandMatrixTest()
+      : tfel::tests::TestCase("MTest", "BorderedBandMatrixTest") {
+  }  // end of BorderedBandMatrixTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief compare the solution with the one obtained by a dense solver
+  void check(const mtest::BorderedBandMatrix::size_type n,
+             const mtest::BorderedBandMatrix::size_type b,
+             const mtest::BorderedBandMatrix::size_type m) {
+    using size_type = mtest::BorderedBandMatrix::size_type;
+    constexpr auto eps = mtest::real(1e-12);
+    auto K = mtest::BorderedBandMatrix{};
+    auto Kd = tfel::math::matrix<mtest::real>(n, n, mtest::real(0));
+    auto x = tfel::math::vector<mtest::real>(n);
+    K.resize(n, b, m);
+    TFEL_TESTS_ASSERT(K.getNbRows() == n);
+    TFEL_TESTS_ASSERT(K.getNbCols() == n);
+    TFEL_TESTS_ASSERT(K.getHalfBandWidth() == b);
+    TFEL_TESTS_ASSERT(K.getBorderSize() == m);
+    const auto nb = n - m;
+    for (size_type i = 0; i != n; ++i) {
+      for (size_type j = 0; j != n; ++j) {
+        const auto in_band = (i < nb) && (j < nb);
+        if ((in_band) && (((i > j) ? i - j : j - i) > b)) {
+          continue;
+        }
+        // a non symmetric, diagonally dominant matrix
+        const auto v = (i == j) ? mtest::real(4 * (b + m + 1))
+                                : std::cos(mtest::real(3 * i + 7 * j));
+        K(i, j) = v;
+        Kd(i, j) = v;
+      }
+      x(i) = std::sin(mtest::real(i + 1));
+    }
+    const auto& cK = K;
+    for (size_type i = 0; i != n; ++i) {
+      for (size_type j = 0; j != n; ++j) {
+        TFEL_TESTS_ASSERT(std::abs(cK(i, j) - Kd(i, j)) < eps);
+      }
+    }
+    auto xd = x;
+    K.factorize();
+    K.solve(x);
+    tfel::math::LUSolve::exe(Kd, xd);
+    for (size_type i = 0; i != n; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(x(i) - xd(i)) < eps);
+    }
+  }  // end of check
+  void test1() {
+    // tridiagonal matrix
+    this->check(10, 1, 0);
+    this->check(10, 1, 1);
+  }  // end of test1
+  void test2() {
+    // matrices similar to the ones of quadratic and cubic pipe elements
+    this->check(21, 2, 1);
+    this->check(31, 3, 1);
+    this->check(25, 3, 2);
+  }  // end of test2
+  void test3() {
+    auto K = mtest::BorderedBandMatrix{};
+    K.resize(5, 1, 1);
+    auto throws = false;
+    try {
+      K(0, 3) = 1;
+    } catch (std::exception&) {
+      throws = true;
+    }
+    TFEL_TESTS_ASSERT(throws);
+    const auto& cK = K;
+    TFEL_TESTS_ASSERT(std::abs(cK(0, 3)) < 1e-14);
+    K(0, 4) = 1;
+    TFEL_TESTS_ASSERT(std::abs(cK(0, 4) - 1) < 1e-14);
+  }  // end of test3
+};
+
+TFEL_TESTS_GENERATE_PROXY(BorderedBandMatrixTest, "BorderedBandMatrixTest");
+
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("BorderedBandMatrix.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
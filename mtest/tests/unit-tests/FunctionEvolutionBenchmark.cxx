@@ -0,0 +1,75 @@
+/*!
+ * \file   mtest/tests/unit-tests/FunctionEvolutionBenchmark.cxx
+ * \brief  This file measures the cost of the evaluation of a graph of
+ * function evolutions and counts the memory allocations it requires.
+ *
+ * This program is not a test: it is only built on request
+ * (`make FunctionEvolutionBenchmark`). The number of evaluation times can
+ * be given as the first argument of the program. The program fails if an
+ * evaluation allocates memory.
+ *
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <new>
+#include <cmath>
+#include <chrono>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include "MTest/Evolution.hxx"
+#include "MTest/FunctionEvolution.hxx"
+
+//! \brief number of calls to the global `new` operator
+static std::size_t number_of_allocations = 0;
+
+void* operator new(std::size_t s) {
+  ++number_of_allocations;
+  if (auto* const p = std::malloc(s == 0 ? 1 : s)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}  // end of operator new
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main(const int argc, const char* const* const argv) {
+  if (argc > 2) {
+    std::cerr << "usage: " << argv[0] << " [number_of_times]\n";
+    return EXIT_FAILURE;
+  }
+  const auto n = (argc == 2) ? std::stoi(argv[1]) : 100000;
+  auto evm = mtest::EvolutionManager{};
+  evm.insert({"a", mtest::make_evolution({{0., 1.}, {1., 2.}})});
+  evm.insert({"b", std::make_shared<mtest::FunctionEvolution>(
+                       "a>1.5 ? 2*a+t : exp(-a)*t", evm)});
+  evm.insert({"c", std::make_shared<mtest::FunctionEvolution>(
+                       "b**2+cos(a)+b*t", evm)});
+  const auto& c = *(evm.at("c"));
+  // the first evaluation resolves the arguments
+  auto r = c(0.);
+  const auto n0 = number_of_allocations;
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i != n; ++i) {
+    // each time is evaluated twice, as done by mtest during the
+    // iterations of a time step
+    const auto t = static_cast<mtest::real>(i % 1000) / 1000;
+    r += c(t) + c(t);
+  }
+  const auto end = std::chrono::steady_clock::now();
+  const auto na = number_of_allocations - n0;
+  std::cout << "FunctionEvolutionBenchmark: " << 2 * n << " evaluations in "
+            << std::chrono::duration<double>(end - start).count() << "s ("
+            << na << " allocations, result: " << r << ")\n";
+  return ((na == 0) && (std::isfinite(r))) ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
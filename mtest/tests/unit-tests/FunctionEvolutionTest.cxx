@@ -0,0 +1,131 @@
+/*!
+ * \file   FunctionEvolutionTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "MTest/Evolution.hxx"
+#include "MTest/FunctionEvolution.hxx"
+
+struct FunctionEvolutionTest final : public tfel::tests::TestCase {
+  FunctionEvolutionTest()
+      : tfel::tests::TestCase("MTest", "FunctionEvolutionTest") {
+  }  // end of FunctionEvolutionTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute
+ private:
+  void test1() {
+    constexpr auto eps = mtest::real(1e-14);
+    auto evm = mtest::EvolutionManager{};
+    // b is defined before a
+    evm.insert({"c", std::make_shared<mtest::FunctionEvolution>("b*b+a", evm)});
+    evm.insert({"b", std::make_shared<mtest::FunctionEvolution>("2*a+t", evm)});
+    evm.insert({"a", mtest::make_evolution({{0., 1.}, {1., 2.}})});
+    const auto& c = *(evm.at("c"));
+    TFEL_TESTS_ASSERT(!c.isConstant());
+    for (const auto t : {0., 0.5, 0.5, 1., 0.25}) {
+      const auto a = 1 + t;
+      const auto b = 2 * a + t;
+      TFEL_TESTS_ASSERT(std::abs(c(t) - (b * b + a)) < eps);
+    }
+    TFEL_TESTS_CHECK_THROW(mtest::FunctionEvolution("2*d", evm)(0.),
+                           std::runtime_error);
+  }  // end of test1
+  void test2() {
+    // modification of an evolution at a given time
+    constexpr auto eps = mtest::real(1e-14);
+    auto evm = mtest::EvolutionManager{};
+    evm.insert({"a", mtest::make_evolution(2.)});
+    evm.insert({"b", std::make_shared<mtest::FunctionEvolution>("3*a", evm)});
+    auto& a = *(evm.at("a"));
+    const auto& b = *(evm.at("b"));
+    TFEL_TESTS_ASSERT(b.isConstant());
+    TFEL_TESTS_ASSERT(std::abs(b(0.) - 6) < eps);
+    a.setValue(4.);
+    TFEL_TESTS_ASSERT(std::abs(b(0.) - 12) < eps);
+    // replacement of an evolution
+    evm["a"] = mtest::make_evolution({{0., 1.}, {1., 2.}});
+    TFEL_TESTS_ASSERT(!b.isConstant());
+    TFEL_TESTS_ASSERT(std::abs(b(0.) - 3) < eps);
+  }  // end of test2
+  void test3() {
+    // repeated evaluations at the same time shall use the cached values
+    constexpr auto eps = mtest::real(1e-14);
+    auto evm = mtest::EvolutionManager{};
+    evm.insert({"a", mtest::make_evolution({{0., 1.}, {1., 2.}})});
+    evm.insert({"b", std::make_shared<mtest::FunctionEvolution>(
+                         "a>1.5 ? 2*a+t : exp(-a)*t", evm)});
+    evm.insert({"c", std::make_shared<mtest::FunctionEvolution>(
+                         "b**2+cos(a)+b*t", evm)});
+    const auto& c = *(evm.at("c"));
+    for (int i = 0; i != 100; ++i) {
+      const auto t = static_cast<mtest::real>(i % 10) / 10;
+      const auto a = 1 + t;
+      const auto b = a > 1.5 ? 2 * a + t : std::exp(-a) * t;
+      const auto v = b * b + std::cos(a) + b * t;
+      TFEL_TESTS_ASSERT(std::abs(c(t) - v) < eps);
+      TFEL_TESTS_ASSERT(std::abs(c(t) - v) < eps);
+    }
+  }  // end of test3
+  void test4() {
+    // invalidation of the cached values
+    constexpr auto eps = mtest::real(1e-14);
+    auto evm = mtest::EvolutionManager{};
+    evm.insert({"a", mtest::make_evolution(2.)});
+    evm.insert({"b", std::make_shared<mtest::FunctionEvolution>("a+t", evm)});
+    evm.insert({"c", std::make_shared<mtest::FunctionEvolution>("2*b", evm)});
+    auto& a = *(evm.at("a"));
+    const auto& c = *(evm.at("c"));
+    TFEL_TESTS_ASSERT(std::abs(c(1.) - 6) < eps);
+    // modification of an evolution on which the evolution depends
+    // indirectly
+    a.setValue(3.);
+    TFEL_TESTS_ASSERT(std::abs(c(1.) - 8) < eps);
+    // replacement of an evolution on which the evolution depends
+    // indirectly
+    evm["a"] = mtest::make_evolution(5.);
+    TFEL_TESTS_ASSERT(std::abs(c(1.) - 12) < eps);
+    // removal of an evolution: the evolution can't be evaluated anymore
+    evm.erase("a");
+    TFEL_TESTS_CHECK_THROW(c(1.), std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(c.isConstant(), std::runtime_error);
+    evm.insert({"a", mtest::make_evolution(1.)});
+    TFEL_TESTS_ASSERT(std::abs(c(1.) - 4) < eps);
+  }  // end of test4
+};
+
+TFEL_TESTS_GENERATE_PROXY(FunctionEvolutionTest, "FunctionEvolutionTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("FunctionEvolutionTest.xml");
+  const auto r = m.execute();
+  return r.success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
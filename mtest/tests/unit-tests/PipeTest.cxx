@@ -50,6 +50,9 @@ struct PipeTestUnitTest final : public tfel::tests::TestCase {
     TFEL_TESTS_CHECK_THROW(t.setNumberOfElements(0), std::runtime_error);
     t.setNumberOfElements(10);
     TFEL_TESTS_CHECK_THROW(t.setNumberOfElements(10), std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(t.setNumberOfThreads(-1), std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(t.setNumberOfThreads(0), std::runtime_error);
+    t.setNumberOfThreads(2);
   }
   void test2() {
     mtest::PipeTest t;
@@ -0,0 +1,664 @@
+/*!
+ * \file   src/Math/ByteCode.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <cerrno>
+#include <limits>
+#include <array>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Math/General/IEEE754.hxx"
+#include "TFEL/Math/Parser/Expr.hxx"
+#include "TFEL/Math/Parser/LogicalExpr.hxx"
+#include "TFEL/Math/Parser/BinaryOperator.hxx"
+#include "TFEL/Math/Parser/Function.hxx"
+#include "TFEL/Math/Parser/BinaryFunction.hxx"
+#include "TFEL/Math/Parser/ByteCode.hxx"
+
+namespace tfel::math::parser {
+
+  /*!
+   * \return if the given value, resulting from the evaluation of a logical
+   * expression, is true
+   * \param[in] v: value
+   */
+  static bool isTrue(const double v) {
+    return tfel::math::ieee754::fpclassify(v) != FP_ZERO;
+  }  // end of isTrue
+
+  /*!
+   * \brief storages of the registers used by the `getValue` method for
+   * large byte codes, one per level of nested evaluations.
+   *
+   * Those storages are kept from one evaluation to the other, so that an
+   * evaluation only allocates memory if a storage must grow. Each thread
+   * has its own storages, so that the same byte code can be evaluated
+   * concurrently, and each level of nested evaluations has its own
+   * storage, so that a byte code can be evaluated recursively through an
+   * `EXPRESSION` instruction.
+   */
+  static thread_local std::vector<std::vector<double>> registers_storages;
+  //! \brief current level of nested evaluations using `registers_storages`
+  static thread_local std::size_t evaluation_depth = 0;
+
+  ByteCode::ByteCode() = default;
+  ByteCode::ByteCode(ByteCode&&) = default;
+  ByteCode::ByteCode(const ByteCode&) = default;
+  ByteCode& ByteCode::operator=(ByteCode&&) = default;
+  ByteCode& ByteCode::operator=(const ByteCode&) = default;
+
+  void ByteCode::compile(const Expr& e) {
+    this->clear();
+    this->result = e.compile(*this);
+    // the common subexpressions are only required during the compilation
+    this->cse.clear();
+  }  // end of compile
+
+  void ByteCode::clear() {
+    this->instructions.clear();
+    this->registers.clear();
+    this->constants.clear();
+    this->constants_registers.clear();
+    this->cse.clear();
+    this->result = 0;
+  }  // end of clear
+
+  bool ByteCode::empty() const {
+    return this->registers.empty();
+  }  // end of empty
+
+  ByteCode::size_type ByteCode::getNumberOfInstructions() const {
+    return this->instructions.size();
+  }  // end of getNumberOfInstructions
+
+  ByteCode::size_type ByteCode::getNumberOfRegisters() const {
+    return this->registers.size();
+  }  // end of getNumberOfRegisters
+
+  ByteCode::size_type ByteCode::addRegister() {
+    this->registers.push_back(0);
+    this->constants.push_back(false);
+    return this->registers.size() - 1;
+  }  // end of addRegister
+
+  ByteCode::size_type ByteCode::addConstant(const double v) {
+    auto k = std::uint64_t{};
+    static_assert(sizeof(k) == sizeof(v));
+    std::memcpy(&k, &v, sizeof(v));
+    const auto p = this->constants_registers.find(k);
+    if (p != this->constants_registers.end()) {
+      return p->second;
+    }
+    const auto r = this->addRegister();
+    this->registers[r] = v;
+    this->constants[r] = true;
+    this->constants_registers.insert({k, r});
+    return r;
+  }  // end of addConstant
+
+  ByteCode::size_type ByteCode::addVariable(const std::vector<double>& v,
+                                            const size_type p) {
+    auto i = Instruction{};
+    i.op = VARIABLE;
+    i.a = p;
+    i.v = &v;
+    const auto k = InstructionKey{VARIABLE, p, 0,
+                                  reinterpret_cast<std::uintptr_t>(&v), 0};
+    return this->addInstruction(i, k, false, false);
+  }  // end of addVariable
+
+  ByteCode::size_type ByteCode::addUnaryOperation(const OpCode op,
+                                                  const size_type a) {
+    tfel::raise_if((op != NEGATION) && (op != NOT),
+                   "ByteCode::addUnaryOperation: invalid operation");
+    auto i = Instruction{};
+    i.op = op;
+    i.a = a;
+    return this->addInstruction(i, {op, a, 0, 0, 0}, true, false);
+  }  // end of addUnaryOperation
+
+  ByteCode::size_type ByteCode::addBinaryOperation(const OpCode op,
+                                                   const size_type a,
+                                                   const size_type b) {
+    tfel::raise_if((op != ADDITION) && (op != SUBSTRACTION) &&
+                       (op != MULTIPLICATION) && (op != DIVISION) &&
+                       (op != POWER) && (op != EQUAL) && (op != GREATER) &&
+                       (op != GREATER_OR_EQUAL) && (op != LESSER) &&
+                       (op != LESSER_OR_EQUAL) && (op != AND) && (op != OR),
+                   "ByteCode::addBinaryOperation: invalid operation");
+    auto i = Instruction{};
+    i.op = op;
+    i.a = a;
+    i.b = b;
+    return this->addInstruction(i, {op, a, b, 0, 0}, true, true);
+  }  // end of addBinaryOperation
+
+  ByteCode::size_type ByteCode::addFunction(const FunctionPtr f,
+                                            const size_type a) {
+    auto i = Instruction{};
+    i.op = FUNCTION;
+    i.a = a;
+    i.f = f;
+    const auto k = InstructionKey{FUNCTION, a, 0,
+                                  reinterpret_cast<std::uintptr_t>(f), 0};
+    return this->addInstruction(i, k, true, false);
+  }  // end of addFunction
+
+  ByteCode::size_type ByteCode::addUncheckedFunction(const FunctionPtr f,
+                                                     const size_type a) {
+    auto i = Instruction{};
+    i.op = UNCHECKED_FUNCTION;
+    i.a = a;
+    i.f = f;
+    const auto k = InstructionKey{UNCHECKED_FUNCTION, a, 0,
+                                  reinterpret_cast<std::uintptr_t>(f), 0};
+    return this->addInstruction(i, k, true, false);
+  }  // end of addUncheckedFunction
+
+  ByteCode::size_type ByteCode::addBinaryFunction(const BinaryFunctionPtr f,
+                                                  const size_type a,
+                                                  const size_type b) {
+    auto i = Instruction{};
+    i.op = BINARY_FUNCTION;
+    i.a = a;
+    i.b = b;
+    i.f2 = f;
+    const auto k = InstructionKey{BINARY_FUNCTION, a, b,
+                                  reinterpret_cast<std::uintptr_t>(f), 0};
+    return this->addInstruction(i, k, true, true);
+  }  // end of addBinaryFunction
+
+  ByteCode::size_type ByteCode::addIntegerPower(const size_type a,
+                                                const int n) {
+    auto i = Instruction{};
+    i.op = INTEGER_POWER;
+    i.a = a;
+    i.n = n;
+    return this->addInstruction(i, {INTEGER_POWER, a, 0, 0, n}, true, false);
+  }  // end of addIntegerPower
+
+  ByteCode::size_type ByteCode::addConditionalExpression(const LogicalExpr& c,
+                                                         const Expr& a,
+                                                         const Expr& b) {
+    const auto rc = c.compile(*this);
+    if (this->constants[rc]) {
+      return isTrue(this->registers[rc]) ? a.compile(*this) : b.compile(*this);
+    }
+    const auto r = this->addRegister();
+    // the subexpressions computed in one branch can't be used outside
+    // this branch
+    const auto cse_bck = this->cse;
+    auto jump_if_false = Instruction{};
+    jump_if_false.op = JUMP_IF_FALSE;
+    jump_if_false.a = rc;
+    const auto pjf = this->instructions.size();
+    this->instructions.push_back(jump_if_false);
+    auto move = Instruction{};
+    move.op = MOVE;
+    move.r = r;
+    move.a = a.compile(*this);
+    this->instructions.push_back(move);
+    this->cse = cse_bck;
+    auto jump = Instruction{};
+    jump.op = JUMP;
+    const auto pj = this->instructions.size();
+    this->instructions.push_back(jump);
+    this->instructions[pjf].b = this->instructions.size();
+    move.a = b.compile(*this);
+    this->instructions.push_back(move);
+    this->cse = cse_bck;
+    this->instructions[pj].b = this->instructions.size();
+    return r;
+  }  // end of addConditionalExpression
+
+  ByteCode::size_type ByteCode::addExpression(const Expr& e) {
+    auto i = Instruction{};
+    i.op = EXPRESSION;
+    i.r = this->addRegister();
+    i.e = &e;
+    this->instructions.push_back(i);
+    return i.r;
+  }  // end of addExpression
+
+  ByteCode::size_type ByteCode::addLogicalExpression(const LogicalExpr& e) {
+    auto i = Instruction{};
+    i.op = LOGICAL_EXPRESSION;
+    i.r = this->addRegister();
+    i.l = &e;
+    this->instructions.push_back(i);
+    return i.r;
+  }  // end of addLogicalExpression
+
+  ByteCode::size_type ByteCode::addInstruction(Instruction i,
+                                               const InstructionKey& k,
+                                               const bool ba,
+                                               const bool bb) {
+    // constant folding
+    if ((ba || bb) && ((!ba) || (this->constants[i.a])) &&
+        ((!bb) || (this->constants[i.b]))) {
+      i.r = this->registers.size();
+      this->registers.push_back(0);
+      try {
+        evaluate(i, this->registers.data());
+        const auto v = this->registers.back();
+        this->registers.pop_back();
+        return this->addConstant(v);
+      } catch (...) {
+        // the exception will be thrown at runtime
+        this->registers.pop_back();
+      }
+    }
+    // common subexpression elimination
+    const auto p = this->cse.find(k);
+    if (p != this->cse.end()) {
+      return p->second;
+    }
+    i.r = this->addRegister();
+    this->instructions.push_back(i);
+    this->cse.insert({k, i.r});
+    return i.r;
+  }  // end of addInstruction
+
+  void ByteCode::evaluate(const Instruction& i, double* const r) {
+    switch (i.op) {
+      case VARIABLE:
+        r[i.r] = (*(i.v))[i.a];
+        break;
+      case NEGATION:
+        r[i.r] = -r[i.a];
+        break;
+      case ADDITION:
+        r[i.r] = r[i.a] + r[i.b];
+        break;
+      case SUBSTRACTION:
+        r[i.r] = r[i.a] - r[i.b];
+        break;
+      case MULTIPLICATION:
+        r[i.r] = r[i.a] * r[i.b];
+        break;
+      case DIVISION:
+        if (std::abs(r[i.b]) < std::numeric_limits<double>::min()) {
+          // throws the same exception than the `BinaryOperation` class
+          r[i.r] = OpDiv::apply(r[i.a], r[i.b]);
+        } else {
+          r[i.r] = r[i.a] / r[i.b];
+        }
+        break;
+      case POWER:
+        r[i.r] = std::pow(r[i.a], r[i.b]);
+        break;
+      case INTEGER_POWER: {
+        const auto old = errno;
+        errno = 0;
+        r[i.r] = std::pow(r[i.a], i.n);
+        if (errno != 0) {
+          const auto e = errno;
+          errno = old;
+          FunctionBase::throwInvalidCallException(r[i.a], e);
+        }
+        errno = old;
+      } break;
+      case FUNCTION: {
+        const auto old = errno;
+        errno = 0;
+        r[i.r] = i.f(r[i.a]);
+        if (errno != 0) {
+          const auto e = errno;
+          errno = old;
+          FunctionBase::throwInvalidCallException(r[i.a], e);
+        }
+        errno = old;
+      } break;
+      case UNCHECKED_FUNCTION:
+        r[i.r] = i.f(r[i.a]);
+        break;
+      case BINARY_FUNCTION: {
+        const auto old = errno;
+        errno = 0;
+        r[i.r] = i.f2(r[i.a], r[i.b]);
+        if (errno != 0) {
+          const auto e = errno;
+          errno = old;
+          StandardBinaryFunctionBase::throwInvalidCallException(e);
+        }
+        errno = old;
+      } break;
+      case EQUAL:
+        r[i.r] = (tfel::math::ieee754::fpclassify(std::abs(r[i.a] - r[i.b])) ==
+                  FP_ZERO)
+                     ? 1
+                     : 0;
+        break;
+      case GREATER:
+        r[i.r] = (r[i.a] > r[i.b]) ? 1 : 0;
+        break;
+      case GREATER_OR_EQUAL:
+        r[i.r] = (r[i.a] >= r[i.b]) ? 1 : 0;
+        break;
+      case LESSER:
+        r[i.r] = (r[i.a] < r[i.b]) ? 1 : 0;
+        break;
+      case LESSER_OR_EQUAL:
+        r[i.r] = (r[i.a] <= r[i.b]) ? 1 : 0;
+        break;
+      case AND:
+        r[i.r] = (isTrue(r[i.a]) && isTrue(r[i.b])) ? 1 : 0;
+        break;
+      case OR:
+        r[i.r] = (isTrue(r[i.a]) || isTrue(r[i.b])) ? 1 : 0;
+        break;
+      case NOT:
+        r[i.r] = isTrue(r[i.a]) ? 0 : 1;
+        break;
+      case MOVE:
+        r[i.r] = r[i.a];
+        break;
+      case EXPRESSION:
+        r[i.r] = i.e->getValue();
+        break;
+      case LOGICAL_EXPRESSION:
+        r[i.r] = i.l->getValue() ? 1 : 0;
+        break;
+      case JUMP:
+      case JUMP_IF_FALSE:
+        tfel::raise("ByteCode::evaluate: unexpected jump instruction");
+    }
+  }  // end of evaluate
+
+  double ByteCode::getValue() const {
+    tfel::raise_if(this->registers.empty(),
+                   "ByteCode::getValue: no expression");
+    // the registers are copied in a storage local to this call, or to the
+    // current thread and level of nested evaluations, so that the same byte
+    // code can be evaluated concurrently, or recursively through an
+    // `EXPRESSION` instruction. Only the registers of the byte code are
+    // initialized.
+    const auto nr = this->registers.size();
+    if (nr <= small_size) {
+      std::array<double, small_size> r;
+      std::copy(this->registers.begin(), this->registers.end(), r.begin());
+      return this->execute(r.data());
+    }
+    struct DepthGuard {
+      DepthGuard() { ++evaluation_depth; }
+      ~DepthGuard() { --evaluation_depth; }
+    } guard;
+    if (registers_storages.size() < evaluation_depth) {
+      registers_storages.resize(evaluation_depth);
+    }
+    // moving the storages of the enclosing evaluations, if any, when
+    // resizing `registers_storages` does not change their addresses
+    auto& r = registers_storages[evaluation_depth - 1];
+    if (r.size() < nr) {
+      r.resize(nr);
+    }
+    std::copy(this->registers.begin(), this->registers.end(), r.begin());
+    return this->execute(r.data());
+  }  // end of getValue
+
+  double ByteCode::execute(double* const r) const {
+    const auto* const instructions_begin = this->instructions.data();
+    const auto n = this->instructions.size();
+    auto pc = size_type{};
+    while (pc != n) {
+      const auto& i = instructions_begin[pc];
+      if (i.op == JUMP) {
+        pc = i.b;
+      } else if (i.op == JUMP_IF_FALSE) {
+        pc = isTrue(r[i.a]) ? pc + 1 : i.b;
+      } else {
+        evaluate(i, r);
+        ++pc;
+      }
+    }
+    return r[this->result];
+  }  // end of getValue
+
+  bool ByteCode::isVectorizable() const {
+    // number of the conditional expressions being treated and, for each
+    // of them, a boolean stating if the false branch is treated
+    auto branches = std::vector<bool>{};
+    for (const auto& i : this->instructions) {
+      if ((i.op == EXPRESSION) || (i.op == LOGICAL_EXPRESSION)) {
+        return false;
+      }
+      if (i.op == JUMP_IF_FALSE) {
+        branches.push_back(false);
+      } else if (i.op == JUMP) {
+        branches.back() = true;
+      } else if (i.op == MOVE) {
+        if (branches.back()) {
+          branches.pop_back();
+        }
+      } else if (!branches.empty()) {
+        // both branches are evaluated, so operations which may fail
+        // are not allowed
+        if ((i.op == DIVISION) || (i.op == INTEGER_POWER) ||
+            (i.op == FUNCTION) || (i.op == UNCHECKED_FUNCTION) ||
+            (i.op == BINARY_FUNCTION)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }  // end of isVectorizable
+
+  void ByteCode::evaluateBlock(const Instruction& i,
+                               double* const r,
+                               const std::vector<const double*>& args,
+                               const size_type o,
+                               const size_type n) {
+    auto* const pr = r + i.r * block_size;
+    if (i.op == VARIABLE) {
+      const auto* const pv = args[i.a];
+      if (pv == nullptr) {
+        std::fill(pr, pr + n, (*(i.v))[i.a]);
+      } else {
+        std::copy(pv + o, pv + o + n, pr);
+      }
+      return;
+    }
+    const auto* const pa = r + i.a * block_size;
+    const auto* const pb = r + i.b * block_size;
+    // call a function reporting errors through errno on each value. If an
+    // error occurs, the first invalid value is searched to report an
+    // error message consistent with the one of the `getValue` method
+    auto call = [pr, pa, pb, n](const auto& f, const auto& report) {
+      const auto old = errno;
+      errno = 0;
+      for (size_type k = 0; k != n; ++k) {
+        pr[k] = f(pa[k], pb[k]);
+      }
+      if (errno != 0) {
+        for (size_type k = 0; k != n; ++k) {
+          errno = 0;
+          f(pa[k], pb[k]);
+          if (errno != 0) {
+            const auto e = errno;
+            errno = old;
+            report(pa[k], e);
+          }
+        }
+      }
+      errno = old;
+    };
+    switch (i.op) {
+      case NEGATION:
+        for (size_type k = 0; k != n; ++k) {
+          pr[k] = -pa[k];
+        }
+        break;
+      case ADDITION:
+        for (size_type k = 0; k != n; ++k) {
+          pr[k] = pa[k] + pb[k];
+        }
+        break;
+      case SUBSTRACTION:
+        for (size_type k = 0; k != n; ++k) {
+          pr[k] = pa[k] - pb[k];
+        }
+        break;
+      case MULTIPLICATION:
+        for (size_type k = 0; k != n; ++k) {
+          pr[k] = pa[k] * pb[k];
+        }
+        break;
+      case DIVISION:
+        for (size_type k = 0; k != n; ++k) {
+          if (std::abs(pb[k]) < std::numeric_limits<double>::min()) {
+            // throws the same exception than the `BinaryOperation` class
+            OpDiv::apply(pa[k], pb[k]);
+          }
+        }
+        for (size_type k = 0; k != n; ++k) {
+          pr[k] = pa[k] / pb[k];
+        }
+        break;
+      case POWER:
+        for (size_type k = 0; k != n; ++k) {
+          pr[k] = std::pow(pa[k], pb[k]);
+        }
+        break;
+      case INTEGER_POWER:
+        call([&i](const double a, const double) { return std::pow(a, i.n); },
+             [](const double a, const int e) {
+               FunctionBase::throwInvalidCallException(a, e);
+             });
+        break;
+      case FUNCTION:
+        call([&i](const double a, const double) { return i.f(a); },
+             [](const double a, const int e) {
+               FunctionBase::throwInvalidCallException(a, e);
+             });
+        break;
+      case UNCHECKED_FUNCTION:
+        for (size_type k = 0; k != n; ++k) {
+          pr[k] = i.f(pa[k]);
+        }
+        break;
+      case BINARY_FUNCTION:
+        call([&i](const double a, const double b) { return i.f2(a, b); },
+             [](const double, const int e) {
+               StandardBinaryFunctionBase::throwInvalidCallException(e);
+             });
+        break;
+      case EQUAL:
+        for (size_type k = 0; k != n; ++k) {
+          pr[k] = (tfel::math::ieee754::fpclassify(std::abs(pa[k] - pb[k])) ==
+                   FP_ZERO)
+                      ? 1
+                      : 0;
+        }
+        break;
+      case GREATER:
+        for (size_type k = 0; k != n; ++k) {
+          pr[k] = (pa[k] > pb[k]) ? 1 : 0;
+        }
+        break;
+      case GREATER_OR_EQUAL:
+        for (size_type k = 0; k != n; ++k) {
+          pr[k] = (pa[k] >= pb[k]) ? 1 : 0;
+        }
+        break;
+      case LESSER:
+        for (size_type k = 0; k != n; ++k) {
+          pr[k] = (pa[k] < pb[k]) ? 1 : 0;
+        }
+        break;
+      case LESSER_OR_EQUAL:
+        for (size_type k = 0; k != n; ++k) {
+          pr[k] = (pa[k] <= pb[k]) ? 1 : 0;
+        }
+        break;
+      case AND:
+        for (size_type k = 0; k != n; ++k) {
+          pr[k] = (isTrue(pa[k]) && isTrue(pb[k])) ? 1 : 0;
+        }
+        break;
+      case OR:
+        for (size_type k = 0; k != n; ++k) {
+          pr[k] = (isTrue(pa[k]) || isTrue(pb[k])) ? 1 : 0;
+        }
+        break;
+      case NOT:
+        for (size_type k = 0; k != n; ++k) {
+          pr[k] = isTrue(pa[k]) ? 0 : 1;
+        }
+        break;
+      default:
+        tfel::raise("ByteCode::evaluateBlock: unsupported instruction");
+    }
+  }  // end of evaluateBlock
+
+  void ByteCode::getValues(double* const v,
+                           const std::vector<const double*>& args,
+                           const size_type n) const {
+    tfel::raise_if(this->registers.empty(),
+                   "ByteCode::getValues: no expression");
+    tfel::raise_if(!this->isVectorizable(),
+                   "ByteCode::getValues: "
+                   "the expression can't be evaluated by blocks");
+    for (const auto& i : this->instructions) {
+      tfel::raise_if((i.op == VARIABLE) && (i.a >= args.size()),
+                     "ByteCode::getValues: invalid number of arguments");
+    }
+    const auto nr = this->registers.size();
+    // registers local to this call, see `getValue`
+    auto registers_values = std::vector<double>(nr * block_size);
+    auto* const r = registers_values.data();
+    for (size_type i = 0; i != nr; ++i) {
+      if (this->constants[i]) {
+        std::fill(r + i * block_size, r + (i + 1) * block_size,
+                  this->registers[i]);
+      }
+    }
+    // registers holding the conditions of the conditional expressions
+    // being treated and, for each of them, a boolean stating if the false
+    // branch is treated
+    auto branches = std::vector<std::pair<size_type, bool>>{};
+    const auto* const pr = r + this->result * block_size;
+    for (size_type o = 0; o < n; o += block_size) {
+      const auto m = std::min(block_size, n - o);
+      for (const auto& i : this->instructions) {
+        if (i.op == JUMP_IF_FALSE) {
+          branches.push_back({i.a, false});
+        } else if (i.op == JUMP) {
+          branches.back().second = true;
+        } else if (i.op == MOVE) {
+          const auto [c, b] = branches.back();
+          const auto* const pc = r + c * block_size;
+          const auto* const pa = r + i.a * block_size;
+          auto* const pm = r + i.r * block_size;
+          if (b) {
+            for (size_type k = 0; k != m; ++k) {
+              pm[k] = isTrue(pc[k]) ? pm[k] : pa[k];
+            }
+            branches.pop_back();
+          } else {
+            for (size_type k = 0; k != m; ++k) {
+              pm[k] = isTrue(pc[k]) ? pa[k] : pm[k];
+            }
+          }
+        } else {
+          evaluateBlock(i, r, args, o, m);
+        }
+      }
+      std::copy(pr, pr + m, v + o);
+    }
+  }  // end of getValues
+
+  ByteCode::~ByteCode() = default;
+
+}  // end of namespace tfel::math::parser
@@ -1239,9 +1239,58 @@ namespace tfel::math {
     raise_if(this->expr == nullptr,
              "Evaluator::getValue: "
              "uninitialized expression.");
+    if ((this->use_bytecode) && (!this->bytecode.empty())) {
+      return this->bytecode.getValue();
+    }
     return this->expr->getValue();
   }  // end of getValue
 
+  void Evaluator::getValues(double* const r,
+                            const std::vector<const double*>& args,
+                            const std::vector<double>::size_type n) {
+    raise_if(this->expr == nullptr,
+             "Evaluator::getValues: "
+             "uninitialized expression.");
+    raise_if(args.size() != this->variables.size(),
+             "Evaluator::getValues: "
+             "invalid number of arguments");
+    if ((this->use_bytecode) && (!this->bytecode.empty()) &&
+        (this->bytecode.isVectorizable())) {
+      this->bytecode.getValues(r, args, n);
+      return;
+    }
+    for (std::vector<double>::size_type i = 0; i != n; ++i) {
+      for (std::vector<double>::size_type j = 0; j != args.size(); ++j) {
+        if (args[j] != nullptr) {
+          this->variables[j] = args[j][i];
+        }
+      }
+      r[i] = this->getValue();
+    }
+  }  // end of getValues
+
+  void Evaluator::getValues(double* const r,
+                            const std::map<std::string, const double*>& args,
+                            const std::vector<double>::size_type n) {
+    auto vargs = std::vector<const double*>(this->variables.size(), nullptr);
+    for (const auto& a : args) {
+      vargs[this->getVariablePosition(a.first)] = a.second;
+    }
+    this->getValues(r, vargs, n);
+  }  // end of getValues
+
+  void Evaluator::setByteCodeEvaluation(const bool b) {
+    this->use_bytecode = b;
+  }  // end of setByteCodeEvaluation
+
+  void Evaluator::compileByteCode() {
+    if (this->expr == nullptr) {
+      this->bytecode.clear();
+      return;
+    }
+    this->bytecode.compile(*(this->expr));
+  }  // end of compileByteCode
+
   double Evaluator::operator()() const {
     return this->getValue();
   }  // end of operator()
@@ -1269,6 +1318,7 @@ namespace tfel::math {
       auto g = this->treatGroup(p, pe, b, "");
       g->reduce();
       this->expr = g->analyse();
+      this->compileByteCode();
     } catch (std::exception& e) {
       tfel::raise(
           "Evaluator::analyse: "
@@ -1295,11 +1345,15 @@ namespace tfel::math {
   Evaluator::Evaluator() = default;
 
   Evaluator::Evaluator(const Evaluator& src)
-      : EvaluatorBase(src), variables(src.variables), positions(src.positions) {
+      : EvaluatorBase(src),
+        variables(src.variables),
+        positions(src.positions),
+        use_bytecode(src.use_bytecode) {
     this->manager = src.manager;
     if (src.expr != nullptr) {
       this->expr = src.expr->clone(this->variables);
     }
+    this->compileByteCode();
   }  // end of Evaluator
 
   Evaluator& Evaluator::operator=(const Evaluator& src) {
@@ -1312,6 +1366,8 @@ namespace tfel::math {
       } else {
         this->expr.reset();
       }
+      this->use_bytecode = src.use_bytecode;
+      this->compileByteCode();
     }
     return *this;
   }  // end of Evaluator
@@ -1343,12 +1399,14 @@ namespace tfel::math {
     str.precision(15);
     str << v;
     this->expr = std::make_shared<parser::Number>(str.str(), v);
+    this->compileByteCode();
   }  // end of Evaluator
 
   void Evaluator::clear() {
     this->variables.clear();
     this->positions.clear();
     this->expr.reset();
+    this->bytecode.clear();
     this->manager.reset();
   }
 
@@ -1435,6 +1493,8 @@ namespace tfel::math {
       }
       pev->expr = this->expr->differentiate(pos, pev->variables);
     }
+    pev->use_bytecode = this->use_bytecode;
+    pev->compileByteCode();
     return std::move(pev);
   }  // end of differentiate
 
@@ -1448,12 +1508,14 @@ namespace tfel::math {
     this->checkCyclicDependency();
     auto f = std::make_shared<Evaluator>(*this);
     f->expr = f->expr->resolveDependencies(f->variables);
+    f->compileByteCode();
     return std::move(f);
   }  // end of resolveDependencies() const
 
   void Evaluator::removeDependencies() {
     this->checkCyclicDependency();
     this->expr = this->expr->resolveDependencies(this->variables);
+    this->compileByteCode();
   }  // end of removeDependencies() const
 
   std::shared_ptr<tfel::math::parser::ExternalFunctionManager>
@@ -1523,6 +1585,8 @@ namespace tfel::math {
     pev->manager = this->manager;
     pev->expr = this->expr->createFunctionByChangingParametersIntoVariables(
         pev->variables, params, pev->positions);
+    pev->use_bytecode = this->use_bytecode;
+    pev->compileByteCode();
     return std::move(pev);
   }  // end of createFunctionByChangingParametersIntoVariables
 
@@ -37,4 +37,11 @@ namespace tfel::math {
   KrigingErrorInsufficientData::~KrigingErrorInsufficientData() noexcept =
       default;
 
+  KrigingErrorSingularSystem::KrigingErrorSingularSystem()
+      : std::runtime_error(std::string("singular system")) {
+  }  // end of KrigingErrorSingularSystem::KrigingErrorSingularSystem()
+
+  KrigingErrorSingularSystem::~KrigingErrorSingularSystem() noexcept =
+      default;
+
 }  // end of namespace tfel::math
@@ -42,6 +42,21 @@ namespace tfel::math::parser {
   }  // end of
      // LevenbergMarquardtEvaluatorWrapper::LevenbergMarquardtEvaluatorWrapper
 
+  LevenbergMarquardtEvaluatorWrapper::LevenbergMarquardtEvaluatorWrapper(
+      const LevenbergMarquardtEvaluatorWrapper& src)
+      : ev(std::make_shared<tfel::math::Evaluator>(*(src.ev))),
+        dev(src.np),
+        nv(src.nv),
+        np(src.np) {
+    // external functions referenced by the evaluator are shared with the
+    // source: they are replaced by their definitions
+    this->ev->removeDependencies();
+    for (size_type i = 0; i != this->getNumberOfParameters(); ++i) {
+      this->dev[i] = this->ev->differentiate(this->getNumberOfVariables() + i);
+    }
+  }  // end of
+     // LevenbergMarquardtEvaluatorWrapper::LevenbergMarquardtEvaluatorWrapper
+
   LevenbergMarquardtEvaluatorWrapper::size_type
   LevenbergMarquardtEvaluatorWrapper::getNumberOfVariables() const {
     return this->nv;
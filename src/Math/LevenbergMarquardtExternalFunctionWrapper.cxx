@@ -50,6 +50,19 @@ namespace tfel::math::parser {
   }  // end of
      // LevenbergMarquardtExternalFunctionWrapper::LevenbergMarquardtExternalFunctionWrapper
 
+  LevenbergMarquardtExternalFunctionWrapper::
+      LevenbergMarquardtExternalFunctionWrapper(
+          const LevenbergMarquardtExternalFunctionWrapper& src)
+      : ev(src.ev->resolveDependencies()),
+        dev(src.np),
+        nv(src.nv),
+        np(src.np) {
+    for (size_type i = 0; i != this->getNumberOfParameters(); ++i) {
+      this->dev[i] = this->ev->differentiate(this->getNumberOfVariables() + i);
+    }
+  }  // end of
+     // LevenbergMarquardtExternalFunctionWrapper::LevenbergMarquardtExternalFunctionWrapper
+
   LevenbergMarquardtExternalFunctionWrapper::size_type
   LevenbergMarquardtExternalFunctionWrapper::getNumberOfVariables() const {
     return this->nv;
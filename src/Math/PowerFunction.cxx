@@ -35,6 +35,11 @@ namespace tfel::math::parser {
     return res;
   }  // end of getValue
 
+  std::vector<double>::size_type GeneralPowerFunction::compile(
+      ByteCode& c) const {
+    return c.addIntegerPower(this->expr->compile(c), this->n);
+  }  // end of compile
+
   std::string GeneralPowerFunction::getCxxFormula(
       const std::vector<std::string>& m) const {
     const auto a = this->expr->getCxxFormula(m);
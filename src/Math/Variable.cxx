@@ -15,6 +15,7 @@
 #include <stdexcept>
 
 #include "TFEL/Raise.hxx"
+#include "TFEL/Math/Parser/ByteCode.hxx"
 #include "TFEL/Math/Parser/Number.hxx"
 #include "TFEL/Math/Parser/Variable.hxx"
 
@@ -35,6 +36,10 @@ namespace tfel::math::parser {
     return this->v[this->pos];
   }  // end of Variable::getValue
 
+  std::vector<double>::size_type Variable::compile(ByteCode& c) const {
+    return c.addVariable(this->v, this->pos);
+  }  // end of compile
+
   std::string Variable::getCxxFormula(const std::vector<std::string>& m) const {
     tfel::raise_if(this->pos >= m.size(),
                    "Variable::getCxxFormula: "
@@ -0,0 +1,141 @@
+/*!
+ * \file   src/System/ColumnarBinaryWriter.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cerrno>
+#include <cstdint>
+#include <climits>
+#include <algorithm>
+#include <unistd.h>
+#include <sys/uio.h>
+#include "TFEL/Raise.hxx"
+#include "TFEL/System/System.hxx"
+#include "TFEL/System/BinaryWrite.hxx"
+#include "TFEL/System/ColumnarBinaryWriter.hxx"
+#include "TFEL/Utilities/ColumnarBinaryFormat.hxx"
+
+namespace tfel::system {
+
+  ColumnarBinaryWriter::ColumnarBinaryWriter(const std::string& f,
+                                             const std::vector<std::string>& c,
+                                             const std::size_t n)
+      : file(f), ncolumns(c.size()), block_size(n) {
+    namespace format = tfel::utilities::columnar_binary_format;
+    raise_if(this->ncolumns == 0,
+             "ColumnarBinaryWriter::ColumnarBinaryWriter: "
+             "no column defined");
+    raise_if(this->block_size == 0,
+             "ColumnarBinaryWriter::ColumnarBinaryWriter: "
+             "invalid block size");
+    const auto fd = this->file.getFileDescriptor();
+    systemCall::write(fd, format::magic, format::magic_size);
+    binary_write(fd, format::version);
+    binary_write(fd, format::byte_order_mark);
+    binary_write(fd, static_cast<std::uint64_t>(this->ncolumns));
+    auto hsize = format::magic_size + 2 * sizeof(std::uint32_t) +
+                 sizeof(std::uint64_t);
+    for (const auto& name : c) {
+      binary_write(fd, static_cast<std::uint64_t>(name.size()));
+      systemCall::write(fd, name.data(), name.size());
+      hsize += sizeof(std::uint64_t) + name.size();
+    }
+    // padding, so that the values of the blocks are aligned
+    const char padding[format::alignment] = {};
+    if (hsize % format::alignment != 0) {
+      systemCall::write(fd, padding,
+                        format::alignment - hsize % format::alignment);
+    }
+    this->buffer.resize(this->ncolumns * this->block_size);
+  }  // end of ColumnarBinaryWriter
+
+  std::size_t ColumnarBinaryWriter::getNumberOfColumns() const {
+    return this->ncolumns;
+  }  // end of getNumberOfColumns
+
+  void ColumnarBinaryWriter::write(const double* const v) {
+    for (std::size_t c = 0; c != this->ncolumns; ++c) {
+      this->buffer[c * this->block_size + this->nrows] = v[c];
+    }
+    if (++(this->nrows) == this->block_size) {
+      this->flush();
+    }
+  }  // end of write
+
+  void ColumnarBinaryWriter::write(const std::vector<double>& v) {
+    raise_if(v.size() != this->ncolumns,
+             "ColumnarBinaryWriter::write: "
+             "the number of values (" +
+                 std::to_string(v.size()) +
+                 ") does not match the number of columns (" +
+                 std::to_string(this->ncolumns) + ")");
+    this->write(v.data());
+  }  // end of write
+
+  void ColumnarBinaryWriter::flush() {
+    if (this->nrows == 0) {
+      return;
+    }
+    // the columns of an incomplete block are made contiguous
+    if (this->nrows != this->block_size) {
+      for (std::size_t c = 1; c != this->ncolumns; ++c) {
+        const auto b = this->buffer.begin() + c * this->block_size;
+        std::copy(b, b + this->nrows, this->buffer.begin() + c * this->nrows);
+      }
+    }
+    // the number of rows and the values are written by a single call to
+    // writev, unless the system performs a partial write
+    auto n = static_cast<std::uint64_t>(this->nrows);
+    iovec iov[2];
+    iov[0].iov_base = &n;
+    iov[0].iov_len = sizeof(n);
+    iov[1].iov_base = this->buffer.data();
+    iov[1].iov_len = this->ncolumns * this->nrows * sizeof(double);
+    raise_if<SystemError>(iov[0].iov_len + iov[1].iov_len >= SSIZE_MAX,
+                          "ColumnarBinaryWriter::flush: invalid size");
+    const auto fd = this->file.getFileDescriptor();
+    auto* v = iov;
+    auto c = 2;
+    while (c != 0) {
+      const auto w = ::writev(fd, v, c);
+      if (w == -1) {
+        if (errno == EINTR) {
+          continue;
+        }
+        if (errno != EAGAIN) {
+          systemCall::throwSystemError("ColumnarBinaryWriter::flush", errno);
+        }
+        ::sleep(1);
+        continue;
+      }
+      // skip the data already written
+      auto r = static_cast<std::size_t>(w);
+      while ((c != 0) && (r >= v->iov_len)) {
+        r -= v->iov_len;
+        ++v;
+        --c;
+      }
+      if (c != 0) {
+        v->iov_base = static_cast<char*>(v->iov_base) + r;
+        v->iov_len -= r;
+      }
+    }
+    this->nrows = 0;
+  }  // end of flush
+
+  ColumnarBinaryWriter::~ColumnarBinaryWriter() {
+    try {
+      this->flush();
+    } catch (...) {
+    }
+  }  // end of ~ColumnarBinaryWriter
+
+}  // end of namespace tfel::system
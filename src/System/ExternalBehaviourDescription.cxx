@@ -232,7 +232,9 @@ char* getExternalBehaviourData(tfel::system::ExternalBehaviourData* const d,
     return msg;
   };
   try {
-    *d = tfel::system::ExternalBehaviourDescription(l, f, h);
+    auto& elm =
+        tfel::system::ExternalLibraryManager::getExternalLibraryManager();
+    *d = *(elm.getExternalBehaviourDescription(l, f, h));
   } catch (std::exception& e) {
     return report(e.what());
   } catch (...) {
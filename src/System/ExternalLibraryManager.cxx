@@ -13,6 +13,9 @@
 
 #include <cctype>
 #include <cstring>
+#include <tuple>
+#include <memory>
+#include <algorithm>
 #include <fstream>
 #include <stdexcept>
 #if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
@@ -30,6 +33,7 @@
 #include "TFEL/System/getFunction.h"
 #include "TFEL/System/LibraryInformation.hxx"
 #include "TFEL/System/ExternalLibraryManager.hxx"
+#include "TFEL/System/ExternalBehaviourDescription.hxx"
 
 namespace tfel::system {
 
@@ -56,15 +60,28 @@ namespace tfel::system {
   }
 #endif /*  (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
 
+#if !((defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__))
+  /*!
+   * \brief error message associated with the last undefined symbol
+   * returned by the `getSymbolAddress` method. Reading the error message
+   * reported by `dlerror` resets it, so this message is used when the
+   * undefined symbol is retrieved from the cache of resolved symbols.
+   */
+  static thread_local std::string undefined_symbol_error;
+#endif /* !((defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)) */
+
   static std::string getErrorMessage() {
 #if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
     return getLastWin32Error();
 #else
     const auto e = ::dlerror();
     if (e != nullptr) {
+      undefined_symbol_error.clear();
       return std::string(e);
     }
-    return "";
+    auto r = std::string{};
+    std::swap(r, undefined_symbol_error);
+    return r;
 #endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
   }    // end of  getErrorMessage
 
@@ -257,6 +274,8 @@ namespace tfel::system {
   void*
 #endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
   ExternalLibraryManager::loadLibrary(const std::string& name, const bool b) {
+    // libraries may be loaded by tests executed concurrently
+    std::lock_guard<std::mutex> lock(this->librairies_mutex);
     auto p = this->librairies.find(name);
     if (p == librairies.end()) {
       // this library has not been
@@ -278,6 +297,107 @@ namespace tfel::system {
     return p->second;
   }  // end of loadLibrary
 
+  void ExternalLibraryManager::reloadLibrary(const std::string& name) {
+    auto names = std::vector<std::string>{};
+    {
+      std::lock_guard<std::mutex> lock(this->librairies_mutex);
+      const auto p = this->librairies.find(name);
+      if (p != this->librairies.end()) {
+        // the same library may have been loaded using different names.
+        // Each call to `loadLibrary` has increased the reference counter
+        // of the library, so the library must be closed as many times.
+        const auto lib = p->second;
+        for (auto pl = this->librairies.begin();
+             pl != this->librairies.end();) {
+          if (pl->second != lib) {
+            ++pl;
+            continue;
+          }
+          names.push_back(pl->first);
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+          ::FreeLibrary(lib);
+#else
+          ::dlclose(lib);
+#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+          pl = this->librairies.erase(pl);
+        }
+        this->symbols.erase(lib);
+      } else {
+        names.push_back(name);
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lock(this->descriptions_mutex);
+      for (auto pd = this->descriptions.begin();
+           pd != this->descriptions.end();) {
+        if (std::find(names.begin(), names.end(), std::get<0>(pd->first)) !=
+            names.end()) {
+          pd = this->descriptions.erase(pd);
+        } else {
+          ++pd;
+        }
+      }
+    }
+    this->loadLibrary(name);
+  }  // end of reloadLibrary
+
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+  void* ExternalLibraryManager::getSymbolAddress(HINSTANCE__* const lib,
+                                                 const char* const s)
+#else
+  void* ExternalLibraryManager::getSymbolAddress(void* const lib,
+                                                 const char* const s)
+#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+  {
+    std::lock_guard<std::mutex> lock(this->librairies_mutex);
+    auto& lsymbols = this->symbols[lib];
+    auto p = lsymbols.find(s);
+    if (p == lsymbols.end()) {
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+      const auto ptr = reinterpret_cast<void*>(::GetProcAddress(lib, s));
+      const auto e = (ptr == nullptr) ? ::GetLastError() : 0;
+      p = lsymbols.insert({s, ResolvedSymbol{ptr, e}}).first;
+#else
+      // clear any previous error, so that the message read after
+      // `dlsym` is the one associated with this symbol
+      ::dlerror();
+      const auto ptr = ::dlsym(lib, s);
+      const auto e = (ptr == nullptr) ? ::dlerror() : nullptr;
+      p = lsymbols
+              .insert({s, ResolvedSymbol{ptr, e != nullptr ? e : ""}})
+              .first;
+#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+    }
+    if (p->second.address == nullptr) {
+      // the error reported by the system is restored for the caller
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+      ::SetLastError(p->second.error);
+#else
+      undefined_symbol_error = p->second.error;
+#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+    }
+    return p->second.address;
+  }  // end of getSymbolAddress
+
+  std::shared_ptr<const ExternalBehaviourDescription>
+  ExternalLibraryManager::getExternalBehaviourDescription(
+      const std::string& l, const std::string& f, const std::string& h) {
+    const auto k = std::make_tuple(l, f, h);
+    {
+      std::lock_guard<std::mutex> lock(this->descriptions_mutex);
+      const auto p = this->descriptions.find(k);
+      if (p != this->descriptions.end()) {
+        return p->second;
+      }
+    }
+    // the description is built outside the lock as it requires calls
+    // to other methods of this class. If two threads build the same
+    // description, the first one inserted is kept.
+    auto d = std::make_shared<const ExternalBehaviourDescription>(l, f, h);
+    std::lock_guard<std::mutex> lock(this->descriptions_mutex);
+    return this->descriptions.insert({k, std::move(d)}).first->second;
+  }  // end of getExternalBehaviourDescription
+
   std::vector<std::string> ExternalLibraryManager::getEntryPoints(
       const std::string& l) {
     auto ends_with = [](const std::string& s1, const std::string& s2) {
@@ -325,14 +445,8 @@ namespace tfel::system {
   bool ExternalLibraryManager::contains(const std::string& l,
                                         const std::string& s) {
     const auto lib = this->loadLibrary(l);
-#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
-    int (*p)() = (int (*)())::GetProcAddress(lib, s.c_str());
-    return p != static_cast<int (*)()>(nullptr);
-#else
-    void* p = ::dlsym(lib, s.c_str());
-    return p != nullptr;
-#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
-  }    // end of contains
+    return this->getSymbolAddress(lib, s.c_str()) != nullptr;
+  }  // end of contains
 
   std::string ExternalLibraryManager::getString(const std::string& l,
                                                 const std::string& s) {
@@ -348,20 +462,12 @@ namespace tfel::system {
   std::string ExternalLibraryManager::getStringIfDefined(const std::string& l,
                                                          const std::string& s) {
     const auto lib = this->loadLibrary(l);
-#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
-    const auto p = (const char* const*)::GetProcAddress(lib, s.c_str());
-#else
-    const auto p = ::dlsym(lib, s.c_str());
-#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+    const auto p = this->getSymbolAddress(lib, s.c_str());
     if (p == nullptr) {
       return "";
     }
-#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
-    return *p;
-#else
     return *(static_cast<const char* const*>(p));
-#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
-  }    // end of ExternalLibraryManager::getStringIfDefined
+  }  // end of ExternalLibraryManager::getStringIfDefined
 
   std::string ExternalLibraryManager::getAuthor(const std::string& l,
                                                 const std::string& s) {
@@ -391,25 +497,17 @@ namespace tfel::system {
   std::string ExternalLibraryManager::getInterface(const std::string& l,
                                                    const std::string& f) {
     const auto lib = this->loadLibrary(l);
-#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
-    const auto p = (const char* const*)::GetProcAddress(
-        lib, (f + "_mfront_interface").c_str());
-#else
-    const auto p = ::dlsym(lib, (f + "_mfront_interface").c_str());
-#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+    const auto p =
+        this->getSymbolAddress(lib, (f + "_mfront_interface").c_str());
     raise_if(p == nullptr,
              "ExternalLibraryManager::getInterface: "
              "no interface found for entry point '" +
                  f +
                  "' "
                  "in library '" +
-                 l + "'");
-#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
-    return *p;
-#else
+                 l + "' (" + getErrorMessage() + ")");
     return *(static_cast<const char* const*>(p));
-#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
-  }    // end of getInterface
+  }  // end of getInterface
 
   std::string ExternalLibraryManager::getLaw(const std::string& l,
                                              const std::string& f) {
@@ -1066,6 +1164,25 @@ namespace tfel::system {
     return fct;
   }
 
+  bool ExternalLibraryManager::hasGenericBehaviourBatchFunction(
+      const std::string& l, const std::string& f) {
+    return this->contains(l, f + "_integrateBatch");
+  }  // end of hasGenericBehaviourBatchFunction
+
+  GenericBehaviourBatchFctPtr
+  ExternalLibraryManager::getGenericBehaviourBatchFunction(
+      const std::string& l, const std::string& f) {
+    const auto lib = this->loadLibrary(l);
+    const auto fct = ::tfel_getGenericBehaviourBatchFunction(
+        lib, (f + "_integrateBatch").c_str());
+    raise_if(fct == nullptr,
+             "ExternalLibraryManager::getGenericBehaviourBatchFunction: "
+             "could not load the batch integration function associated with "
+             "the generic behaviour function '" +
+                 f + "' (" + getErrorMessage() + ")");
+    return fct;
+  }  // end of getGenericBehaviourBatchFunction
+
   std::vector<std::string>
   ExternalLibraryManager::getGenericBehaviourInitializeFunctions(
       const std::string& l, const std::string& f, const std::string& h) {
@@ -2290,3 +2407,16 @@ namespace tfel::system {
   ExternalLibraryManager::~ExternalLibraryManager() = default;
 
 }  // end of namespace tfel::system
+
+extern "C" {
+
+void* tfel_getSymbolAddress(LibraryHandlerPtr lib, const char* const s) {
+  try {
+    auto& elm = tfel::system::ExternalLibraryManager::getExternalLibraryManager();
+    return elm.getSymbolAddress(lib, s);
+  } catch (...) {
+  }
+  return nullptr;
+}  // end of tfel_getSymbolAddress
+
+}  // end of extern "C"
@@ -12,42 +12,256 @@
  */
 
 #include <memory>
+#include <string>
+#include <algorithm>
 #include <stdexcept>
+#ifdef __linux__
+#include <sched.h>
+#include <pthread.h>
+#endif /* __linux__ */
+#include "TFEL/Raise.hxx"
 #include "TFEL/System/ThreadPool.hxx"
 
 namespace tfel::system {
 
-  ThreadPool::ThreadPool(const size_t n) {
-    this->statuses.resize(n, ThreadPool::Status::IDLE);
-    for (size_t i = 0; i < n; ++i) {
-      auto f = [this, i] {
+  struct ThreadPool::WorkQueue {
+    //! \brief mutex protecting the tasks
+    std::mutex m;
+    //! \brief tasks
+    std::deque<std::function<void()>> tasks;
+  };  // end of struct ThreadPool::WorkQueue
+
+  //! \brief pool owning the current thread, if any
+  static thread_local const ThreadPool* current_pool = nullptr;
+  //! \brief index of the current thread in the pool owning it
+  static thread_local ThreadPool::size_type current_worker = 0;
+
+  //! \return the processors on which the current process may run
+  static std::vector<int> getAvailableProcessors() {
+    auto processors = std::vector<int>{};
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (::sched_getaffinity(0, sizeof(cpu_set_t), &set) == 0) {
+      for (int i = 0; i != CPU_SETSIZE; ++i) {
+        if (CPU_ISSET(i, &set)) {
+          processors.push_back(i);
+        }
+      }
+    }
+#endif /* __linux__ */
+    return processors;
+  }  // end of getAvailableProcessors
+
+  /*!
+   * \brief bind the current thread to the given processor
+   * \param[in] p: processor
+   */
+  static void bindCurrentThread(const int p) {
+#ifdef __linux__
+    if (p < 0) {
+      return;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(p, &set);
+    ::pthread_setaffinity_np(::pthread_self(), sizeof(cpu_set_t), &set);
+#else  /* __linux__ */
+    static_cast<void>(p);
+#endif /* __linux__ */
+  }  // end of bindCurrentThread
+
+  ThreadPool::ThreadPool(const size_type n, const PinningPolicy p) {
+    auto processors = std::vector<int>(n, -1);
+    if (p == PIN_TO_PROCESSORS) {
+      const auto available = getAvailableProcessors();
+      if (!available.empty()) {
+        for (size_type i = 0; i != n; ++i) {
+          processors[i] = available[i % available.size()];
+        }
+      }
+    }
+    this->createWorkers(processors);
+  }  // end of ThreadPool::ThreadPool
+
+  ThreadPool::ThreadPool(const std::vector<size_type>& processors) {
+    auto ids = std::vector<int>{};
+    for (const auto p : processors) {
+#ifdef __linux__
+      raise_if(p >= CPU_SETSIZE,
+               "ThreadPool::ThreadPool: invalid processor '" +
+                   std::to_string(p) + "'");
+#endif /* __linux__ */
+      ids.push_back(static_cast<int>(p));
+    }
+    this->createWorkers(ids);
+  }  // end of ThreadPool::ThreadPool
+
+  void ThreadPool::createWorkers(const std::vector<int>& processors) {
+    const auto n = processors.size();
+    for (size_type i = 0; i != n; ++i) {
+      this->queues.push_back(std::make_unique<WorkQueue>());
+    }
+    for (size_type i = 0; i != n; ++i) {
+      const auto p = processors[i];
+      auto f = [this, i, p] {
+        bindCurrentThread(p);
+        current_pool = this;
+        current_worker = i;
         for (;;) {
-          std::function<void()> task;
-          {
-            std::unique_lock<std::mutex> lock(this->m);
-            while (!(this->stop || !this->tasks.empty())) {
-              this->c.wait(
-                  lock, [this] { return this->stop || !this->tasks.empty(); });
-            }
-            if (this->stop && this->tasks.empty()) {
-              return;
-            }
-            task = std::move(this->tasks.front());
-            this->tasks.pop();
-            this->statuses[i] = ThreadPool::Status::WORKING;
-            this->c.notify_all();
+          if (this->runPendingTask(i)) {
+            continue;
           }
-          task();
-          {
-            std::unique_lock<std::mutex> lock(this->m);
-            this->statuses[i] = ThreadPool::Status::IDLE;
-            this->c.notify_all();
+          std::unique_lock<std::mutex> lock(this->m);
+          ++(this->sleeping_workers);
+          this->c.wait(lock, [this] {
+            return this->stop || this->queued_tasks != 0;
+          });
+          --(this->sleeping_workers);
+          if (this->stop && this->queued_tasks == 0) {
+            return;
           }
         }
       };
       this->workers.emplace_back(f);
     }
-  }  // end of ThreadPool::ThreadPool
+  }  // end of ThreadPool::createWorkers
+
+  void ThreadPool::push(std::function<void()> t) {
+    // don't allow enqueueing after stopping the pool
+    if (this->stop) {
+      throw std::runtime_error(
+          "ThreadPool::addTask: "
+          "enqueue on stopped ThreadPool");
+    }
+    if (this->queues.empty()) {
+      // no worker, the task is executed by the calling thread
+      t();
+      return;
+    }
+    // a worker adds new tasks in its own queue
+    const auto i = (current_pool == this)
+                       ? current_worker
+                       : (this->next_queue++) % this->queues.size();
+    // the counters are incremented before the task is published, so that a
+    // worker popping it right away never sees them going below zero
+    ++(this->unfinished_tasks);
+    ++(this->queued_tasks);
+    try {
+      auto& q = *(this->queues[i]);
+      std::lock_guard<std::mutex> lock(q.m);
+      q.tasks.push_back(std::move(t));
+    } catch (...) {
+      --(this->queued_tasks);
+      --(this->unfinished_tasks);
+      throw;
+    }
+    if (this->sleeping_workers != 0) {
+      {
+        std::lock_guard<std::mutex> lock(this->m);
+      }
+      this->c.notify_one();
+    }
+  }  // end of ThreadPool::push
+
+  bool ThreadPool::pop(std::function<void()>& t, const size_type i) {
+    const auto n = this->queues.size();
+    const auto own = (current_pool == this) && (current_worker == i);
+    for (size_type k = 0; k != n; ++k) {
+      auto& q = *(this->queues[(i + k) % n]);
+      std::lock_guard<std::mutex> lock(q.m);
+      if (q.tasks.empty()) {
+        continue;
+      }
+      if ((k == 0) && (own)) {
+        // most recent task of the worker's own queue
+        t = std::move(q.tasks.back());
+        q.tasks.pop_back();
+      } else {
+        // steal the oldest task of another queue
+        t = std::move(q.tasks.front());
+        q.tasks.pop_front();
+      }
+      --(this->queued_tasks);
+      return true;
+    }
+    return false;
+  }  // end of ThreadPool::pop
+
+  bool ThreadPool::runPendingTask(const size_type i) {
+    auto t = std::function<void()>{};
+    if (!this->pop(t, i)) {
+      return false;
+    }
+    t();
+    this->finishTask();
+    return true;
+  }  // end of ThreadPool::runPendingTask
+
+  void ThreadPool::finishTask() {
+    if (--(this->unfinished_tasks) == 0) {
+      {
+        std::lock_guard<std::mutex> lock(this->m);
+      }
+      this->finished.notify_all();
+    }
+  }  // end of ThreadPool::finishTask
+
+  void ThreadPool::executeBlocks(const size_type n,
+                                 void (*f)(const void*, const size_type),
+                                 const void* const ctx) {
+    if (n == 0) {
+      return;
+    }
+    struct State {
+      //! \brief index of the next block
+      std::atomic<size_type> next{0};
+      //! \brief number of helper tasks not finished
+      std::atomic<size_type> active{0};
+      //! \brief boolean stating that an exception was thrown
+      std::atomic<bool> failed{false};
+      //! \brief first exception thrown
+      std::exception_ptr exception;
+      //! \brief mutex protecting the exception
+      std::mutex m;
+    } s;
+    auto work = [&s, f, ctx, n] {
+      while (!s.failed) {
+        const auto i = s.next++;
+        if (i >= n) {
+          return;
+        }
+        try {
+          f(ctx, i);
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(s.m);
+          if (!s.exception) {
+            s.exception = std::current_exception();
+          }
+          s.failed = true;
+        }
+      }
+    };
+    const auto nhelpers = std::min(this->workers.size(), n - 1);
+    s.active = nhelpers;
+    for (size_type i = 0; i != nhelpers; ++i) {
+      this->push([&s, &work] {
+        work();
+        --(s.active);
+      });
+    }
+    work();
+    // wait for the helpers, treating pending tasks meanwhile
+    const auto i0 = (current_pool == this) ? current_worker : 0;
+    while (s.active != 0) {
+      if ((this->queues.empty()) || (!this->runPendingTask(i0))) {
+        std::this_thread::yield();
+      }
+    }
+    if (s.exception) {
+      std::rethrow_exception(s.exception);
+    }
+  }  // end of ThreadPool::executeBlocks
 
   ThreadPool::size_type ThreadPool::getNumberOfThreads() const {
     return this->workers.size();
@@ -55,15 +269,7 @@ namespace tfel::system {
 
   void ThreadPool::wait() {
     std::unique_lock<std::mutex> lock(this->m);
-    while (!this->tasks.empty()) {
-      this->c.wait(lock, [this] { return this->tasks.empty(); });
-    }
-    for (size_t i = 0; i != this->statuses.size(); ++i) {
-      while (this->statuses[i] != Status::IDLE) {
-        this->c.wait(lock,
-                     [this, i] { return this->statuses[i] == Status::IDLE; });
-      }
-    }
+    this->finished.wait(lock, [this] { return this->unfinished_tasks == 0; });
   }  // end of ThreadPool::wait()
 
   ThreadPool::~ThreadPool() {
@@ -0,0 +1,306 @@
+/*!
+ * \file   src/Utilities/ColumnarBinaryData.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+#include <string_view>
+#if !(defined _WIN32 || defined _WIN64)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif /* !(defined _WIN32 || defined _WIN64) */
+#include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/ColumnarBinaryFormat.hxx"
+#include "TFEL/Utilities/ColumnarBinaryData.hxx"
+
+namespace tfel::utilities {
+
+  /*!
+   * \brief a class giving a read-only access to the content of a file.
+   *
+   * The file is memory-mapped on POSIX systems. Otherwise, it is read in
+   * a buffer of doubles, so that its content is suitably aligned.
+   */
+  struct ColumnarBinaryData::File {
+    /*!
+     * \brief constructor
+     * \param[in] f: file name
+     */
+    explicit File(const std::string& f) {
+#if !(defined _WIN32 || defined _WIN64)
+      const auto fd = ::open(f.c_str(), O_RDONLY);
+      raise_if(fd == -1,
+               "ColumnarBinaryData::ColumnarBinaryData: "
+               "can't open '" +
+                   f + '\'');
+      struct stat s;
+      if (::fstat(fd, &s) == -1) {
+        ::close(fd);
+        raise(
+            "ColumnarBinaryData::ColumnarBinaryData: "
+            "can't open '" +
+            f + '\'');
+      }
+      this->size = static_cast<std::size_t>(s.st_size);
+      if (this->size != 0) {
+        this->address =
+            ::mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, fd, 0);
+      }
+      ::close(fd);
+      if (this->address == MAP_FAILED) {
+        this->address = nullptr;
+        raise(
+            "ColumnarBinaryData::ColumnarBinaryData: "
+            "can't map '" +
+            f + "' in memory");
+      }
+      if (this->address != nullptr) {
+        this->content = std::string_view(
+            static_cast<const char*>(this->address), this->size);
+      }
+#else  /* !(defined _WIN32 || defined _WIN64) */
+      std::ifstream in(f, std::ios::binary);
+      raise_if(!in,
+               "ColumnarBinaryData::ColumnarBinaryData: "
+               "can't open '" +
+                   f + '\'');
+      in.seekg(0, std::ios::end);
+      const auto size = static_cast<std::size_t>(in.tellg());
+      in.seekg(0, std::ios::beg);
+      this->buffer.resize((size + sizeof(double) - 1) / sizeof(double));
+      in.read(reinterpret_cast<char*>(this->buffer.data()),
+              static_cast<std::streamsize>(size));
+      raise_if(!in,
+               "ColumnarBinaryData::ColumnarBinaryData: "
+               "can't read '" +
+                   f + '\'');
+      this->content = std::string_view(
+          reinterpret_cast<const char*>(this->buffer.data()), size);
+#endif /* !(defined _WIN32 || defined _WIN64) */
+    }  // end of File
+    File(File&&) = delete;
+    File(const File&) = delete;
+    File& operator=(File&&) = delete;
+    File& operator=(const File&) = delete;
+    //! \brief destructor
+    ~File() {
+#if !(defined _WIN32 || defined _WIN64)
+      if (this->address != nullptr) {
+        ::munmap(this->address, this->size);
+      }
+#endif /* !(defined _WIN32 || defined _WIN64) */
+    }  // end of ~File
+    //! \brief content of the file
+    std::string_view content;
+
+   private:
+#if !(defined _WIN32 || defined _WIN64)
+    //! \brief address of the mapped file
+    void* address = nullptr;
+    //! \brief size of the file
+    std::size_t size = 0;
+#else  /* !(defined _WIN32 || defined _WIN64) */
+    //! \brief content of the file
+    std::vector<double> buffer;
+#endif /* !(defined _WIN32 || defined _WIN64) */
+  };   // end of struct ColumnarBinaryData::File
+
+  ColumnarBinaryData::size_type ColumnarBinaryData::ColumnView::size() const {
+    if (this->segments.empty()) {
+      return 0;
+    }
+    const auto& s = this->segments.back();
+    return s.first + s.size;
+  }  // end of size
+
+  double ColumnarBinaryData::ColumnView::operator[](const size_type i) const {
+    // first segment starting after the given row
+    const auto p = std::upper_bound(
+        this->segments.begin(), this->segments.end(), i,
+        [](const size_type r, const Segment& s) { return r < s.first; });
+    const auto& s = *(p - 1);
+    return s.values[i - s.first];
+  }  // end of operator[]
+
+  void ColumnarBinaryData::ColumnView::copy(double* const out) const {
+    for (const auto& s : this->segments) {
+      std::copy(s.values, s.values + s.size, out + s.first);
+    }
+  }  // end of copy
+
+  bool ColumnarBinaryData::isColumnarBinaryFile(const std::string& f) {
+    namespace format = columnar_binary_format;
+    std::ifstream in(f, std::ios::binary);
+    if (!in) {
+      return false;
+    }
+    char m[format::magic_size];
+    in.read(m, format::magic_size);
+    if (static_cast<std::size_t>(in.gcount()) != format::magic_size) {
+      return false;
+    }
+    return std::memcmp(m, format::magic, format::magic_size) == 0;
+  }  // end of isColumnarBinaryFile
+
+  ColumnarBinaryData::ColumnarBinaryData(const std::string& f)
+      : file(std::make_unique<File>(f)) {
+    namespace format = columnar_binary_format;
+    auto throw_if = [&f](const bool b, const std::string& msg) {
+      raise_if(b, "ColumnarBinaryData::ColumnarBinaryData: " + msg +
+                      " (file '" + f + "')");
+    };
+    const auto content = this->file->content;
+    auto pos = std::size_t{};
+    // number of bytes remaining in the file
+    auto remaining = [&content, &pos] { return content.size() - pos; };
+    auto read = [&content, &pos, &remaining, &throw_if](void* const v,
+                                                        const std::size_t n) {
+      throw_if(n > remaining(), "unexpected end of file");
+      std::memcpy(v, content.data() + pos, n);
+      pos += n;
+    };
+    // header
+    char m[format::magic_size];
+    read(m, format::magic_size);
+    throw_if(std::memcmp(m, format::magic, format::magic_size) != 0,
+             "invalid file format");
+    auto version = std::uint32_t{};
+    auto byte_order_mark = std::uint32_t{};
+    read(&version, sizeof(version));
+    read(&byte_order_mark, sizeof(byte_order_mark));
+    throw_if(byte_order_mark != format::byte_order_mark,
+             "unsupported byte order");
+    throw_if((version == 0) || (version > format::version),
+             "unsupported version (" + std::to_string(version) + ")");
+    auto nc = std::uint64_t{};
+    read(&nc, sizeof(nc));
+    throw_if(nc == 0, "no column defined");
+    for (std::uint64_t i = 0; i != nc; ++i) {
+      auto s = std::uint64_t{};
+      read(&s, sizeof(s));
+      throw_if(s > remaining(), "invalid size of a column name");
+      auto& l = this->legends.emplace_back(static_cast<std::size_t>(s), '\0');
+      read(l.data(), l.size());
+    }
+    if ((version > 1) && (pos % format::alignment != 0)) {
+      const auto padding = format::alignment - pos % format::alignment;
+      throw_if(padding > remaining(), "unexpected end of file");
+      pos += padding;
+    }
+    const auto ncolumns = this->legends.size();
+    // blocks, whose values are used in place if suitably aligned
+    auto unaligned = std::vector<std::pair<std::size_t, std::size_t>>{};
+    auto ncopies = size_type{};
+    while (remaining() != 0) {
+      auto n = std::uint64_t{};
+      read(&n, sizeof(n));
+      throw_if(n > remaining() / (ncolumns * sizeof(double)),
+               "truncated block");
+      const auto* const p = content.data() + pos;
+      const auto nvalues = static_cast<size_type>(n) * ncolumns;
+      if (reinterpret_cast<std::uintptr_t>(p) % alignof(double) == 0) {
+        this->blocks.push_back({this->nrows, static_cast<size_type>(n),
+                                reinterpret_cast<const double*>(p)});
+      } else {
+        unaligned.push_back({this->blocks.size(), pos});
+        this->blocks.push_back(
+            {this->nrows, static_cast<size_type>(n), nullptr});
+        ncopies += nvalues;
+      }
+      this->nrows += static_cast<size_type>(n);
+      pos += nvalues * sizeof(double);
+    }
+    // copies of the unaligned blocks
+    this->copies.resize(ncopies);
+    auto* v = this->copies.data();
+    for (const auto& [i, bpos] : unaligned) {
+      auto& b = this->blocks[i];
+      const auto nvalues = b.nrows * ncolumns;
+      std::memcpy(v, content.data() + bpos, nvalues * sizeof(double));
+      b.values = v;
+      v += nvalues;
+    }
+  }  // end of ColumnarBinaryData
+
+  ColumnarBinaryData::ColumnarBinaryData(ColumnarBinaryData&&) = default;
+  ColumnarBinaryData& ColumnarBinaryData::operator=(ColumnarBinaryData&&) =
+      default;
+
+  ColumnarBinaryData::size_type ColumnarBinaryData::getNumberOfColumns()
+      const {
+    return this->legends.size();
+  }  // end of getNumberOfColumns
+
+  ColumnarBinaryData::size_type ColumnarBinaryData::getNumberOfRows() const {
+    return this->nrows;
+  }  // end of getNumberOfRows
+
+  void ColumnarBinaryData::checkColumnNumber(const char* const m,
+                                             const size_type i) const {
+    raise_if((i == 0) || (i > this->legends.size()),
+             "ColumnarBinaryData::" + std::string(m) +
+                 ": invalid column number '" + std::to_string(i) +
+                 "' (column numbers begins at '1' and the number of "
+                 "columns is '" +
+                 std::to_string(this->legends.size()) + "')");
+  }  // end of checkColumnNumber
+
+  ColumnarBinaryData::ColumnView ColumnarBinaryData::getColumnView(
+      const size_type i) const {
+    this->checkColumnNumber("getColumnView", i);
+    auto v = ColumnView{};
+    v.segments.reserve(this->blocks.size());
+    for (const auto& b : this->blocks) {
+      v.segments.push_back({b.first, b.nrows, b.values + (i - 1) * b.nrows});
+    }
+    return v;
+  }  // end of getColumnView
+
+  std::vector<double> ColumnarBinaryData::getColumn(const size_type i) const {
+    auto tab = std::vector<double>{};
+    this->getColumn(tab, i);
+    return tab;
+  }  // end of getColumn
+
+  void ColumnarBinaryData::getColumn(std::vector<double>& tab,
+                                     const size_type i) const {
+    const auto v = this->getColumnView(i);
+    tab.resize(this->nrows);
+    v.copy(tab.data());
+  }  // end of getColumn
+
+  ColumnarBinaryData::size_type ColumnarBinaryData::findColumn(
+      const std::string& n) const {
+    const auto p = std::find(this->legends.begin(), this->legends.end(), n);
+    raise_if(p == this->legends.end(),
+             "ColumnarBinaryData::findColumn: "
+             "no column named '" +
+                 n + "' found");
+    return static_cast<size_type>(p - this->legends.begin() + 1);
+  }  // end of findColumn
+
+  const std::vector<std::string>& ColumnarBinaryData::getLegends() const {
+    return this->legends;
+  }  // end of getLegends
+
+  std::string ColumnarBinaryData::getLegend(const size_type i) const {
+    this->checkColumnNumber("getLegend", i);
+    return this->legends[i - 1];
+  }  // end of getLegend
+
+  ColumnarBinaryData::~ColumnarBinaryData() = default;
+
+}  // end of namespace tfel::utilities
@@ -11,76 +11,322 @@
  * project under specific licensing conditions.
  */
 
+#include <cerrno>
 #include <cassert>
+#include <cstdlib>
 #include <stdexcept>
 #include <sstream>
 #include <fstream>
 #include <algorithm>
 #include <iterator>
+#include <charconv>
+#include <functional>
+#include <string_view>
+#include <thread>
+#if !(defined _WIN32 || defined _WIN64)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif /* !(defined _WIN32 || defined _WIN64) */
 #include "TFEL/Raise.hxx"
 #include "TFEL/Utilities/CxxTokenizer.hxx"
+#include "TFEL/Utilities/ColumnarBinaryData.hxx"
 #include "TFEL/Utilities/TextData.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 
 namespace tfel::utilities {
 
-  TextData::TextData(const std::string& file, const std::string& format) {
-    auto get_legends = [](const std::string& l) {
-      std::vector<std::string> r;
-      CxxTokenizer t;
-      t.treatCharAsString(true);
-      t.parseString(l);
-      t.stripComments();
-      std::for_each(t.begin(), t.end(), [&r](const Token& w) {
-        if (w.flag == Token::String) {
-          r.push_back(w.value.substr(1, w.value.size() - 2));
-        } else {
-          r.push_back(w.value);
-        }
-      });
-      return r;
-    };
-    auto add_line = [this](const std::string& l, const Token::size_type n) {
-      Line nl;
-      CxxTokenizer t;
-      t.treatCharAsString(true);
-      t.parseString(l);
-      t.stripComments();
-      std::for_each(t.begin(), t.end(), [&nl, &n](const Token& w) {
-        nl.tokens.push_back(w);
-        nl.tokens.back().line = n;
-      });
-      this->lines.push_back(std::move(nl));
+  /*!
+   * \brief a class giving a read-only access to the content of a file.
+   *
+   * The file is memory-mapped on POSIX systems.
+   */
+  struct TFEL_VISIBILITY_LOCAL TextDataFile {
+    /*!
+     * \brief constructor
+     * \param[in] f: file name
+     */
+    explicit TextDataFile(const std::string& f) {
+#if !(defined _WIN32 || defined _WIN64)
+      const auto fd = ::open(f.c_str(), O_RDONLY);
+      raise_if(fd == -1, "TextData::TextData: can't open '" + f + '\'');
+      struct stat s;
+      if (::fstat(fd, &s) == -1) {
+        ::close(fd);
+        raise("TextData::TextData: can't open '" + f + '\'');
+      }
+      this->size = static_cast<std::size_t>(s.st_size);
+      if (this->size != 0) {
+        this->address =
+            ::mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, fd, 0);
+      }
+      ::close(fd);
+      if (this->address == MAP_FAILED) {
+        this->address = nullptr;
+        raise("TextData::TextData: can't map '" + f + "' in memory");
+      }
+      if (this->address != nullptr) {
+        ::madvise(this->address, this->size, MADV_SEQUENTIAL);
+        this->content =
+            std::string_view(static_cast<const char*>(this->address),
+                             this->size);
+      }
+#else  /* !(defined _WIN32 || defined _WIN64) */
+      std::ifstream in(f, std::ios::binary);
+      raise_if(!in, "TextData::TextData: can't open '" + f + '\'');
+      auto os = std::ostringstream{};
+      os << in.rdbuf();
+      this->buffer = os.str();
+      this->content = this->buffer;
+#endif /* !(defined _WIN32 || defined _WIN64) */
+    }  // end of TextDataFile
+    TextDataFile(TextDataFile&&) = delete;
+    TextDataFile(const TextDataFile&) = delete;
+    TextDataFile& operator=(TextDataFile&&) = delete;
+    TextDataFile& operator=(const TextDataFile&) = delete;
+    //! \brief destructor
+    ~TextDataFile() {
+#if !(defined _WIN32 || defined _WIN64)
+      if (this->address != nullptr) {
+        ::munmap(this->address, this->size);
+      }
+#endif /* !(defined _WIN32 || defined _WIN64) */
+    }  // end of ~TextDataFile
+    //! \brief content of the file
+    std::string_view content;
+
+   private:
+#if !(defined _WIN32 || defined _WIN64)
+    //! \brief address of the mapped file
+    void* address = nullptr;
+    //! \brief size of the file
+    std::size_t size = 0;
+#else  /* !(defined _WIN32 || defined _WIN64) */
+    //! \brief content of the file
+    std::string buffer;
+#endif /* !(defined _WIN32 || defined _WIN64) */
+  };   // end of struct TextDataFile
+
+  /*!
+   * \brief description of a data line
+   */
+  struct TFEL_VISIBILITY_LOCAL TextDataLine {
+    //! \brief content of the line
+    std::string_view line;
+    //! \brief line number (empty lines are not counted)
+    TextData::size_type number;
+  };
+
+  /*!
+   * \brief the part of a text file containing the data
+   */
+  struct TFEL_VISIBILITY_LOCAL TextDataSection {
+    /*!
+     * \brief data lines found while reading the header, i.e. the first line
+     * of the file in the `gnuplot` format if it only contains numbers.
+     */
+    std::vector<TextDataLine> header_lines;
+    //! \brief data lines following the header
+    std::string_view data;
+    //! \brief number of the first data line following the header
+    TextData::size_type first_line_number = 1;
+  };
+
+  /*!
+   * \brief result of the parsing of a part of the data section by the fast
+   * numeric path
+   */
+  struct TFEL_VISIBILITY_LOCAL TextDataChunk {
+    //! \brief part of the data section
+    std::string_view data;
+    //! \brief values stored by lines
+    std::vector<double> values;
+    //! \brief number of data lines
+    TextData::size_type nlines = 0;
+    //! \brief number of values per line
+    TextData::size_type ncolumns = 0;
+    //! \brief boolean stating if all lines only contain numeric values
+    bool numeric = true;
+  };
+
+  /*!
+   * \brief call the given function on each line of a text
+   * \param[in] s: text
+   * \param[in] f: function
+   */
+  template <typename Function>
+  static void forEachLine(std::string_view s, const Function& f) {
+    auto pos = std::string_view::size_type{};
+    while (pos < s.size()) {
+      const auto e = s.find('\n', pos);
+      if (e == std::string_view::npos) {
+        f(s.substr(pos));
+        return;
+      }
+      f(s.substr(pos, e - pos));
+      pos = e + 1;
+    }
+  }  // end of forEachLine
+
+  //! \return if the given character separates values
+  static bool isSeparator(const char c) {
+    return (c == ' ') || (c == '\t') || (c == '\r');
+  }  // end of isSeparator
+
+  /*!
+   * \brief parse a line containing only numeric values.
+   * \return the number of values read or -1 if the line contains a
+   * non-numeric value
+   * \param[out] values: values read
+   * \param[in] l: line
+   *
+   * Only values starting with a digit, a point or a minus sign followed by
+   * a digit or a point are accepted, so that special values (`inf`, `nan`)
+   * or values that would not be read as a single token by the
+   * `CxxTokenizer` class are treated by the tokenizer.
+   */
+  static int parseNumericLine(std::vector<double>& values,
+                              std::string_view l) {
+    auto is_digit = [](const char c) {
+      return ((c >= '0') && (c <= '9')) || (c == '.');
     };
+    auto n = int{};
+    const auto* p = l.data();
+    const auto* const pe = l.data() + l.size();
+    while (true) {
+      while ((p != pe) && (isSeparator(*p))) {
+        ++p;
+      }
+      if (p == pe) {
+        return n;
+      }
+      const auto* const b = p;
+      while ((p != pe) && (!isSeparator(*p))) {
+        ++p;
+      }
+      const auto first = (*b == '-') ? b + 1 : b;
+      if ((first == p) || (!is_digit(*first))) {
+        return -1;
+      }
+      auto v = double{};
+#if defined(__cpp_lib_to_chars)
+      const auto r = std::from_chars(b, p, v);
+      if ((r.ec != std::errc()) || (r.ptr != p)) {
+        return -1;
+      }
+#else  /* defined(__cpp_lib_to_chars) */
+      const auto s = std::string(b, p);
+      char* e = nullptr;
+      errno = 0;
+      v = std::strtod(s.c_str(), &e);
+      if ((errno != 0) || (e != s.c_str() + s.size())) {
+        return -1;
+      }
+#endif /* defined(__cpp_lib_to_chars) */
+      values.push_back(v);
+      ++n;
+    }
+  }  // end of parseNumericLine
+
+  /*!
+   * \brief parse a part of the data section
+   * \param[in,out] c: chunk
+   */
+  static void parseChunk(TextDataChunk& c) {
+    forEachLine(c.data, [&c](std::string_view l) {
+      if ((!c.numeric) || (l.empty()) || (l[0] == '#')) {
+        return;
+      }
+      const auto n = parseNumericLine(c.values, l);
+      if ((n <= 0) || ((c.nlines != 0) &&
+                       (static_cast<TextData::size_type>(n) != c.ncolumns))) {
+        c.numeric = false;
+        return;
+      }
+      c.ncolumns = static_cast<TextData::size_type>(n);
+      ++(c.nlines);
+    });
+  }  // end of parseChunk
+
+  /*!
+   * \brief split the data section in chunks of lines
+   * \param[in] s: data section
+   * \param[in] n: number of chunks
+   */
+  static std::vector<TextDataChunk> splitDataSection(std::string_view s,
+                                                     const std::size_t n) {
+    auto chunks = std::vector<TextDataChunk>{};
+    auto pos = std::string_view::size_type{};
+    for (std::size_t i = 0; (i != n) && (pos < s.size()); ++i) {
+      auto e = (i + 1 == n) ? s.size() : pos + (s.size() - pos) / (n - i);
+      if (e < s.size()) {
+        e = s.find('\n', e);
+        e = (e == std::string_view::npos) ? s.size() : e + 1;
+      }
+      chunks.emplace_back();
+      chunks.back().data = s.substr(pos, e - pos);
+      pos = e;
+    }
+    return chunks;
+  }  // end of splitDataSection
+
+  //! \brief extract the column legends out of a line
+  static std::vector<std::string> getLegends(const std::string& l) {
+    std::vector<std::string> r;
+    CxxTokenizer t;
+    t.treatCharAsString(true);
+    t.parseString(l);
+    t.stripComments();
+    std::for_each(t.begin(), t.end(), [&r](const Token& w) {
+      if (w.flag == Token::String) {
+        r.push_back(w.value.substr(1, w.value.size() - 2));
+      } else {
+        r.push_back(w.value);
+      }
+    });
+    return r;
+  }  // end of getLegends
+
+  /*!
+   * \brief read the legends and the preamble of a file and return the data
+   * section.
+   *
+   * \param[out] legends: column legends
+   * \param[out] preamble: first commented lines
+   * \param[in] s: content of the file
+   * \param[in] format: file format
+   */
+  static TextDataSection readHeader(std::vector<std::string>& legends,
+                                    std::vector<std::string>& preamble,
+                                    std::string_view s,
+                                    const std::string& format) {
+    auto r = TextDataSection{};
     auto firstLine = true;
-    auto firstComments = true;
-    auto nbr = size_type{1};
-    std::ifstream f{file};
-    raise_if(!f, "TextData::TextData: can't open '" + file + '\'');
-    while (!f.eof()) {
-      auto line = std::string{};
-      getline(f, line);
-      if (line.empty()) {
+    auto nbr = TextData::size_type{1};
+    auto pos = std::string_view::size_type{};
+    while (pos < s.size()) {
+      const auto e = std::min(s.find('\n', pos), s.size());
+      const auto l = s.substr(pos, e - pos);
+      if (l.empty()) {
+        pos = e + 1;
         continue;
       }
-      if (line[0] == '#') {
-        if (!firstComments) {
-          continue;
-        }
+      if (l[0] == '#') {
         if (format.empty()) {
-          line.erase(line.begin());
+          auto line = std::string(l.substr(1));
           if (firstLine) {
-            this->legends = get_legends(line);
+            legends = getLegends(line);
           }
-          this->preamble.push_back(line);
+          preamble.push_back(std::move(line));
         }
       } else {
         if (((format == "gnuplot") || (format == "alcyone")) && (firstLine)) {
-          this->legends = get_legends(line);
+          legends = getLegends(std::string(l));
           bool all_numbers = true;
-          for (const auto& l : this->legends) {
+          for (const auto& legend : legends) {
             try {
-              convert<double>(l);
+              convert<double>(legend);
             } catch (std::exception&) {
               all_numbers = false;
             }
@@ -89,19 +335,205 @@ namespace tfel::utilities {
             }
           }
           if (all_numbers) {
-            this->legends.clear();
-            add_line(line, nbr);
+            legends.clear();
+            r.header_lines.push_back({l, nbr});
           }
         } else {
-          add_line(line, nbr);
-          firstComments = false;
+          // first data line, the following commented lines are ignored
+          break;
         }
       }
       firstLine = false;
       ++nbr;
+      pos = e + 1;
+    }
+    r.data = s.substr(std::min(pos, s.size()));
+    r.first_line_number = nbr;
+    return r;
+  }  // end of readHeader
+
+  /*!
+   * \brief call the given function on each data line
+   * \param[in] d: data section
+   * \param[in] f: function
+   */
+  template <typename Function>
+  static void forEachDataLine(const TextDataSection& d, const Function& f) {
+    for (const auto& l : d.header_lines) {
+      f(l.line, l.number);
+    }
+    auto nbr = d.first_line_number;
+    forEachLine(d.data, [&f, &nbr](std::string_view l) {
+      if ((l.empty()) || (l[0] == '#')) {
+        return;
+      }
+      f(l, nbr);
+      ++nbr;
+    });
+  }  // end of forEachDataLine
+
+  /*!
+   * \brief split a data line in tokens
+   * \param[in] l: line
+   * \param[in] n: line number
+   */
+  static TextData::Line tokenize(std::string_view l,
+                                 const TextData::size_type n) {
+    TextData::Line nl;
+    CxxTokenizer t;
+    t.treatCharAsString(true);
+    t.parseString(std::string(l));
+    t.stripComments();
+    std::for_each(t.begin(), t.end(), [&nl, &n](const Token& w) {
+      nl.tokens.push_back(w);
+      nl.tokens.back().line = n;
+    });
+    return nl;
+  }  // end of tokenize
+
+  /*!
+   * \brief convert a value to a string which can be read back exactly
+   * \param[in] v: value
+   */
+  static std::string convertToString(const double v) {
+#if defined(__cpp_lib_to_chars)
+    char b[32];
+    const auto r = std::to_chars(b, b + sizeof(b), v);
+    return std::string(b, r.ptr);
+#else  /* defined(__cpp_lib_to_chars) */
+    auto os = std::ostringstream{};
+    os.precision(17);
+    os << v;
+    return os.str();
+#endif /* defined(__cpp_lib_to_chars) */
+  }  // end of convertToString
+
+  TextData::TextData(const std::string& f, const std::string& fmt)
+      : file(f), format(fmt) {
+    if (ColumnarBinaryData::isColumnarBinaryFile(f)) {
+      // the format is irrelevant for binary files
+      const auto d = ColumnarBinaryData(f);
+      const auto nrows = d.getNumberOfRows();
+      this->binary = true;
+      this->numeric = true;
+      this->legends = d.getLegends();
+      this->ncolumns = d.getNumberOfColumns();
+      this->values.resize(nrows * this->ncolumns);
+      for (size_type c = 0; c != this->ncolumns; ++c) {
+        d.getColumnView(c + 1).copy(this->values.data() + c * nrows);
+      }
+      // the line numbers are the ones of a text file whose first line
+      // contains the legends
+      this->line_numbers.resize(nrows);
+      for (size_type i = 0; i != nrows; ++i) {
+        this->line_numbers[i] = i + 2;
+      }
+      return;
+    }
+    const auto content = TextDataFile(f);
+    const auto d = readHeader(this->legends, this->preamble,
+                              content.content, this->format);
+    // fast numeric path
+    auto chunks = std::vector<TextDataChunk>{};
+    for (const auto& l : d.header_lines) {
+      chunks.emplace_back();
+      chunks.back().data = l.line;
+    }
+    const auto nthreads = [&d]() -> std::size_t {
+      // below this size, parsing in parallel is not worth the effort
+      constexpr auto chunk_size = std::size_t{1} << 22;
+      const auto nt = std::max(std::thread::hardware_concurrency(), 1u);
+      return std::max(std::min(std::size_t{nt}, d.data.size() / chunk_size),
+                      std::size_t{1});
+    }();
+    const auto offset = chunks.size();
+    for (auto& c : splitDataSection(d.data, nthreads)) {
+      chunks.push_back(std::move(c));
+    }
+    if (chunks.size() - offset > 1) {
+      auto threads = std::vector<std::thread>{};
+      for (auto i = offset + 1; i < chunks.size(); ++i) {
+        threads.emplace_back(parseChunk, std::ref(chunks[i]));
+      }
+      for (auto i = std::size_t{}; i <= offset; ++i) {
+        parseChunk(chunks[i]);
+      }
+      for (auto& t : threads) {
+        t.join();
+      }
+    } else {
+      for (auto& c : chunks) {
+        parseChunk(c);
+      }
+    }
+    this->numeric = true;
+    auto nrows = size_type{};
+    for (const auto& c : chunks) {
+      if ((!c.numeric) ||
+          ((c.nlines != 0) && (nrows != 0) && (c.ncolumns != this->ncolumns))) {
+        this->numeric = false;
+        break;
+      }
+      if (c.nlines != 0) {
+        this->ncolumns = c.ncolumns;
+      }
+      nrows += c.nlines;
+    }
+    if (this->numeric) {
+      // store the values by columns
+      this->values.resize(nrows * this->ncolumns);
+      auto row = size_type{};
+      for (const auto& c : chunks) {
+        for (size_type i = 0; i != c.nlines; ++i, ++row) {
+          for (size_type j = 0; j != this->ncolumns; ++j) {
+            this->values[j * nrows + row] = c.values[i * this->ncolumns + j];
+          }
+        }
+      }
+      this->line_numbers.reserve(nrows);
+      forEachDataLine(d, [this](std::string_view, const size_type n) {
+        this->line_numbers.push_back(n);
+      });
+      return;
     }
+    // general case
+    this->ncolumns = 0;
+    forEachDataLine(d, [this](std::string_view l, const size_type n) {
+      this->lines.push_back(tokenize(l, n));
+    });
   }  // end of TextData::TextData
 
+  void TextData::buildLines() const {
+    if (!this->numeric) {
+      return;
+    }
+    std::call_once(this->lines_flag, [this] {
+      if (this->binary) {
+        const auto nrows = this->line_numbers.size();
+        this->lines.resize(nrows);
+        for (size_type i = 0; i != nrows; ++i) {
+          const auto n = this->line_numbers[i];
+          auto& tokens = this->lines[i].tokens;
+          for (size_type j = 0; j != this->ncolumns; ++j) {
+            tokens.emplace_back(convertToString(this->values[j * nrows + i]),
+                                n, j, Token::Number);
+          }
+        }
+        return;
+      }
+      // the file is read again
+      const auto content = TextDataFile(this->file);
+      auto l = std::vector<std::string>{};
+      auto p = std::vector<std::string>{};
+      const auto d = readHeader(l, p, content.content, this->format);
+      forEachDataLine(d, [this](std::string_view line, const size_type n) {
+        if (n >= this->first_line) {
+          this->lines.push_back(tokenize(line, n));
+        }
+      });
+    });
+  }  // end of TextData::buildLines
+
   const std::vector<std::string>& TextData::getLegends() const {
     return this->legends;
   }  // end of TextData::getLegends
@@ -139,11 +571,25 @@ namespace tfel::utilities {
       raise_if(b, "TextData::getColumn: " + msg);
     };
     tab.clear();
-    tab.reserve(this->lines.size());
     // sanity check
     throw_if(i == 0u,
              "column '0' requested "
              "(column numbers begins at '1').");
+    if (this->numeric) {
+      const auto nrows = this->line_numbers.size();
+      if (nrows == 0) {
+        return;
+      }
+      throw_if(this->ncolumns < i, "line '" +
+                                       std::to_string(this->line_numbers[0]) +
+                                       "' "
+                                       "does not have '" +
+                                       std::to_string(i) + "' columns.");
+      const auto b = this->values.begin() + (i - 1) * nrows;
+      tab.assign(b, b + nrows);
+      return;
+    }
+    tab.reserve(this->lines.size());
     // treatment
     for (const auto& l : this->lines) {
       auto n = l.tokens.empty() ? 0 : l.tokens[0].line;
@@ -156,10 +602,12 @@ namespace tfel::utilities {
   }  // end of TextData::getColumn
 
   std::vector<TextData::Line>::const_iterator TextData::begin() const {
+    this->buildLines();
     return this->lines.begin();
   }  // end of TextData::begin()
 
   std::vector<TextData::Line>::const_iterator TextData::end() const {
+    this->buildLines();
     return this->lines.end();
   }  // end of TextData::end()
 
@@ -167,11 +615,29 @@ namespace tfel::utilities {
     auto get_line = [](const Line& l) -> Token::size_type {
       return l.tokens.empty() ? 0 : l.tokens[0].line;
     };
+    this->first_line = std::max(this->first_line, n + 2);
+    if (this->numeric) {
+      const auto nrows = this->line_numbers.size();
+      const auto p = std::find_if(
+          this->line_numbers.begin(), this->line_numbers.end(),
+          [this](const size_type l) { return l >= this->first_line; });
+      const auto nskipped = static_cast<size_type>(p - line_numbers.begin());
+      if (nskipped != 0) {
+        const auto nrows2 = nrows - nskipped;
+        for (size_type j = 0; j != this->ncolumns; ++j) {
+          std::copy(this->values.begin() + j * nrows + nskipped,
+                    this->values.begin() + (j + 1) * nrows,
+                    this->values.begin() + j * nrows2);
+        }
+        this->values.resize(nrows2 * this->ncolumns);
+        this->line_numbers.erase(this->line_numbers.begin(), p);
+      }
+    }
     if (this->lines.empty()) {
       return;
     }
     auto p = this->lines.begin();
-    while ((get_line(*p) <= n + 1) && (p != this->lines.end())) {
+    while ((p != this->lines.end()) && (get_line(*p) <= n + 1)) {
       ++p;
     }
     lines.erase(lines.begin(), p);
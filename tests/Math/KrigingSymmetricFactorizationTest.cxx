@@ -0,0 +1,174 @@
+/*!
+ * \file   tests/Math/KrigingSymmetricFactorizationTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Math/LUSolve.hxx"
+#include "TFEL/Math/Kriging.hxx"
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+static double random_value(const double min, const double max) {
+  return min + ((max - min) * std::rand()) / RAND_MAX;
+}
+
+struct KrigingSymmetricFactorizationTest final
+    : public tfel::tests::TestCase {
+  KrigingSymmetricFactorizationTest()
+      : tfel::tests::TestCase("TFEL/Math",
+                              "KrigingSymmetricFactorizationTest") {
+  }  // end of KrigingSymmetricFactorizationTest
+  tfel::tests::TestResult execute() override {
+    std::srand(12345);
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute
+ private:
+  //! \brief factorization of an indefinite matrix
+  void test1() {
+    using namespace tfel::math;
+    constexpr auto n = 12u;
+    matrix<double> m(n, n, 0.);
+    for (unsigned short i = 0; i != n; ++i) {
+      for (unsigned short j = 0; j != i; ++j) {
+        m(i, j) = m(j, i) = random_value(-1., 1.);
+      }
+    }
+    // null diagonal terms for the last rows, as the drifts in kriging
+    for (unsigned short i = 0; i != n - 3; ++i) {
+      m(i, i) = random_value(-1., 1.);
+    }
+    auto m2 = m;
+    auto b = vector<double>(n);
+    for (auto& v : b) {
+      v = random_value(-1., 1.);
+    }
+    auto x = b;
+    auto x2 = b;
+    KrigingSymmetricFactorization<double> ldlt;
+    ldlt.factorize(m);
+    ldlt.solve(x);
+    LUSolve::exe(m2, x2);
+    for (unsigned short i = 0; i != n; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(x[i] - x2[i]) < 1e-10 * (1 + std::abs(x2[i])));
+    }
+    // purely off-diagonal matrix, which requires 2x2 pivots
+    matrix<double> m3(2, 2, 0.);
+    m3(0, 1) = m3(1, 0) = 2;
+    auto y = vector<double>{1., 3.};
+    ldlt.factorize(m3);
+    ldlt.solve(y);
+    TFEL_TESTS_ASSERT(std::abs(y[0] - 1.5) < 1e-14);
+    TFEL_TESTS_ASSERT(std::abs(y[1] - 0.5) < 1e-14);
+  }
+  //! \brief symmetric factorization vs LU decomposition in 1D
+  void test2() {
+    using namespace tfel::math;
+    Kriging<1u> k1;
+    Kriging<1u> k2;
+    k2.useSymmetricFactorization();
+    for (unsigned short i = 0; i != 200; ++i) {
+      const auto x = random_value(0., 1.);
+      const auto y = std::exp(std::cos(x * x));
+      k1.addValue(x, y);
+      k2.addValue(x, y);
+    }
+    k1.buildInterpolation();
+    k2.buildInterpolation();
+    for (double x = -0.5; x < 1.5; x += 0.01) {
+      TFEL_TESTS_ASSERT(std::abs(k1(x) - k2(x)) < 1e-8);
+    }
+  }
+  //! \brief incremental construction and batch evaluation in 1D
+  void test3() {
+    using namespace tfel::math;
+    Kriging<1u> k1;
+    Kriging<1u> k2;
+    k2.useSymmetricFactorization();
+    for (unsigned short i = 0; i != 150; ++i) {
+      const auto x = random_value(0., 1.);
+      const auto y = std::exp(std::cos(x * x));
+      k1.addValue(x, y);
+      if (i == 10) {
+        k2.addValue(x, y);
+        k2.buildInterpolation();
+      } else if (i > 10) {
+        k2.addValueAndUpdateInterpolation(x, y);
+      } else {
+        k2.addValue(x, y);
+      }
+    }
+    k1.buildInterpolation();
+    auto xv = std::vector<double>{};
+    for (double x = -0.5; x < 1.5; x += 0.01) {
+      xv.push_back(x);
+      TFEL_TESTS_ASSERT(std::abs(k1(x) - k2(x)) < 1e-8);
+    }
+    auto r = std::vector<double>(xv.size());
+    k1.getValues(r.data(), xv.data(), xv.size());
+    for (std::vector<double>::size_type i = 0; i != xv.size(); ++i) {
+      TFEL_TESTS_ASSERT(std::abs(r[i] - k1(xv[i])) < 1e-12);
+    }
+  }
+  //! \brief incremental construction and batch evaluation in 2D
+  void test4() {
+    using namespace tfel::math;
+    Kriging<2u> k1;
+    Kriging<2u> k2;
+    k2.useSymmetricFactorization();
+    tvector<2u> v;
+    for (unsigned short i = 0; i != 100; ++i) {
+      v(0) = random_value(0., 1.);
+      v(1) = random_value(0., 1.);
+      const auto z = std::cos(v(0) + v(1)) * std::exp(v(0));
+      k1.addValue(v, z);
+      k2.addValueAndUpdateInterpolation(v, z);
+    }
+    k1.buildInterpolation();
+    auto xv = std::vector<tvector<2u>>{};
+    for (double x = -0.5; x < 1.5; x += 0.1) {
+      for (double y = -0.5; y < 1.5; y += 0.1) {
+        v(0) = x;
+        v(1) = y;
+        xv.push_back(v);
+        TFEL_TESTS_ASSERT(std::abs(k1(v) - k2(v)) < 1e-8);
+      }
+    }
+    auto r = std::vector<double>(xv.size());
+    k2.getValues(r.data(), xv.data(), xv.size());
+    for (std::vector<double>::size_type i = 0; i != xv.size(); ++i) {
+      TFEL_TESTS_ASSERT(std::abs(r[i] - k2(xv[i])) < 1e-12);
+    }
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(KrigingSymmetricFactorizationTest,
+                          "KrigingSymmetricFactorizationTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("KrigingSymmetricFactorizationTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
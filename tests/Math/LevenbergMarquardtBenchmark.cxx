@@ -0,0 +1,101 @@
+/*!
+ * \file   tests/Math/LevenbergMarquardtBenchmark.cxx
+ * \brief  This file measures the time needed by the `LevenbergMarquardt`
+ * class to fit a model on a large set of data points, the data points
+ * being split in an increasing number of ranges treated by a thread
+ * pool.
+ *
+ * This program is not a test: it is only built on request
+ * (`make LevenbergMarquardtBenchmark`). The number of data points and the
+ * maximum number of threads can be given as the first and second
+ * arguments of the program.
+ *
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <thread>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include <functional>
+#include "TFEL/System/ThreadPool.hxx"
+#include "TFEL/Math/Evaluator.hxx"
+#include "TFEL/Math/LevenbergMarquardt.hxx"
+#include "TFEL/Math/Parser/LevenbergMarquardtEvaluatorWrapper.hxx"
+
+//! \brief number of data points
+static unsigned int number_of_data_points = 20000;
+//! \brief maximum number of threads
+static unsigned int maximum_number_of_threads =
+    std::max(std::thread::hardware_concurrency(), 2u);
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main(const int argc, const char* const* const argv) {
+  using namespace tfel::math;
+  using namespace tfel::math::parser;
+  using LevMar = LevenbergMarquardt<LevenbergMarquardtEvaluatorWrapper>;
+  using size_type = LevMar::size_type;
+  if (argc > 3) {
+    std::cerr << "usage: " << argv[0]
+              << " [number_of_data_points] [maximum_number_of_threads]\n";
+    return EXIT_FAILURE;
+  }
+  if (argc >= 2) {
+    number_of_data_points = static_cast<unsigned int>(std::stoul(argv[1]));
+  }
+  if (argc == 3) {
+    maximum_number_of_threads =
+        static_cast<unsigned int>(std::stoul(argv[2]));
+  }
+  const auto f = std::make_shared<Evaluator>(
+      std::vector<std::string>{"x", "p0", "p1"}, "p1*exp(p0*cos(x*x))");
+  const auto fit = [&f](const unsigned int n) {
+    tfel::system::ThreadPool pool(n - 1);
+    LevMar levmar(LevenbergMarquardtEvaluatorWrapper(f, 1u, 2u));
+    vector<double> x(1u);
+    for (unsigned int i = 0; i != number_of_data_points; ++i) {
+      x(0) = static_cast<double>(i) / number_of_data_points;
+      levmar.addData(x, 2.7 * std::exp(-0.7 * std::cos(x(0) * x(0))));
+    }
+    vector<double> p(2u);
+    p(0) = -0.6;
+    p(1) = 2.5;
+    levmar.setInitialGuess(p);
+    levmar.setExecutor(n, [&pool](const size_type nt,
+                                  const std::function<void(const size_type)>&
+                                      t) {
+      pool.parallel_for(size_type{0}, nt, size_type{1}, t);
+    });
+    const auto start = std::chrono::steady_clock::now();
+    p = levmar.execute();
+    const auto end = std::chrono::steady_clock::now();
+    if ((std::abs(p(0) + 0.7) > 1e-8) || (std::abs(p(1) - 2.7) > 1e-8)) {
+      std::cerr << "LevenbergMarquardtBenchmark: invalid parameters with "
+                << n << " threads\n";
+      std::exit(EXIT_FAILURE);
+    }
+    return std::chrono::duration<double>(end - start).count();
+  };
+  std::cout << "LevenbergMarquardtBenchmark: " << number_of_data_points
+            << " data points\n";
+  const auto t1 = fit(1);
+  std::cout << "- 1 thread: " << t1 << "s\n";
+  for (unsigned int n = 2; n <= maximum_number_of_threads; n *= 2) {
+    const auto t = fit(n);
+    std::cout << "- " << n << " threads: " << t << "s (speed-up: " << t1 / t
+              << ")\n";
+  }
+  return EXIT_SUCCESS;
+}  // end of main
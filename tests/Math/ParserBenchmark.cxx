@@ -0,0 +1,128 @@
+/*!
+ * \file   tests/Math/ParserBenchmark.cxx
+ * \brief  This file compares the evaluation of formulas by the bytecode
+ * compiled by the `Evaluator` class to the direct evaluation of the tree
+ * of expressions resulting from the analysis of those formulas.
+ *
+ * This program is not a test: it is only built on request
+ * (`make ParserBenchmark`). The number of evaluations per formula can be
+ * given as the first argument of the program.
+ *
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "TFEL/Math/Evaluator.hxx"
+
+//! \brief number of evaluations per formula
+static std::size_t number_of_evaluations = 1000000;
+
+/*!
+ * \return the time per evaluation (ns) of the given formula
+ * \param[out] s: sum of the results, which shall not depend on the
+ * evaluation mode
+ * \param[in] f: formula
+ * \param[in] b: if true, the bytecode is used
+ */
+static double measure(double& s, const std::string& f, const bool b) {
+  using clock = std::chrono::steady_clock;
+  auto e = tfel::math::Evaluator(f);
+  e.setByteCodeEvaluation(b);
+  const auto px = e.getVariablePosition("x");
+  const auto py = e.getVariablePosition("y");
+  s = 0;
+  const auto start = clock::now();
+  for (std::size_t i = 0; i != number_of_evaluations; ++i) {
+    const auto x = static_cast<double>(i % 1000) / 1000;
+    e.setVariableValue(px, x);
+    e.setVariableValue(py, 1 - x);
+    s += e.getValue();
+  }
+  const auto end = clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() /
+         static_cast<double>(number_of_evaluations);
+}  // end of measure
+
+/*!
+ * \return the time per evaluation (ns) of the given formula by the
+ * `getValues` method
+ * \param[out] s: sum of the results
+ * \param[in] f: formula
+ */
+static double measureBatch(double& s, const std::string& f) {
+  using clock = std::chrono::steady_clock;
+  auto e = tfel::math::Evaluator(f);
+  auto x = std::vector<double>(number_of_evaluations);
+  auto y = std::vector<double>(number_of_evaluations);
+  auto r = std::vector<double>(number_of_evaluations);
+  for (std::size_t i = 0; i != number_of_evaluations; ++i) {
+    x[i] = static_cast<double>(i % 1000) / 1000;
+    y[i] = 1 - x[i];
+  }
+  auto args = std::vector<const double*>(2);
+  args[e.getVariablePosition("x")] = x.data();
+  args[e.getVariablePosition("y")] = y.data();
+  const auto start = clock::now();
+  e.getValues(r.data(), args, number_of_evaluations);
+  const auto end = clock::now();
+  s = 0;
+  for (const auto& v : r) {
+    s += v;
+  }
+  return std::chrono::duration<double, std::nano>(end - start).count() /
+         static_cast<double>(number_of_evaluations);
+}  // end of measureBatch
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main(const int argc, const char* const* const argv) {
+  if (argc > 2) {
+    std::cerr << "usage: " << argv[0] << " [number_of_evaluations]\n";
+    return EXIT_FAILURE;
+  }
+  if (argc == 2) {
+    number_of_evaluations = static_cast<std::size_t>(std::stoul(argv[1]));
+  }
+  const auto formulas = std::vector<std::string>{
+      "x+2*y",                                     //
+      "exp(-x)*cos(y)+x**3",                       //
+      "2*exp(x)*sqrt(y+1)+3*exp(x)*sqrt(y+1)",     //
+      "x>0.5 ? sin(x)*y : cos(y)/(1+x)",           //
+      "(1+x)**2.5*(1-y**2)/(2+x*y)+log(1+x*x+y)"};
+  auto success = true;
+  std::cout << "ParserBenchmark: " << number_of_evaluations
+            << " evaluations per formula, time per evaluation (ns)\n"
+            << std::setw(48) << std::left << "formula" << std::setw(8)
+            << "tree" << std::setw(10) << "bytecode" << "getValues\n";
+  for (const auto& f : formulas) {
+    auto s_tree = double{};
+    auto s_bytecode = double{};
+    auto s_batch = double{};
+    const auto t_tree = measure(s_tree, f, false);
+    const auto t_bytecode = measure(s_bytecode, f, true);
+    const auto t_batch = measureBatch(s_batch, f);
+    const auto tolerance = 1e-10 * std::abs(s_tree);
+    if ((std::abs(s_bytecode - s_tree) > tolerance) ||
+        (std::abs(s_batch - s_tree) > tolerance)) {
+      std::cerr << "ParserBenchmark: inconsistent results for '" << f
+                << "'\n";
+      success = false;
+    }
+    std::cout << std::setw(48) << std::left << f << std::setw(8)
+              << std::setprecision(3) << t_tree << std::setw(10)
+              << t_bytecode << t_batch << '\n';
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -17,6 +17,7 @@
 #endif /* NDEBUG */
 
 #include <iostream>
+#include <cassert>
 #include <iterator>
 #include <algorithm>
 #include <functional>
@@ -27,6 +28,7 @@
 #include <memory>
 #include "TFEL/Math/Evaluator.hxx"
 #include "TFEL/Math/LevenbergMarquardt.hxx"
+#include "TFEL/System/ThreadPool.hxx"
 #include "TFEL/Math/Parser/LevenbergMarquardtEvaluatorWrapper.hxx"
 
 /* coverity [UNCAUGHT_EXCEPT]*/
@@ -64,6 +66,51 @@ int main() {
   cout << "res : ";
   copy(p.begin(), p.end(), ostream_iterator<double>(cout, " "));
   cout << endl;
+  // same fit using three threads
+  using size_type =
+      LevenbergMarquardt<LevenbergMarquardtEvaluatorWrapper>::size_type;
+  tfel::system::ThreadPool pool(2);
+  const auto executor = [&pool](
+                            const size_type n,
+                            const std::function<void(const size_type)>& t) {
+    pool.parallel_for(size_type{0}, n, size_type{1}, t);
+  };
+  LevenbergMarquardt<LevenbergMarquardtEvaluatorWrapper> levmar2(
+      LevenbergMarquardtEvaluatorWrapper(test, 1u, 2u));
+  for (i = 0; i != 10; ++i) {
+    x(0) = x_data[i];
+    levmar2.addData(x, y_data[i]);
+  }
+  vector<double> p2(2u);
+  p2(0) = 1.2;
+  p2(1) = -0.2;
+  levmar2.setInitialGuess(p2);
+  levmar2.setExecutor(3u, executor);
+  p2 = levmar2.execute();
+  assert(abs(p2(0) - p(0)) < 1e-10 * abs(p(0)));
+  assert(abs(p2(1) - p(1)) < 1e-10 * abs(p(1)));
+  // fit on a larger set of data
+  const auto fit = [&test, &executor](const unsigned int n) {
+    LevenbergMarquardt<LevenbergMarquardtEvaluatorWrapper> b(
+        LevenbergMarquardtEvaluatorWrapper(test, 1u, 2u));
+    vector<double> xb(1u);
+    for (unsigned short j = 0; j != 2000; ++j) {
+      xb(0) = j / 2000.;
+      b.addData(xb, 2.7 * std::exp(-0.7 * std::cos(xb(0) * xb(0))));
+    }
+    vector<double> pb(2u);
+    pb(0) = -0.6;
+    pb(1) = 2.5;
+    b.setInitialGuess(pb);
+    b.setExecutor(n, executor);
+    return b.execute();
+  };
+  const auto pb1 = fit(1u);
+  const auto pb2 = fit(4u);
+  assert(abs(pb1(0) + 0.7) < 1e-8);
+  assert(abs(pb1(1) - 2.7) < 1e-8);
+  assert(abs(pb2(0) - pb1(0)) < 1e-10);
+  assert(abs(pb2(1) - pb1(1)) < 1e-10);
 #endif
   return EXIT_SUCCESS;
 }  // end of main
@@ -0,0 +1,194 @@
+/*!
+ * \file   tests/Math/parser13.cxx
+ * \brief  This file tests the evaluation of formulae using the bytecode
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <utility>
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "TFEL/Math/Evaluator.hxx"
+
+struct ParserTest13 final : public tfel::tests::TestCase {
+  ParserTest13()
+      : tfel::tests::TestCase("TFEL/Math", "ParserTest13") {
+  }  // end of ParserTest13
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    this->test5();
+    this->test6();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief compare the bytecode and the tree evaluations
+  void check(tfel::math::Evaluator& e,
+             const std::vector<std::string>& vnames,
+             const std::vector<double>& values) {
+    constexpr auto eps = double{1e-14};
+    for (decltype(vnames.size()) i = 0; i != vnames.size(); ++i) {
+      e.setVariableValue(vnames[i], values[i]);
+    }
+    e.setByteCodeEvaluation(false);
+    auto v1 = double{};
+    try {
+      v1 = e.getValue();
+    } catch (std::runtime_error&) {
+      // the evaluation with the bytecode must also fail
+      e.setByteCodeEvaluation(true);
+      TFEL_TESTS_CHECK_THROW(e.getValue(), std::runtime_error);
+      return;
+    }
+    e.setByteCodeEvaluation(true);
+    const auto v2 = e.getValue();
+    TFEL_TESTS_ASSERT(std::abs(v1 - v2) < eps * std::max(1., std::abs(v1)));
+  }  // end of check
+  //! \brief check that an evaluation fails in both modes
+  void checkFailure(tfel::math::Evaluator& e, const double x) {
+    e.setVariableValue("x", x);
+    e.setByteCodeEvaluation(false);
+    TFEL_TESTS_CHECK_THROW(e.getValue(), std::runtime_error);
+    e.setByteCodeEvaluation(true);
+    TFEL_TESTS_CHECK_THROW(e.getValue(), std::runtime_error);
+  }  // end of checkFailure
+  void test1() {
+    const auto formulae = std::vector<std::string>{
+        "2*x+3*y-4",
+        "-x*(y-2)/(1+x*x)",
+        "2*3*x+4**2-y",
+        "x**2+y**3-x**-2",
+        "abs(x)**7.5+abs(y)**x",
+        "exp(x)*sin(y)+cos(x)*sin(y)",
+        "sqrt(x*x+y*y)+sqrt(x*x+y*y)*2",
+        "log(1+x*x)-tanh(y)+abs(x-y)",
+        "max(x,y)-min(x,2*y)+atan2(y,x)+hypot(x,y)",
+        "x>y ? x-y : y-x",
+        "(x>=0) && (y<0) ? 1 : 2",
+        "(x<0) || (y<=0) ? x*y : x+y",
+        "x==y ? 1 : 0",
+        "!(x>y) ? 2*x : 3*y",
+        "(x>0 ? x : -x) + (x>0 ? 2 : 3)*y",
+        "x>0 ? (y>0 ? x*y : x-y) : (y>0 ? y-x : -x-y)",
+        "x**0+x**1+x**2+x**-1+x**17+x**-17"};
+    const auto vnames = std::vector<std::string>{"x", "y"};
+    const auto values = std::vector<std::vector<double>>{
+        {1.2, 0.3}, {-0.7, 2.1}, {0.4, -1.3}, {-2.2, -0.5}, {1.5, 1.5}};
+    for (const auto& f : formulae) {
+      auto e = tfel::math::Evaluator(vnames, f);
+      for (const auto& v : values) {
+        this->check(e, vnames, v);
+      }
+    }
+  }  // end of test1
+  void test2() {
+    // constant expressions
+    constexpr auto eps = double{1e-14};
+    auto e = tfel::math::Evaluator("2*3+exp(0)-4**2");
+    TFEL_TESTS_ASSERT(std::abs(e.getValue() + 9) < eps);
+    auto e2 = tfel::math::Evaluator(2.5);
+    TFEL_TESTS_ASSERT(std::abs(e2.getValue() - 2.5) < eps);
+  }  // end of test2
+  void test3() {
+    // invalid operations shall be reported in both modes
+    auto e1 = tfel::math::Evaluator("1/x");
+    this->checkFailure(e1, 0);
+    auto e2 = tfel::math::Evaluator("log(x)");
+    this->checkFailure(e2, -1);
+    auto e3 = tfel::math::Evaluator("x**-2");
+    this->checkFailure(e3, 0);
+    auto e4 = tfel::math::Evaluator("sqrt(x)+1");
+    this->checkFailure(e4, -1);
+    // only the selected branch of a conditional expression is evaluated
+    constexpr auto eps = double{1e-14};
+    auto e5 = tfel::math::Evaluator("x>0 ? log(x) : 2");
+    e5.setVariableValue("x", -1);
+    TFEL_TESTS_ASSERT(std::abs(e5.getValue() - 2) < eps);
+  }  // end of test3
+  void test4() {
+    // derivatives, copies and resolution of dependencies
+    constexpr auto eps = double{1e-14};
+    const auto e = tfel::math::Evaluator("x**3*sin(y)");
+    const auto dx = e.differentiate("x");
+    dx->setVariableValue(0, 2);
+    dx->setVariableValue(1, 0.5);
+    TFEL_TESTS_ASSERT(std::abs(dx->getValue() - 12 * std::sin(0.5)) < eps);
+    auto e2 = e;
+    e2.setVariableValue("x", 2);
+    e2.setVariableValue("y", 0.5);
+    TFEL_TESTS_ASSERT(std::abs(e2.getValue() - 8 * std::sin(0.5)) < eps);
+    auto e3 = tfel::math::Evaluator(1);
+    e3 = e2;
+    e3.setVariableValue("x", 1);
+    TFEL_TESTS_ASSERT(std::abs(e2.getValue() - 8 * std::sin(0.5)) < eps);
+    TFEL_TESTS_ASSERT(std::abs(e3.getValue() - std::sin(0.5)) < eps);
+  }  // end of test4
+  void test5() {
+    // comparison of the tree and bytecode evaluations on a large number of
+    // values
+    const auto n = 2000;
+    auto e = tfel::math::Evaluator(
+        "x>0 ? 2*x**2+exp(-y)*(x**2+1) : sin(x)*cos(y)+(x-y)/(1+y*y)");
+    const auto evaluate = [&e, n](const bool b) {
+      e.setByteCodeEvaluation(b);
+      auto r = double{0};
+      for (int i = 0; i != n; ++i) {
+        e.setVariableValue("x", (i % 100) * 0.01 - 0.5);
+        e.setVariableValue("y", (i % 37) * 0.1);
+        r += e.getValue();
+      }
+      return r;
+    };
+    const auto r1 = evaluate(false);
+    const auto r2 = evaluate(true);
+    TFEL_TESTS_ASSERT(std::abs(r1 - r2) < 1e-12 * std::abs(r1));
+  }  // end of test5
+  void test6() {
+    // large formulae, whose registers are not stored on the stack
+    auto f = std::string{};
+    for (int i = 0; i != 50; ++i) {
+      const auto c = std::to_string(i + 1);
+      f += (i == 0 ? "" : "+") + c + "*x*sin(" + c + "*y)";
+    }
+    auto e = tfel::math::Evaluator(f);
+    auto e2 = tfel::math::Evaluator(f + "-exp(x*y)");
+    for (const auto x : {-1., 0.5, 2.}) {
+      this->check(e, {"x", "y"}, {x, 0.3});
+      this->check(e2, {"x", "y"}, {x, 0.3});
+      this->check(e, {"x", "y"}, {x, -0.7});
+    }
+  }  // end of test6
+};
+
+TFEL_TESTS_GENERATE_PROXY(ParserTest13, "ParserTest13");
+
+/* coverity[UNCAUGHT_EXCEPT] */
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("Parser13.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,171 @@
+/*!
+ * \file   tests/Math/parser14.cxx
+ * \brief  This file tests the evaluation of formulae on arrays of values
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <map>
+#include <cmath>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "TFEL/Math/Evaluator.hxx"
+
+struct ParserTest14 final : public tfel::tests::TestCase {
+  ParserTest14()
+      : tfel::tests::TestCase("TFEL/Math", "ParserTest14") {
+  }  // end of ParserTest14
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief a simple alias
+  using size_type = std::vector<double>::size_type;
+  //! \brief a simple alias
+  using Columns = std::vector<const double*>;
+  //! \brief number of values (not a multiple of the size of the blocks)
+  static constexpr size_type n = 1000;
+  //! \brief values of the first variable
+  static std::vector<double> getX() {
+    auto x = std::vector<double>(n);
+    for (size_type i = 0; i != n; ++i) {
+      x[i] = 0.01 * static_cast<double>(i) - 3;
+    }
+    return x;
+  }  // end of getX
+  //! \brief values of the second variable
+  static std::vector<double> getY() {
+    auto y = std::vector<double>(n);
+    for (size_type i = 0; i != n; ++i) {
+      y[i] = 1 + 0.5 * std::sin(static_cast<double>(i));
+    }
+    return y;
+  }  // end of getY
+  //! \brief compare the evaluation on arrays to scalar evaluations
+  void check(const std::string& f) {
+    constexpr auto eps = double{1e-14};
+    const auto x = getX();
+    const auto y = getY();
+    auto e = tfel::math::Evaluator(std::vector<std::string>{"x", "y"}, f);
+    auto r = std::vector<double>(n);
+    e.getValues(r.data(), Columns{x.data(), y.data()}, n);
+    auto r2 = std::vector<double>(n);
+    e.getValues(r2.data(), {{"y", y.data()}, {"x", x.data()}}, n);
+    for (size_type i = 0; i != n; ++i) {
+      e.setVariableValue("x", x[i]);
+      e.setVariableValue("y", y[i]);
+      const auto v = e.getValue();
+      TFEL_TESTS_ASSERT(std::abs(r[i] - v) < eps * std::max(1., std::abs(v)));
+      TFEL_TESTS_ASSERT(std::abs(r2[i] - v) < eps * std::max(1., std::abs(v)));
+    }
+  }  // end of check
+  void test1() {
+    // formulae that can be evaluated by blocks
+    this->check("2*x+3*y-4");
+    this->check("-x*(y-2)/(1+x*x)");
+    this->check("exp(-x*x)*sin(y)+x**3-y**-2");
+    this->check("max(x,y)-min(x,2*y)+atan2(y,x)+y**1.5");
+    this->check("2*3+4");
+    this->check("x>0 ? x : -x");
+    this->check("(x>=0)&&(y<1.2) ? x+y : x-y");
+    this->check("(x<-1)||(y==1) ? 1 : 2");
+    this->check("!(x>y) ? x : y");
+    this->check("x>y ? x-y : (y>1 ? y : x*y)");
+    this->check("exp(x)>2 ? x*x : y*y");
+  }  // end of test1
+  void test2() {
+    // formulae that can't be evaluated by blocks
+    this->check("x>0 ? log(x) : y");
+    this->check("x>0 ? 1/(x+10) : y");
+    this->check("x>y ? x-y : (y>1 ? y : 1/(x+10))");
+  }  // end of test2
+  void test3() {
+    // variables whose values are not given
+    constexpr auto eps = double{1e-14};
+    const auto x = getX();
+    auto e = tfel::math::Evaluator("a*x+b");
+    e.setVariableValue("a", 2);
+    e.setVariableValue("b", 3);
+    auto r = std::vector<double>(n);
+    e.getValues(r.data(), {{"x", x.data()}}, n);
+    for (size_type i = 0; i != n; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(r[i] - (2 * x[i] + 3)) < eps);
+    }
+    // invalid operations shall be reported
+    auto e2 = tfel::math::Evaluator("log(x+3)");
+    TFEL_TESTS_CHECK_THROW(e2.getValues(r.data(), {{"x", x.data()}}, n),
+                           std::runtime_error);
+    auto e3 = tfel::math::Evaluator("1/(x+2)");
+    TFEL_TESTS_CHECK_THROW(e3.getValues(r.data(), {{"x", x.data()}}, n),
+                           std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(e3.getValues(r.data(), {{"y", x.data()}}, n),
+                           std::runtime_error);
+  }  // end of test3
+  void test4() {
+    // comparison of the evaluation times
+    const auto x = getX();
+    const auto y = getY();
+    auto e = tfel::math::Evaluator(std::vector<std::string>{"x", "y"},
+                                   "2*x**2+exp(-y)*(x**2+1)-(x-y)/(1+y*y)");
+    auto r = std::vector<double>(n);
+    auto r2 = std::vector<double>(n);
+    const auto m = 200;
+    const auto start = std::chrono::steady_clock::now();
+    for (int k = 0; k != m; ++k) {
+      for (size_type i = 0; i != n; ++i) {
+        e.setVariableValue(size_type{0}, x[i]);
+        e.setVariableValue(size_type{1}, y[i]);
+        r[i] = e.getValue();
+      }
+    }
+    const auto middle = std::chrono::steady_clock::now();
+    for (int k = 0; k != m; ++k) {
+      e.getValues(r2.data(), Columns{x.data(), y.data()}, n);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    for (size_type i = 0; i != n; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(r[i] - r2[i]) <
+                        1e-14 * std::max(1., std::abs(r[i])));
+    }
+    std::cout << "ParserTest14: scalar evaluation: "
+              << std::chrono::duration<double>(middle - start).count()
+              << "s, evaluation on arrays: "
+              << std::chrono::duration<double>(end - middle).count()
+              << "s\n";
+  }  // end of test4
+};
+
+TFEL_TESTS_GENERATE_PROXY(ParserTest14, "ParserTest14");
+
+/* coverity[UNCAUGHT_EXCEPT] */
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("Parser14.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
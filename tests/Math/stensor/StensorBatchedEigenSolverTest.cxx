@@ -0,0 +1,209 @@
+/*!
+ * \file   tests/Math/stensor/StensorBatchedEigenSolverTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <tuple>
+#include <limits>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Stensor/StensorBatchedEigenSolver.hxx"
+
+struct StensorBatchedEigenSolverTest final : public tfel::tests::TestCase {
+  //! a simple alias
+  using EigenSolver = tfel::math::stensor_common::EigenSolver;
+
+  StensorBatchedEigenSolverTest()
+      : tfel::tests::TestCase("TFEL/Math", "StensorBatchedEigenSolverTest") {
+  }  // end of StensorBatchedEigenSolverTest
+
+  tfel::tests::TestResult execute() override {
+    this->check<EigenSolver::TFELEIGENSOLVER>();
+    this->check<EigenSolver::FSESANALYTICALEIGENSOLVER>();
+    this->check<EigenSolver::FSESJACOBIEIGENSOLVER>();
+    this->check<EigenSolver::FSESQLEIGENSOLVER>();
+    this->check<EigenSolver::FSESCUPPENEIGENSOLVER>();
+    this->check<EigenSolver::FSESHYBRIDEIGENSOLVER>();
+    this->check<EigenSolver::GTESYMMETRICQREIGENSOLVER>();
+    return this->result;
+  }  // end of execute
+
+ private:
+  template <EigenSolver es>
+  void check() {
+    this->test<float, es>();
+    this->test<double, es>();
+  }  // end of check
+  /*!
+   * \return an array of tensors containing random tensors and
+   * tensors with (nearly) degenerate eigenvalues. The number of
+   * tensors is not a multiple of the pack size.
+   */
+  template <typename real>
+  static std::vector<real> getTensors() {
+    constexpr auto cste = tfel::math::Cste<real>::sqrt2;
+    auto random_value = [] {
+      return real(2) * static_cast<real>(std::rand()) / RAND_MAX - 1;
+    };
+    std::srand(1234);
+    auto s = std::vector<real>{};
+    auto add = [&s](const real s0, const real s1, const real s2,
+                    const real s3, const real s4, const real s5) {
+      s.insert(s.end(), {s0, s1, s2, s3, s4, s5});
+    };
+    for (unsigned short i = 0; i != 53; ++i) {
+      add(random_value(), random_value(), random_value(), random_value(),
+          random_value(), random_value());
+    }
+    // null tensor
+    add(0, 0, 0, 0, 0, 0);
+    // hydrostatic tensors
+    add(1, 1, 1, 0, 0, 0);
+    add(-2, -2, -2, 0, 0, 0);
+    // uniaxial and equibiaxial tensors
+    add(1, 0, 0, 0, 0, 0);
+    add(0, 0, 1, 0, 0, 0);
+    add(1, 1, 0, 0, 0, 0);
+    add(real(1) / 2, real(1) / 2, 0, cste / 2, 0, 0);
+    add(real(1) / 2, 0, real(1) / 2, 0, cste / 2, 0);
+    // a nearly hydrostatic tensor
+    const auto e = 100 * std::numeric_limits<real>::epsilon();
+    add(1 + e, 1, 1 - e, e, 0, e);
+    return s;
+  }  // end of getTensors
+  /*!
+   * \return if a value computed by a batched solver is close to the
+   * one computed by the scalar solver. Some scalar solvers (QL with
+   * implicit shifts for instance) return invalid values for some
+   * diagonal tensors: in this case, the batched solver is expected to
+   * behave in the same way.
+   * \param[in] v: value computed by the batched solver
+   * \param[in] v2: value computed by the scalar solver
+   * \param[in] eps: tolerance
+   */
+  template <typename real>
+  static bool areClose(const real v, const real v2, const real eps) {
+    if (!std::isfinite(v2)) {
+      return !std::isfinite(v);
+    }
+    return std::abs(v - v2) < eps;
+  }  // end of areClose
+  /*!
+   * \return the norm of the residual of the eigenvalue problem
+   * \param[in] s: tensor
+   * \param[in] vp: eigenvalues
+   * \param[in] m: eigenvectors
+   */
+  template <typename real>
+  static real getResidual(const tfel::math::stensor<3u, real>& s,
+                          const real* const vp,
+                          const real* const m) {
+    constexpr auto icste = tfel::math::Cste<real>::isqrt2;
+    const real a[3][3] = {{s[0], s[3] * icste, s[4] * icste},
+                          {s[3] * icste, s[1], s[5] * icste},
+                          {s[4] * icste, s[5] * icste, s[2]}};
+    auto r = real(0);
+    for (unsigned short c = 0; c != 3; ++c) {
+      for (unsigned short i = 0; i != 3; ++i) {
+        auto v = -vp[c] * m[3 * i + c];
+        for (unsigned short j = 0; j != 3; ++j) {
+          v += a[i][j] * m[3 * j + c];
+        }
+        r = std::max(r, std::abs(v));
+      }
+    }
+    return r;
+  }  // end of getResidual
+  /*!
+   * \return the maximum deviation of the eigenvectors from an
+   * orthonormal basis
+   * \param[in] m: eigenvectors
+   */
+  template <typename real>
+  static real getOrthonormalityError(const real* const m) {
+    auto e = real(0);
+    for (unsigned short c = 0; c != 3; ++c) {
+      for (unsigned short c2 = 0; c2 != 3; ++c2) {
+        auto d = (c == c2) ? real(-1) : real(0);
+        for (unsigned short r = 0; r != 3; ++r) {
+          d += m[3 * r + c] * m[3 * r + c2];
+        }
+        e = std::max(e, std::abs(d));
+      }
+    }
+    return e;
+  }  // end of getOrthonormalityError
+  template <typename real, EigenSolver es>
+  void test() {
+    const auto eps = 100 * std::numeric_limits<real>::epsilon();
+    const auto values = getTensors<real>();
+    const auto n = values.size() / 6;
+    auto vp = std::vector<real>(3 * n);
+    auto vp2 = std::vector<real>(3 * n);
+    auto m = std::vector<real>(9 * n);
+    tfel::math::computeBatchedEigenValues<es>(vp.data(), values.data(), n);
+    tfel::math::computeBatchedEigenVectors<es>(vp2.data(), m.data(),
+                                               values.data(), n);
+    for (std::size_t i = 0; i != n; ++i) {
+      auto s = tfel::math::stensor<3u, real>{};
+      std::copy(values.begin() + 6 * i, values.begin() + 6 * (i + 1),
+                s.begin());
+      const auto ns = std::max(real(1), std::sqrt(s | s));
+      // eigenvalues, compared to the ones of the scalar solver
+      const auto e = s.template computeEigenValues<es>();
+      for (unsigned short r = 0; r != 3; ++r) {
+        TFEL_TESTS_ASSERT(areClose(vp[3 * i + r], e[r], eps * ns));
+      }
+      // eigenvectors, compared to the ones of the scalar solver
+      auto e2 = tfel::math::tvector<3u, real>{};
+      auto m2 = tfel::math::tmatrix<3u, 3u, real>{};
+      std::tie(e2, m2) = s.template computeEigenVectors<es>();
+      auto m2v = std::vector<real>(9);
+      for (unsigned short r = 0; r != 3; ++r) {
+        TFEL_TESTS_ASSERT(areClose(vp2[3 * i + r], e2[r], eps * ns));
+        for (unsigned short c = 0; c != 3; ++c) {
+          m2v[3 * r + c] = m2(r, c);
+        }
+      }
+      const auto r1 = getResidual(s, vp2.data() + 3 * i, m.data() + 9 * i);
+      const auto r2 = getResidual(s, e2.begin(), m2v.data());
+      TFEL_TESTS_ASSERT((!std::isfinite(r2)) ||
+                        (r1 < std::max(10 * r2, eps * ns)));
+      // orthonormality of the eigenvectors
+      const auto o1 = getOrthonormalityError(m.data() + 9 * i);
+      const auto o2 = getOrthonormalityError(m2v.data());
+      TFEL_TESTS_ASSERT((!std::isfinite(o2)) ||
+                        (o1 < std::max(10 * o2, eps)));
+    }
+  }  // end of test
+};
+
+TFEL_TESTS_GENERATE_PROXY(StensorBatchedEigenSolverTest,
+                          "StensorBatchedEigenSolverTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("StensorBatchedEigenSolverTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
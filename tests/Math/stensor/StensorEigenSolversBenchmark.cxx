@@ -0,0 +1,335 @@
+/*!
+ * \file   tests/Math/stensor/StensorEigenSolversBenchmark.cxx
+ * \brief  This file compares the accuracy and the throughput of the
+ * available eigen solvers, used tensor by tensor or on arrays of
+ * tensors, on stress states typical of mechanical computations.
+ *
+ * This program is not a test: it is only built on request
+ * (`make StensorEigenSolversBenchmark`). The number of tensors per
+ * stress state can be given as the first argument of the program.
+ *
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <array>
+#include <limits>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/Stensor/StensorBatchedEigenSolver.hxx"
+
+//! \brief number of tensors per stress state
+static std::size_t number_of_tensors = 1000;
+
+//! \brief a set of tensors with known eigenvalues
+struct StressStates {
+  //! \brief name
+  std::string name;
+  //! \brief values of the tensors
+  std::vector<double> values;
+  //! \brief sorted eigenvalues of the tensors
+  std::vector<double> eigenvalues;
+};
+
+//! \brief accuracy and throughput of an eigen solver
+struct EigenSolverStatistics {
+  //! \brief time per tensor needed to compute the eigenvalues (ns)
+  double eigenvalues_time = 0;
+  //! \brief time per tensor needed to compute the eigenvectors (ns)
+  double eigenvectors_time = 0;
+  //! \brief maximum error on the eigenvalues, relative to the norm
+  double eigenvalues_error = 0;
+  //! \brief maximum residual of the eigenvalue problem, relative to the
+  //! norm
+  double residual = 0;
+  //! \brief maximum deviation of the eigenvectors from an orthonormal
+  //! basis
+  double orthonormality_error = 0;
+};
+
+/*!
+ * \return tensors \f$R\,D\,R^{T}\f$ where \f$D\f$ is diagonal and
+ * \f$R\f$ is a random rotation
+ * \param[in] n: name of the stress states
+ * \param[in] d: generator of the eigenvalues
+ */
+template <typename EigenValuesGenerator>
+static StressStates generate(const std::string& n,
+                             const EigenValuesGenerator& d) {
+  constexpr auto cste = tfel::math::Cste<double>::sqrt2;
+  auto random_value = [] {
+    return 2 * static_cast<double>(std::rand()) / RAND_MAX - 1;
+  };
+  auto s = StressStates{n, {}, {}};
+  for (std::size_t i = 0; i != number_of_tensors; ++i) {
+    auto vp = d(random_value);
+    // random unit quaternion
+    auto q = std::array<double, 4>{};
+    auto nq = double{};
+    do {
+      for (auto& v : q) {
+        v = random_value();
+      }
+      nq = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+    } while ((nq < 0.1) || (nq > 1));
+    for (auto& v : q) {
+      v /= nq;
+    }
+    const auto [a, b, c, e] = q;
+    const double r[3][3] = {
+        {1 - 2 * (c * c + e * e), 2 * (b * c - a * e), 2 * (b * e + a * c)},
+        {2 * (b * c + a * e), 1 - 2 * (b * b + e * e), 2 * (c * e - a * b)},
+        {2 * (b * e - a * c), 2 * (c * e + a * b), 1 - 2 * (b * b + c * c)}};
+    auto m = [&r, &vp](const unsigned short k, const unsigned short l) {
+      auto v = 0.;
+      for (unsigned short j = 0; j != 3; ++j) {
+        v += r[k][j] * vp[j] * r[l][j];
+      }
+      return v;
+    };
+    s.values.insert(s.values.end(), {m(0, 0), m(1, 1), m(2, 2),
+                                     cste * m(0, 1), cste * m(0, 2),
+                                     cste * m(1, 2)});
+    std::sort(vp.begin(), vp.end());
+    s.eigenvalues.insert(s.eigenvalues.end(), vp.begin(), vp.end());
+  }
+  return s;
+}  // end of generate
+
+//! \return the stress states used by the benchmark
+static std::vector<StressStates> getStressStates() {
+  using EigenValues = std::array<double, 3>;
+  constexpr auto MPa = 1e6;
+  std::srand(1234);
+  auto states = std::vector<StressStates>{};
+  // general stress states
+  states.push_back(generate("general", [](const auto& r) {
+    return EigenValues{300 * MPa * r(), 300 * MPa * r(), 300 * MPa * r()};
+  }));
+  // uniaxial tension or compression: two null eigenvalues
+  states.push_back(generate("uniaxial", [](const auto& r) {
+    return EigenValues{500 * MPa * r(), 0, 0};
+  }));
+  // nearly equibiaxial stress states
+  states.push_back(generate("equibiaxial", [](const auto& r) {
+    const auto s = 200 * MPa * r();
+    return EigenValues{s, s * (1 + 1e-9 * r()), 10 * MPa * r()};
+  }));
+  // high hydrostatic pressure and small deviatoric stresses
+  states.push_back(generate("nearly hydrostatic", [](const auto& r) {
+    const auto p = -1000 * MPa;
+    return EigenValues{p + 1e-3 * MPa * r(), p + 1e-3 * MPa * r(),
+                       p + 1e-3 * MPa * r()};
+  }));
+  return states;
+}  // end of getStressStates
+
+/*!
+ * \brief compute the errors made by an eigen solver
+ * \param[out] r: statistics
+ * \param[in] s: stress states
+ * \param[in] vp: computed eigenvalues
+ * \param[in] vp2: computed eigenvalues (associated with the eigenvectors)
+ * \param[in] m: computed eigenvectors
+ */
+static void computeErrors(EigenSolverStatistics& r,
+                          const StressStates& s,
+                          const std::vector<double>& vp,
+                          const std::vector<double>& vp2,
+                          const std::vector<double>& m) {
+  constexpr auto icste = tfel::math::Cste<double>::isqrt2;
+  for (std::size_t i = 0; i != s.eigenvalues.size() / 3; ++i) {
+    const auto* const v = s.values.data() + 6 * i;
+    const auto* const mi = m.data() + 9 * i;
+    const double a[3][3] = {{v[0], v[3] * icste, v[4] * icste},
+                            {v[3] * icste, v[1], v[5] * icste},
+                            {v[4] * icste, v[5] * icste, v[2]}};
+    const auto* const e = s.eigenvalues.data() + 3 * i;
+    const auto ne = std::max(std::max(std::abs(e[0]), std::abs(e[1])),
+                             std::max(std::abs(e[2]), 1.));
+    auto svp = std::array<double, 3>{vp[3 * i], vp[3 * i + 1], vp[3 * i + 2]};
+    std::sort(svp.begin(), svp.end());
+    for (unsigned short k = 0; k != 3; ++k) {
+      r.eigenvalues_error =
+          std::max(r.eigenvalues_error, std::abs(svp[k] - e[k]) / ne);
+    }
+    for (unsigned short c = 0; c != 3; ++c) {
+      for (unsigned short k = 0; k != 3; ++k) {
+        auto rv = -vp2[3 * i + c] * mi[3 * k + c];
+        for (unsigned short j = 0; j != 3; ++j) {
+          rv += a[k][j] * mi[3 * j + c];
+        }
+        r.residual = std::max(r.residual, std::abs(rv) / ne);
+      }
+      for (unsigned short c2 = 0; c2 != 3; ++c2) {
+        auto d = (c == c2) ? -1. : 0.;
+        for (unsigned short k = 0; k != 3; ++k) {
+          d += mi[3 * k + c] * mi[3 * k + c2];
+        }
+        r.orthonormality_error = std::max(r.orthonormality_error, std::abs(d));
+      }
+    }
+  }
+}  // end of computeErrors
+
+/*!
+ * \return the time, in nanoseconds, per tensor needed to execute the
+ * given function. The function is called several times and the
+ * minimum time is returned.
+ * \param[in] f: function
+ * \param[in] n: number of tensors
+ */
+template <typename Function>
+static double measure(const Function& f, const std::size_t n) {
+  auto t = std::numeric_limits<double>::max();
+  for (unsigned short i = 0; i != 3; ++i) {
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const auto end = std::chrono::steady_clock::now();
+    t = std::min(t, std::chrono::duration<double, std::nano>(end - start).count());
+  }
+  return t / n;
+}  // end of measure
+
+struct StensorEigenSolversBenchmark {
+  //! a simple alias
+  using EigenSolver = tfel::math::stensor_common::EigenSolver;
+  //! \brief run the benchmark on all the stress states
+  void execute() const {
+    for (const auto& s : getStressStates()) {
+      std::cout << "\n- stress states: " << s.name << " ("
+                << s.eigenvalues.size() / 3 << " tensors)\n\n"
+                << std::setw(28) << std::left << "solver" << std::setw(9)
+                << "mode" << std::right << std::setw(12) << "values(ns)"
+                << std::setw(12) << "vectors(ns)" << std::setw(13)
+                << "value error" << std::setw(13) << "residual"
+                << std::setw(13) << "orth. error" << '\n';
+      this->check<EigenSolver::TFELEIGENSOLVER>("TFELEIGENSOLVER", s);
+      this->check<EigenSolver::FSESANALYTICALEIGENSOLVER>(
+          "FSESANALYTICALEIGENSOLVER", s);
+      this->check<EigenSolver::FSESJACOBIEIGENSOLVER>("FSESJACOBIEIGENSOLVER",
+                                                      s);
+      this->check<EigenSolver::FSESQLEIGENSOLVER>("FSESQLEIGENSOLVER", s);
+      this->check<EigenSolver::FSESCUPPENEIGENSOLVER>("FSESCUPPENEIGENSOLVER",
+                                                      s);
+      this->check<EigenSolver::FSESHYBRIDEIGENSOLVER>("FSESHYBRIDEIGENSOLVER",
+                                                      s);
+      this->check<EigenSolver::GTESYMMETRICQREIGENSOLVER>(
+          "GTESYMMETRICQREIGENSOLVER", s);
+    }
+  }  // end of execute
+
+ private:
+  /*!
+   * \brief compare the scalar and batched versions of an eigen solver
+   * \param[in] n: name of the eigen solver
+   * \param[in] s: stress states
+   */
+  template <EigenSolver es>
+  void check(const std::string& n, const StressStates& s) const {
+    print(n, "scalar", this->scalar<es>(s));
+    print(n, "batched", this->batched<es>(s));
+  }  // end of check
+  //! \return the statistics of the scalar version of an eigen solver
+  template <EigenSolver es>
+  EigenSolverStatistics scalar(const StressStates& s) const {
+    const auto n = s.eigenvalues.size() / 3;
+    auto vp = std::vector<double>(3 * n);
+    auto vp2 = std::vector<double>(3 * n);
+    auto m = std::vector<double>(9 * n);
+    auto r = EigenSolverStatistics{};
+    r.eigenvalues_time = measure(
+        [&s, &vp, n] {
+          auto t = tfel::math::stensor<3u, double>{};
+          for (std::size_t i = 0; i != n; ++i) {
+            std::copy(s.values.begin() + 6 * i,
+                      s.values.begin() + 6 * (i + 1), t.begin());
+            t.template computeEigenValues<es>(vp[3 * i], vp[3 * i + 1],
+                                              vp[3 * i + 2]);
+          }
+        },
+        n);
+    r.eigenvectors_time = measure(
+        [&s, &vp2, &m, n] {
+          auto t = tfel::math::stensor<3u, double>{};
+          auto e = tfel::math::tvector<3u, double>{};
+          auto q = tfel::math::tmatrix<3u, 3u, double>{};
+          for (std::size_t i = 0; i != n; ++i) {
+            std::copy(s.values.begin() + 6 * i,
+                      s.values.begin() + 6 * (i + 1), t.begin());
+            t.template computeEigenVectors<es>(e, q);
+            for (unsigned short k = 0; k != 3; ++k) {
+              vp2[3 * i + k] = e(k);
+              for (unsigned short l = 0; l != 3; ++l) {
+                m[9 * i + 3 * k + l] = q(k, l);
+              }
+            }
+          }
+        },
+        n);
+    computeErrors(r, s, vp, vp2, m);
+    return r;
+  }  // end of scalar
+  //! \return the statistics of the batched version of an eigen solver
+  template <EigenSolver es>
+  EigenSolverStatistics batched(const StressStates& s) const {
+    const auto n = s.eigenvalues.size() / 3;
+    auto vp = std::vector<double>(3 * n);
+    auto vp2 = std::vector<double>(3 * n);
+    auto m = std::vector<double>(9 * n);
+    auto r = EigenSolverStatistics{};
+    r.eigenvalues_time = measure(
+        [&s, &vp, n] {
+          tfel::math::computeBatchedEigenValues<es>(vp.data(), s.values.data(),
+                                                    n);
+        },
+        n);
+    r.eigenvectors_time = measure(
+        [&s, &vp2, &m, n] {
+          tfel::math::computeBatchedEigenVectors<es>(vp2.data(), m.data(),
+                                                     s.values.data(), n);
+        },
+        n);
+    computeErrors(r, s, vp, vp2, m);
+    return r;
+  }  // end of batched
+  //! \brief print the statistics of an eigen solver
+  static void print(const std::string& n,
+                    const std::string& mode,
+                    const EigenSolverStatistics& r) {
+    std::cout << std::setw(28) << std::left << n << std::setw(9) << mode
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << r.eigenvalues_time << std::setw(12)
+              << r.eigenvectors_time << std::scientific
+              << std::setprecision(2) << std::setw(13) << r.eigenvalues_error
+              << std::setw(13) << r.residual << std::setw(13)
+              << r.orthonormality_error << '\n'
+              << std::defaultfloat;
+  }  // end of print
+};
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main(const int argc, const char* const* const argv) {
+  if (argc > 2) {
+    std::cerr << "usage: " << argv[0] << " [number_of_tensors]\n";
+    return EXIT_FAILURE;
+  }
+  if (argc == 2) {
+    number_of_tensors = static_cast<std::size_t>(std::stoul(argv[1]));
+  }
+  StensorEigenSolversBenchmark{}.execute();
+  return EXIT_SUCCESS;
+}  // end of main
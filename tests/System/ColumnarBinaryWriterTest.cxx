@@ -0,0 +1,218 @@
+/*!
+ * \file   tests/System/ColumnarBinaryWriterTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ColumnarBinaryWriter.hxx"
+#include "TFEL/Utilities/ColumnarBinaryData.hxx"
+#include "TFEL/Utilities/TextData.hxx"
+
+struct ColumnarBinaryWriterTest final : public tfel::tests::TestCase {
+  ColumnarBinaryWriterTest()
+      : tfel::tests::TestCase("TFEL/System", "ColumnarBinaryWriterTest") {
+  }  // end of ColumnarBinaryWriterTest
+  tfel::tests::TestResult execute() override {
+    this->write();
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    this->test5();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief number of rows written, which is not a multiple of the block size
+  static constexpr std::size_t nrows = 2500;
+  //! \return the value of the given row and column
+  static double getValue(const std::size_t r, const std::size_t c) {
+    return std::sin(static_cast<double>(r) + 0.1 * static_cast<double>(c));
+  }
+  //! \return if two values are exactly the same
+  static bool areEqual(const double a, const double b) {
+    return std::memcmp(&a, &b, sizeof(double)) == 0;
+  }
+  //! \brief write the test file
+  void write() {
+    using tfel::system::ColumnarBinaryWriter;
+    auto w = ColumnarBinaryWriter("ColumnarBinaryWriterTest.bin",
+                                  {"t", "first value", "v2"}, 1000);
+    TFEL_TESTS_ASSERT(w.getNumberOfColumns() == 3);
+    for (std::size_t r = 0; r != nrows; ++r) {
+      w.write({getValue(r, 0), getValue(r, 1), getValue(r, 2)});
+      if (r == 10) {
+        w.flush();
+      }
+    }
+    TFEL_TESTS_CHECK_THROW(w.write(std::vector<double>{1, 2}),
+                           std::runtime_error);
+  }  // end of write
+  //! \brief read the file with the `ColumnarBinaryData` class
+  void test1() {
+    using tfel::utilities::ColumnarBinaryData;
+    const auto f = std::string{"ColumnarBinaryWriterTest.bin"};
+    TFEL_TESTS_ASSERT(ColumnarBinaryData::isColumnarBinaryFile(f));
+    const auto d = ColumnarBinaryData(f);
+    TFEL_TESTS_ASSERT(d.getNumberOfColumns() == 3);
+    TFEL_TESTS_ASSERT(d.getNumberOfRows() == nrows);
+    TFEL_TESTS_ASSERT(d.getLegend(2) == "first value");
+    TFEL_TESTS_ASSERT(d.findColumn("v2") == 3);
+    TFEL_TESTS_CHECK_THROW(d.findColumn("v3"), std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(d.getColumn(0), std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(d.getColumn(4), std::runtime_error);
+    for (std::size_t c = 0; c != 3; ++c) {
+      const auto v = d.getColumn(c + 1);
+      TFEL_TESTS_ASSERT(v.size() == nrows);
+      auto ok = true;
+      for (std::size_t r = 0; r != v.size(); ++r) {
+        ok = ok && areEqual(v[r], getValue(r, c));
+      }
+      TFEL_TESTS_ASSERT(ok);
+    }
+  }  // end of test1
+  //! \brief read the file with the `TextData` class
+  void test2() {
+    using tfel::utilities::TextData;
+    auto d = TextData("ColumnarBinaryWriterTest.bin");
+    TFEL_TESTS_ASSERT(d.getLegends().size() == 3);
+    TFEL_TESTS_ASSERT(d.findColumn("first value") == 2);
+    TFEL_TESTS_ASSERT(d.getColumn(1).size() == nrows);
+    d.skipLines(10);
+    const auto v = d.getColumn(2);
+    TFEL_TESTS_ASSERT(v.size() == nrows - 10);
+    if (!v.empty()) {
+      TFEL_TESTS_ASSERT(areEqual(v[0], getValue(10, 1)));
+    }
+    // tokens built on demand
+    const auto nlines = static_cast<std::size_t>(d.end() - d.begin());
+    TFEL_TESTS_ASSERT(nlines == nrows - 10);
+    if (nlines != 0) {
+      const auto& tokens = d.begin()->tokens;
+      TFEL_TESTS_ASSERT(tokens.size() == 3);
+      if (tokens.size() == 3) {
+        TFEL_TESTS_ASSERT(
+            areEqual(std::stod(tokens[2].value), getValue(10, 2)));
+      }
+    }
+  }  // end of test2
+  //! \brief invalid files
+  void test3() {
+    using tfel::utilities::ColumnarBinaryData;
+    // truncated file
+    {
+      std::ifstream in("ColumnarBinaryWriterTest.bin", std::ios::binary);
+      std::ofstream out("ColumnarBinaryWriterTest2.bin", std::ios::binary);
+      auto b = std::vector<char>(100);
+      in.read(b.data(), static_cast<std::streamsize>(b.size()));
+      out.write(b.data(), static_cast<std::streamsize>(b.size()));
+    }
+    TFEL_TESTS_ASSERT(
+        ColumnarBinaryData::isColumnarBinaryFile("ColumnarBinaryWriterTest2.bin"));
+    TFEL_TESTS_CHECK_THROW(ColumnarBinaryData("ColumnarBinaryWriterTest2.bin"),
+                           std::runtime_error);
+    // text file
+    {
+      std::ofstream out("ColumnarBinaryWriterTest3.txt");
+      out << "# t v\n0 1\n";
+    }
+    TFEL_TESTS_ASSERT(
+        !ColumnarBinaryData::isColumnarBinaryFile("ColumnarBinaryWriterTest3.txt"));
+    TFEL_TESTS_CHECK_THROW(ColumnarBinaryData("ColumnarBinaryWriterTest3.txt"),
+                           std::runtime_error);
+  }  // end of test3
+  //! \brief column views
+  void test4() {
+    using tfel::utilities::ColumnarBinaryData;
+    const auto d = ColumnarBinaryData("ColumnarBinaryWriterTest.bin");
+    for (std::size_t c = 0; c != 3; ++c) {
+      const auto v = d.getColumnView(c + 1);
+      TFEL_TESTS_ASSERT(v.size() == nrows);
+      // blocks of 11, 1000, 1000 and 489 rows
+      TFEL_TESTS_ASSERT(v.segments.size() == 4);
+      auto ok = true;
+      for (const auto& s : v.segments) {
+        // values are used in place
+        ok = ok && (reinterpret_cast<std::uintptr_t>(s.values) %
+                        alignof(double) ==
+                    0);
+      }
+      for (std::size_t r = 0; r != v.size(); ++r) {
+        ok = ok && areEqual(v[r], getValue(r, c));
+      }
+      TFEL_TESTS_ASSERT(ok);
+    }
+    TFEL_TESTS_CHECK_THROW(d.getColumnView(4), std::runtime_error);
+  }  // end of test4
+  //! \brief files using the first version of the format, which are not
+  //! aligned
+  void test5() {
+    using tfel::utilities::ColumnarBinaryData;
+    {
+      std::ofstream out("ColumnarBinaryWriterTest4.bin", std::ios::binary);
+      auto write = [&out](const auto& v) {
+        out.write(reinterpret_cast<const char*>(&v), sizeof(v));
+      };
+      out.write("TFELCBF", 8);
+      write(std::uint32_t{1});
+      write(std::uint32_t{0x01020304});
+      write(std::uint64_t{2});
+      write(std::uint64_t{1});
+      out.write("t", 1);
+      write(std::uint64_t{2});
+      out.write("v1", 2);
+      for (std::size_t b = 0; b != 2; ++b) {
+        write(std::uint64_t{2});
+        for (std::size_t c = 0; c != 2; ++c) {
+          write(getValue(2 * b, c));
+          write(getValue(2 * b + 1, c));
+        }
+      }
+    }
+    const auto d = ColumnarBinaryData("ColumnarBinaryWriterTest4.bin");
+    TFEL_TESTS_ASSERT(d.getNumberOfRows() == 4);
+    TFEL_TESTS_ASSERT(d.getLegend(2) == "v1");
+    for (std::size_t c = 0; c != 2; ++c) {
+      const auto v = d.getColumn(c + 1);
+      TFEL_TESTS_ASSERT(v.size() == 4);
+      auto ok = true;
+      for (std::size_t r = 0; r != v.size(); ++r) {
+        ok = ok && areEqual(v[r], getValue(r, c));
+      }
+      TFEL_TESTS_ASSERT(ok);
+    }
+  }  // end of test5
+};
+
+TFEL_TESTS_GENERATE_PROXY(ColumnarBinaryWriterTest, "ColumnarBinaryWriterTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("ColumnarBinaryWriterTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
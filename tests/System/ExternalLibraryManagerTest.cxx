@@ -0,0 +1,139 @@
+/*!
+ * \file   ExternalLibraryManagerTest.cxx
+ * \brief  tests of the caches of the ExternalLibraryManager class
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <string>
+#include <cstdlib>
+#include <stdexcept>
+#include <iostream>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+#include "TFEL/System/ExternalBehaviourDescription.hxx"
+
+//! \brief path to the library defining `ExternalLibraryManagerTest_counter`
+static std::string library;
+//! \brief path to a library containing the `Elasticity` behaviour
+static std::string behaviours;
+
+struct ExternalLibraryManagerTest final : public tfel::tests::TestCase {
+  ExternalLibraryManagerTest()
+      : tfel::tests::TestCase("TFEL/System", "ExternalLibraryManagerTest") {
+  }  // end of ExternalLibraryManagerTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief name of the symbol defined by the test library
+  static constexpr const char* counter = "ExternalLibraryManagerTest_counter";
+  //! \brief resolved and undefined symbols are cached
+  void test1() {
+    auto& elm =
+        tfel::system::ExternalLibraryManager::getExternalLibraryManager();
+    const auto lib = elm.loadLibrary(library);
+    TFEL_TESTS_ASSERT(lib != nullptr);
+    const auto p = elm.getSymbolAddress(lib, counter);
+    TFEL_TESTS_ASSERT(p != nullptr);
+    TFEL_TESTS_ASSERT(elm.getSymbolAddress(lib, counter) == p);
+    TFEL_TESTS_ASSERT(elm.contains(library, counter));
+    for (int i = 0; i != 2; ++i) {
+      TFEL_TESTS_ASSERT(elm.getSymbolAddress(lib, "undefined") == nullptr);
+      TFEL_TESTS_ASSERT(!elm.contains(library, "undefined"));
+    }
+    // the error reported by the system is still available when the
+    // undefined symbol is retrieved from the cache
+    for (int i = 0; i != 2; ++i) {
+      auto msg = std::string{};
+      try {
+        elm.getInterface(library, "undefined");
+      } catch (std::exception& e) {
+        msg = e.what();
+      }
+      TFEL_TESTS_ASSERT(!msg.empty());
+      TFEL_TESTS_ASSERT(msg.find("' ()") == std::string::npos);
+    }
+  }  // end of test1
+  //! \brief reloading a library drops the symbols resolved in it
+  void test2() {
+    auto& elm =
+        tfel::system::ExternalLibraryManager::getExternalLibraryManager();
+    auto* c = static_cast<int*>(
+        elm.getSymbolAddress(elm.loadLibrary(library), counter));
+    TFEL_TESTS_ASSERT(c != nullptr);
+    *c = 3;
+    TFEL_TESTS_ASSERT(*static_cast<int*>(elm.getSymbolAddress(
+                          elm.loadLibrary(library), counter)) == 3);
+    elm.reloadLibrary(library);
+    // the value is read through a freshly resolved symbol, which is
+    // initialised again by the new instance of the library
+    c = static_cast<int*>(
+        elm.getSymbolAddress(elm.loadLibrary(library), counter));
+    TFEL_TESTS_ASSERT(c != nullptr);
+    TFEL_TESTS_ASSERT(*c == 0);
+  }  // end of test2
+  //! \brief descriptions of behaviours are shared until the library is
+  //! reloaded
+  void test3() {
+    if (behaviours.empty()) {
+      return;
+    }
+    auto& elm =
+        tfel::system::ExternalLibraryManager::getExternalLibraryManager();
+    const auto d1 = elm.getExternalBehaviourDescription(
+        behaviours, "Elasticity", "Tridimensional");
+    TFEL_TESTS_ASSERT(d1 != nullptr);
+    TFEL_TESTS_ASSERT(d1->behaviour == "Elasticity");
+    TFEL_TESTS_ASSERT(d1->hypothesis == "Tridimensional");
+    TFEL_TESTS_ASSERT(elm.getExternalBehaviourDescription(
+                          behaviours, "Elasticity", "Tridimensional") == d1);
+    const auto d2 = elm.getExternalBehaviourDescription(
+        behaviours, "Elasticity", "PlaneStrain");
+    TFEL_TESTS_ASSERT(d2 != d1);
+    TFEL_TESTS_ASSERT(d2->hypothesis == "PlaneStrain");
+    elm.reloadLibrary(behaviours);
+    const auto d3 = elm.getExternalBehaviourDescription(
+        behaviours, "Elasticity", "Tridimensional");
+    TFEL_TESTS_ASSERT(d3 != d1);
+    TFEL_TESTS_ASSERT(d3->mpnames == d1->mpnames);
+    TFEL_TESTS_CHECK_THROW(elm.getExternalBehaviourDescription(
+                               behaviours, "Elasticity", "Undefined"),
+                           std::exception);
+  }  // end of test3
+};
+
+TFEL_TESTS_GENERATE_PROXY(ExternalLibraryManagerTest,
+                          "ExternalLibraryManagerTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main(const int argc, const char* const* const argv) {
+  if ((argc != 2) && (argc != 3)) {
+    std::cerr << "usage: " << argv[0] << " library [behaviours]\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  if (argc == 3) {
+    behaviours = argv[2];
+  }
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("ExternalLibraryManagerTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
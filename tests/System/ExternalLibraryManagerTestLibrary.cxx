@@ -0,0 +1,21 @@
+/*!
+ * \file   ExternalLibraryManagerTestLibrary.cxx
+ * \brief  library loaded by the ExternalLibraryManagerTest test
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include "TFEL/Config/TFELConfig.hxx"
+
+extern "C" {
+
+//! \brief a variable whose value is reset when the library is reloaded
+TFEL_VISIBILITY_EXPORT int ExternalLibraryManagerTest_counter = 0;
+
+}  // end of extern "C"
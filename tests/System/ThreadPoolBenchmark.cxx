@@ -0,0 +1,177 @@
+/*!
+ * \file   tests/System/ThreadPoolBenchmark.cxx
+ * \brief  This file compares the `ThreadPool` class to the single queue
+ * pool used by previous versions of `TFEL` on fine-grained tasks.
+ *
+ * This program is not a test: it is only built on request
+ * (`make ThreadPoolBenchmark`). The number of tasks and the number of
+ * threads can be given as the first and second arguments of the program.
+ *
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <queue>
+#include <mutex>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <thread>
+#include <future>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include <functional>
+#include <condition_variable>
+#include "TFEL/System/ThreadPool.hxx"
+
+//! \brief number of tasks
+static int number_of_tasks = 100000;
+//! \brief number of threads
+static std::size_t number_of_threads =
+    std::max(std::thread::hardware_concurrency(), 2u);
+
+/*!
+ * \brief a thread pool based on a single queue of packaged tasks, as
+ * implemented by the `ThreadPool` class of previous versions of `TFEL`. This
+ * class is only used as a reference.
+ */
+struct LegacyThreadPool {
+  LegacyThreadPool(const std::size_t n) {
+    for (std::size_t i = 0; i != n; ++i) {
+      this->workers.emplace_back([this] {
+        for (;;) {
+          auto t = std::function<void()>{};
+          {
+            std::unique_lock<std::mutex> lock(this->m);
+            this->c.wait(lock,
+                         [this] { return this->stop || !this->tasks.empty(); });
+            if (this->stop && this->tasks.empty()) {
+              return;
+            }
+            t = std::move(this->tasks.front());
+            this->tasks.pop();
+          }
+          t();
+        }
+      });
+    }
+  }
+  template <typename F>
+  std::future<void> addTask(F&& f) {
+    auto t = std::make_shared<std::packaged_task<void()>>(std::forward<F>(f));
+    auto r = t->get_future();
+    {
+      std::lock_guard<std::mutex> lock(this->m);
+      this->tasks.push([t] { (*t)(); });
+    }
+    this->c.notify_one();
+    return r;
+  }
+  ~LegacyThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(this->m);
+      this->stop = true;
+    }
+    this->c.notify_all();
+    for (auto& w : this->workers) {
+      w.join();
+    }
+  }
+
+ private:
+  std::vector<std::thread> workers;
+  std::queue<std::function<void()>> tasks;
+  std::mutex m;
+  std::condition_variable c;
+  bool stop = false;
+};  // end of struct LegacyThreadPool
+
+//! \brief elementary work
+static double work(const int i) {
+  return std::sin(static_cast<double>(i)) * std::cos(static_cast<double>(i));
+}  // end of work
+
+/*!
+ * \return the time spent in the given function (s)
+ * \param[in] f: function
+ */
+template <typename F>
+static double measure(F&& f) {
+  using clock = std::chrono::steady_clock;
+  const auto t = clock::now();
+  f();
+  return std::chrono::duration<double>(clock::now() - t).count();
+}  // end of measure
+
+/*!
+ * \brief check the results against the sequential computation
+ * \param[in] n: name of the pool
+ * \param[in] r: results
+ */
+static void check(const char* const n, const std::vector<double>& r) {
+  for (int i = 0; i != number_of_tasks; ++i) {
+    if (std::abs(r[i] - work(i)) > 0) {
+      std::cerr << "ThreadPoolBenchmark: invalid results for " << n << '\n';
+      std::exit(EXIT_FAILURE);
+    }
+  }
+}  // end of check
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main(const int argc, const char* const* const argv) {
+  if (argc > 3) {
+    std::cerr << "usage: " << argv[0]
+              << " [number_of_tasks] [number_of_threads]\n";
+    return EXIT_FAILURE;
+  }
+  if (argc >= 2) {
+    number_of_tasks = std::stoi(argv[1]);
+  }
+  if (argc == 3) {
+    number_of_threads = static_cast<std::size_t>(std::stoul(argv[2]));
+  }
+  auto results = std::vector<double>(number_of_tasks);
+  const auto t_legacy = measure([&results] {
+    LegacyThreadPool p(number_of_threads);
+    auto futures = std::vector<std::future<void>>{};
+    futures.reserve(number_of_tasks);
+    for (int i = 0; i != number_of_tasks; ++i) {
+      futures.push_back(
+          p.addTask([&results, i]() noexcept { results[i] = work(i); }));
+    }
+    for (auto& f : futures) {
+      f.get();
+    }
+  });
+  check("the legacy thread pool", results);
+  std::fill(results.begin(), results.end(), 0);
+  tfel::system::ThreadPool p(number_of_threads);
+  const auto t_tasks = measure([&p, &results] {
+    for (int i = 0; i != number_of_tasks; ++i) {
+      p.addTask([&results, i]() noexcept { results[i] = work(i); });
+    }
+    p.wait();
+  });
+  check("ThreadPool::addTask", results);
+  std::fill(results.begin(), results.end(), 0);
+  const auto t_parallel_for = measure([&p, &results] {
+    p.parallel_for(0, number_of_tasks, 256,
+                   [&results](const int i) { results[i] = work(i); });
+  });
+  check("ThreadPool::parallel_for", results);
+  std::cout << "ThreadPoolBenchmark: " << number_of_tasks << " tasks on "
+            << number_of_threads << " threads\n"
+            << "- legacy thread pool:       " << t_legacy << "s\n"
+            << "- ThreadPool::addTask:      " << t_tasks << "s\n"
+            << "- ThreadPool::parallel_for: " << t_parallel_for << "s\n";
+  return EXIT_SUCCESS;
+}  // end of main
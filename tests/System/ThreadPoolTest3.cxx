@@ -0,0 +1,168 @@
+/*!
+ * \file   ThreadPoolTest3.cxx
+ * \brief  This file tests the `parallel_for` method of the `ThreadPool`
+ * class (results, exceptions, nested loops, pinning options) and the
+ * results of fine-grained tasks. Timings are reported by the
+ * `ThreadPoolBenchmark` program.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cmath>
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include <thread>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ThreadPool.hxx"
+
+struct ThreadPoolTest3 final : public tfel::tests::TestCase {
+  ThreadPoolTest3()
+      : tfel::tests::TestCase("TFEL/System", "ThreadPoolTest3") {
+  }  // end of ThreadPoolTest3
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    this->test5();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief elementary work used in the tests
+  static double work(const int i) {
+    return std::sin(static_cast<double>(i)) * std::cos(static_cast<double>(i));
+  }
+  //! \return the expected sum of elementary works
+  static double reference(const int n) {
+    auto r = double{0};
+    for (int i = 0; i != n; ++i) {
+      r += work(i);
+    }
+    return r;
+  }
+  void test1() {
+    // per index and per block loops
+    constexpr auto n = 10000;
+    for (const auto nthreads : {0, 1, 2, 4}) {
+      tfel::system::ThreadPool p(nthreads);
+      auto v = std::vector<int>(n, 0);
+      p.parallel_for(0, n, 7, [&v](const int i) { v[i] += 1; });
+      auto ok = true;
+      for (const auto& vi : v) {
+        ok = ok && (vi == 1);
+      }
+      TFEL_TESTS_ASSERT(ok);
+      std::atomic<long> s(0);
+      p.parallel_for(0, n, 100, [&s](const int b, const int e) {
+        auto ls = long{0};
+        for (int i = b; i != e; ++i) {
+          ls += i;
+        }
+        s += ls;
+      });
+      TFEL_TESTS_ASSERT(s == static_cast<long>(n) * (n - 1) / 2);
+      // empty range and null grain size
+      p.parallel_for(4, 4, 1, [&v](const int i) { v[i] = -1; });
+      p.parallel_for(4, 2, 1, [&v](const int i) { v[i] = -1; });
+      p.parallel_for(0, 3, 0, [&v](const int i) { v[i] = 2; });
+      TFEL_TESTS_ASSERT(v[0] == 2 && v[2] == 2 && v[3] == 1 && v[4] == 1);
+    }
+  }  // end of test1
+  void test2() {
+    // exceptions are propagated to the caller
+    tfel::system::ThreadPool p(2);
+    TFEL_TESTS_CHECK_THROW(p.parallel_for(0, 1000, 1,
+                                          [](const int i) {
+                                            if (i == 517) {
+                                              throw(std::runtime_error("517"));
+                                            }
+                                          }),
+                           std::runtime_error);
+    // the pool is still usable
+    std::atomic<int> c(0);
+    p.parallel_for(0, 100, 3, [&c](const int) { ++c; });
+    TFEL_TESTS_ASSERT(c == 100);
+  }  // end of test2
+  void test3() {
+    // nested loops and loops called from tasks
+    tfel::system::ThreadPool p(2);
+    std::atomic<int> c(0);
+    p.parallel_for(0, 10, 1, [&p, &c](const int) {
+      p.parallel_for(0, 10, 1, [&c](const int) { ++c; });
+    });
+    TFEL_TESTS_ASSERT(c == 100);
+    auto task = [&p, &c] {
+      p.parallel_for(0, 25, 2, [&c](const int) { ++c; });
+    };
+    auto r = std::vector<decltype(p.addTask(task))>{};
+    for (int i = 0; i != 4; ++i) {
+      r.push_back(p.addTask(task));
+    }
+    for (auto& ri : r) {
+      TFEL_TESTS_ASSERT(static_cast<bool>(ri.get()));
+    }
+    TFEL_TESTS_ASSERT(c == 200);
+    p.wait();
+  }  // end of test3
+  void test4() {
+    // pinning options
+    using tfel::system::ThreadPool;
+    std::atomic<int> c(0);
+    ThreadPool p(3, ThreadPool::PIN_TO_PROCESSORS);
+    TFEL_TESTS_ASSERT(p.getNumberOfThreads() == 3);
+    p.parallel_for(0, 100, 1, [&c](const int) { ++c; });
+    ThreadPool p2(std::vector<ThreadPool::size_type>{0, 0});
+    TFEL_TESTS_ASSERT(p2.getNumberOfThreads() == 2);
+    p2.parallel_for(0, 100, 1, [&c](const int) { ++c; });
+    TFEL_TESTS_ASSERT(c == 200);
+  }  // end of test4
+  void test5() {
+    // fine-grained tasks
+    constexpr auto n = 100000;
+    const auto nthreads = std::max(std::thread::hardware_concurrency(), 2u);
+    const auto r = reference(n);
+    auto results = std::vector<double>(n);
+    auto check = [&results, r] {
+      auto s = double{0};
+      for (const auto& v : results) {
+        s += v;
+      }
+      return std::abs(s - r) < 1e-8 * std::max(1., std::abs(r));
+    };
+    tfel::system::ThreadPool p(nthreads);
+    for (int i = 0; i != n; ++i) {
+      p.addTask([&results, i] { results[i] = work(i); });
+    }
+    p.wait();
+    TFEL_TESTS_ASSERT(check());
+    std::fill(results.begin(), results.end(), 0);
+    p.parallel_for(0, n, 256, [&results](const int i) { results[i] = work(i); });
+    TFEL_TESTS_ASSERT(check());
+  }  // end of test5
+};
+
+TFEL_TESTS_GENERATE_PROXY(ThreadPoolTest3, "ThreadPoolTest3");
+
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("ThreadPoolTest3.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
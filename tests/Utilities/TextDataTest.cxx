@@ -0,0 +1,158 @@
+/*!
+ * \file   tests/Utilities/TextDataTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cmath>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <iostream>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Utilities/TextData.hxx"
+
+struct TextDataTest final : public tfel::tests::TestCase {
+  TextDataTest() : tfel::tests::TestCase("TFEL/Utilities", "TextDataTest") {}
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    this->test5();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief write a file
+  static void write(const std::string& f, const std::string& c) {
+    std::ofstream out(f);
+    out << c;
+  }  // end of write
+  //! \brief compare two arrays of values
+  bool check(const std::vector<double>& v, const std::vector<double>& v2) {
+    if (v.size() != v2.size()) {
+      return false;
+    }
+    for (std::vector<double>::size_type i = 0; i != v.size(); ++i) {
+      if (std::abs(v[i] - v2[i]) > 1e-14 * std::max(1., std::abs(v2[i]))) {
+        return false;
+      }
+    }
+    return true;
+  }  // end of check
+  void test1() {
+    // numeric data, legends and preamble
+    using namespace tfel::utilities;
+    write("TextDataTest-1.txt",
+          "# time \"a b\" c\n"
+          "# second comment\n"
+          "0 -1.5e-3 2\n"
+          "\n"
+          "1 2.5E+2\t.5\r\n"
+          "# comment\n"
+          "2 -3 1e3");
+    const auto d = TextData("TextDataTest-1.txt");
+    TFEL_TESTS_ASSERT(d.getLegends() ==
+                      std::vector<std::string>({"time", "a b", "c"}));
+    TFEL_TESTS_ASSERT(d.getPreamble().size() == 2);
+    TFEL_TESTS_ASSERT(d.getPreamble()[1] == " second comment");
+    TFEL_TESTS_ASSERT(d.findColumn("a b") == 2);
+    TFEL_TESTS_ASSERT(check(d.getColumn(1), {0, 1, 2}));
+    TFEL_TESTS_ASSERT(check(d.getColumn(2), {-1.5e-3, 250, -3}));
+    TFEL_TESTS_ASSERT(check(d.getColumn(3), {2, 0.5, 1000}));
+    TFEL_TESTS_CHECK_THROW(d.getColumn(0), std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(d.getColumn(4), std::runtime_error);
+    // tokens are built on demand
+    const auto lines = std::vector<TextData::Line>(d.begin(), d.end());
+    TFEL_TESTS_ASSERT(lines.size() == 3);
+    TFEL_TESTS_ASSERT(lines[1].tokens.size() == 3);
+    TFEL_TESTS_ASSERT(lines[1].tokens[1].value == "2.5E+2");
+    TFEL_TESTS_ASSERT(lines[1].tokens[1].line == 4);
+  }  // end of test1
+  void test2() {
+    // the gnuplot format
+    using namespace tfel::utilities;
+    write("TextDataTest-2.txt", "x y\n1 2\n# c\n3 4\n");
+    const auto d = TextData("TextDataTest-2.txt", "gnuplot");
+    TFEL_TESTS_ASSERT(d.getLegends() == std::vector<std::string>({"x", "y"}));
+    TFEL_TESTS_ASSERT(check(d.getColumn(2), {2, 4}));
+    write("TextDataTest-3.txt", "1 2\n3 4\n");
+    const auto d2 = TextData("TextDataTest-3.txt", "gnuplot");
+    TFEL_TESTS_ASSERT(d2.getLegends().empty());
+    TFEL_TESTS_ASSERT(check(d2.getColumn(1), {1, 3}));
+  }  // end of test2
+  void test3() {
+    // data that are not read by the fast numeric path
+    using namespace tfel::utilities;
+    write("TextDataTest-4.txt", "1 2\n3 +4\n5 6\n");
+    const auto d = TextData("TextDataTest-4.txt");
+    TFEL_TESTS_ASSERT(check(d.getColumn(2), {2, 4, 6}));
+    write("TextDataTest-5.txt", "1 2 3\n3 4\n");
+    const auto d2 = TextData("TextDataTest-5.txt");
+    TFEL_TESTS_ASSERT(check(d2.getColumn(2), {2, 4}));
+    TFEL_TESTS_CHECK_THROW(d2.getColumn(3), std::runtime_error);
+    write("TextDataTest-6.txt", "1 2\n3 nan\n");
+    const auto d3 = TextData("TextDataTest-6.txt");
+    TFEL_TESTS_ASSERT(check(d3.getColumn(1), {1, 3}));
+    TFEL_TESTS_ASSERT(std::isnan(d3.getColumn(2)[1]));
+  }  // end of test3
+  void test4() {
+    // skipping lines
+    using namespace tfel::utilities;
+    write("TextDataTest-7.txt", "# a b\n1 2\n3 4\n5 6\n");
+    auto d = TextData("TextDataTest-7.txt");
+    d.skipLines(1);
+    TFEL_TESTS_ASSERT(check(d.getColumn(1), {3, 5}));
+    TFEL_TESTS_ASSERT(check(d.getColumn(2), {4, 6}));
+    TFEL_TESTS_ASSERT(std::distance(d.begin(), d.end()) == 2);
+    d.skipLines(10);
+    TFEL_TESTS_ASSERT(d.getColumn(1).empty());
+    TFEL_TESTS_ASSERT(d.begin() == d.end());
+  }  // end of test4
+  void test5() {
+    // a larger file
+    using namespace tfel::utilities;
+    constexpr auto n = 20000;
+    {
+      std::ofstream out("TextDataTest-8.txt");
+      out.precision(15);
+      out << "# t e s\n";
+      for (int i = 0; i != n; ++i) {
+        const auto t = static_cast<double>(i) / n;
+        out << t << ' ' << std::sin(t) << ' ' << -std::exp(t) << '\n';
+      }
+    }
+    const auto d = TextData("TextDataTest-8.txt");
+    const auto s = d.getColumn(d.findColumn("s"));
+    TFEL_TESTS_ASSERT(s.size() == n);
+    TFEL_TESTS_ASSERT(std::abs(s[n / 2] + std::exp(0.5)) < 1e-13);
+  }  // end of test5
+};
+
+TFEL_TESTS_GENERATE_PROXY(TextDataTest, "TextDataTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("TextDataTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -11,6 +11,7 @@
  * project under specific licensing conditions.
  */
 
+#include <map>
 #include <sstream>
 #include <stdexcept>
 #include <algorithm>
@@ -22,10 +23,6 @@ namespace tfel::check {
 
   static std::vector<double> eval(const tfel::utilities::TextData& d,
                                   const std::string& f) {
-    struct Variable {
-      unsigned short p;
-      std::vector<double> values;
-    };
     auto matches = [](const std::string& vn) {
       if (vn.size() < 2) {
         return false;
@@ -57,27 +54,26 @@ namespace tfel::check {
       return value;
     };
     tfel::math::Evaluator e{f};
-    std::vector<Variable> variables;
-    unsigned short p = 0u;
+    auto columns = std::map<std::string, std::vector<double>>{};
     for (const auto& v : e.getVariablesNames()) {
       raise_if(!matches(v),
                "tfel::check::eval: undeclared "
                "variable '" +
                    v + "'");
-      variables.push_back(Variable{p, d.getColumn(convert(v))});
-      ++p;
+      columns.insert({v, d.getColumn(convert(v))});
     }
-    if (variables.empty()) {
+    if (columns.empty()) {
       return d.getColumn(convert(f));
     }
-    std::vector<double> r;
-    r.resize(variables[0].values.size());
-    for (std::vector<double>::size_type i = 0; i != r.size(); ++i) {
-      for (const auto& v : variables) {
-        e.setVariableValue(v.p, v.values[i]);
-      }
-      r[i] = e.getValue();
+    const auto n = columns.begin()->second.size();
+    auto args = std::map<std::string, const double*>{};
+    for (const auto& c : columns) {
+      raise_if(c.second.size() != n,
+               "tfel::check::eval: unmatched column sizes");
+      args.insert({c.first, c.second.data()});
     }
+    auto r = std::vector<double>(n);
+    e.getValues(r.data(), args, n);
     return r;
   }  // end of eval
 
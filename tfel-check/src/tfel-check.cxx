@@ -12,8 +12,13 @@
  */
 
 #include <map>
+#include <limits>
 #include <vector>
 #include <string>
+#include <chrono>
+#include <thread>
+#include <fstream>
+#include <sstream>
 #include <cstring>
 #include <cstdlib>
 #include <cerrno>
@@ -24,6 +29,13 @@
 #include <climits>
 #include <unistd.h>
 #include <libgen.h>
+#if !(defined _WIN32 || defined _WIN64)
+#include <utime.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif /* !(defined _WIN32 || defined _WIN64) */
 
 #include "TFEL/Raise.hxx"
 #include "TFEL/Config/GetInstallPath.hxx"
@@ -97,6 +109,236 @@ namespace tfel::check {
 #endif /* */
   }    // end of declareTFELExecutables
 
+  //! \brief name of the file storing the durations of the tests
+  static const char* const durationsFile = "tfel-check.durations";
+
+  /*!
+   * \brief read the durations of the tests recorded by previous runs
+   * \return a map associating the path to a test and its duration in
+   * seconds
+   */
+  static std::map<std::string, double> readDurations() {
+    auto durations = std::map<std::string, double>{};
+    std::ifstream in(durationsFile);
+    if (!in) {
+      return durations;
+    }
+    auto line = std::string{};
+    while (std::getline(in, line)) {
+      std::istringstream is(line);
+      auto t = double{};
+      auto path = std::string{};
+      if ((is >> t) && (std::getline(is >> std::ws, path)) && (!path.empty())) {
+        durations[path] = t;
+      }
+    }
+    return durations;
+  }  // end of readDurations
+
+  /*!
+   * \brief write the durations of the tests
+   * \param[in] durations: durations of the tests
+   */
+  static void writeDurations(const std::map<std::string, double>& durations) {
+    std::ofstream out(durationsFile);
+    if (!out) {
+      return;
+    }
+    out.precision(6);
+    for (const auto& [path, t] : durations) {
+      out << t << ' ' << path << '\n';
+    }
+  }  // end of writeDurations
+
+  /*!
+   * \brief execute a `.check` file
+   * \return true on success
+   * \param[in] configurations: configuration manager
+   * \param[in] log: global logger
+   * \param[in] d: directory
+   * \param[in] f: file name
+   * \param[in] wd: directory in which the test is executed, i.e. `d` or a
+   * copy of `d`
+   *
+   * \note the current working directory is changed to the directory `wd`
+   * and is not restored by this function.
+   */
+  static bool executeTest(const ConfigurationManager& configurations,
+                          PCLogger& log,
+                          const std::string& d,
+                          const std::string& f,
+                          const std::string& wd) {
+    using namespace tfel::system;
+    const auto path = systemCall::getAbsolutePath(d);
+    log.addMessage("entering directory '" + path + "'");
+    try {
+      systemCall::changeCurrentWorkingDirectory(wd);
+    } catch (std::exception& e) {
+      log.addMessage("can't move to directory '" + wd + "' (" +
+                     std::string(e.what()) + ")");
+      log.addSimpleTestResult("* result of test '" + d + '/' + f + "'", false);
+      return false;
+    }
+    log.addMessage("* beginning of test '" + d + '/' + f + "'");
+    auto success = true;
+    try {
+      // if(this->file_version==TestLauncher::V1){
+      // 	TestLauncherV1 c(f,log);
+      // 	success = c.execute();
+      // } else {
+      auto c = configurations.getConfiguration(d);
+      c.log = log;
+      TestLauncher t(c, f);
+      success = t.execute(c);
+      //      }
+    } catch (std::exception& e) {
+      log.addMessage("test failed : '" + f + "', reason:\n" + e.what());
+      success = false;
+    }
+    log.addSimpleTestResult("* end of test '" + d + '/' + f + "'", success);
+    log.addMessage("======");
+    return success;
+  }  // end of executeTest
+
+#if !(defined _WIN32 || defined _WIN64)
+
+  /*!
+   * \brief modification times and sizes of the files copied in the working
+   * directory of a test, indexed by their paths relative to this directory
+   */
+  using DirectorySnapshot = std::map<std::string, std::pair<time_t, off_t>>;
+
+  /*!
+   * \return the entries of a directory, except `.` and `..`
+   * \param[in] d: directory
+   */
+  static std::vector<std::string> getDirectoryEntries(const std::string& d) {
+    auto entries = std::vector<std::string>{};
+    auto* const dir = ::opendir(d.c_str());
+    if (dir == nullptr) {
+      tfel::system::systemCall::throwSystemError(
+          "getDirectoryEntries: can't open directory '" + d + "'", errno);
+    }
+    struct dirent* p;
+    while ((p = ::readdir(dir)) != nullptr) {
+      if ((std::strcmp(p->d_name, ".") != 0) &&
+          (std::strcmp(p->d_name, "..") != 0)) {
+        entries.emplace_back(p->d_name);
+      }
+    }
+    ::closedir(dir);
+    return entries;
+  }  // end of getDirectoryEntries
+
+  /*!
+   * \brief create a directory if it does not exist
+   * \param[in] d: directory
+   */
+  static void createDirectory(const std::string& d) {
+    if ((::mkdir(d.c_str(), S_IRWXU | S_IRWXG) != 0) && (errno != EEXIST)) {
+      tfel::system::systemCall::throwSystemError(
+          "createDirectory: can't create directory '" + d + "'", errno);
+    }
+  }  // end of createDirectory
+
+  /*!
+   * \brief copy a file and its modification time
+   * \param[in] src: source file
+   * \param[in] dest: destination file
+   * \param[in] infos: description of the source file
+   */
+  static void copyFile(const std::string& src,
+                       const std::string& dest,
+                       const struct stat& infos) {
+    tfel::system::systemCall::copy(src, dest);
+    // build systems (make, cmake) rely on the modification times
+    auto times = utimbuf{};
+    times.actime = infos.st_atime;
+    times.modtime = infos.st_mtime;
+    ::utime(dest.c_str(), &times);
+  }  // end of copyFile
+
+  /*!
+   * \return a new temporary directory, created in the directory given by
+   * the `TMPDIR` environment variable or in `/tmp`
+   */
+  static std::string createTemporaryDirectory() {
+    const auto* const tmp = ::getenv("TMPDIR");
+    auto d = std::string((tmp != nullptr) && (*tmp != '\0') ? tmp : "/tmp") +
+             "/tfel-check-XXXXXX";
+    if (::mkdtemp(d.data()) == nullptr) {
+      tfel::system::systemCall::throwSystemError(
+          "createTemporaryDirectory: can't create a temporary directory",
+          errno);
+    }
+    return d;
+  }  // end of createTemporaryDirectory
+
+  /*!
+   * \brief recursively copy the directory of a test in its working directory
+   * \param[out] snapshot: description of the copied files
+   * \param[in] src: directory of the test
+   * \param[in] dest: working directory of the test
+   * \param[in] r: path of the copied directory relative to `src`
+   */
+  static void copyTestDirectory(DirectorySnapshot& snapshot,
+                                const std::string& src,
+                                const std::string& dest,
+                                const std::string& r = "") {
+    const auto sd = r.empty() ? src : src + '/' + r;
+    for (const auto& e : getDirectoryEntries(sd)) {
+      const auto re = r.empty() ? e : r + '/' + e;
+      struct stat infos;
+      if (::stat((sd + '/' + e).c_str(), &infos) == -1) {
+        // dangling symbolic links are ignored
+        continue;
+      }
+      if (S_ISDIR(infos.st_mode)) {
+        createDirectory(dest + '/' + re);
+        copyTestDirectory(snapshot, src, dest, re);
+      } else if (S_ISREG(infos.st_mode)) {
+        copyFile(sd + '/' + e, dest + '/' + re, infos);
+        snapshot[re] = {infos.st_mtime, infos.st_size};
+      }
+    }
+  }  // end of copyTestDirectory
+
+  /*!
+   * \brief copy the files created or modified in the working directory of
+   * a test back to the directory of the test. The files removed by the test
+   * are kept.
+   * \param[in] snapshot: description of the files copied in the working
+   * directory before the execution of the test
+   * \param[in] src: working directory of the test
+   * \param[in] dest: directory of the test
+   * \param[in] r: path of the merged directory relative to `src`
+   */
+  static void mergeTestDirectory(const DirectorySnapshot& snapshot,
+                                 const std::string& src,
+                                 const std::string& dest,
+                                 const std::string& r = "") {
+    const auto sd = r.empty() ? src : src + '/' + r;
+    for (const auto& e : getDirectoryEntries(sd)) {
+      const auto re = r.empty() ? e : r + '/' + e;
+      struct stat infos;
+      if (::stat((sd + '/' + e).c_str(), &infos) == -1) {
+        continue;
+      }
+      if (S_ISDIR(infos.st_mode)) {
+        createDirectory(dest + '/' + re);
+        mergeTestDirectory(snapshot, src, dest, re);
+      } else if (S_ISREG(infos.st_mode)) {
+        const auto p = snapshot.find(re);
+        if ((p == snapshot.end()) ||
+            (p->second != std::make_pair(infos.st_mtime, infos.st_size))) {
+          copyFile(sd + '/' + e, dest + '/' + re, infos);
+        }
+      }
+    }
+  }  // end of mergeTestDirectory
+
+#endif /* !(defined _WIN32 || defined _WIN64) */
+
   /*!
    * \brief main entry point
    */
@@ -127,12 +369,40 @@ namespace tfel::check {
     std::string getVersionDescription() const override;
     //! \return the description of the usage of `tfel-check`
     std::string getUsageDescription() const override;
+    /*!
+     * \brief execute the given tests sequentially
+     * \return true on success
+     * \param[in] log: global logger
+     * \param[out] durations: durations of the tests
+     * \param[in] tests: list of tests, given by a directory and a file name
+     */
+    bool executeSequentially(
+        PCLogger&,
+        std::map<std::string, double>&,
+        const std::vector<std::pair<std::string, std::string>>&) const;
+#if !(defined _WIN32 || defined _WIN64)
+    /*!
+     * \brief execute the given tests in at most `jobs` child processes.
+     * Each test is executed in a temporary copy of its directory. The files
+     * created or modified by the test are then copied back in its directory.
+     * \return true on success
+     * \param[in] log: global logger
+     * \param[in,out] durations: durations of the tests
+     * \param[in] tests: list of tests, given by a directory and a file name
+     */
+    bool executeConcurrently(
+        PCLogger&,
+        std::map<std::string, double>&,
+        const std::vector<std::pair<std::string, std::string>>&) const;
+#endif /* !(defined _WIN32 || defined _WIN64) */
     //! \brief configuration manager
     ConfigurationManager configurations;
     //! list of configuration files
     std::vector<std::string> configFiles;
     //! list of input files
     std::vector<std::string> inputs;
+    //! \brief number of `.check` files executed concurrently
+    std::size_t jobs = 1;
   };  // end of struct TFELCheck
 
   bool TFELCheck::treatSubstitution() {
@@ -203,6 +473,34 @@ namespace tfel::check {
                    std::exit(EXIT_SUCCESS);
                  },
                  false));
+    declare2(
+        "--jobs", "-j",
+        CallBack(
+            "number of `.check` files executed concurrently. If no value is "
+            "given, the number of concurrent threads supported by the system "
+            "is used",
+            [this] {
+              const auto& o = this->currentArgument->getOption();
+              if (o.empty()) {
+                this->jobs = std::max(std::thread::hardware_concurrency(), 1u);
+                return;
+              }
+              const auto n = [&o] {
+                try {
+                  auto pos = std::size_t{};
+                  const auto v = std::stoi(o, &pos);
+                  if (pos == o.size()) {
+                    return v;
+                  }
+                } catch (std::exception&) {
+                }
+                return 0;
+              }();
+              tfel::raise_if(n <= 0, "TFELCheck::registerArgumentCallBacks: "
+                                     "invalid number of jobs '" + o + "'");
+              this->jobs = static_cast<std::size_t>(n);
+            },
+            true));
   }  // end of TFELCheck::registerArgumentCallBacks
 
   std::string TFELCheck::getVersionDescription() const { return VERSION; }
@@ -222,43 +520,21 @@ namespace tfel::check {
     declareTFELExecutables(this->configurations);
   }  // end of TFELCheck::TFELCheck
 
-  int TFELCheck::execute() {
-    using namespace std;
-    auto log = PCLogger(std::make_shared<PCTextDriver>("tfel-check.log"));
-    log.addDriver(std::make_shared<PCTextDriver>());
-    auto exe = [this, &log](const std::string& d, const std::string& f) {
-      using namespace tfel::system;
+  bool TFELCheck::executeSequentially(
+      PCLogger& log,
+      std::map<std::string, double>& durations,
+      const std::vector<std::pair<std::string, std::string>>& tests) const {
+    using namespace tfel::system;
+    auto status = true;
+    for (const auto& [d, f] : tests) {
       const auto cpath = systemCall::getCurrentWorkingDirectory();
-      const auto path = systemCall::getAbsolutePath(d);
-      log.addMessage("entering directory '" + path + "'");
-      try {
-        systemCall::changeCurrentWorkingDirectory(d);
-      } catch (std::exception& e) {
-        log.addMessage("can't move to directory '" + d + "' (" +
-                       std::string(e.what()) + ")");
-        log.addSimpleTestResult("* result of test '" + d + '/' + f + "'",
-                                false);
-        return false;
-      }
-      log.addMessage("* beginning of test '" + d + '/' + f + "'");
-      const auto name = d + '/' + f;
-      auto success = true;
-      try {
-        // if(this->file_version==TestLauncher::V1){
-        // 	TestLauncherV1 c(f,log);
-        // 	success = c.execute();
-        // } else {
-        auto c = this->configurations.getConfiguration(d);
-        c.log = log;
-        TestLauncher t(c, f);
-        success = t.execute(c);
-        //      }
-      } catch (std::exception& e) {
-        log.addMessage("test failed : '" + f + "', reason:\n" + e.what());
-        success = false;
+      const auto start = std::chrono::steady_clock::now();
+      if (!executeTest(this->configurations, log, d, f, d)) {
+        status = false;
       }
-      log.addSimpleTestResult("* end of test '" + d + '/' + f + "'", success);
-      log.addMessage("======");
+      const auto stop = std::chrono::steady_clock::now();
+      durations[d + '/' + f] =
+          std::chrono::duration<double>(stop - start).count();
       try {
         systemCall::changeCurrentWorkingDirectory(cpath);
       } catch (std::exception& e) {
@@ -267,17 +543,184 @@ namespace tfel::check {
         log.addMessage("Aborting");
         exit(EXIT_FAILURE);
       }
-      return success;
+    }
+    return status;
+  }  // end of TFELCheck::executeSequentially
+
+#if !(defined _WIN32 || defined _WIN64)
+
+  bool TFELCheck::executeConcurrently(
+      PCLogger& log,
+      std::map<std::string, double>& durations,
+      const std::vector<std::pair<std::string, std::string>>& tests) const {
+    using namespace tfel::system;
+    using clock = std::chrono::steady_clock;
+    //! \brief description of a test executed by a child process
+    struct Job {
+      //! \brief index of the test
+      std::size_t index;
+      //! \brief file in which the child process writes its global log
+      std::string log;
+      //! \brief working directory of the test
+      std::string directory;
+      //! \brief files copied in the working directory
+      DirectorySnapshot snapshot;
+      //! \brief start time
+      clock::time_point start;
+    };
+    const auto cpath = systemCall::getCurrentWorkingDirectory();
+    const auto sep = dirSeparator();
+    // longest tests first, tests never executed before being considered as
+    // the longest ones
+    auto duration = [&durations, &tests](const std::size_t i) {
+      const auto p = durations.find(tests[i].first + '/' + tests[i].second);
+      return p == durations.end() ? std::numeric_limits<double>::max()
+                                  : p->second;
     };
-    int status = EXIT_SUCCESS;
+    auto pending = std::vector<std::size_t>(tests.size());
+    for (std::size_t i = 0; i != tests.size(); ++i) {
+      pending[i] = i;
+    }
+    std::stable_sort(pending.begin(), pending.end(),
+                     [&duration](const std::size_t i, const std::size_t j) {
+                       return duration(i) > duration(j);
+                     });
+    auto removeWorkingDirectory = [&log](const Job& j) {
+      try {
+        systemCall::rmdir(j.directory);
+      } catch (std::exception& e) {
+        log.addMessage("can't remove directory '" + j.directory + "' (" +
+                       std::string(e.what()) + ")");
+      }
+    };
+    auto running = std::map<pid_t, Job>{};
+    auto status = true;
+    while ((!pending.empty()) || (!running.empty())) {
+      while ((running.size() < this->jobs) && (!pending.empty())) {
+        const auto i = pending.front();
+        pending.erase(pending.begin());
+        const auto& [d, f] = tests[i];
+        auto j = Job{i,
+                     cpath + sep + "tfel-check-job-" + std::to_string(i) +
+                         ".log",
+                     "", DirectorySnapshot{}, clock::time_point{}};
+        // each test is executed in a copy of its directory, so that tests
+        // sharing input or output files can be executed concurrently
+        try {
+          j.directory = createTemporaryDirectory();
+          copyTestDirectory(j.snapshot, d, j.directory);
+        } catch (std::exception& e) {
+          log.addMessage("can't create the working directory of test '" + d +
+                         '/' + f + "' (" + std::string(e.what()) + ")");
+          log.addSimpleTestResult("* end of test '" + d + '/' + f + "'",
+                                  false);
+          if (!j.directory.empty()) {
+            removeWorkingDirectory(j);
+          }
+          status = false;
+          continue;
+        }
+        j.start = clock::now();
+        // the buffered outputs would be duplicated by the child process
+        std::cout.flush();
+        const auto pid = ::fork();
+        if (pid == -1) {
+          log.addMessage("can't create a new process for test '" + d + '/' +
+                         f + "' (" + std::string(std::strerror(errno)) + ")");
+          log.addSimpleTestResult("* end of test '" + d + '/' + f + "'",
+                                  false);
+          removeWorkingDirectory(j);
+          status = false;
+          continue;
+        }
+        if (pid == 0) {
+          // child process: the tests results are written in a dedicated
+          // log file which is merged into the global log by the parent
+          auto success = false;
+          try {
+            auto clog = PCLogger(std::make_shared<PCTextDriver>(j.log));
+            success =
+                executeTest(this->configurations, clog, d, f, j.directory);
+            clog.terminate();
+          } catch (...) {
+            success = false;
+          }
+          ::_exit(success ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+        running.insert({pid, std::move(j)});
+      }
+      if (running.empty()) {
+        // no child process could be created
+        continue;
+      }
+      // waiting for a child process to finish
+      auto s = int{};
+      const auto pid = ::waitpid(-1, &s, 0);
+      if (pid == -1) {
+        tfel::raise_if(errno != EINTR,
+                       "TFELCheck::executeConcurrently: "
+                       "waiting for child processes failed (" +
+                           std::string(std::strerror(errno)) + ")");
+        continue;
+      }
+      const auto p = running.find(pid);
+      if (p == running.end()) {
+        continue;
+      }
+      const auto j = std::move(p->second);
+      running.erase(p);
+      const auto& [d, f] = tests[j.index];
+      durations[d + '/' + f] =
+          std::chrono::duration<double>(clock::now() - j.start).count();
+      {
+        std::ifstream in(j.log);
+        if (in) {
+          std::ostringstream os;
+          os << in.rdbuf();
+          auto msg = os.str();
+          while ((!msg.empty()) && (msg.back() == '\n')) {
+            msg.pop_back();
+          }
+          log.addMessage(msg);
+        }
+      }
+      systemCall::unlink(j.log);
+      // the results of the test are merged in its directory. If tests of the
+      // same directory write the same file, the file written by the last
+      // finished test is kept.
+      try {
+        mergeTestDirectory(j.snapshot, j.directory, d);
+      } catch (std::exception& e) {
+        log.addMessage("can't copy the results of test '" + d + '/' + f +
+                       "' (" + std::string(e.what()) + ")");
+        status = false;
+      }
+      removeWorkingDirectory(j);
+      const auto success = WIFEXITED(s) && (WEXITSTATUS(s) == EXIT_SUCCESS);
+      if (WIFSIGNALED(s)) {
+        log.addMessage("process executing test '" + d + '/' + f +
+                       "' killed by signal " + std::to_string(WTERMSIG(s)));
+        log.addSimpleTestResult("* end of test '" + d + '/' + f + "'", false);
+      }
+      if (!success) {
+        status = false;
+      }
+    }
+    return status;
+  }  // end of TFELCheck::executeConcurrently
+
+#endif /* !(defined _WIN32 || defined _WIN64) */
+
+  int TFELCheck::execute() {
+    auto log = PCLogger(std::make_shared<PCTextDriver>("tfel-check.log"));
+    log.addDriver(std::make_shared<PCTextDriver>());
+    auto tests = std::vector<std::pair<std::string, std::string>>{};
     if (this->inputs.empty()) {
       std::regex re(".+\\.check", std::regex_constants::extended);
       const auto& files = tfel::system::recursiveFind(re, ".", 0);
       for (const auto& d : files) {
         for (const auto& f : d.second) {
-          if (!exe(d.first, f)) {
-            status = EXIT_FAILURE;
-          }
+          tests.push_back({d.first, f});
         }
       }
     } else {
@@ -288,14 +731,21 @@ namespace tfel::check {
         const auto f = std::string(::basename(path2));
         ::free(path);
         ::free(path2);
-        // basename
-        if (!exe(d, f)) {
-          status = EXIT_FAILURE;
-        }
+        tests.push_back({d, f});
       }
     }
+    auto durations = readDurations();
+#if !(defined _WIN32 || defined _WIN64)
+    const auto success =
+        ((this->jobs > 1) && (tests.size() > 1))
+            ? this->executeConcurrently(log, durations, tests)
+            : this->executeSequentially(log, durations, tests);
+#else  /* !(defined _WIN32 || defined _WIN64) */
+    const auto success = this->executeSequentially(log, durations, tests);
+#endif /* !(defined _WIN32 || defined _WIN64) */
+    writeDurations(durations);
     log.terminate();
-    return status;
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
   }
 
   TFELCheck::~TFELCheck() = default;